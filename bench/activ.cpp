@@ -0,0 +1,70 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "activ_reference.hpp"
+#include "bench.hpp"
+#include "host_test.hpp"
+#include <miopen/activ_host.hpp>
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// Forward milliseconds over 32x64x56x56 of the scalar double reference and of the host engine.
+static void Activation()
+{
+    const std::size_t n = std::size_t(32) * 64 * 56 * 56;
+    const auto x        = Generate(n, 1, 3);
+    std::vector<float> y(n);
+    const std::vector<std::pair<miopenActivationMode_t, std::string>> modes = {
+        {miopenActivationLOGISTIC, "logistic"},
+        {miopenActivationTANH, "tanh"},
+        {miopenActivationSOFTRELU, "softrelu"},
+        {miopenActivationPOWER, "power"},
+        {miopenActivationELU, "elu"}};
+    for(auto&& m : modes)
+    {
+        const auto mode = m.first;
+        const ActivReference ref{mode};
+        // One value at a time through libm in double, as the driver references ran it
+        const double scalar = bench::Time([&] {
+            for(std::size_t i = 0; i < n; i++)
+                y[i] = static_cast<float>(ref.fwd(x[i]));
+        });
+        const auto host = [&] {
+            miopen::host::VisitActivation<float>(
+                mode, ref.alpha, ref.beta, ref.gamma, [&](auto fwd, auto) {
+                    miopen::host::ActivationForwardRun(fwd, x.data(), 1, y.data(), 1, n);
+                });
+        };
+        host();
+        std::cout << "  " << m.second << ": scalar " << 1e3 * scalar << " ms, host "
+                  << 1e3 * bench::Time(host, 5) << " ms" << std::endl;
+    }
+}
+
+static const bench::Register activation{"activation", Activation};
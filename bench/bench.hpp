@@ -0,0 +1,63 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_MIOPEN_BENCH_HPP
+#define GUARD_MIOPEN_BENCH_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+struct Benchmark
+{
+    std::string name;
+    void (*run)();
+};
+
+/// Every benchmark, in the order they registered.
+std::vector<Benchmark>& Benchmarks();
+
+/// Adds a benchmark to MIOpenBench from a namespace scope object.
+struct Register
+{
+    Register(const char* name, void (*run)()) { Benchmarks().push_back({name, run}); }
+};
+
+/// Seconds per call of f(), over the given number of calls.
+template <class F>
+double Time(F f, int iterations = 1)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < iterations; i++)
+        f();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() /
+           iterations;
+}
+
+} // namespace bench
+
+#endif
@@ -0,0 +1,73 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "bench.hpp"
+#include "host_test.hpp"
+#include <miopen/gemm_host.hpp>
+
+#include <iostream>
+#include <vector>
+
+using miopen::host::GemmIsa;
+
+static const char* IsaName(GemmIsa isa)
+{
+    switch(isa)
+    {
+    case GemmIsa::Scalar: return "scalar";
+    case GemmIsa::Avx2: return "avx2";
+    case GemmIsa::Avx512: return "avx512";
+    }
+    return "";
+}
+
+/// GFLOP/s of a 512^3 GEMM with the naive triple loop and with host::Gemm on every instruction
+/// set this host supports.
+static void Gemm()
+{
+    const std::size_t n = 512;
+    const auto A        = Generate(n * n, 1);
+    const auto B        = Generate(n * n, 2);
+    std::vector<float> C(n * n);
+    const double flops = 2.0 * n * n * n;
+
+    const double naive = bench::Time(
+        [&] { NaiveGemm(false, false, n, n, n, 1, A.data(), n, B.data(), n, 0, C.data(), n); });
+    std::cout << "  " << n << "^3: naive " << flops / naive * 1e-9 << " GFLOP/s";
+    for(auto isa : HostIsas())
+    {
+        const auto run = [&] {
+            miopen::host::Gemm(
+                isa, false, false, n, n, n, 1, A.data(), n, B.data(), n, 0, C.data(), n);
+        };
+        run();
+        const double blocked = bench::Time(run, 5);
+        std::cout << ", " << IsaName(isa) << " " << flops / blocked * 1e-9 << " GFLOP/s";
+    }
+    std::cout << std::endl;
+}
+
+static const bench::Register gemm{"gemm", Gemm};
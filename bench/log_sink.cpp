@@ -0,0 +1,80 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "bench.hpp"
+#include <miopen/log_sink.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+/// Imitates the logging done by GenericSearch.
+static void Search(int iterations)
+{
+    double best = 1e10;
+    for(int i = 0; i < iterations; i++)
+    {
+        const auto time = 1.0 + std::abs(std::sin(i * 0.1));
+        MIOPEN_LOG_I2('#' << i << '/' << 0 << '/' << iterations << ' ' << time << ", best "
+                          << best);
+        if(time < best)
+        {
+            best = time;
+            MIOPEN_LOG_I('#' << i << '/' << 0 << '/' << iterations << ' ' << time << " < "
+                             << best);
+        }
+    }
+    miopen::LogFlush();
+}
+
+/// Search iterations per second while logging to a file, with the sync and the async sink.
+static void LogSink()
+{
+    if(!miopen::IsLogging(miopen::LoggingLevel::Info2))
+    {
+        std::cout << "  Skipped: run with MIOPEN_LOG_LEVEL=6 to time the logging." << std::endl;
+        return;
+    }
+
+    const int iterations = 20000;
+    miopen::TmpDir dir{"log_sink"};
+    miopen::SetLogSink(std::unique_ptr<miopen::LogSink>{
+        new miopen::FileLogSink{(dir.path / "bench.log").string()}});
+
+    miopen::SetLogAsync(false);
+    const auto sync_time = bench::Time([&] { Search(iterations); });
+    miopen::SetLogAsync(true);
+    const auto async_time = bench::Time([&] { Search(iterations); });
+    miopen::SetLogAsync(false);
+
+    miopen::SetLogSink(std::unique_ptr<miopen::LogSink>{new miopen::StderrLogSink{}});
+    std::cout << "  Search iterations per second: sync " << iterations / sync_time << ", async "
+              << iterations / async_time << std::endl;
+}
+
+static const bench::Register log_sink{"log_sink", LogSink};
@@ -0,0 +1,79 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+/// Runs the benchmarks named on the command line, or all of them, and prints their throughput.
+///
+/// Usage: MIOpenBench [<benchmark>...]
+
+#include "bench.hpp"
+#include <miopen/parallel_for.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+std::vector<Benchmark>& Benchmarks()
+{
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+} // namespace bench
+
+int main(int argc, char* argv[])
+{
+    auto benchmarks = bench::Benchmarks();
+    std::sort(benchmarks.begin(), benchmarks.end(), [](auto&& a, auto&& b) {
+        return a.name < b.name;
+    });
+
+    const std::vector<std::string> names(argv + 1, argv + argc);
+    for(auto&& name : names)
+    {
+        if(std::none_of(benchmarks.begin(), benchmarks.end(), [&](auto&& b) {
+               return b.name == name;
+           }))
+        {
+            std::cerr << "Unknown benchmark: " << name << ". Known:";
+            for(auto&& b : benchmarks)
+                std::cerr << ' ' << b.name;
+            std::cerr << std::endl;
+            return 1;
+        }
+    }
+
+    std::cout << "Threads: " << miopen::ParallelForThreads() << std::endl;
+    for(auto&& b : benchmarks)
+    {
+        if(!names.empty() && std::find(names.begin(), names.end(), b.name) == names.end())
+            continue;
+        std::cout << b.name << ':' << std::endl;
+        b.run();
+    }
+}
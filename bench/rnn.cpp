@@ -0,0 +1,60 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "bench.hpp"
+#include "host_test.hpp"
+#include "rnn_reference.hpp"
+#include <miopen/rnn_host.hpp>
+
+#include <iostream>
+#include <vector>
+
+/// Forward milliseconds of a bidirectional LSTM and GRU over 25 steps of 32 x 256, with the
+/// per-step double reference of the driver verifiers and with the host engine.
+static void RNN()
+{
+    for(auto mode : {miopenLSTM, miopenGRU})
+    {
+        const RNNReference ref{mode, 1, 256, 256, true, true, false};
+        const std::vector<int> batches(25, 32);
+        const int rows = 25 * 32;
+        const auto w   = Generate(ref.WeightSize(), 1, 1 / 16.0f);
+        const auto x   = Generate(std::size_t(rows) * ref.in_h, 2, 1);
+        std::vector<float> y(std::size_t(rows) * 2 * ref.hidden);
+
+        const double steps = bench::Time([&] { ref.Run(w, batches, 32, x, nullptr, nullptr); });
+        const auto host    = [&] {
+            const miopen::host::RNNForward rnn{mode, 1, 256, 256, true, true, false, w.data()};
+            rnn.Run(batches, 32, x.data(), nullptr, nullptr, y.data(), nullptr, nullptr, nullptr);
+        };
+        host();
+        std::cout << "  " << (mode == miopenLSTM ? "LSTM" : "GRU") << ": per-step reference "
+                  << 1e3 * steps << " ms, host " << 1e3 * bench::Time(host, 3) << " ms"
+                  << std::endl;
+    }
+}
+
+static const bench::Register rnn{"rnn", RNN};
@@ -0,0 +1,59 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "bench.hpp"
+#include "host_test.hpp"
+#include "softmax_reference.hpp"
+#include <miopen/softmax_host.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+/// Forward milliseconds of the per-pixel double reference and of the host engine, for images
+/// and for classifier outputs.
+static void Softmax()
+{
+    for(auto&& p : std::vector<std::vector<int>>{{32, 64, 56, 56}, {256, 1000, 1, 1}})
+    {
+        const miopen::host::SoftmaxGeometry g{p[0], p[1], p[2], p[3]};
+        const auto x = Generate(std::size_t(g.n) * g.c * g.Pixels(), 1, 5);
+        auto y       = x;
+
+        // A pixel at a time over channels, as the driver reference ran it
+        const double pixels = bench::Time([&] { SoftmaxReference{g}.Forward(x); });
+        const auto host     = [&] {
+            std::copy(x.begin(), x.end(), y.begin());
+            miopen::host::SoftmaxForward(g, y.data());
+        };
+        host();
+        std::cout << "  " << g.n << "x" << g.c << "x" << g.h << "x" << g.w << ": per pixel "
+                  << 1e3 * pixels << " ms, host " << 1e3 * bench::Time(host, 5) << " ms"
+                  << std::endl;
+    }
+}
+
+static const bench::Register softmax{"softmax", Softmax};
@@ -0,0 +1,125 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "bench.hpp"
+#include "test.hpp"
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+/// The previous layout of TensorDescriptor, with its lengths and strides in std::vectors.
+struct VectorDescriptor
+{
+    VectorDescriptor() = default;
+    VectorDescriptor(const int* plens, const int* pstrides, int size)
+        : lens(plens, plens + size), strides(pstrides, pstrides + size)
+    {
+    }
+
+    std::size_t GetElementSize() const
+    {
+        return std::accumulate(
+            lens.begin(), lens.end(), std::size_t{1}, std::multiplies<std::size_t>());
+    }
+
+    std::size_t GetElementSpace() const
+    {
+        std::vector<std::size_t> maxIndices(lens.size());
+        std::transform(lens.begin(),
+                       lens.end(),
+                       std::vector<std::size_t>(lens.size(), 1).begin(),
+                       maxIndices.begin(),
+                       std::minus<std::size_t>());
+        return std::inner_product(
+                   maxIndices.begin(), maxIndices.end(), strides.begin(), std::size_t{0}) +
+               1;
+    }
+
+    std::vector<std::size_t> lens;
+    std::vector<std::size_t> strides;
+};
+
+struct InlineDescriptor : miopen::TensorDescriptor
+{
+    InlineDescriptor() = default;
+    InlineDescriptor(const int* plens, const int* pstrides, int size)
+        : miopen::TensorDescriptor(miopenFloat, plens, pstrides, size)
+    {
+    }
+};
+
+/// The descriptor traffic of the layer and time loops in rnnocl.cpp: creates the workspace,
+/// weight and input descriptors, passes them by value and queries their sizes.
+template <class Descriptor>
+static std::size_t Churn()
+{
+    const int layers     = 8;
+    const int steps      = 200;
+    const int batch      = 32;
+    const int hidden     = 512;
+    std::size_t checksum = 0;
+    for(int layer = 0; layer < layers; layer++)
+    {
+        for(int ti = 0; ti < steps; ti++)
+        {
+            const int sp_size[]   = {1, batch, hidden};
+            const int sp_stride[] = {batch * hidden * 4, hidden * 4, 1};
+            const int w_size[]    = {1, hidden * 4, hidden};
+            const int w_stride[]  = {hidden * hidden * 4, hidden, 1};
+            const int x_size[]    = {1, batch, hidden};
+            const int x_stride[]  = {batch * hidden, hidden, 1};
+            for(int gate = 0; gate < 4; gate++)
+            {
+                Descriptor sp_desc, w_desc, x_desc;
+                sp_desc = Descriptor(sp_size, sp_stride, 3);
+                w_desc  = Descriptor(w_size, w_stride, 3);
+                x_desc  = Descriptor(x_size, x_stride, 3);
+                const auto copies = std::vector<Descriptor>{sp_desc, w_desc, x_desc};
+                for(auto&& desc : copies)
+                    checksum += desc.GetElementSize() + desc.GetElementSpace();
+            }
+        }
+    }
+    return checksum;
+}
+
+/// Milliseconds of RNN-like descriptor churn with the old std::vector layout and the inline one.
+static void DescriptorChurn()
+{
+    std::size_t vector_checksum = 0;
+    std::size_t inline_checksum = 0;
+    const auto vector_time = bench::Time([&] { vector_checksum = Churn<VectorDescriptor>(); });
+    const auto inline_time = bench::Time([&] { inline_checksum = Churn<InlineDescriptor>(); });
+    EXPECT_EQUAL(vector_checksum, inline_checksum);
+    std::cout << "  std::vector " << 1e3 * vector_time << " ms, inline " << 1e3 * inline_time
+              << " ms" << std::endl;
+}
+
+static const bench::Register descriptor_churn{"descriptor_churn", DescriptorChurn};
@@ -0,0 +1,101 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "bench.hpp"
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/tensor.hpp>
+#include <miopen/tensor_ops_host.hpp>
+
+#include <iostream>
+#include <vector>
+
+/// The recursive per-element reference of test/tensor_ops.cpp (tensor_for_loop), for
+/// C = A * B + 0.5 C.
+static void ReferenceLoop(const miopen::TensorDescriptor& a,
+                          const float* A,
+                          const miopen::TensorDescriptor& b,
+                          const float* B,
+                          const miopen::TensorDescriptor& c,
+                          float* C,
+                          std::size_t ao,
+                          std::size_t bo,
+                          std::size_t co,
+                          std::size_t dim)
+{
+    const auto& lens = c.GetLengths();
+    for(std::size_t idx = 0; idx < lens[dim]; idx++)
+    {
+        const std::size_t aindex = ao + a.GetStrides()[dim] * idx;
+        const std::size_t cindex = co + c.GetStrides()[dim] * idx;
+        const std::size_t bindex =
+            b.GetLengths()[dim] == lens[dim] ? bo + b.GetStrides()[dim] * idx : bo;
+        if(dim == lens.size() - 1)
+            C[cindex] = A[aindex] * B[bindex] + 0.5f * C[cindex];
+        else
+            ReferenceLoop(a, A, b, B, c, C, aindex, bindex, cindex, dim + 1);
+    }
+}
+
+/// Milliseconds per host::OpTensor and per reference loop for a channel-wise multiply.
+static void OpTensor()
+{
+    const std::vector<std::size_t> clens = {32, 16, 20, 16, 8};
+    const std::vector<std::size_t> blens = {1, 16, 1, 1, 1};
+    const miopen::TensorDescriptor a{miopenFloat, clens};
+    const miopen::TensorDescriptor b{miopenFloat, blens};
+    const auto A = Generate(a.GetElementSpace(), 1);
+    const auto B = Generate(b.GetElementSpace(), 2);
+    auto C       = Generate(a.GetElementSpace(), 3);
+    auto R       = C;
+
+    const int iterations = 10;
+    const float one      = 1.0f;
+    const float beta     = 0.5f;
+    const auto reference = bench::Time(
+        [&] { ReferenceLoop(a, A.data(), b, B.data(), a, R.data(), 0, 0, 0, 0); }, iterations);
+    const auto host = bench::Time(
+        [&] {
+            miopen::host::OpTensor(miopenTensorOpMul,
+                                   &one,
+                                   a,
+                                   A.data(),
+                                   &one,
+                                   b,
+                                   B.data(),
+                                   &beta,
+                                   a,
+                                   C.data());
+        },
+        iterations);
+    for(std::size_t i = 0; i < C.size(); i++)
+        CHECK(Near(C[i], R[i], 1e-5));
+
+    std::cout << "  " << a.ToString() << " * " << b.ToString() << ": reference " << 1e3 * reference
+              << " ms, host " << 1e3 * host << " ms" << std::endl;
+}
+
+static const bench::Register op_tensor{"op_tensor", OpTensor};
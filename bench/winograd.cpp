@@ -0,0 +1,97 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "bench.hpp"
+#include "host_test.hpp"
+#include <miopen/gemm_host.hpp>
+#include <miopen/winograd_host.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+using miopen::host::WinogradTile;
+
+/// Direct-equivalent GFLOP/s of a padded 3x3 convolution with im2col + GEMM, as the CPU backend
+/// runs other convolutions, and with both Winograd tiles.
+static void Winograd()
+{
+    const int n = 4, c = 64, k = 64, h = 56, w = 56, pad = 1;
+    const auto in  = Generate(std::size_t(n) * c * h * w, 1);
+    const auto wei = Generate(std::size_t(k) * c * 9, 2);
+    std::vector<float> out(std::size_t(n) * k * h * w);
+    std::vector<float> col(std::size_t(c) * 9 * h * w);
+    const double flops = 2.0 * n * k * c * 9 * h * w;
+
+    const auto im2col_gemm = [&] {
+        for(int b = 0; b < n; b++)
+        {
+            std::fill(col.begin(), col.end(), 0.0f);
+            for(int ci = 0; ci < c; ci++)
+                for(int i = 0; i < 3; i++)
+                    for(int j = 0; j < 3; j++)
+                        for(int y = 0; y < h; y++)
+                            for(int x = 0; x < w; x++)
+                            {
+                                const int yy = y + i - pad;
+                                const int xx = x + j - pad;
+                                if(yy >= 0 && yy < h && xx >= 0 && xx < w)
+                                    col[((ci * 9 + i * 3 + j) * h + y) * w + x] =
+                                        in[((std::size_t(b) * c + ci) * h + yy) * w + xx];
+                            }
+            miopen::host::Gemm(false,
+                               false,
+                               k,
+                               h * w,
+                               c * 9,
+                               1.0f,
+                               wei.data(),
+                               c * 9,
+                               col.data(),
+                               h * w,
+                               0.0f,
+                               out.data() + std::size_t(b) * k * h * w,
+                               h * w);
+        }
+    };
+    im2col_gemm();
+    const double gemm = bench::Time(im2col_gemm, 3);
+    std::cout << "  3x3 " << n << "x" << c << "x" << h << "x" << w << " -> " << k
+              << ": im2col+gemm " << flops / gemm * 1e-9 << " GFLOP/s";
+
+    for(auto tile : {WinogradTile::F2x3, WinogradTile::F4x3})
+    {
+        const miopen::host::WinogradConv3x3 winograd{tile, k, c, wei.data()};
+        const auto run = [&] { winograd.Run(n, h, w, pad, pad, h, w, in.data(), out.data()); };
+        run();
+        const double t = bench::Time(run, 3);
+        std::cout << ", " << (tile == WinogradTile::F2x3 ? "F(2x2,3x3) " : "F(4x4,3x3) ")
+                  << flops / t * 1e-9 << " GFLOP/s";
+    }
+    std::cout << std::endl;
+}
+
+static const bench::Register winograd{"winograd", Winograd};
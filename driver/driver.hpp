@@ -132,7 +132,7 @@ void PadBufferSize(size_t& sz, int datatype_sz)
 {
     printf("Usage: ./driver *base_arg* *other_args*\n");
     printf("Supported Base Arguments: conv[fp16], pool[fp16], lrn[fp16], activ[fp16], "
-           "softmax[fp16], bnorm[fp16], rnn, gemm\n");
+           "softmax[fp16], bnorm[fp16], rnn, gemm, replay\n");
     exit(0);
 }
 
@@ -149,7 +149,8 @@ std::string ParseBaseArg(int argc, char* argv[])
     if(arg != "conv" && arg != "convfp16" && arg != "pool" && arg != "poolfp16" && arg != "lrn" &&
        arg != "lrnfp16" && arg != "activ" && arg != "activfp16" && arg != "softmax" &&
        arg != "softmaxfp16" && arg != "bnorm" && arg != "bnormfp16" &&
-       arg != "rnn" /*&& arg != "rnnfp16" */ && arg != "gemm" /*&& arg != "gemmfp16"*/)
+       arg != "rnn" /*&& arg != "rnnfp16" */ && arg != "gemm" /*&& arg != "gemmfp16"*/ &&
+       arg != "replay")
 
     {
         printf("Invalid Base Input Argument\n");
@@ -31,752 +31,31 @@ void RunGRUForwardGEMMCPUVerify(std::vector<T>& in,
                                 std::vector<T>& rsvspace,
                                 bool hx_is_null = false)
 {
-    int batch_n = sumvc(in_n);
-
-    int numlayer = bidirection ? hy_d / 2 : hy_d;
-    int bacc, baccbi; // accumulation of batch
-    int bi = bidirection ? 2 : 1;
-
-    int in_stride  = in_h;
-    int out_stride = out_h;
-    int wei_stride = bi * 3 * hy_h;
-    int hy_stride  = bi * 4 * hy_h;
-    int h_stride   = bi * hy_h;
-    int uni_stride = hy_h;
-    int bi_stride  = hy_h * bi;
-
-    T* hid_state = new T[numlayer * batch_n * hy_stride * 2];
-    memset(hid_state, 0, numlayer * batch_n * hy_stride * 2 * sizeof(T));
-
-    T* out_state = new T[batch_n * out_h];
-    memset(out_state, 0, batch_n * out_h * sizeof(T));
-
-    // initial input
-    T* in_state = new T[batch_n * in_h];
-    for(int h = 0; h < batch_n; h++)
+    if(inputMode == 1 && in_h != hy_h)
     {
-        for(int w = 0; w < in_h; w++)
-        {
-            in_state[h * in_stride + w] = in[h * in_stride + w];
-        }
+        printf("Verification cannot be completed: The input tensor size must equal to the "
+               "hidden state size of the network in SKIP_INPUT mode!\n");
+        return;
     }
-
-    // initial hidden states
-    T* hy_state = new T[hy_d * hy_n * hy_h];
-    memset(hy_state, 0, hy_d * hy_n * hy_h * sizeof(T));
-    T* hx_state = new T[hy_d * hy_n * hy_h];
-    for(int h = 0; h < hy_d * hy_n * hy_h; h++)
-    {
-        hx_state[h] = hx[h];
-    }
-
-    if(inputMode == 1)
-    {
-        if(in_h != hy_h)
-        {
-            printf("Verification cannot be completed: The input tensor size must equal to the "
-                   "hidden state size of the network in SKIP_INPUT mode!\n");
-            return;
-        }
-        in_h = 0;
-    }
-
-    int wei_shift_bias = (in_h + hy_h + (bi * hy_h + hy_h) * (numlayer - 1)) * wei_stride;
-    int wei_len        = wei_shift_bias;
-    if(biased)
-    {
-        int in_bias = 2;
-        wei_len += (in_bias + (numlayer - 1) * 2) * wei_stride;
-    }
-
-    // initial weights
-    T* wei_state = new T[wei_len];
-    for(int h = 0; h < wei_len; h++)
-    {
-        wei_state[h] = wei[h];
-    }
-
-    // forward emulator
-    for(int li = 0; li < numlayer; li++)
-    {
-        int hid_shift           = li * batch_n * hy_stride;
-        int hx_shift            = li * in_n[0] * h_stride;
-        int wei_shift_bias_temp = wei_shift_bias + li * 2 * wei_stride;
-
-        // from input
-        if(li == 0)
-        {
-            if(inputMode == 1)
-            {
-                for(int bs = 0; bs < batch_n; bs++)
-                {
-                    for(int h = 0; h < hy_h; h++)
-                    {
-                        for(int gi = 0; gi < 3; gi++)
-                        {
-                            hid_state[hid_shift + bs * hy_stride + gi * hy_h + h] +=
-                                in_state[bs * in_stride + h];
-                            if(bidirection)
-                            {
-                                hid_state[hid_shift + bs * hy_stride + (gi + 3) * hy_h + h] +=
-                                    in_state[bs * in_stride + h];
-                            }
-                        }
-                    }
-                }
-
-                // from bias
-                if(biased)
-                {
-                    for(int bs = 0; bs < batch_n; bs++)
-                    {
-                        for(int h = 0; h < wei_stride; h++)
-                        {
-                            hid_state[hid_shift + bs * hy_stride + h] += wei[wei_shift_bias + h];
-                        }
-                    }
-                }
-            }
-            else
-            {
-                ADNN_mm_cpu<T>(const_cast<T*>(in_state),
-                               in_h,
-                               batch_n,
-                               in_stride,
-                               0,
-                               const_cast<T*>(wei_state),
-                               in_h,
-                               hy_h * bi * 3,
-                               in_stride,
-                               ADNN_MM_TRANSPOSE,
-                               &hid_state[hid_shift],
-                               hy_h * bi * 3,
-                               batch_n,
-                               hy_stride,
-                               0,
-                               1,
-                               1);
-
-                // from bias
-                if(biased)
-                {
-                    for(int bs = 0; bs < batch_n; bs++)
-                    {
-                        for(int h = 0; h < wei_stride; h++)
-                        {
-                            hid_state[hid_shift + bs * hy_stride + h] += wei[wei_shift_bias + h];
-                        }
-                    }
-                }
-            }
-        }
-        else
-        {
-            int wei_shift = (in_h + hy_h) * wei_stride + (li - 1) * (bi * hy_h + hy_h) * wei_stride;
-            int prelayer_shift = (li - 1) * batch_n * hy_stride + bi * 3 * hy_h;
-
-            ADNN_mm_cpu<T>(const_cast<T*>(&hid_state[prelayer_shift]),
-                           hy_h * bi,
-                           batch_n,
-                           hy_stride,
-                           0,
-                           const_cast<T*>(&wei_state[wei_shift]),
-                           hy_h * bi,
-                           hy_h * bi * 3,
-                           bi_stride,
-                           ADNN_MM_TRANSPOSE,
-                           &hid_state[hid_shift],
-                           hy_h * bi * 3,
-                           batch_n,
-                           hy_stride,
-                           0,
-                           1,
-                           1);
-
-            // from bias
-            if(biased)
-            {
-                for(int bs = 0; bs < batch_n; bs++)
-                {
-                    for(int h = 0; h < wei_stride; h++)
-                    {
-                        hid_state[hid_shift + bs * hy_stride + h] += wei[wei_shift_bias_temp + h];
-                    }
-                }
-            }
-        }
-
-        // from hidden state
-        bacc   = 0;
-        baccbi = batch_n;
-        for(int ti = 0; ti < seqLength; ti++)
-        {
-            baccbi -= in_n[seqLength - 1 - ti];
-            int wei_shift = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
-            int pretime_shift;
-
-            if(ti == 0)
-            {
-                if(!hx_is_null)
-                {
-                    ADNN_mm_cpu<T>(const_cast<T*>(&hx_state[hx_shift]),
-                                   hy_h,
-                                   in_n[ti],
-                                   uni_stride,
-                                   0,
-                                   const_cast<T*>(&wei_state[wei_shift]),
-                                   hy_h,
-                                   hy_h * 2,
-                                   uni_stride,
-                                   ADNN_MM_TRANSPOSE,
-                                   &hid_state[hid_shift + bacc * hy_stride],
-                                   hy_h * 2,
-                                   in_n[ti],
-                                   hy_stride,
-                                   0,
-                                   1,
-                                   1);
-
-                    if(biased)
-                    {
-                        for(int bs = 0; bs < in_n[ti]; bs++)
-                        {
-                            for(int h = 0; h < hy_h; h++)
-                            {
-                                for(int gi = 0; gi < 2; gi++)
-                                {
-                                    hid_state[hid_shift + (bacc + bs) * hy_stride + gi * hy_h +
-                                              h] +=
-                                        wei[wei_shift_bias_temp + wei_stride + gi * hy_h + h];
-                                }
-                            }
-                        }
-                    }
-
-                    ADNN_mm_cpu<T>(const_cast<T*>(&hx_state[hx_shift]),
-                                   hy_h,
-                                   in_n[ti],
-                                   uni_stride,
-                                   0,
-                                   const_cast<T*>(&wei_state[wei_shift + 2 * hy_h * uni_stride]),
-                                   hy_h,
-                                   hy_h,
-                                   uni_stride,
-                                   ADNN_MM_TRANSPOSE,
-                                   &hid_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
-                                   hy_h,
-                                   in_n[ti],
-                                   hy_stride,
-                                   0,
-                                   1,
-                                   1);
-
-                    if(biased)
-                    {
-                        for(int bs = 0; bs < in_n[ti]; bs++)
-                        {
-                            for(int h = 0; h < hy_h; h++)
-                            {
-                                hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h +
-                                          h] +=
-                                    wei[wei_shift_bias_temp + wei_stride + 2 * hy_h + h];
-                            }
-                        }
-                    }
-
-                    if(bidirection)
-                    {
-                        ADNN_mm_cpu<T>(
-                            const_cast<T*>(&hx_state[hx_shift + hy_n * hy_h]),
-                            hy_h,
-                            in_n[seqLength - 1 - ti],
-                            uni_stride,
-                            0,
-                            const_cast<T*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h * 2,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + baccbi * hy_stride + 3 * hy_h],
-                            hy_h * 2,
-                            in_n[seqLength - 1 - ti],
-                            hy_stride,
-                            0,
-                            1,
-                            1);
-
-                        if(biased)
-                        {
-                            for(int bs = 0; bs < in_n[seqLength - 1 - ti]; bs++)
-                            {
-                                for(int h = 0; h < hy_h; h++)
-                                {
-                                    for(int gi = 0; gi < 2; gi++)
-                                    {
-                                        hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                  (3 + gi) * hy_h + h] +=
-                                            wei[wei_shift_bias_temp + wei_stride + (3 + gi) * hy_h +
-                                                h];
-                                    }
-                                }
-                            }
-                        }
-
-                        ADNN_mm_cpu<T>(
-                            const_cast<T*>(&hx_state[hx_shift + hy_n * hy_h]),
-                            hy_h,
-                            in_n[seqLength - 1 - ti],
-                            uni_stride,
-                            0,
-                            const_cast<T*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
-                            hy_h,
-                            in_n[seqLength - 1 - ti],
-                            hy_stride,
-                            0,
-                            1,
-                            1);
-
-                        if(biased)
-                        {
-                            for(int bs = 0; bs < in_n[seqLength - 1 - ti]; bs++)
-                            {
-                                for(int h = 0; h < hy_h; h++)
-                                {
-                                    hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                              bi * 3 * hy_h + hy_h + h] +=
-                                        wei[wei_shift_bias_temp + wei_stride + 5 * hy_h + h];
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            else
-            {
-                ADNN_mm_cpu<T>(const_cast<T*>(&hy_state[hx_shift]),
-                               hy_h,
-                               in_n[ti],
-                               uni_stride,
-                               0,
-                               const_cast<T*>(&wei_state[wei_shift]),
-                               hy_h,
-                               hy_h * 2,
-                               uni_stride,
-                               ADNN_MM_TRANSPOSE,
-                               &hid_state[hid_shift + bacc * hy_stride],
-                               hy_h * 2,
-                               in_n[ti],
-                               hy_stride,
-                               0,
-                               1,
-                               1);
-
-                if(biased)
-                {
-                    for(int bs = 0; bs < in_n[ti]; bs++)
-                    {
-                        for(int h = 0; h < hy_h; h++)
-                        {
-                            for(int gi = 0; gi < 2; gi++)
-                            {
-                                hid_state[hid_shift + (bacc + bs) * hy_stride + gi * hy_h + h] +=
-                                    wei[wei_shift_bias_temp + wei_stride + gi * hy_h + h];
-                            }
-                        }
-                    }
-                }
-
-                ADNN_mm_cpu<T>(const_cast<T*>(&hy_state[hx_shift]),
-                               hy_h,
-                               in_n[ti],
-                               uni_stride,
-                               0,
-                               const_cast<T*>(&wei_state[wei_shift + 2 * hy_h * uni_stride]),
-                               hy_h,
-                               hy_h,
-                               uni_stride,
-                               ADNN_MM_TRANSPOSE,
-                               &hid_state[hid_shift + bacc * hy_stride + bi * 3 * hy_h],
-                               hy_h,
-                               in_n[ti],
-                               hy_stride,
-                               0,
-                               1,
-                               1);
-
-                if(biased)
-                {
-                    for(int bs = 0; bs < in_n[ti]; bs++)
-                    {
-                        for(int h = 0; h < hy_h; h++)
-                        {
-                            hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h] +=
-                                wei[wei_shift_bias_temp + wei_stride + 2 * hy_h + h];
-                        }
-                    }
-                }
-
-                if(bidirection)
-                {
-
-                    if(!hx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
-                    {
-                        ADNN_mm_cpu<T>(
-                            const_cast<T*>(
-                                &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h]),
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            const_cast<T*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h * 2,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       3 * hy_h],
-                            hy_h * 2,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
-
-                        if(biased)
-                        {
-                            for(int bs = in_n.at(seqLength - ti); bs < in_n.at(seqLength - 1 - ti);
-                                bs++)
-                            {
-                                for(int h = 0; h < hy_h; h++)
-                                {
-                                    for(int gi = 0; gi < 2; gi++)
-                                    {
-                                        hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                  (3 + gi) * hy_h + h] +=
-                                            wei[wei_shift_bias_temp + wei_stride + (3 + gi) * hy_h +
-                                                h];
-                                    }
-                                }
-                            }
-                        }
-
-                        ADNN_mm_cpu<T>(
-                            const_cast<T*>(
-                                &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h]),
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            const_cast<T*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
-                            hy_h,
-                            hy_h,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       bi * 3 * hy_h + hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
-
-                        if(biased)
-                        {
-                            for(int bs = in_n.at(seqLength - ti); bs < in_n.at(seqLength - 1 - ti);
-                                bs++)
-                            {
-                                for(int h = 0; h < hy_h; h++)
-                                {
-                                    hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                              bi * 3 * hy_h + hy_h + h] +=
-                                        wei[wei_shift_bias_temp + wei_stride + 5 * hy_h + h];
-                                }
-                            }
-                        }
-                    }
-
-                    ADNN_mm_cpu<T>(const_cast<T*>(&hy_state[hx_shift + hy_n * hy_h]),
-                                   hy_h,
-                                   in_n[seqLength - ti],
-                                   uni_stride,
-                                   0,
-                                   const_cast<T*>(&wei_state[wei_shift + 3 * hy_h * uni_stride]),
-                                   hy_h,
-                                   hy_h * 2,
-                                   uni_stride,
-                                   ADNN_MM_TRANSPOSE,
-                                   &hid_state[hid_shift + baccbi * hy_stride + 3 * hy_h],
-                                   hy_h * 2,
-                                   in_n[seqLength - ti],
-                                   hy_stride,
-                                   0,
-                                   1,
-                                   1);
-
-                    if(biased)
-                    {
-                        for(int bs = 0; bs < in_n[seqLength - ti]; bs++)
-                        {
-                            for(int h = 0; h < hy_h; h++)
-                            {
-                                for(int gi = 0; gi < 2; gi++)
-                                {
-                                    hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                              (3 + gi) * hy_h + h] +=
-                                        wei[wei_shift_bias_temp + wei_stride + (3 + gi) * hy_h + h];
-                                }
-                            }
-                        }
-                    }
-
-                    ADNN_mm_cpu<T>(
-                        const_cast<T*>(&hy_state[hx_shift + hy_n * hy_h]),
-                        hy_h,
-                        in_n[seqLength - ti],
-                        uni_stride,
-                        0,
-                        const_cast<T*>(&wei_state[wei_shift + 5 * hy_h * uni_stride]),
-                        hy_h,
-                        hy_h,
-                        uni_stride,
-                        ADNN_MM_TRANSPOSE,
-                        &hid_state[hid_shift + baccbi * hy_stride + bi * 3 * hy_h + hy_h],
-                        hy_h,
-                        in_n[seqLength - ti],
-                        hy_stride,
-                        0,
-                        1,
-                        1);
-
-                    if(biased)
-                    {
-                        for(int bs = 0; bs < in_n[seqLength - ti]; bs++)
-                        {
-                            for(int h = 0; h < hy_h; h++)
-                            {
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h +
-                                          hy_h + h] +=
-                                    wei[wei_shift_bias_temp + wei_stride + 5 * hy_h + h];
-                            }
-                        }
-                    }
-                }
-            }
-
-            for(int bs = 0; bs < in_n[ti]; bs++)
-            {
-                for(int h = 0; h < hy_h; h++)
-                {
-                    hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h +
-                              numlayer * batch_n * hy_stride] =
-                        hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h];
-
-                    hid_state[hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h] +=
-                        activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + hy_h + h], 2) *
-                        hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h];
-                    hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h] = 0;
-
-                    if(ti == 0)
-                    {
-                        if(!hx_is_null)
-                        {
-                            hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h] +=
-                                ((1 - activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + h],
-                                                2)) *
-                                     activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride +
-                                                         2 * hy_h + h],
-                                               1) +
-                                 activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + h], 2) *
-                                     hx[hx_shift + bs * uni_stride + h]);
-                        }
-                        else
-                        {
-                            hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h] +=
-                                ((1 - activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + h],
-                                                2)) *
-                                 activfunc(
-                                     hid_state[hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h],
-                                     1));
-                        }
-                    }
-                    else
-                    {
-
-                        pretime_shift = li * batch_n * hy_stride +
-                                        (bacc - in_n[ti - 1]) * hy_stride + bi * 3 * hy_h;
-
-                        hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h] +=
-                            ((1 -
-                              activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + h], 2)) *
-                                 activfunc(
-                                     hid_state[hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h],
-                                     1) +
-                             activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + h], 2) *
-                                 hid_state[pretime_shift + bs * hy_stride + h]);
-                    }
-
-                    hid_state[hid_shift + (bacc + bs) * hy_stride + h +
-                              numlayer * batch_n * hy_stride] =
-                        activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + h], 2);
-                    hid_state[hid_shift + (bacc + bs) * hy_stride + hy_h + h +
-                              numlayer * batch_n * hy_stride] =
-                        activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + hy_h + h], 2);
-                    hid_state[hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h +
-                              numlayer * batch_n * hy_stride] =
-                        activfunc(hid_state[hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h], 1);
-
-                    hy_state[hx_shift + bs * uni_stride + h] =
-                        hid_state[hid_shift + (bacc + bs) * hy_stride + bi * 3 * hy_h + h];
-                }
-            }
-
-            if(bidirection)
-            {
-                pretime_shift = li * batch_n * hy_stride +
-                                (baccbi + in_n[seqLength - 1 - ti]) * hy_stride + bi * 3 * hy_h +
-                                hy_h;
-
-                for(int bs = 0; bs < in_n[seqLength - 1 - ti]; bs++)
-                {
-                    for(int h = 0; h < hy_h; h++)
-                    {
-                        hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h + hy_h + h +
-                                  numlayer * batch_n * hy_stride] =
-                            hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h + hy_h +
-                                      h];
-
-                        hid_state[hid_shift + (baccbi + bs) * hy_stride + 5 * hy_h + h] +=
-                            activfunc(
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + 4 * hy_h + h],
-                                2) *
-                            hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h + hy_h +
-                                      h];
-                        hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h + hy_h +
-                                  h] = 0;
-
-                        if(ti == 0)
-                        {
-                            if(!hx_is_null)
-                            {
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h +
-                                          hy_h + h] +=
-                                    ((1 -
-                                      activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                          3 * hy_h + h],
-                                                2)) *
-                                         activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                             5 * hy_h + h],
-                                                   1) +
-                                     activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                         3 * hy_h + h],
-                                               2) *
-                                         hx[hx_shift + bs * uni_stride + hy_n * hy_h + h]);
-                            }
-                            else
-                            {
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h +
-                                          hy_h + h] +=
-                                    ((1 -
-                                      activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                          3 * hy_h + h],
-                                                2)) *
-                                     activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                         5 * hy_h + h],
-                                               1));
-                            }
-                        }
-                        else
-                        {
-                            if(!hx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
-                            {
-                                if(bs >= in_n.at(seqLength - ti))
-                                {
-                                    hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                              bi * 3 * hy_h + hy_h + h] +=
-                                        (activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                             3 * hy_h + h],
-                                                   2) *
-                                         hx[hx_shift + bs * uni_stride + hy_n * hy_h + h]);
-                                }
-                            }
-
-                            hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h + hy_h +
-                                      h] +=
-                                ((1 - activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                          3 * hy_h + h],
-                                                2)) *
-                                 activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                     5 * hy_h + h],
-                                           1));
-
-                            if(bs < in_n[seqLength - ti])
-                            {
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h +
-                                          hy_h + h] +=
-                                    (activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                         3 * hy_h + h],
-                                               2) *
-                                     hid_state[pretime_shift + bs * hy_stride + h]);
-                            }
-                        }
-
-                        hid_state[hid_shift + (baccbi + bs) * hy_stride + 3 * hy_h + h +
-                                  numlayer * batch_n * hy_stride] =
-                            activfunc(
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + 3 * hy_h + h], 2);
-                        hid_state[hid_shift + (baccbi + bs) * hy_stride + 4 * hy_h + h +
-                                  numlayer * batch_n * hy_stride] =
-                            activfunc(
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + 4 * hy_h + h], 2);
-                        hid_state[hid_shift + (baccbi + bs) * hy_stride + 5 * hy_h + h +
-                                  numlayer * batch_n * hy_stride] =
-                            activfunc(
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + 5 * hy_h + h], 1);
-
-                        hy_state[hx_shift + bs * uni_stride + hy_n * hy_h + h] =
-                            hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 3 * hy_h + hy_h +
-                                      h];
-                    }
-                }
-            }
-
-            bacc += in_n[ti];
-        }
-    }
-
-    // output
-    int prelayer_shift = (numlayer - 1) * batch_n * hy_stride + bi * 3 * hy_h;
-
-    for(int i = 0; i < numlayer * batch_n * hy_stride * 2; i++)
-    {
-        rsvspace[i] = hid_state[i];
-    }
-
-    for(int i = 0; i < hy_d * hy_n * hy_h; i++)
-    {
-        hy_host[i] = hy_state[i];
-    }
-
-    for(int bs = 0; bs < batch_n; bs++)
-    {
-        for(int h = 0; h < out_h; h++)
-        {
-            out_host[bs * out_stride + h] = hid_state[prelayer_shift + bs * hy_stride + h];
-        }
-    }
-
-    delete[] hid_state;
-    delete[] out_state;
-    delete[] in_state;
-    delete[] hx_state;
-    delete[] hy_state;
-    delete[] wei_state;
+    (void)out_h;
+    RunRNNForwardHost(miopenGRU,
+                      in,
+                      wei,
+                      hy_host,
+                      hx_is_null ? nullptr : hx.data(),
+                      nullptr,
+                      nullptr,
+                      out_host,
+                      in_n,
+                      in_h,
+                      seqLength,
+                      bidirection,
+                      biased,
+                      hy_d,
+                      hy_n,
+                      hy_h,
+                      inputMode,
+                      rsvspace);
 }
 
 template <typename T>
@@ -35,576 +35,31 @@ void RunLSTMForwardGEMMCPUVerify(
     bool hx_is_null = false,
     bool cx_is_null = false)
 {
-    int batch_n = sumvc(in_n);
-
-    int numlayer = bidirection ? hy_d / 2 : hy_d;
-    int bacc, baccbi; // accumulation of batch
-    int bi = bidirection ? 2 : 1;
-
-    int in_stride  = in_h;
-    int out_stride = out_h;
-    int wei_stride = bi * 4 * hy_h;
-    int hy_stride  = bi * 6 * hy_h;
-    int h_stride   = bi * hy_h;
-    int uni_stride = hy_h;
-    int bi_stride  = hy_h * bi;
-
-    std::vector<T> hid_state(numlayer * batch_n * hy_stride * 2, 0.);
-    std::vector<T> out_state(batch_n * out_h, 0.);
-
-    // initial input
-    std::vector<T> in_state(batch_n * in_h, 0.);
-    for(int h = 0; h < batch_n; h++)
-    {
-        for(int w = 0; w < in_h; w++)
-        {
-            in_state.at(h * in_stride + w) = in.at(h * in_stride + w);
-        }
-    }
-
-    // initial hidden states
-    std::vector<T> hy_state(hy_d * hy_n * hy_h, 0.);
-    std::vector<T> hx_state(hy_d * hy_n * hy_h, 0.);
-    for(int h = 0; h < hy_d * hy_n * hy_h; h++)
-    {
-        hx_state.at(h) = hx.at(h);
-    }
-    std::vector<T> cy_state(hy_d * hy_n * hy_h, 0.);
-    std::vector<T> cx_state(hy_d * hy_n * hy_h, 0.);
-    for(int h = 0; h < hy_d * hy_n * hy_h; h++)
-    {
-        cx_state.at(h) = cx.at(h);
-    }
-
-    if(inputMode == 1)
-    {
-        if(in_h != hy_h)
-        {
-            printf("Verification cannot be completed: The input tensor size must equal to the "
-                   "hidden state size of the network in SKIP_INPUT mode!\n");
-            return;
-        }
-        in_h = 0;
-    }
-
-    int wei_shift_bias = (in_h + hy_h + (bi * hy_h + hy_h) * (numlayer - 1)) * wei_stride;
-    int wei_len        = wei_shift_bias;
-    if(biased)
-    {
-        int in_bias = 2;
-        wei_len += (in_bias + (numlayer - 1) * 2) * wei_stride;
-    }
-
-    // initial weights
-    std::vector<T> wei_state(wei_len, 0.);
-    ;
-    for(int h = 0; h < wei_len; h++)
-    {
-        wei_state.at(h) = wei.at(h);
-    }
-
-    // forward emulator
-    for(int li = 0; li < numlayer; li++)
-    {
-        int hid_shift = li * batch_n * hy_stride;
-        int hx_shift  = li * in_n.at(0) * h_stride;
-
-        // from input
-        if(li == 0)
-        {
-            if(inputMode == 1)
-            {
-                for(int bs = 0; bs < batch_n; bs++)
-                {
-                    for(int h = 0; h < hy_h; h++)
-                    {
-                        for(int gi = 0; gi < 4; gi++)
-                        {
-                            hid_state.at(hid_shift + bs * hy_stride + gi * hy_h + h) +=
-                                in_state.at(bs * in_stride + h);
-                            if(bidirection)
-                            {
-                                hid_state.at(hid_shift + bs * hy_stride + (gi + 4) * hy_h + h) +=
-                                    in_state.at(bs * in_stride + h);
-                            }
-                        }
-                    }
-                }
-
-                // from bias
-                if(biased)
-                {
-                    for(int bs = 0; bs < batch_n; bs++)
-                    {
-                        for(int h = 0; h < wei_stride; h++)
-                        {
-                            hid_state.at(hid_shift + bs * hy_stride + h) +=
-                                wei.at(wei_shift_bias + h);
-                        }
-                    }
-                }
-            }
-            else
-            {
-                ADNN_mm_cpu<T>(in_state.data(),
-                               in_h,
-                               batch_n,
-                               in_stride,
-                               0,
-                               wei_state.data(),
-                               in_h,
-                               hy_h * bi * 4,
-                               in_stride,
-                               ADNN_MM_TRANSPOSE,
-                               &hid_state[hid_shift],
-                               hy_h * bi * 4,
-                               batch_n,
-                               hy_stride,
-                               0,
-                               1,
-                               1);
-
-                // from bias
-                if(biased)
-                {
-                    for(int bs = 0; bs < batch_n; bs++)
-                    {
-                        for(int h = 0; h < wei_stride; h++)
-                        {
-                            hid_state.at(hid_shift + bs * hy_stride + h) +=
-                                wei.at(wei_shift_bias + h);
-                        }
-                    }
-                }
-            }
-        }
-        else
-        {
-            int wei_shift = (in_h + hy_h) * wei_stride + (li - 1) * (bi * hy_h + hy_h) * wei_stride;
-            int prelayer_shift = (li - 1) * batch_n * hy_stride + bi * 5 * hy_h;
-
-            ADNN_mm_cpu<T>(&hid_state[prelayer_shift],
-                           hy_h * bi,
-                           batch_n,
-                           hy_stride,
-                           0,
-                           &wei_state[wei_shift],
-                           hy_h * bi,
-                           hy_h * bi * 4,
-                           bi_stride,
-                           ADNN_MM_TRANSPOSE,
-                           &hid_state[hid_shift],
-                           hy_h * bi * 4,
-                           batch_n,
-                           hy_stride,
-                           0,
-                           1,
-                           1);
-
-            // from bias
-            if(biased)
-            {
-                int wei_shift_bias_temp = wei_shift_bias + li * 2 * wei_stride;
-
-                for(int bs = 0; bs < batch_n; bs++)
-                {
-                    for(int h = 0; h < wei_stride; h++)
-                    {
-                        hid_state.at(hid_shift + bs * hy_stride + h) +=
-                            wei.at(wei_shift_bias_temp + h);
-                    }
-                }
-            }
-        }
-
-        // from hidden state
-        bacc   = 0;
-        baccbi = batch_n;
-        for(int ti = 0; ti < seqLength; ti++)
-        {
-            baccbi -= in_n.at(seqLength - 1 - ti);
-            int wei_shift = in_h * wei_stride + li * (bi * hy_h + hy_h) * wei_stride;
-
-            if(ti == 0)
-            {
-                if(!hx_is_null)
-                {
-                    ADNN_mm_cpu<T>(&hx_state[hx_shift],
-                                   hy_h,
-                                   in_n.at(ti),
-                                   uni_stride,
-                                   0,
-                                   &wei_state[wei_shift],
-                                   hy_h,
-                                   hy_h * 4,
-                                   uni_stride,
-                                   ADNN_MM_TRANSPOSE,
-                                   &hid_state[hid_shift + bacc * hy_stride],
-                                   hy_h * 4,
-                                   in_n.at(ti),
-                                   hy_stride,
-                                   0,
-                                   1,
-                                   1);
-
-                    // from bias
-                    if(biased)
-                    {
-                        int wei_shift_bias_temp = wei_shift_bias + (li * 2 + 1) * wei_stride;
-
-                        for(int bs = 0; bs < in_n[ti]; bs++)
-                        {
-                            for(int h = 0; h < 4 * hy_h; h++)
-                            {
-                                hid_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h) +=
-                                    wei.at(wei_shift_bias_temp + h);
-                            }
-                        }
-                    }
-
-                    if(bidirection)
-                    {
-                        ADNN_mm_cpu<T>(&hx_state[hx_shift + hy_n * hy_h],
-                                       hy_h,
-                                       in_n.at(seqLength - 1 - ti),
-                                       uni_stride,
-                                       0,
-                                       &wei_state[wei_shift + 4 * hy_h * uni_stride],
-                                       hy_h,
-                                       hy_h * 4,
-                                       uni_stride,
-                                       ADNN_MM_TRANSPOSE,
-                                       &hid_state[hid_shift + baccbi * hy_stride + 4 * hy_h],
-                                       hy_h * 4,
-                                       in_n.at(seqLength - 1 - ti),
-                                       hy_stride,
-                                       0,
-                                       1,
-                                       1);
-
-                        // from bias
-                        if(biased)
-                        {
-                            int wei_shift_bias_temp = wei_shift_bias + (li * 2 + 1) * wei_stride;
-
-                            for(int bs = 0; bs < in_n.at(seqLength - 1 - ti); bs++)
-                            {
-                                for(int h = 0; h < 4 * hy_h; h++)
-                                {
-                                    hid_state.at(hid_shift + baccbi * hy_stride + 4 * hy_h +
-                                                 bs * hy_stride + h) +=
-                                        wei.at(wei_shift_bias_temp + 4 * hy_h + h);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            else
-            {
-                ADNN_mm_cpu<T>(&hy_state[hx_shift],
-                               hy_h,
-                               in_n.at(ti),
-                               uni_stride,
-                               0,
-                               &wei_state[wei_shift],
-                               hy_h,
-                               hy_h * 4,
-                               uni_stride,
-                               ADNN_MM_TRANSPOSE,
-                               &hid_state[hid_shift + bacc * hy_stride],
-                               hy_h * 4,
-                               in_n.at(ti),
-                               hy_stride,
-                               0,
-                               1,
-                               1);
-
-                // from bias
-                if(biased)
-                {
-                    int wei_shift_bias_temp = wei_shift_bias + (li * 2 + 1) * wei_stride;
-
-                    for(int bs = 0; bs < in_n[ti]; bs++)
-                    {
-                        for(int h = 0; h < 4 * hy_h; h++)
-                        {
-                            hid_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h) +=
-                                wei.at(wei_shift_bias_temp + h);
-                        }
-                    }
-                }
-
-                if(bidirection)
-                {
-
-                    if(!hx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
-                    {
-                        ADNN_mm_cpu<T>(
-                            &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            &wei_state[wei_shift + 4 * hy_h * uni_stride],
-                            hy_h,
-                            hy_h * 4,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       4 * hy_h],
-                            hy_h * 4,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
-
-                        // from bias
-                        if(biased)
-                        {
-                            int wei_shift_bias_temp = wei_shift_bias + (li * 2 + 1) * wei_stride;
-
-                            for(int bs = in_n.at(seqLength - ti); bs < in_n.at(seqLength - 1 - ti);
-                                bs++)
-                            {
-                                for(int h = 0; h < 4 * hy_h; h++)
-                                {
-                                    hid_state.at(hid_shift + baccbi * hy_stride + 4 * hy_h +
-                                                 bs * hy_stride + h) +=
-                                        wei.at(wei_shift_bias_temp + 4 * hy_h + h);
-                                }
-                            }
-                        }
-                    }
-
-                    ADNN_mm_cpu<T>(&hy_state[hx_shift + hy_n * hy_h],
-                                   hy_h,
-                                   in_n.at(seqLength - ti),
-                                   uni_stride,
-                                   0,
-                                   &wei_state[wei_shift + 4 * hy_h * uni_stride],
-                                   hy_h,
-                                   hy_h * 4,
-                                   uni_stride,
-                                   ADNN_MM_TRANSPOSE,
-                                   &hid_state[hid_shift + baccbi * hy_stride + 4 * hy_h],
-                                   hy_h * 4,
-                                   in_n.at(seqLength - ti),
-                                   hy_stride,
-                                   0,
-                                   1,
-                                   1);
-
-                    // from bias
-                    if(biased)
-                    {
-                        int wei_shift_bias_temp = wei_shift_bias + (li * 2 + 1) * wei_stride;
-
-                        for(int bs = 0; bs < in_n.at(seqLength - ti); bs++)
-                        {
-                            for(int h = 0; h < 4 * hy_h; h++)
-                            {
-                                hid_state.at(hid_shift + baccbi * hy_stride + 4 * hy_h +
-                                             bs * hy_stride + h) +=
-                                    wei.at(wei_shift_bias_temp + 4 * hy_h + h);
-                            }
-                        }
-                    }
-                }
-            }
-
-            for(int bs = 0; bs < in_n.at(ti); bs++)
-            {
-                for(int h = 0; h < hy_h; h++)
-                {
-                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 4 * hy_h + h) +=
-                        activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + h), 2) *
-                        activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + 3 * hy_h + h),
-                                  1);
-                    if(ti == 0)
-                    {
-                        if(!cx_is_null)
-                        {
-                            hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 4 * hy_h + h) +=
-                                activfunc(
-                                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + hy_h + h),
-                                    2) *
-                                cx_state.at(hx_shift + bs * uni_stride + h);
-                        }
-                    }
-                    else
-                    {
-                        int prec_shift = li * batch_n * hy_stride +
-                                         (bacc - in_n.at(ti - 1)) * hy_stride + bi * 4 * hy_h;
-
-                        hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 4 * hy_h + h) +=
-                            activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + hy_h + h),
-                                      2) *
-                            hid_state.at(prec_shift + bs * hy_stride + h);
-                    }
-
-                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 5 * hy_h + h) +=
-                        activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h),
-                                  2) *
-                        activfunc(
-                            hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 4 * hy_h + h),
-                            1);
-
-                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + h +
-                                 numlayer * batch_n * hy_stride) =
-                        activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + h), 2);
-                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + hy_h + h +
-                                 numlayer * batch_n * hy_stride) =
-                        activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + hy_h + h), 2);
-                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h +
-                                 numlayer * batch_n * hy_stride) =
-                        activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + 2 * hy_h + h),
-                                  2);
-                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + 3 * hy_h + h +
-                                 numlayer * batch_n * hy_stride) =
-                        activfunc(hid_state.at(hid_shift + (bacc + bs) * hy_stride + 3 * hy_h + h),
-                                  1);
-                    hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 4 * hy_h + h +
-                                 numlayer * batch_n * hy_stride) =
-                        activfunc(
-                            hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 4 * hy_h + h),
-                            1);
-
-                    cy_state.at(hx_shift + bs * uni_stride + h) =
-                        hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 4 * hy_h + h);
-                    hy_state.at(hx_shift + bs * uni_stride + h) =
-                        hid_state.at(hid_shift + (bacc + bs) * hy_stride + bi * 5 * hy_h + h);
-                }
-            }
-
-            if(bidirection)
-            {
-                for(int bs = 0; bs < in_n.at(seqLength - 1 - ti); bs++)
-                {
-                    for(int h = 0; h < hy_h; h++)
-                    {
-                        hid_state.at(hid_shift + (baccbi + bs) * hy_stride + bi * 4 * hy_h + hy_h +
-                                     h) +=
-                            activfunc(
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 4 * hy_h + h),
-                                2) *
-                            activfunc(
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 7 * hy_h + h),
-                                1);
-                        if(ti == 0)
-                        {
-                            if(!cx_is_null)
-                            {
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + bi * 4 * hy_h +
-                                             hy_h + h) +=
-                                    activfunc(hid_state.at(hid_shift + (baccbi + bs) * hy_stride +
-                                                           5 * hy_h + h),
-                                              2) *
-                                    cx_state.at(hx_shift + bs * uni_stride + hy_n * hy_h + h);
-                            }
-                        }
-                        else
-                        {
-
-                            if(!cx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
-                            {
-                                if(bs >= in_n.at(seqLength - ti))
-                                {
-                                    hid_state.at(hid_shift + (baccbi + bs) * hy_stride +
-                                                 bi * 4 * hy_h + hy_h + h) +=
-                                        activfunc(hid_state.at(hid_shift +
-                                                               (baccbi + bs) * hy_stride +
-                                                               5 * hy_h + h),
-                                                  2) *
-                                        cx_state.at(hx_shift + bs * uni_stride + hy_n * hy_h + h);
-                                }
-                            }
-
-                            if(bs < in_n.at(seqLength - ti))
-                            {
-                                int prec_shift =
-                                    li * batch_n * hy_stride +
-                                    (baccbi + in_n.at(seqLength - 1 - ti)) * hy_stride +
-                                    bi * 4 * hy_h + hy_h;
-
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + bi * 4 * hy_h +
-                                             hy_h + h) +=
-                                    activfunc(hid_state.at(hid_shift + (baccbi + bs) * hy_stride +
-                                                           5 * hy_h + h),
-                                              2) *
-                                    hid_state.at(prec_shift + bs * hy_stride + h);
-                            }
-                        }
-
-                        hid_state[hid_shift + (baccbi + bs) * hy_stride + bi * 5 * hy_h + hy_h +
-                                  h] +=
-                            activfunc(
-                                hid_state[hid_shift + (baccbi + bs) * hy_stride + 6 * hy_h + h],
-                                2) *
-                            activfunc(hid_state[hid_shift + (baccbi + bs) * hy_stride +
-                                                bi * 4 * hy_h + hy_h + h],
-                                      1);
-
-                        hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 4 * hy_h + h +
-                                     numlayer * batch_n * hy_stride) =
-                            activfunc(
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 4 * hy_h + h),
-                                2);
-                        hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 5 * hy_h + h +
-                                     numlayer * batch_n * hy_stride) =
-                            activfunc(
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 5 * hy_h + h),
-                                2);
-                        hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 6 * hy_h + h +
-                                     numlayer * batch_n * hy_stride) =
-                            activfunc(
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 6 * hy_h + h),
-                                2);
-                        hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 7 * hy_h + h +
-                                     numlayer * batch_n * hy_stride) =
-                            activfunc(
-                                hid_state.at(hid_shift + (baccbi + bs) * hy_stride + 7 * hy_h + h),
-                                1);
-                        hid_state.at(hid_shift + (baccbi + bs) * hy_stride + bi * 4 * hy_h + hy_h +
-                                     h + numlayer * batch_n * hy_stride) =
-                            activfunc(hid_state.at(hid_shift + (baccbi + bs) * hy_stride +
-                                                   bi * 4 * hy_h + hy_h + h),
-                                      1);
-
-                        cy_state.at(hx_shift + bs * uni_stride + hy_n * hy_h + h) = hid_state.at(
-                            hid_shift + (baccbi + bs) * hy_stride + bi * 4 * hy_h + hy_h + h);
-                        hy_state.at(hx_shift + bs * uni_stride + hy_n * hy_h + h) = hid_state.at(
-                            hid_shift + (baccbi + bs) * hy_stride + bi * 5 * hy_h + hy_h + h);
-                    }
-                }
-            }
-
-            bacc += in_n.at(ti);
-        }
-    }
-
-    // output
-    int prelayer_shift = (numlayer - 1) * batch_n * hy_stride + bi * 5 * hy_h;
-
-    for(int i = 0; i < numlayer * batch_n * hy_stride * 2; i++)
-    {
-        rsvspace.at(i) = hid_state.at(i);
-    }
-
-    for(int i = 0; i < hy_d * hy_n * hy_h; i++)
-    {
-        hy_host.at(i) = hy_state.at(i);
-        cy_host.at(i) = cy_state.at(i);
-    }
-
-    for(int bs = 0; bs < batch_n; bs++)
-    {
-        for(int h = 0; h < out_h; h++)
-        {
-            out_host.at(bs * out_stride + h) = hid_state.at(prelayer_shift + bs * hy_stride + h);
-        }
-    }
+    if(inputMode == 1 && in_h != hy_h)
+    {
+        printf("Verification cannot be completed: The input tensor size must equal to the "
+               "hidden state size of the network in SKIP_INPUT mode!\n");
+        return;
+    }
+    (void)out_h;
+    RunRNNForwardHost(miopenLSTM,
+                      in,
+                      wei,
+                      hy_host,
+                      hx_is_null ? nullptr : hx.data(),
+                      cy_host.data(),
+                      cx_is_null ? nullptr : cx.data(),
+                      out_host,
+                      in_n,
+                      in_h,
+                      seqLength,
+                      bidirection,
+                      biased,
+                      hy_d,
+                      hy_n,
+                      hy_h,
+                      inputMode,
+                      rsvspace);
 }
 
 template <typename T>
@@ -35,6 +35,7 @@
 #include "pool_driver.hpp"
 #include "softmax_driver.hpp"
 #include "rnn_driver.hpp"
+#include "replay_driver.hpp"
 #include "miopen/config.h"
 
 int main(int argc, char* argv[])
@@ -113,6 +114,10 @@ int main(int argc, char* argv[])
     {
         drv = new RNNDriver<float>();
     }
+    else if(base_arg == "replay")
+    {
+        drv = new ReplayDriver();
+    }
     else
     {
         printf("Incorrect BaseArg\n");
@@ -31,6 +31,8 @@
 #include <iomanip>
 #include <iostream>
 
+#include <miopen/gemm_host.hpp>
+
 #include "calcerr.hpp"
 
 //#if 0 // disable functions
@@ -39,6 +41,56 @@
 //
 ///////////////////////////////////////////////////////////
 #define ADNN_MM_TRANSPOSE 1
+
+// Float products run on the blocked, multi-threaded host GEMM of the library.
+inline bool ADNN_mm_host(const float* a_ptr,
+                         size_t a_stride,
+                         int a_flags,
+                         const float* b_ptr,
+                         size_t b_stride,
+                         int b_flags,
+                         float* c_ptr,
+                         size_t c_cols,
+                         size_t c_rows,
+                         size_t c_stride,
+                         size_t inner_loop,
+                         double d_alpha,
+                         double d_beta)
+{
+    miopen::host::Gemm((a_flags & ADNN_MM_TRANSPOSE) != 0,
+                       (b_flags & ADNN_MM_TRANSPOSE) != 0,
+                       c_rows,
+                       c_cols,
+                       inner_loop,
+                       float(d_alpha),
+                       a_ptr,
+                       a_stride,
+                       b_ptr,
+                       b_stride,
+                       float(d_beta),
+                       c_ptr,
+                       c_stride);
+    return true;
+}
+
+template <typename Dtype>
+bool ADNN_mm_host(const Dtype*,
+                  size_t,
+                  int,
+                  const Dtype*,
+                  size_t,
+                  int,
+                  Dtype*,
+                  size_t,
+                  size_t,
+                  size_t,
+                  size_t,
+                  double,
+                  double)
+{
+    return false;
+}
+
 template <typename Dtype>
 void ADNN_mm_cpu(const Dtype* a_ptr,
                  size_t a_cols,
@@ -86,6 +138,21 @@ void ADNN_mm_cpu(const Dtype* a_ptr,
 
     size_t inner_loop = (!(a_flags & ADNN_MM_TRANSPOSE)) ? a_cols : a_rows;
 
+    if(ADNN_mm_host(a_ptr,
+                    a_stride,
+                    a_flags,
+                    b_ptr,
+                    b_stride,
+                    b_flags,
+                    c_ptr,
+                    c_cols,
+                    c_rows,
+                    c_stride,
+                    inner_loop,
+                    d_alpha,
+                    d_beta))
+        return;
+
     if(!(a_flags & ADNN_MM_TRANSPOSE) && !(b_flags & ADNN_MM_TRANSPOSE))
     {
         for(size_t n = 0; n < c_rows; ++n)
@@ -164,7 +231,7 @@ void ADNN_mm_cpu(const Dtype* a_ptr,
                 Dtype mm_e = 0;
                 for(size_t m = 0; m < inner_loop; ++m)
                 {
-                    c_ptr[n * c_stride + k] += a_ptr[m * a_stride + n] * b_ptr[k * b_stride + m];
+                    mm_e += a_ptr[m * a_stride + n] * b_ptr[k * b_stride + m];
                 }
                 c_ptr[n * c_stride + k] = beta * c_ptr[n * c_stride + k] + alpha * mm_e;
             }
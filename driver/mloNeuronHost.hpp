@@ -36,6 +36,7 @@
 #include <iostream>
 #include <iomanip>
 
+#include "miopen/activ_host.hpp"
 #include "miopen/float_equal.hpp"
 
 ////////////////////////////////////////////////////////////
@@ -56,8 +57,6 @@
 #define MIOPEN_NEURON_TOTAL 10
 #endif
 
-const float kBNLL_THRESHOLD = 50.;
-
 template <typename T>
 T calculate_relative_error(T uref, T u)
 {
@@ -82,48 +81,15 @@ int mloNeuronForwardRunHostAndVerify(int neuron_type,
     for(size_t k = 0; k < size; k++)
         data[k]  = static_cast<_Tcheck>(bot_ptr[k]);
 
-    std::function<_Tcheck(_Tcheck)> f;
-
-    switch(neuron_type)
-    {
-    case MIOPEN_NEURON_PASTHRU: //	x
-        f = [=](_Tcheck x) { return x; };
-        break;
-    case MIOPEN_NEURON_LOGISTIC: //	1 / (1 + e^-x)	//Sigmoid
-        f = [=](_Tcheck x) { return 1 / (1 + std::exp(-x)); };
-        break;
-    case MIOPEN_NEURON_TANH: //	beta * tanh(alpha * x)
-        f = [=](_Tcheck x) { return beta * std::tanh(alpha * x); };
-        break;
-    case MIOPEN_NEURON_RELU: //	max(0, x)
-        f = [=](_Tcheck x) { return (x > 0) ? x : 0; };
-        break;
-    case MIOPEN_NEURON_SOFTRELU: //	log(1 + e^x)   // bonomial normal log likelihood
-        f = [=](_Tcheck x) { return std::log1p(std::exp(x)); };
-        break;
-    case MIOPEN_NEURON_ABS: //	abs(x)
-        f = [=](_Tcheck x) { return std::abs(x); };
-        break;
-    case MIOPEN_NEURON_POWER: // (alpha + beta * x) ^ gamma
-        f = [=](_Tcheck x) {
-            _Tcheck v = alpha + beta * x;
-            return v <= std::numeric_limits<_Tcheck>::epsilon() ? 0 : pow(v, gamma);
-        };
-        break;
-    case MIOPEN_NEURON_CLIPPED_RELU: // min(alpha, max(0, x))
-        f = [=](_Tcheck x) { return std::min(alpha, std::max(_Tcheck(0), x)); };
-        break;
-    case MIOPEN_NEURON_LEAKY_RELU: // alpha * x | x<=0; x | x>0
-        f = [=](_Tcheck x) { return (x > 0) ? x : x * alpha; };
-        break;
-    case MIOPEN_NEURON_ELU: // alpah * (exp(x)-1) | x<=0; x | x>0
-        f = [=](_Tcheck x) { return (x > 0) ? x : alpha * std::expm1(x); };
-        break;
-    default: printf("ERROR: unknown neuron type: %d\n", neuron_type); break;
-    }
-
-    for(size_t i = 0; i < size; i++)
-        c_res[i] = f(data[i]);
+    if(neuron_type < MIOPEN_NEURON_PASTHRU || neuron_type >= MIOPEN_NEURON_TOTAL)
+        printf("ERROR: unknown neuron type: %d\n", neuron_type);
+    miopen::host::VisitActivation<_Tcheck>(static_cast<miopenActivationMode_t>(neuron_type),
+                                           alpha,
+                                           beta,
+                                           gamma,
+                                           [&](auto fwd, auto) {
+                                               miopen::host::Transform(size, fwd, c_res, data);
+                                           });
 
     for(size_t i = 0; i < size && match; i++)
     {
@@ -182,52 +148,16 @@ int mloNeuronBackwardRunHostAndVerify(int neuron_type,
         top_df_cpu[k] = static_cast<_Tcheck>(top_df_ptr[k]);
     }
 
-    std::function<_Tcheck(_Tcheck, _Tcheck, _Tcheck)> f;
-
-    switch(neuron_type)
-    {
-    case MIOPEN_NEURON_PASTHRU: //	x
-        f = [=](_Tcheck dy, _Tcheck, _Tcheck) { return dy; };
-        break;
-    case MIOPEN_NEURON_LOGISTIC: //	1 / (1 + e^-x)	//Sigmoid
-        f = [=](_Tcheck dy, _Tcheck, _Tcheck y) { return dy * y * (1 - y); };
-        break;
-    case MIOPEN_NEURON_TANH: //	beta * tanh(alpha * x)
-        f = [=](_Tcheck dy, _Tcheck, _Tcheck y) { return dy * alpha * (beta - y * y / beta); };
-        break;
-    case MIOPEN_NEURON_RELU: //	max(0, x)
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return (x > 0) ? dy : 0; };
-        break;
-    case MIOPEN_NEURON_SOFTRELU: //	log(1 + e^x)   // bonomial normal log likelihood
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) {
-            _Tcheck threshold = kBNLL_THRESHOLD;
-            _Tcheck expval    = std::exp(std::min(x, threshold));
-            return dy * expval / (expval + 1.0);
-        };
-        break;
-    case MIOPEN_NEURON_ABS: //	abs(x)
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return dy * ((x > 0) ? 1 : -1); };
-        break;
-    case MIOPEN_NEURON_POWER: // (alpha + beta * x) ^ gamma
-        f = [=](_Tcheck, _Tcheck x, _Tcheck y) {
-            _Tcheck v = alpha + beta * x;
-            return v <= std::numeric_limits<_Tcheck>::epsilon() ? 0 : gamma * beta * y / v;
-        };
-        break;
-    case MIOPEN_NEURON_CLIPPED_RELU: // min(alpha, max(0, x))
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return (x > 0 && x < alpha) ? dy : 0; };
-        break;
-    case MIOPEN_NEURON_LEAKY_RELU: // alpha * x | x<=0; x | x>0
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck) { return dy * ((x > 0) ? 1 : alpha); };
-        break;
-    case MIOPEN_NEURON_ELU: // alpah * (exp(x)-1) | x<=0; x | x>0
-        f = [=](_Tcheck dy, _Tcheck x, _Tcheck y) { return dy * ((x > 0) ? 1 : y + alpha); };
-        break;
-    default: printf("ERROR: unknown neuron type: %d\n", neuron_type); break;
-    }
-
-    for(size_t i      = 0; i < size; i++)
-        bot_df_cpu[i] = f(top_df_cpu[i], bot_cpu[i], top_cpu[i]);
+    if(neuron_type < MIOPEN_NEURON_PASTHRU || neuron_type >= MIOPEN_NEURON_TOTAL)
+        printf("ERROR: unknown neuron type: %d\n", neuron_type);
+    miopen::host::VisitActivation<_Tcheck>(
+        static_cast<miopenActivationMode_t>(neuron_type),
+        alpha,
+        beta,
+        gamma,
+        [&](auto, auto bwd) {
+            miopen::host::Transform(size, bwd, bot_df_cpu, top_df_cpu, bot_cpu, top_cpu);
+        });
 
     for(size_t i = 0; i < size && match; ++i)
     {
@@ -35,6 +35,10 @@
 #include <cmath>
 #include <cstring>
 #include <iomanip>
+#include <limits>
+#include <vector>
+
+#include <miopen/pooling_host.hpp>
 
 #include "calcerr.hpp"
 
@@ -74,6 +78,49 @@ double CalcErr( _T c_val, _T g_val)
 #define MLO_POOLING_OP_STC 2
 #endif
 
+/// The host pooling of NCHW tensors with contiguous rows.
+inline miopen::host::PoolingGeometry mloPoolingGeometry(int kernel_size1,
+                                                        int pad1,
+                                                        int stride1,
+                                                        int kernel_size0,
+                                                        int pad0,
+                                                        int stride0,
+                                                        int n_batchs,
+                                                        int n_outputs,
+                                                        int bot_height,
+                                                        int bot_width,
+                                                        int bot_stride,
+                                                        int bot_channel_stride,
+                                                        int bot_batch_stride,
+                                                        int top_height,
+                                                        int top_width,
+                                                        int top_stride,
+                                                        int top_channel_stride,
+                                                        int top_batch_stride)
+{
+    miopen::host::PoolingGeometry g{n_batchs,
+                                    n_outputs,
+                                    bot_height,
+                                    bot_width,
+                                    top_height,
+                                    top_width,
+                                    kernel_size1,
+                                    kernel_size0,
+                                    pad1,
+                                    pad0,
+                                    stride1,
+                                    stride0};
+    g.in_strides  = {{std::size_t(bot_batch_stride),
+                     std::size_t(bot_channel_stride),
+                     std::size_t(bot_stride),
+                     1}};
+    g.out_strides = {{std::size_t(top_batch_stride),
+                      std::size_t(top_channel_stride),
+                      std::size_t(top_stride),
+                      1}};
+    return g;
+}
+
 template <typename _Tgpu /* the data type used in GPU computations (usually half) */,
           typename _Tcheck /* the data type used in CPU checkings (usually double) */>
 bool mloPoolingForwardRunHostAndVerify(int pooling_method,
@@ -98,18 +145,43 @@ bool mloPoolingForwardRunHostAndVerify(int pooling_method,
                                        const _Tgpu* bot_ptr,
                                        const _Tgpu* top_ptr,
                                        bool do_backward,
-                                       size_t* mask_ptr,
+                                       uint8_t* mask_ptr,
                                        uint8_t* mask_gpu,
                                        _Tcheck allowedEps)
 {
+    if(pooling_method != MLO_POOLING_OP_MAX && pooling_method != MLO_POOLING_OP_AVE)
+    {
+        std::cout << "ERROR: unknown operator : layer: pooling." << std::endl;
+        return false;
+    }
 
     bool match = true;
-    _Tcheck MAX_VAL(3.402823466e+38);
+    _Tcheck MAX_VAL(std::numeric_limits<float>::max());
     _Tgpu G_MAX_VAL = (sizeof(_Tgpu) == 4 || sizeof(_Tgpu) == 8)
                           ? static_cast<_Tgpu>(3.402823466e+38)
                           : static_cast<_Tgpu>(65504);
-    // c-emulator
-    _Tcheck res = static_cast<_Tcheck>(0);
+
+    const auto g = mloPoolingGeometry(kernel_size1,
+                                      pad1,
+                                      stride1,
+                                      kernel_size0,
+                                      pad0,
+                                      stride0,
+                                      n_batchs,
+                                      n_outputs,
+                                      bot_height,
+                                      bot_width,
+                                      bot_stride,
+                                      bot_channel_stride,
+                                      bot_batch_stride,
+                                      top_height,
+                                      top_width,
+                                      top_stride,
+                                      top_channel_stride,
+                                      top_batch_stride);
+    const bool max = pooling_method == MLO_POOLING_OP_MAX;
+    std::vector<_Tcheck> top_host(std::size_t(n_batchs) * top_batch_stride);
+    miopen::host::PoolingForward(g, max, bot_ptr, top_host.data(), max ? mask_ptr : nullptr);
 
     for(int b = 0; b < n_batchs && match; b++)
     {
@@ -119,99 +191,22 @@ bool mloPoolingForwardRunHostAndVerify(int pooling_method,
             {
                 for(int i = 0; i < top_width && match; i++)
                 {
-                    // c-emulator
-                    if(pooling_method == MLO_POOLING_OP_MAX)
-                    {
-                        res = -MAX_VAL;
-                    }
-                    else if(pooling_method == MLO_POOLING_OP_AVE)
+                    const size_t top_index =
+                        b * top_batch_stride + o * top_channel_stride + j * top_stride + i;
+                    if(max && do_backward && mask_gpu[top_index] != mask_ptr[top_index])
                     {
-                        res = static_cast<_Tcheck>(0);
-                    }
-
-                    int hstart = j * stride1 - pad1;
-                    int wstart = i * stride0 - pad0;
-                    int hend   = std::min(hstart + kernel_size1, bot_height);
-                    int wend   = std::min(wstart + kernel_size0, bot_width);
-                    hstart     = std::max(hstart, 0);
-                    wstart     = std::max(wstart, 0);
-
-                    int pool_size        = (hend - hstart) * (wend - wstart);
-                    pool_size            = (pool_size == 0) ? 1 : pool_size;
-                    size_t res_index     = 0;
-                    size_t res_index_gpu = 0;
-                    bool found           = false;
-                    for(int h = hstart; h < hend; ++h)
-                    {
-                        for(int w = wstart; w < wend; ++w)
-                        {
-                            if(pooling_method == MLO_POOLING_OP_MAX)
-                            {
-                                size_t bot_index = b * bot_batch_stride + o * bot_channel_stride +
-                                                   h * bot_stride + w;
-                                if(static_cast<_Tcheck>(bot_ptr[bot_index]) > res)
-                                {
-                                    res           = static_cast<_Tcheck>(bot_ptr[bot_index]);
-                                    res_index     = bot_index;
-                                    res_index_gpu = ((h - j * stride1 + pad1) * kernel_size0) +
-                                                    (w - i * stride0 + pad0);
-                                    found = true;
-                                }
-                            }
-                            else if(pooling_method == MLO_POOLING_OP_AVE)
-                            {
-
-                                res += static_cast<_Tcheck>(
-                                    bot_ptr[b * bot_batch_stride + o * bot_channel_stride +
-                                            h * bot_stride + w]);
-                            }
-                            else
-                            {
-                                std::cout << "ERROR: unknown operator : layer: pooling."
-                                          << std::endl;
-                                match = false;
-                                continue;
-                            }
-                        }
-                    }
-                    // special index value is used to mark top points which has no associated bottom
-                    // points
-                    if(!found)
-                    {
-                        res_index     = std::numeric_limits<size_t>::max();
-                        res_index_gpu = std::numeric_limits<uint8_t>::max();
-                    }
-                    if(pooling_method == MLO_POOLING_OP_MAX)
-                    {
-                        // the case with the odd input, the even kernel size and 2*pad == kernel
-                        // size
-                        mask_ptr[b * top_batch_stride + o * top_channel_stride + j * top_stride +
-                                 i] = res_index;
-                        if(do_backward)
-                        {
-                            uint8_t mg = mask_gpu[b * top_batch_stride + o * top_channel_stride +
-                                                  j * top_stride + i];
-                            if(mg != res_index_gpu)
-                            {
-                                std::cout << "Mask mismatch, gpu " << mg << " cpu " << res_index_gpu
-                                          << "(" << res_index << ")" << std::endl;
-                                match = false;
-                            }
-                        }
-                    }
-                    if(pooling_method == MLO_POOLING_OP_AVE)
-                    {
-                        res /= pool_size;
+                        std::cout << "Mask mismatch, gpu " << int(mask_gpu[top_index]) << " cpu "
+                                  << int(mask_ptr[top_index]) << std::endl;
+                        match = false;
                     }
-                    _Tcheck c_val = res;
 
-                    _Tgpu gg_val = (top_ptr[b * top_batch_stride + o * top_channel_stride +
-                                            j * top_stride + i]);
+                    // windows with no value get the lowest float
+                    _Tcheck c_val = top_host[top_index];
+                    c_val         = (c_val == -MAX_VAL) ? 0 : c_val;
 
+                    _Tgpu gg_val = top_ptr[top_index];
                     gg_val = (_Tgpu(gg_val) == _Tgpu(-G_MAX_VAL)) ? _Tgpu(0) : _Tgpu(gg_val);
 
-                    c_val = (c_val == -MAX_VAL) ? 0 : c_val;
-
                     _Tcheck g_val(gg_val);
 
                     double err = std::abs(c_val - g_val);
@@ -243,9 +238,9 @@ int mloPoolingBackwardRunHost(
     int pad0,
     int stride0,
 
-    _Tcheck* bot_df_v_ptr, // the code assumes that bot_df_v_ptr was zeroed
+    _Tcheck* bot_df_v_ptr, // every value is written
     const _Tgpu* top_df_ptr,
-    const size_t* mask_ptr,
+    const uint8_t* mask_ptr,
 
     int bot_df_v_batch_stride,
     int bot_df_v_channel_stride,
@@ -264,77 +259,33 @@ int mloPoolingBackwardRunHost(
 
     int ret = 0;
 
-    for(int b = 0; b < n_batchs; b++)
+    if(pooling_method != MLO_POOLING_OP_MAX && pooling_method != MLO_POOLING_OP_AVE)
     {
-        for(int o = 0; o < n_outputs; o++)
-        {
-            int bot_df_v_off = b * bot_df_v_batch_stride + o * bot_df_v_channel_stride;
-            int top_df_off   = b * top_df_batch_stride + o * top_df_channel_stride;
-
-            if(pooling_method == MLO_POOLING_OP_MAX)
-            {
-                for(int j = 0; j < top_height; j++)
-                {
-                    for(int i = 0; i < top_width; i++)
-                    {
-                        size_t top_idx = top_df_off + j * top_df_stride + i;
-                        size_t bot_idx = mask_ptr[top_idx];
-                        // skip top points that don't have associated bottom points
-                        if(bot_idx == std::numeric_limits<size_t>::max())
-                            continue;
-                        bot_df_v_ptr[bot_idx] += static_cast<_Tcheck>(top_df_ptr[top_idx]);
-                    }
-                }
-            }
-            else if(pooling_method == MLO_POOLING_OP_AVE)
-            {
+        std::cout << "ERROR: unknown operator : layer: pooling back-propagation." << std::endl;
+        return (ret);
+    }
 
-                for(int j = 0; j < bot_height; j++)
-                {
-                    for(int i = 0; i < bot_width; i++)
-                    {
-                        // c-emulator
-                        bot_df_v_ptr[bot_df_v_off + j * bot_df_v_stride + i] =
-                            static_cast<_Tcheck>(0);
-                        int h       = j + pad1;
-                        int w       = i + pad0;
-                        int phstart = (h < kernel_size1) ? 0 : (h - kernel_size1) / stride1 + 1;
-                        int phend   = std::min(h / stride1 + 1, top_height);
-                        int pwstart = (w < kernel_size0) ? 0 : (w - kernel_size0) / stride0 + 1;
-                        int pwend   = std::min(w / stride0 + 1, top_width);
-                        _Tcheck gradient = static_cast<_Tcheck>(0);
-                        for(int ph = phstart; ph < phend; ++ph)
-                        {
-                            for(int pw = pwstart; pw < pwend; ++pw)
-                            {
-                                // figure out the pooling size
-                                int hstart = ph * stride1 - pad1;
-                                int wstart = pw * stride0 - pad0;
-                                int hend   = std::min(hstart + kernel_size1, bot_height);
-                                int wend   = std::min(wstart + kernel_size0, bot_width);
-                                hstart     = std::max(hstart, 0);
-                                wstart     = std::max(wstart, 0);
+    const auto g = mloPoolingGeometry(kernel_size1,
+                                      pad1,
+                                      stride1,
+                                      kernel_size0,
+                                      pad0,
+                                      stride0,
+                                      n_batchs,
+                                      n_outputs,
+                                      bot_height,
+                                      bot_width,
+                                      bot_df_v_stride,
+                                      bot_df_v_channel_stride,
+                                      bot_df_v_batch_stride,
+                                      top_height,
+                                      top_width,
+                                      top_df_stride,
+                                      top_df_channel_stride,
+                                      top_df_batch_stride);
+    miopen::host::PoolingBackward(
+        g, pooling_method == MLO_POOLING_OP_MAX, top_df_ptr, bot_df_v_ptr, mask_ptr);
 
-                                int pool_size = ((hend - hstart) * (wend - wstart) == 0)
-                                                    ? 1
-                                                    : (hend - hstart) * (wend - wstart);
-                                gradient += static_cast<_Tcheck>(
-                                                top_df_ptr[top_df_off + ph * top_df_stride + pw]) /
-                                            static_cast<_Tcheck>(pool_size);
-                            }
-                        }
-                        bot_df_v_ptr[bot_df_v_off + j * bot_df_v_stride + i] = gradient;
-                    }
-                }
-            }
-            else
-            {
-                std::cout << "ERROR: unknown operator : layer: pooling back-propagation."
-                          << std::endl;
-                continue;
-            }
-        }
-    }
     return (ret);
 }
 
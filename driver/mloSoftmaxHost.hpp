@@ -25,77 +25,26 @@ POSSIBILITY OF SUCH DAMAGE.
 #ifndef MLO_SOFTMAXHOST_H_
 #define MLO_SOFTMAXHOST_H_
 
+#include <miopen/softmax_host.hpp>
+
 ////////////////////////////////////////////////////////////
 //
 ///////////////////////////////////////////////////////////
 
 template <typename Tcheck /* the data type used in CPU checkings (usually double) */>
-int mloSoftmaxForwardRunHost(int n, int c, int h, int w, Tcheck* channel_max, Tcheck* outhost)
+int mloSoftmaxForwardRunHost(int n, int c, int h, int w, Tcheck* /*channel_max*/, Tcheck* outhost)
 {
-
-    int ret = 0;
-
-    for(int i = 0; i < n; i++)
-    {
-        for(int s = 0; s < h * w; s++)
-        {
-            for(int j = 0; j < c; j++)
-            {
-                channel_max[i * h * w + s] =
-                    std::max(outhost[(i * c + j) * h * w + s], channel_max[i * h * w + s]);
-            }
-
-            for(int j = 0; j < c; j++)
-            {
-                outhost[(i * c + j) * h * w + s] -= channel_max[i * h * w + s];
-                outhost[(i * c + j) * h * w + s] = exp(outhost[(i * c + j) * h * w + s]);
-            }
-
-            channel_max[i * h * w + s] = 0.0;
-            for(int j = 0; j < c; j++)
-            {
-                channel_max[i * h * w + s] += outhost[(i * c + j) * h * w + s];
-            }
-
-            for(int j = 0; j < c; j++)
-            {
-                outhost[(i * c + j) * h * w + s] /= channel_max[i * h * w + s];
-            }
-        }
-    }
-
-    return ret;
+    miopen::host::SoftmaxForward(miopen::host::SoftmaxGeometry{n, c, h, w}, outhost);
+    return 0;
 }
 
 template <typename Tgpu /* the data type used in GPU computations (usually half) */,
           typename Tcheck /* the data type used in CPU checkings (usually double) */>
 int mloSoftmaxBackwardRunHost(
-    int n, int c, int h, int w, Tcheck* channel_dot, Tgpu* out, Tcheck* dinhost)
+    int n, int c, int h, int w, Tcheck* /*channel_dot*/, Tgpu* out, Tcheck* dinhost)
 {
-
-    int ret = 0;
-
-    for(int i = 0; i < n; i++)
-    {
-        for(int s = 0; s < h * w; s++)
-        {
-            for(int j = 0; j < c; j++)
-            {
-                channel_dot[i * h * w + s] += static_cast<Tcheck>(out[(i * c + j) * h * w + s]) *
-                                              dinhost[(i * c + j) * h * w + s];
-            }
-
-            for(int j = 0; j < c; j++)
-            {
-                dinhost[(i * c + j) * h * w + s] -= channel_dot[i * h * w + s];
-                dinhost[(i * c + j) * h * w + s] =
-                    static_cast<Tcheck>(out[(i * c + j) * h * w + s]) *
-                    dinhost[(i * c + j) * h * w + s];
-            }
-        }
-    }
-
-    return ret;
+    miopen::host::SoftmaxBackward(miopen::host::SoftmaxGeometry{n, c, h, w}, out, dinhost);
+    return 0;
 }
 
 #endif
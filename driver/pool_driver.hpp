@@ -101,7 +101,7 @@ class PoolDriver : public Driver
 
     std::vector<Tgpu> in;
     std::vector<Tgpu> out;
-    std::vector<size_t> maskhost;
+    std::vector<uint8_t> maskhost;
     std::vector<Tref> outhost;
 
     miopenPoolingDescriptor_t poolDesc;
@@ -277,7 +277,7 @@ int PoolDriver<Tgpu, Tref>::AllocateBuffersAndCopy()
 
     in       = std::vector<Tgpu>(in_sz, static_cast<Tgpu>(0));
     out      = std::vector<Tgpu>(out_sz, static_cast<Tgpu>(0));
-    maskhost = std::vector<size_t>(out_sz, static_cast<size_t>(0));
+    maskhost = std::vector<uint8_t>(out_sz, uint8_t(0));
     outhost  = std::vector<Tref>(out_sz, static_cast<Tref>(0));
 
     din     = std::vector<Tgpu>(in_sz, static_cast<Tgpu>(0));
@@ -0,0 +1,796 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_REPLAY_DRIVER_HPP
+#define GUARD_MIOPEN_REPLAY_DRIVER_HPP
+
+#include "InputFlags.hpp"
+#include "driver.hpp"
+#include "timer.hpp"
+#include <miopen/capture.hpp>
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// Replays a capture made with MIOPEN_CAPTURE_FILE (see miopen/capture.hpp) on synthetic buffers
+/// and reports the latency of each API function. The first pass builds the kernels and is
+/// reported separately.
+class ReplayDriver : public Driver
+{
+    public:
+    int AddCmdLineArgs();
+    int ParseCmdLineArgs(int argc, char* argv[]);
+    InputFlags& GetInputFlags() { return inflags; }
+
+    int GetandSetData();
+    int AllocateBuffersAndCopy() { return miopenStatusSuccess; }
+    int RunForwardGPU();
+    int VerifyForward() { return miopenStatusSuccess; }
+    int RunBackwardGPU() { return miopenStatusSuccess; }
+    int VerifyBackward() { return miopenStatusSuccess; }
+
+    /// Returns a buffer of at least size bytes. Its contents are not preserved when it grows.
+    void* GetBuffer(std::int64_t id, std::size_t size);
+
+    private:
+    /// Arguments of one recorded call, converted for the API. Descriptors are created once.
+    class Args
+    {
+        public:
+        Args(const miopen::capture::Call& call_, ReplayDriver& driver_)
+            : call(call_), driver(driver_)
+        {
+        }
+
+        miopenHandle_t Handle() { return driver.GetHandle(); }
+        miopenTensorDescriptor_t Tensor(const std::string& name);
+        miopenConvolutionDescriptor_t Convolution(const std::string& name);
+        miopenPoolingDescriptor_t Pooling(const std::string& name);
+        miopenLRNDescriptor_t LRN(const std::string& name);
+        miopenActivationDescriptor_t Activation(const std::string& name);
+        void* Buffer(const std::string& name, std::size_t min_size = 0);
+        float* Scalar(const std::string& name, float default_value);
+        std::int64_t Int(const std::string& name);
+        template <class T>
+        T* Output(std::size_t n = 1)
+        {
+            outputs.emplace_back(std::max<std::size_t>(n, 1) * sizeof(T));
+            return reinterpret_cast<T*>(outputs.back().data());
+        }
+
+        private:
+        const miopen::capture::Arg& Get(const std::string& name, miopen::capture::Kind kind);
+        template <class T, class F>
+        T Descriptor(const std::string& name, F make);
+
+        const miopen::capture::Call& call;
+        ReplayDriver& driver;
+        std::map<std::string, std::shared_ptr<void>> descriptors;
+        std::map<std::string, float> scalars;
+        std::vector<std::vector<char>> outputs;
+    };
+
+    using Function = std::function<miopenStatus_t(Args&)>;
+
+    struct Stats
+    {
+        std::size_t calls = 0;
+        std::size_t fails = 0;
+        double first_ms   = 0;
+        double total_ms   = 0;
+    };
+
+    static const std::map<std::string, Function>& Functions();
+    void Sync();
+
+    InputFlags inflags;
+    std::vector<miopen::capture::Call> calls;
+    std::map<std::int64_t, std::unique_ptr<GPUMem>> buffers;
+};
+
+int ReplayDriver::AddCmdLineArgs()
+{
+    inflags.AddInputFlag("file", 'f', "", "Capture made with MIOPEN_CAPTURE_FILE (Default=)", "str");
+    inflags.AddInputFlag("iter", 'i', "10", "Number of Iterations (Default=10)", "int");
+    inflags.AddInputFlag("forw", 'F', "1", "Not used (Default=1)", "int");
+    inflags.AddInputFlag("verify", 'V', "0", "Not used (Default=0)", "int");
+    return miopenStatusSuccess;
+}
+
+int ReplayDriver::ParseCmdLineArgs(int argc, char* argv[])
+{
+    inflags.Parse(argc, argv);
+    return miopenStatusSuccess;
+}
+
+int ReplayDriver::GetandSetData()
+{
+    const auto path = inflags.GetValueStr("file");
+    std::ifstream file(path, std::ios::binary);
+    miopen::capture::Reader reader(file);
+    if(!reader.IsValid())
+    {
+        printf("Cannot read capture %s\n", path.c_str());
+        exit(EXIT_FAILURE);
+    }
+    miopen::capture::Call call;
+    while(reader.Read(call))
+        calls.push_back(call);
+    printf("Read %zu calls from %s\n", calls.size(), path.c_str());
+    return miopenStatusSuccess;
+}
+
+void* ReplayDriver::GetBuffer(std::int64_t id, std::size_t size)
+{
+    auto& buffer = buffers[id];
+    if(buffer == nullptr || buffer->GetSize() < size)
+    {
+#if MIOPEN_BACKEND_OPENCL
+        cl_context ctx;
+        clGetCommandQueueInfo(q, CL_QUEUE_CONTEXT, sizeof(cl_context), &ctx, nullptr);
+#elif MIOPEN_BACKEND_HIP
+        uint32_t ctx = 0;
+#endif
+        // Synthetic contents: zeros.
+        const auto n = std::max<std::size_t>((size + 3) / 4, 1);
+        buffer       = std::unique_ptr<GPUMem>(new GPUMem(ctx, n, sizeof(float)));
+        std::vector<float> zeros(n, 0.0f);
+        buffer->ToGPU(q, zeros.data());
+    }
+    return buffer->GetMem();
+}
+
+void ReplayDriver::Sync()
+{
+#if MIOPEN_BACKEND_OPENCL
+    clFinish(q);
+#elif MIOPEN_BACKEND_HIP
+    hipStreamSynchronize(q);
+#endif
+}
+
+int ReplayDriver::RunForwardGPU()
+{
+    const auto& functions = Functions();
+    std::vector<std::unique_ptr<Args>> args;
+    std::map<std::string, Stats> stats;
+    std::map<std::string, std::size_t> skipped;
+    for(auto&& call : calls)
+    {
+        if(functions.count(call.name) == 0)
+            skipped[call.name]++;
+        args.emplace_back(new Args(call, *this));
+    }
+
+    const int iters = std::max(inflags.GetValueInt("iter"), 0) + 1;
+    double total_ms = 0;
+    Timer t;
+    for(int iter = 0; iter < iters; iter++)
+    {
+        for(std::size_t i = 0; i < calls.size(); i++)
+        {
+            const auto f = functions.find(calls[i].name);
+            if(f == functions.end())
+                continue;
+            auto& s = stats[calls[i].name];
+            Sync();
+            t.start();
+            miopenStatus_t status = miopenStatusSuccess;
+            try
+            {
+                status = f->second(*args[i]);
+            }
+            catch(const std::exception& ex)
+            {
+                if(iter == 0)
+                    printf("%s: %s\n", calls[i].name.c_str(), ex.what());
+                status = miopenStatusBadParm;
+            }
+            Sync();
+            t.stop();
+            if(status != miopenStatusSuccess)
+                s.fails++;
+            if(iter == 0)
+            {
+                s.first_ms += t.gettime_ms();
+                continue;
+            }
+            s.calls++;
+            s.total_ms += t.gettime_ms();
+            total_ms += t.gettime_ms();
+        }
+    }
+
+    printf("%-56s %8s %6s %12s %12s %12s\n", "Function", "Calls", "Fails", "First ms",
+           "Avg ms", "Total ms");
+    std::size_t total_calls = 0;
+    for(auto&& p : stats)
+    {
+        const auto& s = p.second;
+        total_calls += s.calls;
+        printf("%-56s %8zu %6zu %12.3f %12.4f %12.3f\n",
+               p.first.c_str(),
+               s.calls,
+               s.fails,
+               s.first_ms,
+               s.calls == 0 ? 0.0 : s.total_ms / s.calls,
+               s.total_ms);
+    }
+    printf("Replayed %d iteration(s) of %zu calls in %.3f ms, %.1f calls/s, %.3f ms per iteration\n",
+           iters - 1,
+           total_calls / std::max(iters - 1, 1),
+           total_ms,
+           total_ms > 0 ? total_calls * 1000.0 / total_ms : 0.0,
+           total_ms / std::max(iters - 1, 1));
+    for(auto&& p : skipped)
+        printf("Not replayed: %s (%zu)\n", p.first.c_str(), p.second);
+    return miopenStatusSuccess;
+}
+
+const miopen::capture::Arg& ReplayDriver::Args::Get(const std::string& name,
+                                                     miopen::capture::Kind kind)
+{
+    const auto arg = call.Find(name);
+    if(arg == nullptr || arg->kind != kind)
+        throw std::runtime_error("argument " + name + " is missing in the capture");
+    return *arg;
+}
+
+template <class T, class F>
+T ReplayDriver::Args::Descriptor(const std::string& name, F make)
+{
+    auto& desc = descriptors[name];
+    if(desc == nullptr)
+        desc = make();
+    return static_cast<T>(desc.get());
+}
+
+miopenTensorDescriptor_t ReplayDriver::Args::Tensor(const std::string& name)
+{
+    return Descriptor<miopenTensorDescriptor_t>(name, [&] {
+        const auto& ints = Get(name, miopen::capture::Kind::Tensor).ints;
+        const auto n     = static_cast<int>(ints.at(1));
+        std::vector<int> lens(ints.begin() + 2, ints.begin() + 2 + n);
+        std::vector<int> strides(ints.begin() + 2 + n, ints.begin() + 2 + 2 * n);
+        miopenTensorDescriptor_t desc;
+        miopenCreateTensorDescriptor(&desc);
+        miopenSetTensorDescriptor(
+            desc, static_cast<miopenDataType_t>(ints[0]), n, lens.data(), strides.data());
+        return std::shared_ptr<void>(desc, [](void* p) {
+            miopenDestroyTensorDescriptor(static_cast<miopenTensorDescriptor_t>(p));
+        });
+    });
+}
+
+miopenConvolutionDescriptor_t ReplayDriver::Args::Convolution(const std::string& name)
+{
+    return Descriptor<miopenConvolutionDescriptor_t>(name, [&] {
+        const auto& v = Get(name, miopen::capture::Kind::Convolution).ints;
+        miopenConvolutionDescriptor_t desc;
+        miopenCreateConvolutionDescriptor(&desc);
+        miopenInitConvolutionDescriptor(desc,
+                                        static_cast<miopenConvolutionMode_t>(v.at(0)),
+                                        v.at(1),
+                                        v.at(2),
+                                        v.at(3),
+                                        v.at(4),
+                                        v.at(5),
+                                        v.at(6));
+        return std::shared_ptr<void>(desc, [](void* p) {
+            miopenDestroyConvolutionDescriptor(static_cast<miopenConvolutionDescriptor_t>(p));
+        });
+    });
+}
+
+miopenPoolingDescriptor_t ReplayDriver::Args::Pooling(const std::string& name)
+{
+    return Descriptor<miopenPoolingDescriptor_t>(name, [&] {
+        const auto& v = Get(name, miopen::capture::Kind::Pooling).ints;
+        // The public API only sets 2-D pooling with the default padding mode.
+        if(v.at(2) != 2)
+            throw std::runtime_error("only 2-D pooling can be replayed");
+        miopenPoolingDescriptor_t desc;
+        miopenCreatePoolingDescriptor(&desc);
+        miopenSet2dPoolingDescriptor(desc,
+                                     static_cast<miopenPoolingMode_t>(v[0]),
+                                     v.at(3),
+                                     v.at(4),
+                                     v.at(5),
+                                     v.at(6),
+                                     v.at(7),
+                                     v.at(8));
+        return std::shared_ptr<void>(desc, [](void* p) {
+            miopenDestroyPoolingDescriptor(static_cast<miopenPoolingDescriptor_t>(p));
+        });
+    });
+}
+
+miopenLRNDescriptor_t ReplayDriver::Args::LRN(const std::string& name)
+{
+    return Descriptor<miopenLRNDescriptor_t>(name, [&] {
+        const auto& arg = Get(name, miopen::capture::Kind::LRN);
+        miopenLRNDescriptor_t desc;
+        miopenCreateLRNDescriptor(&desc);
+        miopenSetLRNDescriptor(desc,
+                               static_cast<miopenLRNMode_t>(arg.ints.at(0)),
+                               arg.ints.at(1),
+                               arg.floats.at(0),
+                               arg.floats.at(1),
+                               arg.floats.at(2));
+        return std::shared_ptr<void>(desc, [](void* p) {
+            miopenDestroyLRNDescriptor(static_cast<miopenLRNDescriptor_t>(p));
+        });
+    });
+}
+
+miopenActivationDescriptor_t ReplayDriver::Args::Activation(const std::string& name)
+{
+    return Descriptor<miopenActivationDescriptor_t>(name, [&] {
+        const auto& arg = Get(name, miopen::capture::Kind::Activation);
+        miopenActivationDescriptor_t desc;
+        miopenCreateActivationDescriptor(&desc);
+        miopenSetActivationDescriptor(desc,
+                                      static_cast<miopenActivationMode_t>(arg.ints.at(0)),
+                                      arg.floats.at(0),
+                                      arg.floats.at(1),
+                                      arg.floats.at(2));
+        return std::shared_ptr<void>(desc, [](void* p) {
+            miopenDestroyActivationDescriptor(static_cast<miopenActivationDescriptor_t>(p));
+        });
+    });
+}
+
+void* ReplayDriver::Args::Buffer(const std::string& name, std::size_t min_size)
+{
+    const auto arg = call.Find(name);
+    if(arg == nullptr || arg->kind == miopen::capture::Kind::Null)
+        return nullptr;
+    if(arg->kind != miopen::capture::Kind::Buffer)
+        throw std::runtime_error("argument " + name + " is not a buffer");
+    const auto size = std::max(static_cast<std::size_t>(arg->ints.at(1)), min_size);
+    return driver.GetBuffer(arg->ints.at(0), size);
+}
+
+float* ReplayDriver::Args::Scalar(const std::string& name, float default_value)
+{
+    auto inserted = scalars.emplace(name, default_value);
+    if(inserted.second)
+    {
+        const auto arg = call.Find(name);
+        if(arg != nullptr && arg->kind == miopen::capture::Kind::Float)
+            inserted.first->second = static_cast<float>(arg->floats.at(0));
+    }
+    return &inserted.first->second;
+}
+
+std::int64_t ReplayDriver::Args::Int(const std::string& name)
+{
+    return Get(name, miopen::capture::Kind::Int).ints.at(0);
+}
+
+const std::map<std::string, ReplayDriver::Function>& ReplayDriver::Functions()
+{
+    static const std::map<std::string, Function> functions = {
+        {"miopenConvolutionForwardGetWorkSpaceSize",
+         [](Args& a) {
+             return miopenConvolutionForwardGetWorkSpaceSize(a.Handle(),
+                                                             a.Tensor("wDesc"),
+                                                             a.Tensor("xDesc"),
+                                                             a.Convolution("convDesc"),
+                                                             a.Tensor("yDesc"),
+                                                             a.Output<size_t>());
+         }},
+        {"miopenFindConvolutionForwardAlgorithm",
+         [](Args& a) {
+             const auto n = a.Int("requestAlgoCount");
+             return miopenFindConvolutionForwardAlgorithm(
+                 a.Handle(),
+                 a.Tensor("xDesc"),
+                 a.Buffer("x"),
+                 a.Tensor("wDesc"),
+                 a.Buffer("w"),
+                 a.Convolution("convDesc"),
+                 a.Tensor("yDesc"),
+                 a.Buffer("y"),
+                 n,
+                 a.Output<int>(),
+                 a.Output<miopenConvAlgoPerf_t>(n),
+                 a.Buffer("workSpace", a.Int("workSpaceSize")),
+                 a.Int("workSpaceSize"),
+                 a.Int("exhaustiveSearch") != 0);
+         }},
+        {"miopenConvolutionForwardGetImmediateAlgorithm",
+         [](Args& a) {
+             return miopenConvolutionForwardGetImmediateAlgorithm(
+                 a.Handle(),
+                 a.Tensor("wDesc"),
+                 a.Tensor("xDesc"),
+                 a.Convolution("convDesc"),
+                 a.Tensor("yDesc"),
+                 a.Int("workSpaceSize"),
+                 a.Output<miopenConvFwdAlgorithm_t>());
+         }},
+        {"miopenConvolutionForward",
+         [](Args& a) {
+             return miopenConvolutionForward(
+                 a.Handle(),
+                 a.Scalar("alpha", 1),
+                 a.Tensor("xDesc"),
+                 a.Buffer("x"),
+                 a.Tensor("wDesc"),
+                 a.Buffer("w"),
+                 a.Convolution("convDesc"),
+                 static_cast<miopenConvFwdAlgorithm_t>(a.Int("algo")),
+                 a.Scalar("beta", 0),
+                 a.Tensor("yDesc"),
+                 a.Buffer("y"),
+                 a.Buffer("workSpace", a.Int("workSpaceSize")),
+                 a.Int("workSpaceSize"));
+         }},
+        {"miopenConvolutionForwardBias",
+         [](Args& a) {
+             return miopenConvolutionForwardBias(a.Handle(),
+                                                 a.Scalar("alpha", 1),
+                                                 a.Tensor("bDesc"),
+                                                 a.Buffer("b"),
+                                                 a.Scalar("beta", 0),
+                                                 a.Tensor("yDesc"),
+                                                 a.Buffer("y"));
+         }},
+        {"miopenConvolutionBackwardDataGetWorkSpaceSize",
+         [](Args& a) {
+             return miopenConvolutionBackwardDataGetWorkSpaceSize(a.Handle(),
+                                                                  a.Tensor("dyDesc"),
+                                                                  a.Tensor("wDesc"),
+                                                                  a.Convolution("convDesc"),
+                                                                  a.Tensor("dxDesc"),
+                                                                  a.Output<size_t>());
+         }},
+        {"miopenFindConvolutionBackwardDataAlgorithm",
+         [](Args& a) {
+             const auto n = a.Int("requestAlgoCount");
+             return miopenFindConvolutionBackwardDataAlgorithm(
+                 a.Handle(),
+                 a.Tensor("dyDesc"),
+                 a.Buffer("dy"),
+                 a.Tensor("wDesc"),
+                 a.Buffer("w"),
+                 a.Convolution("convDesc"),
+                 a.Tensor("dxDesc"),
+                 a.Buffer("dx"),
+                 n,
+                 a.Output<int>(),
+                 a.Output<miopenConvAlgoPerf_t>(n),
+                 a.Buffer("workSpace", a.Int("workSpaceSize")),
+                 a.Int("workSpaceSize"),
+                 a.Int("exhaustiveSearch") != 0);
+         }},
+        {"miopenConvolutionBackwardDataGetImmediateAlgorithm",
+         [](Args& a) {
+             return miopenConvolutionBackwardDataGetImmediateAlgorithm(
+                 a.Handle(),
+                 a.Tensor("dyDesc"),
+                 a.Tensor("wDesc"),
+                 a.Convolution("convDesc"),
+                 a.Tensor("dxDesc"),
+                 a.Int("workSpaceSize"),
+                 a.Output<miopenConvBwdDataAlgorithm_t>());
+         }},
+        {"miopenConvolutionBackwardData",
+         [](Args& a) {
+             return miopenConvolutionBackwardData(
+                 a.Handle(),
+                 a.Scalar("alpha", 1),
+                 a.Tensor("dyDesc"),
+                 a.Buffer("dy"),
+                 a.Tensor("wDesc"),
+                 a.Buffer("w"),
+                 a.Convolution("convDesc"),
+                 static_cast<miopenConvBwdDataAlgorithm_t>(a.Int("algo")),
+                 a.Scalar("beta", 0),
+                 a.Tensor("dxDesc"),
+                 a.Buffer("dx"),
+                 a.Buffer("workSpace", a.Int("workSpaceSize")),
+                 a.Int("workSpaceSize"));
+         }},
+        {"miopenConvolutionBackwardWeightsGetWorkSpaceSize",
+         [](Args& a) {
+             return miopenConvolutionBackwardWeightsGetWorkSpaceSize(a.Handle(),
+                                                                     a.Tensor("dyDesc"),
+                                                                     a.Tensor("xDesc"),
+                                                                     a.Convolution("convDesc"),
+                                                                     a.Tensor("dwDesc"),
+                                                                     a.Output<size_t>());
+         }},
+        {"miopenFindConvolutionBackwardWeightsAlgorithm",
+         [](Args& a) {
+             const auto n = a.Int("requestAlgoCount");
+             return miopenFindConvolutionBackwardWeightsAlgorithm(
+                 a.Handle(),
+                 a.Tensor("dyDesc"),
+                 a.Buffer("dy"),
+                 a.Tensor("xDesc"),
+                 a.Buffer("x"),
+                 a.Convolution("convDesc"),
+                 a.Tensor("dwDesc"),
+                 a.Buffer("dw"),
+                 n,
+                 a.Output<int>(),
+                 a.Output<miopenConvAlgoPerf_t>(n),
+                 a.Buffer("workSpace", a.Int("workSpaceSize")),
+                 a.Int("workSpaceSize"),
+                 a.Int("exhaustiveSearch") != 0);
+         }},
+        {"miopenConvolutionBackwardWeightsGetImmediateAlgorithm",
+         [](Args& a) {
+             return miopenConvolutionBackwardWeightsGetImmediateAlgorithm(
+                 a.Handle(),
+                 a.Tensor("dyDesc"),
+                 a.Tensor("xDesc"),
+                 a.Convolution("convDesc"),
+                 a.Tensor("dwDesc"),
+                 a.Int("workSpaceSize"),
+                 a.Output<miopenConvBwdWeightsAlgorithm_t>());
+         }},
+        {"miopenConvolutionBackwardWeights",
+         [](Args& a) {
+             return miopenConvolutionBackwardWeights(
+                 a.Handle(),
+                 a.Scalar("alpha", 1),
+                 a.Tensor("dyDesc"),
+                 a.Buffer("dy"),
+                 a.Tensor("xDesc"),
+                 a.Buffer("x"),
+                 a.Convolution("convDesc"),
+                 static_cast<miopenConvBwdWeightsAlgorithm_t>(a.Int("algo")),
+                 a.Scalar("beta", 0),
+                 a.Tensor("dwDesc"),
+                 a.Buffer("dw"),
+                 a.Buffer("workSpace", a.Int("workSpaceSize")),
+                 a.Int("workSpaceSize"));
+         }},
+        {"miopenConvolutionBackwardBias",
+         [](Args& a) {
+             return miopenConvolutionBackwardBias(a.Handle(),
+                                                  a.Scalar("alpha", 1),
+                                                  a.Tensor("dyDesc"),
+                                                  a.Buffer("dy"),
+                                                  a.Scalar("beta", 0),
+                                                  a.Tensor("dbDesc"),
+                                                  a.Buffer("db"));
+         }},
+        {"miopenActivationForward",
+         [](Args& a) {
+             return miopenActivationForward(a.Handle(),
+                                            a.Activation("activDesc"),
+                                            a.Scalar("alpha", 1),
+                                            a.Tensor("xDesc"),
+                                            a.Buffer("x"),
+                                            a.Scalar("beta", 0),
+                                            a.Tensor("yDesc"),
+                                            a.Buffer("y"));
+         }},
+        {"miopenActivationBackward",
+         [](Args& a) {
+             return miopenActivationBackward(a.Handle(),
+                                             a.Activation("activDesc"),
+                                             a.Scalar("alpha", 1),
+                                             a.Tensor("yDesc"),
+                                             a.Buffer("y"),
+                                             a.Tensor("dyDesc"),
+                                             a.Buffer("dy"),
+                                             a.Tensor("xDesc"),
+                                             a.Buffer("x"),
+                                             a.Scalar("beta", 0),
+                                             a.Tensor("dxDesc"),
+                                             a.Buffer("dx"));
+         }},
+        {"miopenSoftmaxForward",
+         [](Args& a) {
+             return miopenSoftmaxForward(a.Handle(),
+                                         a.Scalar("alpha", 1),
+                                         a.Tensor("xDesc"),
+                                         a.Buffer("x"),
+                                         a.Scalar("beta", 0),
+                                         a.Tensor("yDesc"),
+                                         a.Buffer("y"));
+         }},
+        {"miopenSoftmaxBackward",
+         [](Args& a) {
+             return miopenSoftmaxBackward(a.Handle(),
+                                          a.Scalar("alpha", 1),
+                                          a.Tensor("yDesc"),
+                                          a.Buffer("y"),
+                                          a.Tensor("dyDesc"),
+                                          a.Buffer("dy"),
+                                          a.Scalar("beta", 0),
+                                          a.Tensor("dxDesc"),
+                                          a.Buffer("dx"));
+         }},
+        {"miopenPoolingForward",
+         [](Args& a) {
+             return miopenPoolingForward(a.Handle(),
+                                         a.Pooling("poolDesc"),
+                                         a.Scalar("alpha", 1),
+                                         a.Tensor("xDesc"),
+                                         a.Buffer("x"),
+                                         a.Scalar("beta", 0),
+                                         a.Tensor("yDesc"),
+                                         a.Buffer("y"),
+                                         a.Int("do_backward") != 0,
+                                         a.Buffer("workSpace", a.Int("workSpaceSize")),
+                                         a.Int("workSpaceSize"));
+         }},
+        {"miopenPoolingBackward",
+         [](Args& a) {
+             size_t workspace_size = 0;
+             miopenPoolingGetWorkSpaceSize(a.Tensor("yDesc"), &workspace_size);
+             return miopenPoolingBackward(a.Handle(),
+                                          a.Pooling("poolDesc"),
+                                          a.Scalar("alpha", 1),
+                                          a.Tensor("yDesc"),
+                                          a.Buffer("y"),
+                                          a.Tensor("dyDesc"),
+                                          a.Buffer("dy"),
+                                          a.Tensor("xDesc"),
+                                          a.Buffer("x"),
+                                          a.Scalar("beta", 0),
+                                          a.Tensor("dxDesc"),
+                                          a.Buffer("dx"),
+                                          a.Buffer("workSpace", workspace_size));
+         }},
+        {"miopenLRNForward",
+         [](Args& a) {
+             size_t workspace_size = 0;
+             miopenLRNGetWorkSpaceSize(a.Tensor("yDesc"), &workspace_size);
+             return miopenLRNForward(a.Handle(),
+                                     a.LRN("lrnDesc"),
+                                     a.Scalar("alpha", 1),
+                                     a.Tensor("xDesc"),
+                                     a.Buffer("x"),
+                                     a.Scalar("beta", 0),
+                                     a.Tensor("yDesc"),
+                                     a.Buffer("y"),
+                                     a.Int("do_backward") != 0,
+                                     a.Buffer("workSpace", workspace_size));
+         }},
+        {"miopenLRNBackward",
+         [](Args& a) {
+             size_t workspace_size = 0;
+             miopenLRNGetWorkSpaceSize(a.Tensor("yDesc"), &workspace_size);
+             return miopenLRNBackward(a.Handle(),
+                                      a.LRN("lrnDesc"),
+                                      a.Scalar("alpha", 1),
+                                      a.Tensor("yDesc"),
+                                      a.Buffer("y"),
+                                      a.Tensor("dyDesc"),
+                                      a.Buffer("dy"),
+                                      a.Tensor("xDesc"),
+                                      a.Buffer("x"),
+                                      a.Scalar("beta", 0),
+                                      a.Tensor("dxDesc"),
+                                      a.Buffer("dx"),
+                                      a.Buffer("workSpace", workspace_size));
+         }},
+        {"miopenBatchNormalizationForwardInference",
+         [](Args& a) {
+             return miopenBatchNormalizationForwardInference(
+                 a.Handle(),
+                 static_cast<miopenBatchNormMode_t>(a.Int("bn_mode")),
+                 a.Scalar("alpha", 1),
+                 a.Scalar("beta", 0),
+                 a.Tensor("xDesc"),
+                 a.Buffer("x"),
+                 a.Tensor("yDesc"),
+                 a.Buffer("y"),
+                 a.Tensor("bnScaleBiasMeanVarDesc"),
+                 a.Buffer("bnScale"),
+                 a.Buffer("bnBias"),
+                 a.Buffer("estimatedMean"),
+                 a.Buffer("estimatedVariance"),
+                 *a.Scalar("epsilon", 1e-5f));
+         }},
+        {"miopenBatchNormalizationForwardTraining",
+         [](Args& a) {
+             return miopenBatchNormalizationForwardTraining(
+                 a.Handle(),
+                 static_cast<miopenBatchNormMode_t>(a.Int("bn_mode")),
+                 a.Scalar("alpha", 1),
+                 a.Scalar("beta", 0),
+                 a.Tensor("xDesc"),
+                 a.Buffer("x"),
+                 a.Tensor("yDesc"),
+                 a.Buffer("y"),
+                 a.Tensor("bnScaleBiasMeanVarDesc"),
+                 a.Buffer("bnScale"),
+                 a.Buffer("bnBias"),
+                 *a.Scalar("expAvgFactor", 1),
+                 a.Buffer("resultRunningMean"),
+                 a.Buffer("resultRunningVariance"),
+                 *a.Scalar("epsilon", 1e-5f),
+                 a.Buffer("resultSaveMean"),
+                 a.Buffer("resultSaveInvVariance"));
+         }},
+        {"miopenBatchNormalizationBackward",
+         [](Args& a) {
+             return miopenBatchNormalizationBackward(
+                 a.Handle(),
+                 static_cast<miopenBatchNormMode_t>(a.Int("bn_mode")),
+                 a.Scalar("alphaDataDiff", 1),
+                 a.Scalar("betaDataDiff", 0),
+                 a.Scalar("alphaParamDiff", 1),
+                 a.Scalar("betaParamDiff", 0),
+                 a.Tensor("xDesc"),
+                 a.Buffer("x"),
+                 a.Tensor("dyDesc"),
+                 a.Buffer("dy"),
+                 a.Tensor("dxDesc"),
+                 a.Buffer("dx"),
+                 a.Tensor("bnScaleBiasDiffDesc"),
+                 a.Buffer("bnScale"),
+                 a.Buffer("resultBnScaleDiff"),
+                 a.Buffer("resultBnBiasDiff"),
+                 *a.Scalar("epsilon", 1e-5f),
+                 a.Buffer("savedMean"),
+                 a.Buffer("savedInvVariance"));
+         }},
+        {"miopenOpTensor",
+         [](Args& a) {
+             return miopenOpTensor(a.Handle(),
+                                   static_cast<miopenTensorOp_t>(a.Int("tensorOp")),
+                                   a.Scalar("alpha1", 1),
+                                   a.Tensor("aDesc"),
+                                   a.Buffer("A"),
+                                   a.Scalar("alpha2", 1),
+                                   a.Tensor("bDesc"),
+                                   a.Buffer("B"),
+                                   a.Scalar("beta", 0),
+                                   a.Tensor("cDesc"),
+                                   a.Buffer("C"));
+         }},
+        {"miopenSetTensor",
+         [](Args& a) {
+             return miopenSetTensor(
+                 a.Handle(), a.Tensor("yDesc"), a.Buffer("y"), a.Scalar("alpha", 0));
+         }},
+        {"miopenScaleTensor",
+         [](Args& a) {
+             return miopenScaleTensor(
+                 a.Handle(), a.Tensor("yDesc"), a.Buffer("y"), a.Scalar("alpha", 1));
+         }},
+    };
+    return functions;
+}
+
+#endif // GUARD_MIOPEN_REPLAY_DRIVER_HPP
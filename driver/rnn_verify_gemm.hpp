@@ -3,9 +3,12 @@
 
 #define ADNN_MM_TRANSPOSE 1
 
+#include <miopen/rnn_host.hpp>
+
 #include <cmath>
 #include <cassert>
 #include <algorithm>
+#include <vector>
 
 int sumvc(std::vector<int>& x)
 {
@@ -49,6 +52,46 @@ float dervactivfunc(float x, int actvf)
     return 1 / cosh(x) / cosh(x);
 }
 
+// The forward pass of all RNN modes on float data, by the host engine of the CPU backend. Null hx
+// and cx start from zero states.
+void RunRNNForwardHost(miopenRNNMode_t mode,
+                       std::vector<float>& in,
+                       std::vector<float>& wei,
+                       std::vector<float>& hy_host,
+                       const float* hx,
+                       float* cy_host,
+                       const float* cx,
+                       std::vector<float>& out_host,
+                       std::vector<int>& in_n,
+                       int in_h,
+                       int seqLength,
+                       bool bidirection,
+                       bool biased,
+                       int hy_d,
+                       int hy_n,
+                       int hy_h,
+                       int inputMode,
+                       std::vector<float>& rsvspace)
+{
+    const miopen::host::RNNForward rnn{mode,
+                                       bidirection ? hy_d / 2 : hy_d,
+                                       hy_h,
+                                       in_h,
+                                       bidirection,
+                                       biased,
+                                       inputMode == 1,
+                                       wei.data()};
+    rnn.Run(std::vector<int>(in_n.begin(), in_n.begin() + seqLength),
+            hy_n,
+            in.data(),
+            hx,
+            cx,
+            out_host.data(),
+            hy_host.data(),
+            cy_host,
+            rsvspace.data());
+}
+
 template <typename T>
 void RunRNNForwardGEMMCPUVerify(std::vector<T>& in,
                                 std::vector<T>& wei,     // [ input_state_weight_trans
@@ -74,454 +117,31 @@ void RunRNNForwardGEMMCPUVerify(std::vector<T>& in,
                                 std::vector<T>& rsvspace,
                                 bool hx_is_null = false)
 {
-    //    printf("FWD TRAIN CPU:\n");
-    //    printf("seqLen: %d, in_h: %d, hy_d: %d, hy_n: %d, hy_h: %d, out_h: %d\n", seqLength, in_h,
-    //    hy_d, hy_n, hy_h, out_h);
-    //    printf("dirmode: %d, hx size: %d, hy_host size: %d, reserveSpace: %d\n", bidirection ? 2 :
-    //    1, hx.size(), hy_host.size(), rsvspace.size());
-    //    printf("input size: %d\n", in.size());
-    //    printf("output size: %d\n", out_host.size());
-    int batch_n = sumvc(in_n);
-    std::vector<T> hid_state(hy_d * batch_n * hy_h, 0.);
-    std::vector<T> wk_state(hy_d * batch_n * hy_h, 0.);
-    std::vector<T> out_state(batch_n * out_h, 0.);
-
-    int numlayer = bidirection ? hy_d / 2 : hy_d;
-    int bacc, baccbi; // accumulation of batch
-    int bi = bidirection ? 2 : 1;
-
-    int in_stride  = in_h;
-    int hy_stride  = hy_h * bi;
-    int out_stride = out_h;
-    int uni_stride = hy_h;
-    int bi_stride  = hy_h * bi;
-
-    // initial input
-    std::vector<T> in_state(batch_n * in_h, 0.);
-    for(int h = 0; h < batch_n; h++)
-    {
-        for(int w = 0; w < in_h; w++)
-        {
-            in_state.at(h * in_h + w) = in.at(h * in_h + w);
-        }
-    }
-
-    // initial hidden states
-    std::vector<T> hy_state(hy_d * hy_n * hy_h, 0.);
-    std::vector<T> hx_state(hy_d * hy_n * hy_h, 0.);
-    for(int h = 0; h < hy_d * hy_n * hy_h; h++)
-    {
-        hx_state.at(h) = hx.at(h);
-    }
-
-    if(inputMode == 1)
-    {
-        if(in_h != hy_h)
-        {
-            printf("Verification cannot be completed: The input tensor size must equal to the "
-                   "hidden state size of the network in SKIP_INPUT mode!\n");
-            return;
-        }
-        in_h = 0;
-    }
-
-    // initial weights
-    int wei_len = (bi * (in_h + hy_h) + (numlayer - 1) * bi * (bi + 1) * hy_h) * hy_h;
-    if(biased)
-    {
-        int in_bias = 2;
-        wei_len += (bi * in_bias + (numlayer - 1) * bi * 2) * hy_h;
-    }
-
-    std::vector<T> wei_state(wei_len, 0.);
-    for(int h = 0; h < wei_len; h++)
-    {
-        wei_state.at(h) = wei[h];
-    }
-
-    int wei_shift_bias = ((in_h + hy_h) * bi + (bi * hy_h + hy_h) * bi * (numlayer - 1)) * hy_h;
-
-    // forward emulator
-    for(int li = 0; li < numlayer; li++)
-    {
-        int hid_shift = li * batch_n * hy_h * bi;
-        int hx_shift  = li * bi * in_n.at(0) * hy_h;
-
-        // from input
-        if(li == 0)
-        {
-            if(inputMode == 1)
-            {
-                for(int bs = 0; bs < batch_n; bs++)
-                {
-                    for(int h = 0; h < hy_h; h++)
-                    {
-                        hid_state.at(hid_shift + bs * hy_stride + h) +=
-                            in_state.at(bs * in_stride + h);
-                        if(bidirection)
-                        {
-                            hid_state.at(hid_shift + bs * hy_stride + hy_h + h) +=
-                                in_state.at(bs * in_stride + h);
-                        }
-                    }
-                }
-
-                // from bias
-                if(biased)
-                {
-                    for(int bs = 0; bs < batch_n; bs++)
-                    {
-                        for(int h = 0; h < hy_stride; h++)
-                        {
-                            hid_state.at(hid_shift + bs * hy_stride + h) +=
-                                wei.at(wei_shift_bias + h);
-                        }
-                    }
-                }
-            }
-            else
-            {
-                ADNN_mm_cpu<T>(in_state.data(),
-                               in_h,
-                               batch_n,
-                               in_stride,
-                               0,
-                               wei_state.data(),
-                               in_h,
-                               hy_h * bi,
-                               in_stride,
-                               ADNN_MM_TRANSPOSE,
-                               &hid_state[hid_shift],
-                               hy_h * bi,
-                               batch_n,
-                               hy_stride,
-                               0,
-                               1,
-                               1);
-
-                // from bias
-                if(biased)
-                {
-                    for(int bs = 0; bs < batch_n; bs++)
-                    {
-                        for(int h = 0; h < hy_stride; h++)
-                        {
-                            hid_state.at(hid_shift + bs * hy_stride + h) +=
-                                wei.at(wei_shift_bias + h);
-                        }
-                    }
-                }
-            }
-        }
-        else
-        {
-            int wei_shift = bi * (in_h + hy_h) * hy_h + (li - 1) * bi * (bi * hy_h + hy_h) * hy_h;
-            int prelayer_shift = (li - 1) * batch_n * hy_h * bi;
-
-            ADNN_mm_cpu<T>(&wk_state[prelayer_shift],
-                           hy_h * bi,
-                           batch_n,
-                           hy_stride,
-                           0,
-                           &wei_state[wei_shift],
-                           hy_h * bi,
-                           hy_h * bi,
-                           bi_stride,
-                           ADNN_MM_TRANSPOSE,
-                           &hid_state[hid_shift],
-                           hy_h * bi,
-                           batch_n,
-                           hy_stride,
-                           0,
-                           1,
-                           1);
-
-            // from bias
-            if(biased)
-            {
-                int wei_shift_bias_temp = wei_shift_bias + bi * li * 2 * hy_h;
-
-                for(int bs = 0; bs < batch_n; bs++)
-                {
-                    for(int h = 0; h < hy_stride; h++)
-                    {
-                        hid_state.at(hid_shift + bs * hy_stride + h) +=
-                            wei.at(wei_shift_bias_temp + h);
-                    }
-                }
-            }
-        }
-
-        // from hidden state
-        bacc   = 0;
-        baccbi = batch_n;
-        for(int ti = 0; ti < seqLength; ti++)
-        {
-            baccbi -= in_n.at(seqLength - 1 - ti);
-
-            int wei_shift =
-                li == 0 ? (in_h * hy_h * bi)
-                        : (bi * (in_h + hy_h) * hy_h + (li - 1) * bi * (bi * hy_h + hy_h) * hy_h +
-                           bi * hy_h * hy_stride);
-
-            if(ti == 0)
-            {
-                if(!hx_is_null)
-                {
-                    ADNN_mm_cpu<T>(&hx_state[hx_shift],
-                                   hy_h,
-                                   in_n[ti],
-                                   uni_stride,
-                                   0,
-                                   &wei_state[wei_shift],
-                                   hy_h,
-                                   hy_h,
-                                   uni_stride,
-                                   ADNN_MM_TRANSPOSE,
-                                   &hid_state[hid_shift + bacc * hy_stride],
-                                   hy_h,
-                                   in_n[ti],
-                                   hy_stride,
-                                   0,
-                                   1,
-                                   1);
-
-                    // from bias
-                    if(biased)
-                    {
-                        int wei_shift_bias_temp = wei_shift_bias + bi * (li * 2 + 1) * hy_h;
-
-                        for(int bs = 0; bs < in_n[ti]; bs++)
-                        {
-                            for(int h = 0; h < hy_h; h++)
-                            {
-                                hid_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h) +=
-                                    wei.at(wei_shift_bias_temp + h);
-                            }
-                        }
-                    }
-
-                    if(bidirection)
-                    {
-                        ADNN_mm_cpu<T>(&hx_state[hx_shift + hy_n * hy_h],
-                                       hy_h,
-                                       in_n[seqLength - 1 - ti],
-                                       uni_stride,
-                                       0,
-                                       &wei_state[wei_shift + hy_h * uni_stride],
-                                       hy_h,
-                                       hy_h,
-                                       uni_stride,
-                                       ADNN_MM_TRANSPOSE,
-                                       &hid_state[hid_shift + baccbi * hy_stride + hy_h],
-                                       hy_h,
-                                       in_n[seqLength - 1 - ti],
-                                       hy_stride,
-                                       0,
-                                       1,
-                                       1);
-
-                        // from bias
-                        if(biased)
-                        {
-                            int wei_shift_bias_temp = wei_shift_bias + bi * (li * 2 + 1) * hy_h;
-
-                            for(int bs = 0; bs < in_n.at(seqLength - 1 - ti); bs++)
-                            {
-                                for(int h = 0; h < hy_h; h++)
-                                {
-                                    hid_state.at(hid_shift + baccbi * hy_stride + hy_h +
-                                                 bs * hy_stride + h) +=
-                                        wei.at(wei_shift_bias_temp + hy_h + h);
-                                }
-                            }
-                        }
-                    }
-                }
-            }
-            else
-            {
-                ADNN_mm_cpu<T>(&hy_state[hx_shift],
-                               hy_h,
-                               in_n[ti],
-                               uni_stride,
-                               0,
-                               &wei_state[wei_shift],
-                               hy_h,
-                               hy_h,
-                               uni_stride,
-                               ADNN_MM_TRANSPOSE,
-                               &hid_state[hid_shift + bacc * hy_stride],
-                               hy_h,
-                               in_n[ti],
-                               hy_stride,
-                               0,
-                               1,
-                               1);
-
-                // from bias
-                if(biased)
-                {
-                    int wei_shift_bias_temp = wei_shift_bias + bi * (li * 2 + 1) * hy_h;
-
-                    for(int bs = 0; bs < in_n[ti]; bs++)
-                    {
-                        for(int h = 0; h < hy_h; h++)
-                        {
-                            hid_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h) +=
-                                wei.at(wei_shift_bias_temp + h);
-                        }
-                    }
-                }
-
-                if(bidirection)
-                {
-
-                    if(!hx_is_null && in_n.at(seqLength - 1 - ti) > in_n.at(seqLength - ti))
-                    {
-                        ADNN_mm_cpu<T>(
-                            &hx_state[hx_shift + hy_n * hy_h + in_n.at(seqLength - ti) * hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            uni_stride,
-                            0,
-                            &wei_state[wei_shift + hy_h * uni_stride],
-                            hy_h,
-                            hy_h,
-                            uni_stride,
-                            ADNN_MM_TRANSPOSE,
-                            &hid_state[hid_shift + (baccbi + in_n.at(seqLength - ti)) * hy_stride +
-                                       hy_h],
-                            hy_h,
-                            (in_n.at(seqLength - 1 - ti) - in_n.at(seqLength - ti)),
-                            hy_stride,
-                            0,
-                            1,
-                            1);
-
-                        // from bias
-                        if(biased)
-                        {
-                            int wei_shift_bias_temp = wei_shift_bias + bi * (li * 2 + 1) * hy_h;
-
-                            for(int bs = in_n.at(seqLength - ti); bs < in_n.at(seqLength - 1 - ti);
-                                bs++)
-                            {
-                                for(int h = 0; h < hy_h; h++)
-                                {
-                                    hid_state.at(hid_shift + baccbi * hy_stride + hy_h +
-                                                 bs * hy_stride + h) +=
-                                        wei.at(wei_shift_bias_temp + hy_h + h);
-                                }
-                            }
-                        }
-                    }
-
-                    ADNN_mm_cpu<T>(&hy_state[hx_shift + hy_n * hy_h],
-                                   hy_h,
-                                   in_n[seqLength - ti],
-                                   uni_stride,
-                                   0,
-                                   &wei_state[wei_shift + hy_h * uni_stride],
-                                   hy_h,
-                                   hy_h,
-                                   uni_stride,
-                                   ADNN_MM_TRANSPOSE,
-                                   &hid_state[hid_shift + baccbi * hy_stride + hy_h],
-                                   hy_h,
-                                   in_n[seqLength - ti],
-                                   hy_stride,
-                                   0,
-                                   1,
-                                   1);
-
-                    // from bias
-                    if(biased)
-                    {
-                        int wei_shift_bias_temp = wei_shift_bias + bi * (li * 2 + 1) * hy_h;
-
-                        for(int bs = 0; bs < in_n.at(seqLength - ti); bs++)
-                        {
-                            for(int h = 0; h < hy_h; h++)
-                            {
-                                hid_state.at(hid_shift + baccbi * hy_stride + hy_h +
-                                             bs * hy_stride + h) +=
-                                    wei.at(wei_shift_bias_temp + hy_h + h);
-                            }
-                        }
-                    }
-                }
-            }
-
-            for(int bs = 0; bs < in_n[ti]; bs++)
-            {
-                for(int h = 0; h < hy_h; h++)
-                {
-                    wk_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h) =
-                        activfunc(hid_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h),
-                                  squash); // squash_func
-                    hy_state.at(hx_shift + bs * uni_stride + h) =
-                        wk_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h);
-
-                    rsvspace.at(hid_shift + bacc * hy_stride + bs * hy_stride + h) =
-                        hid_state.at(hid_shift + bacc * hy_stride + bs * hy_stride + h);
-
-                    rsvspace.at(hid_shift + bacc * hy_stride + bs * hy_stride + h +
-                                numlayer * batch_n * hy_h * bi) =
-                        activfunc(hid_state[hid_shift + bacc * hy_stride + bs * hy_stride + h],
-                                  squash);
-
-                    hy_host.at(hx_shift + bs * uni_stride + h) =
-                        hy_state.at(hx_shift + bs * uni_stride + h);
-                }
-            }
-
-            if(bidirection)
-            {
-                for(int bs = 0; bs < in_n.at(seqLength - 1 - ti); bs++)
-                {
-                    for(int h = 0; h < hy_h; h++)
-                    {
-                        wk_state.at(hid_shift + baccbi * hy_stride + hy_h + bs * hy_stride + h) =
-                            activfunc(hid_state[hid_shift + baccbi * hy_stride + hy_h +
-                                                bs * hy_stride + h],
-                                      squash); // squash_func
-
-                        hy_state.at(hx_shift + hy_n * hy_h + bs * uni_stride + h) =
-                            wk_state.at(hid_shift + baccbi * hy_stride + hy_h + bs * hy_stride + h);
-
-                        rsvspace.at(hid_shift + baccbi * hy_stride + hy_h + bs * hy_stride + h) =
-                            hid_state.at(hid_shift + baccbi * hy_stride + hy_h + bs * hy_stride +
-                                         h);
-
-                        rsvspace.at(hid_shift + baccbi * hy_stride + hy_h + bs * hy_stride + h +
-                                    numlayer * batch_n * hy_h * bi) =
-                            activfunc(hid_state[hid_shift + baccbi * hy_stride + hy_h +
-                                                bs * hy_stride + h],
-                                      squash);
-
-                        hy_host.at(hx_shift + hy_n * hy_h + bs * uni_stride + h) =
-                            hy_state.at(hx_shift + hy_n * hy_h + bs * uni_stride + h);
-                    }
-                }
-            }
-
-            bacc += in_n.at(ti);
-        }
-    }
-
-    // output
-    int prelayer_shift = (numlayer - 1) * batch_n * hy_h * bi;
-
-    for(int bs = 0; bs < batch_n; bs++)
+    if(inputMode == 1 && in_h != hy_h)
     {
-        for(int h = 0; h < out_h; h++)
-        {
-            assert(!std::isnan(wk_state.at(prelayer_shift + bs * hy_stride + h)));
-            out_host.at(bs * out_stride + h) = wk_state.at(prelayer_shift + bs * hy_stride + h);
-            // printf("out_host[%d]: %f\n", bs * out_stride + h, out_host.at(bs * out_stride + h));
-        }
+        printf("Verification cannot be completed: The input tensor size must equal to the "
+               "hidden state size of the network in SKIP_INPUT mode!\n");
+        return;
     }
+    (void)out_h;
+    RunRNNForwardHost(squash == 0 ? miopenRNNRELU : miopenRNNTANH,
+                      in,
+                      wei,
+                      hy_host,
+                      hx_is_null ? nullptr : hx.data(),
+                      nullptr,
+                      nullptr,
+                      out_host,
+                      in_n,
+                      in_h,
+                      seqLength,
+                      bidirection,
+                      biased,
+                      hy_d,
+                      hy_n,
+                      hy_h,
+                      inputMode,
+                      rsvspace);
 }
 
 template <typename T>
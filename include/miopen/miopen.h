@@ -75,6 +75,9 @@ extern "C" {
 typedef cl_command_queue miopenAcceleratorQueue_t;
 #elif MIOPEN_BACKEND_HIP
 typedef hipStream_t miopenAcceleratorQueue_t;
+#elif MIOPEN_BACKEND_CPU
+/*! Kernels run on the calling thread, the queue is only carried around by the handle */
+typedef void* miopenAcceleratorQueue_t;
 #endif
 
 /*! @ingroup handle
@@ -182,6 +185,19 @@ MIOPEN_EXPORT miopenStatus_t miopenSetStream(miopenHandle_t handle,
 MIOPEN_EXPORT miopenStatus_t miopenGetStream(miopenHandle_t handle,
                                              miopenAcceleratorQueue_t* streamID);
 
+/*! @brief Set accelerator command queue for the calling thread
+ *
+ * A handle may be used from several host threads at once. By default, all of them
+ * enqueue work to the command queue of the handle. This function sets a command queue
+ * used only by the calling thread; miopenGetStream() returns it for that thread.
+ * Kernel time (see miopenGetKernelTime) is accumulated per thread as well.
+ * @param handle     MIOpen handle (input)
+ * @param streamID   An accelerator queue type, or nullptr to use the queue of the handle (input)
+ * @return           miopenStatus_t
+*/
+MIOPEN_EXPORT miopenStatus_t miopenSetThreadStream(miopenHandle_t handle,
+                                                   miopenAcceleratorQueue_t streamID);
+
 /*! @brief Set allocator for previously created miopenHandle
  *
  * Set a command queue for an accelerator device
@@ -203,6 +219,27 @@ MIOPEN_EXPORT miopenStatus_t miopenSetAllocator(miopenHandle_t handle,
                                                 miopenDeallocatorFunction deallocator,
                                                 void* allocatorContext);
 
+/*! @brief Set the size of the buffer cache of a handle
+ *
+ * Buffers which MIOpen allocates internally (workspaces and temporaries) are cached
+ * for reuse instead of being freed. The cache sits on top of the allocator set by
+ * miopenSetAllocator() and keeps at most \p limit bytes allocated from it.
+ * The default limit is taken from the MIOPEN_ALLOCATOR_POOL_LIMIT environment
+ * variable (in megabytes) and is 0, which disables caching, if it is not set.
+ *
+ * @param handle     MIOpen handle (input)
+ * @param limit      Maximum number of bytes held by the cache (input)
+ * @return           miopenStatus_t
+*/
+MIOPEN_EXPORT miopenStatus_t miopenSetAllocatorPoolLimit(miopenHandle_t handle, size_t limit);
+
+/*! @brief Free all the buffers cached by a handle
+ *
+ * @param handle     MIOpen handle (input)
+ * @return           miopenStatus_t
+*/
+MIOPEN_EXPORT miopenStatus_t miopenTrimAllocatorPool(miopenHandle_t handle);
+
 /*! @brief Get time for last kernel launched
  *
  * This function is used only when profiling mode has been enabled.
@@ -686,6 +723,12 @@ typedef struct
  * executing convolution layer functions. The maximum size of the memory needed from the set
  * of potential forward convolution algorithms is returned.
  *
+ * For miopenConvolutionFwdAlgoGEMM the size returned covers one image at a time. The algorithm
+ * only batches several images into one GEMM when it is given a larger workspace: a chunk of
+ * B > 1 images needs (C*R*S + K) * H_out * W_out * B elements of the data type, for C input
+ * channels, K output channels and R x S filters. Find and the convolution itself use the
+ * largest chunk that fits into the workspace they are passed.
+ *
  * @param handle         MIOpen handle (input)
  * @param wDesc          Tensor descriptor for weight tensor w (input)
  * @param xDesc          Tensor descriptor for input data tensor x (input)
@@ -754,6 +797,31 @@ miopenFindConvolutionForwardAlgorithm(miopenHandle_t handle,
                                       size_t workSpaceSize,
                                       bool exhaustiveSearch);
 
+/*! @brief Select a forward convolution algorithm without running Find (immediate mode)
+ *
+ * Returns the fastest algorithm recorded in the find-db for the configuration. If there
+ * is no record, the algorithm is chosen heuristically among the applicable ones which fit
+ * into workSpaceSize. No kernels are built; miopenConvolutionForward() builds the kernels
+ * of the algorithm when it is executed for the first time.
+ *
+ * @param handle         MIOpen handle (input)
+ * @param wDesc          Tensor descriptor for weight tensor w (input)
+ * @param xDesc          Tensor descriptor for input data tensor x (input)
+ * @param convDesc       Convolution layer descriptor (input)
+ * @param yDesc          Tensor descriptor for output data tensor y (input)
+ * @param workSpaceSize  Size in bytes of the workspace available for the execution (input)
+ * @param algo           Pointer to the selected algorithm (output)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenConvolutionForwardGetImmediateAlgorithm(miopenHandle_t handle,
+                                              const miopenTensorDescriptor_t wDesc,
+                                              const miopenTensorDescriptor_t xDesc,
+                                              const miopenConvolutionDescriptor_t convDesc,
+                                              const miopenTensorDescriptor_t yDesc,
+                                              size_t workSpaceSize,
+                                              miopenConvFwdAlgorithm_t* algo);
+
 /*! @brief Execute a forward convolution layer
  *
  * Runs the forward convolution layer based on the selected algorithm. The functions
@@ -761,6 +829,10 @@ miopenFindConvolutionForwardAlgorithm(miopenHandle_t handle,
  * been executed previously to determine the required memory needed for the workspace and the
  * best convolutional algorithm, respectively.
  *
+ * Alternatively the algorithm can be taken from
+ * miopenConvolutionForwardGetImmediateAlgorithm() without running Find (immediate mode). Then
+ * the kernels of the algorithm are built during the first call for the given configuration.
+ *
  * @param handle         MIOpen handle (input)
  * @param alpha          Floating point scaling factor, allocated on the host (input)
  * @param xDesc          Tensor descriptor for data input tensor x (input)
@@ -887,6 +959,28 @@ miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
                                            size_t workSpaceSize,
                                            bool exhaustiveSearch);
 
+/*! @brief Select a backward data convolution algorithm without running Find (immediate mode)
+ *
+ * See miopenConvolutionForwardGetImmediateAlgorithm().
+ *
+ * @param handle         MIOpen handle (input)
+ * @param dyDesc         Tensor descriptor for data input tensor dy (input)
+ * @param wDesc          Tensor descriptor for weight tensor w (input)
+ * @param convDesc       Convolution layer descriptor (input)
+ * @param dxDesc         Tensor descriptor for output data tensor dx (input)
+ * @param workSpaceSize  Size in bytes of the workspace available for the execution (input)
+ * @param algo           Pointer to the selected algorithm (output)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenConvolutionBackwardDataGetImmediateAlgorithm(miopenHandle_t handle,
+                                                   const miopenTensorDescriptor_t dyDesc,
+                                                   const miopenTensorDescriptor_t wDesc,
+                                                   const miopenConvolutionDescriptor_t convDesc,
+                                                   const miopenTensorDescriptor_t dxDesc,
+                                                   size_t workSpaceSize,
+                                                   miopenConvBwdDataAlgorithm_t* algo);
+
 /*! @brief Execute a backward data convolution layer
  *
  * Runs the backward data convolution layer based on the selected algorithm. The function
@@ -894,6 +988,9 @@ miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
  * must have been executed previously to determine the required memory needed for the workspace and
  * the best convolutional algorithm, respectively.
  *
+ * Alternatively the algorithm can be taken from
+ * miopenConvolutionBackwardDataGetImmediateAlgorithm() without running Find (immediate mode).
+ *
  * @param handle         MIOpen handle (input)
  * @param alpha          Floating point scaling factor, allocated on the host (input)
  * @param dyDesc         Tensor descriptor for data input tensor dy (input)
@@ -932,6 +1029,12 @@ miopenConvolutionBackwardData(miopenHandle_t handle,
  * convolution layer functions. The maximum size of the memory needed from the set of potential
  * forward convolution algorithms is returned.
  *
+ * For miopenConvolutionBwdWeightsAlgoGEMM the size returned covers one image at a time. The
+ * algorithm only batches several images into one GEMM when it is given a larger workspace: a
+ * chunk of B > 1 images needs (C*R*S + K) * H_out * W_out * B elements of the data type, for C
+ * input channels, K output channels and R x S filters. Find and the convolution itself use the
+ * largest chunk that fits into the workspace they are passed.
+ *
  * @param handle         MIOpen handle (input)
  * @param dyDesc         Tensor descriptor for data input tensor dy (input)
  * @param xDesc          Tensor descriptor for data tensor x (input)
@@ -1000,6 +1103,28 @@ miopenFindConvolutionBackwardWeightsAlgorithm(miopenHandle_t handle,
                                               size_t workSpaceSize,
                                               bool exhaustiveSearch);
 
+/*! @brief Select a backward weights convolution algorithm without running Find (immediate mode)
+ *
+ * See miopenConvolutionForwardGetImmediateAlgorithm().
+ *
+ * @param handle         MIOpen handle (input)
+ * @param dyDesc         Tensor descriptor for data tensor dy (input)
+ * @param xDesc          Tensor descriptor for data tensor x (input)
+ * @param convDesc       Convolution layer descriptor (input)
+ * @param dwDesc         Tensor descriptor for weight tensor dw (input)
+ * @param workSpaceSize  Size in bytes of the workspace available for the execution (input)
+ * @param algo           Pointer to the selected algorithm (output)
+ * @return               miopenStatus_t
+ */
+MIOPEN_EXPORT miopenStatus_t
+miopenConvolutionBackwardWeightsGetImmediateAlgorithm(miopenHandle_t handle,
+                                                      const miopenTensorDescriptor_t dyDesc,
+                                                      const miopenTensorDescriptor_t xDesc,
+                                                      const miopenConvolutionDescriptor_t convDesc,
+                                                      const miopenTensorDescriptor_t dwDesc,
+                                                      size_t workSpaceSize,
+                                                      miopenConvBwdWeightsAlgorithm_t* algo);
+
 /*! @brief Execute a backward weights convolution layer
  *
  * Runs the backward weights convolution layer based on the selected algorithm. The function
@@ -1008,6 +1133,9 @@ miopenFindConvolutionBackwardWeightsAlgorithm(miopenHandle_t handle,
  * been executed previously to determine the required memory needed for the workspace and the
  * best convolutional algorithm, respectively.
  *
+ * Alternatively the algorithm can be taken from
+ * miopenConvolutionBackwardWeightsGetImmediateAlgorithm() without running Find (immediate mode).
+ *
  * @param handle         MIOpen handle (input)
  * @param alpha          Floating point scaling factor, allocated on the host (input)
  * @param dyDesc         Tensor descriptor for data tensor dy (input)
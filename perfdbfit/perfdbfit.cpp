@@ -0,0 +1,507 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+
+/// Offline tool which fits the default-config predictor (see miopen/perf_predictor.hpp)
+/// to the perf dbs, reports its quality on held-out records and generates
+/// src/perf_predictor_tables.cpp.
+///
+/// Usage: perfdbfit [-h[oldout] <n>] [-t[arget] <path>] -s[ource] {<perf db file>}
+
+#include <miopen/generic_search.hpp>
+#include <miopen/perf_predictor.hpp>
+#include <miopen/solver.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+struct Sample
+{
+    std::string device;
+    std::string solver;
+    std::string key;
+    miopen::PerfPredictorKey problem;
+    std::string values;
+
+    std::tuple<const std::string&, const std::string&, const std::string&> Group() const
+    {
+        return std::tie(device, solver, problem.signature);
+    }
+};
+
+std::string DeviceFromPath(const std::string& path)
+{
+    // .../gfx900_64.cd.pdb.txt -> gfx900_64
+    const auto slash = path.find_last_of("/\\");
+    const auto name  = slash == std::string::npos ? path : path.substr(slash + 1);
+    return name.substr(0, name.find('.'));
+}
+
+void Load(const std::string& path, std::vector<Sample>& samples)
+{
+    std::ifstream file(path);
+    if(!file.good())
+    {
+        std::cerr << "File not found: " << path << std::endl;
+        std::exit(1);
+    }
+
+    const auto device = DeviceFromPath(path);
+    std::set<std::string> keys;
+    std::string line;
+    int n_line = 0;
+    while(std::getline(file, line))
+    {
+        ++n_line;
+        const auto eq = line.find('=');
+        if(line.empty() || eq == std::string::npos)
+            continue;
+
+        Sample sample;
+        sample.device = device;
+        sample.key    = line.substr(0, eq);
+        if(!miopen::ParsePerfDbKey(sample.key, sample.problem))
+        {
+            std::cerr << path << ":" << n_line << ": skipped, bad key: " << sample.key
+                      << std::endl;
+            continue;
+        }
+        // Db uses the first record if there are duplicates.
+        if(!keys.insert(sample.key).second)
+            continue;
+
+        std::istringstream contents(line.substr(eq + 1));
+        std::string pair;
+        while(std::getline(contents, pair, ';'))
+        {
+            const auto colon = pair.find(':');
+            if(colon == std::string::npos)
+                continue;
+            sample.solver = pair.substr(0, colon);
+            sample.values = pair.substr(colon + 1);
+            samples.push_back(sample);
+        }
+    }
+}
+
+/// Sorts by group. Keeps the original order within a group.
+void SortByGroup(std::vector<Sample>& samples)
+{
+    std::stable_sort(samples.begin(), samples.end(), [](const Sample& l, const Sample& r) {
+        return l.Group() < r.Group();
+    });
+}
+
+const Sample* Nearest(const std::vector<const Sample*>& prototypes, const Sample& sample)
+{
+    const Sample* nearest = nullptr;
+    auto best             = std::numeric_limits<double>::max();
+    for(const auto p : prototypes)
+    {
+        const auto d = miopen::PerfPredictorDistance(p->problem.features, sample.problem.features);
+        if(d < best)
+        {
+            best    = d;
+            nearest = p;
+        }
+    }
+    return nearest;
+}
+
+/// Hart's condensed nearest neighbour: keeps only the samples required to
+/// classify all the training samples correctly with 1-NN.
+std::vector<Sample> Fit(std::vector<Sample> samples)
+{
+    SortByGroup(samples);
+    std::vector<Sample> result;
+    auto begin = samples.begin();
+    while(begin != samples.end())
+    {
+        const auto end = std::find_if(
+            begin, samples.end(), [&](const Sample& s) { return s.Group() != begin->Group(); });
+
+        std::vector<const Sample*> prototypes{&*begin};
+        for(bool changed = true; changed;)
+        {
+            changed = false;
+            for(auto it = begin; it != end; ++it)
+            {
+                if(std::find(prototypes.begin(), prototypes.end(), &*it) == prototypes.end() &&
+                   Nearest(prototypes, *it)->values != it->values)
+                {
+                    prototypes.push_back(&*it);
+                    changed = true;
+                }
+            }
+        }
+        for(const auto p : prototypes)
+            result.push_back(*p);
+        begin = end;
+    }
+    SortByGroup(result);
+    return result;
+}
+
+std::vector<miopen::PerfPredictorRecord> ToRecords(const std::vector<Sample>& samples)
+{
+    std::vector<miopen::PerfPredictorRecord> records;
+    for(const auto& s : samples)
+    {
+        records.push_back({s.device.c_str(),
+                           s.solver.c_str(),
+                           s.problem.signature.c_str(),
+                           s.problem.features,
+                           s.values.c_str()});
+    }
+    return records;
+}
+
+/// Restores the problem config from a perf db key (see ProblemDescription::Serialize).
+miopen::ConvolutionContext ContextFromKey(const std::string& key)
+{
+    miopen::ConvolutionContext ctx;
+    std::string k = key;
+    std::replace(k.begin(), k.end(), '-', ' ');
+    std::replace(k.begin(), k.end(), 'x', ' ');
+    std::istringstream ss(k);
+    std::string dir;
+    int dilation0 = 0;
+    ss >> ctx.n_inputs >> ctx.in_height >> ctx.in_width >> ctx.kernel_size1 >> ctx.kernel_size0 >>
+        ctx.n_outputs >> ctx.out_height >> ctx.out_width >> ctx.batch_sz >> ctx.pad1 >> ctx.pad0 >>
+        ctx.kernel_stride1 >> ctx.kernel_stride0 >> ctx.kernel_dilation1 >> dilation0 >> ctx.bias >>
+        ctx.in_layout >> ctx.in_data_type >> dir;
+    ctx.kernel_dilation0 = dilation0;
+    ctx.out_layout       = ctx.in_layout;
+    ctx.out_data_type    = ctx.in_data_type;
+    ctx.float_size       = ctx.in_data_type == "FP32" ? 32 : 16;
+    ctx.use_asm_kernels  = true;
+    if(dir == "F")
+        ctx.direction.Set(1);
+    else if(dir == "B")
+        ctx.direction.Set(0);
+    else
+        ctx.direction.SetBackwardWrW();
+    return ctx;
+}
+
+struct Stats
+{
+    int n_test              = 0;
+    int n_covered           = 0; // there is a prediction
+    int n_valid             = 0; // at least one predicted config is valid for the problem
+    int n_exact             = 0; // the config used at runtime matches the tuned one
+    int n_heuristic         = 0; // GetPerformanceConfig() matches the tuned one
+    double field_hits       = 0.0;
+    int n_regret            = 0;
+    double regret_predicted = 0.0;
+    double regret_heuristic = 0.0;
+};
+
+template <class Config>
+std::string ToString(const Config& config)
+{
+    std::ostringstream ss;
+    config.Serialize(ss);
+    return ss.str();
+}
+
+double FieldHits(const std::string& lhs, const std::string& rhs)
+{
+    std::istringstream l(lhs), r(rhs);
+    std::string a, b;
+    int n = 0, hits = 0;
+    while(std::getline(l, a, ',') && std::getline(r, b, ','))
+    {
+        ++n;
+        if(a == b)
+            ++hits;
+    }
+    return n == 0 ? 0.0 : static_cast<double>(hits) / n;
+}
+
+/// Mirrors the run-time logic of FindSolutionImpl(): the first valid predicted config
+/// is used, the heuristic is the fallback. Regret is estimated by the solver's
+/// cost model (if any) relative to the tuned config, as kernel times are not in the db.
+template <class Solver>
+void Evaluate(Solver s,
+              const Sample& sample,
+              const std::vector<std::string>& predicted,
+              Stats& stats)
+{
+    using PerformanceConfig = decltype(s.GetPerformanceConfig(miopen::ConvolutionContext{}));
+    const auto ctx          = ContextFromKey(sample.key);
+
+    PerformanceConfig tuned{};
+    if(!tuned.Deserialize(sample.values))
+        return;
+
+    ++stats.n_test;
+    if(!predicted.empty())
+        ++stats.n_covered;
+
+    const auto heuristic = s.GetPerformanceConfig(ctx);
+    auto used            = heuristic;
+    for(const auto& values : predicted)
+    {
+        PerformanceConfig config{};
+        if(config.Deserialize(values) && s.IsValidPerformanceConfig(ctx, config))
+        {
+            ++stats.n_valid;
+            used = config;
+            break;
+        }
+    }
+
+    const auto used_str = ToString(used);
+    if(used_str == ToString(tuned))
+        ++stats.n_exact;
+    if(ToString(heuristic) == ToString(tuned))
+        ++stats.n_heuristic;
+    stats.field_hits += FieldHits(used_str, ToString(tuned));
+
+    const auto tuned_cost = miopen::solver::EstimateCost(s, ctx, tuned);
+    if(tuned_cost.first && tuned_cost.second > 0.0 &&
+       tuned_cost.second < std::numeric_limits<double>::max())
+    {
+        const auto used_cost      = miopen::solver::EstimateCost(s, ctx, used).second;
+        const auto heuristic_cost = miopen::solver::EstimateCost(s, ctx, heuristic).second;
+        if(used_cost < std::numeric_limits<double>::max() &&
+           heuristic_cost < std::numeric_limits<double>::max())
+        {
+            ++stats.n_regret;
+            stats.regret_predicted += std::max(0.0, used_cost / tuned_cost.second - 1.0);
+            stats.regret_heuristic += std::max(0.0, heuristic_cost / tuned_cost.second - 1.0);
+        }
+    }
+}
+
+void Evaluate(const Sample& sample, const std::vector<std::string>& predicted, Stats& stats)
+{
+    miopen::each_args(
+        [&](auto s) {
+            if(miopen::solver::SolverDbId(s) == sample.solver)
+                Evaluate(s, sample, predicted, stats);
+        },
+        miopen::solver::ConvAsm3x3U{},
+        miopen::solver::ConvAsm1x1U{},
+        miopen::solver::ConvOclDirectFwd{},
+        miopen::solver::ConvOclDirectFwd1x1{},
+        miopen::solver::ConvAsmBwdWrW3x3{},
+        miopen::solver::ConvAsmBwdWrW1x1{});
+}
+
+std::string Percent(int n, int total)
+{
+    std::ostringstream ss;
+    ss << std::fixed << std::setprecision(1) << (total == 0 ? 0.0 : 100.0 * n / total) << "%";
+    return ss.str();
+}
+
+/// Every holdout-th record of each group is used for testing, the rest for training.
+void Report(const std::vector<Sample>& samples, int holdout, std::ostream& out)
+{
+    std::vector<Sample> train, test;
+    std::map<std::string, int> group_counters;
+    for(const auto& s : samples)
+    {
+        auto& counter = group_counters[s.device + s.solver + s.problem.signature];
+        (counter++ % holdout == holdout - 1 ? test : train).push_back(s);
+    }
+
+    const auto model   = Fit(train);
+    const auto records = ToRecords(model);
+    std::map<std::string, Stats> stats;
+    for(const auto& s : test)
+    {
+        const std::size_t max_n = 3;
+        const auto predicted    = miopen::PredictPerformanceConfigs(
+            records.data(), records.size(), s.device, s.solver, s.problem, max_n);
+        Evaluate(s, predicted, stats[s.solver]);
+    }
+
+    out << "Trained on " << train.size() << " records (" << model.size()
+        << " kept), tested on " << test.size() << " held-out records." << std::endl;
+    for(const auto& item : stats)
+    {
+        const auto& st = item.second;
+        out << item.first << ": tested " << st.n_test << ", covered "
+            << Percent(st.n_covered, st.n_test) << ", valid " << Percent(st.n_valid, st.n_test)
+            << ", exact " << Percent(st.n_exact, st.n_test) << " (heuristic "
+            << Percent(st.n_heuristic, st.n_test) << "), fields "
+            << Percent(static_cast<int>(st.field_hits * 1000), st.n_test * 1000);
+        if(st.n_regret > 0)
+            out << ", estimated regret " << std::fixed << std::setprecision(3)
+                << st.regret_predicted / st.n_regret << " (heuristic "
+                << st.regret_heuristic / st.n_regret << ")";
+        out << std::endl;
+    }
+}
+
+const char* const license = // clang-format off
+    "/*******************************************************************************\n"
+    "*\n"
+    "* MIT License\n"
+    "*\n"
+    "* Copyright (c) 2018 Advanced Micro Devices, Inc.\n"
+    "*\n"
+    "* Permission is hereby granted, free of charge, to any person obtaining a copy\n"
+    "* of this software and associated documentation files (the \"Software\"), to deal\n"
+    "* in the Software without restriction, including without limitation the rights\n"
+    "* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell\n"
+    "* copies of the Software, and to permit persons to whom the Software is\n"
+    "* furnished to do so, subject to the following conditions:\n"
+    "*\n"
+    "* The above copyright notice and this permission notice shall be included in all\n"
+    "* copies or substantial portions of the Software.\n"
+    "*\n"
+    "* THE SOFTWARE IS PROVIDED \"AS IS\", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n"
+    "* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+    "* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+    "* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+    "* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,\n"
+    "* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE\n"
+    "* SOFTWARE.\n"
+    "*\n"
+    "*******************************************************************************/\n";
+// clang-format on
+
+void Generate(const std::vector<Sample>& model, std::ostream& out)
+{
+    out << license
+        << "// Generated by perfdbfit from the installed perf dbs. Do not edit.\n"
+           "#include <miopen/perf_predictor.hpp>\n"
+           "\n"
+           "namespace miopen {\n"
+           "\n"
+           "// clang-format off\n"
+           "static const PerfPredictorRecord perf_predictor_records[] = {\n";
+    for(const auto& s : model)
+    {
+        const auto& f = s.problem.features;
+        out << "    {\"" << s.device << "\", \"" << s.solver << "\", \"" << s.problem.signature
+            << "\", {{" << f[0] << ", " << f[1] << ", " << f[2] << ", " << f[3] << ", " << f[4]
+            << "}}, \"" << s.values << "\"},\n";
+    }
+    out << "};\n"
+           "// clang-format on\n"
+           "\n"
+           "const PerfPredictorRecord* GetPerfPredictorRecords(std::size_t& n_records)\n"
+           "{\n"
+           "    n_records = sizeof(perf_predictor_records) / sizeof(perf_predictor_records[0]);\n"
+           "    return perf_predictor_records;\n"
+           "}\n"
+           "\n"
+           "} // namespace miopen\n";
+}
+
+void PrintHelp()
+{
+    std::cout << "Usage: perfdbfit {<option>}" << std::endl;
+    std::cout << "Option format: -<option name>[ <option value>]" << std::endl;
+    std::cout << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "[REQUIRED] -s[ource] {<path to perf db>}: files to be processed. Must be last "
+                 "argument."
+              << std::endl;
+    std::cout << "           -t[arget] <path>: generated tables. Default: none, report only."
+              << std::endl;
+    std::cout << "           -h[oldout] <number>: use every n-th record for testing. Default: 5."
+              << std::endl;
+}
+
+[[gnu::noreturn]] void WrongUsage(const std::string& error)
+{
+    std::cout << "Wrong usage: " << error << std::endl;
+    std::cout << std::endl;
+    PrintHelp();
+    std::exit(1);
+}
+
+} // namespace
+
+int main(int argsn, char** args)
+{
+    if(argsn == 1)
+    {
+        PrintHelp();
+        return 2;
+    }
+
+    std::string target;
+    int holdout = 5;
+    std::vector<Sample> samples;
+
+    for(int i = 1; i < argsn; ++i)
+    {
+        if(args[i][0] != '-')
+            WrongUsage(std::string("unknown argument - ") + args[i]);
+
+        std::string arg(args[i] + 1);
+        std::transform(arg.begin(), arg.end(), arg.begin(), ::tolower);
+
+        if(arg == "s" || arg == "source")
+        {
+            while(++i < argsn)
+                Load(args[i], samples);
+        }
+        else if(++i >= argsn)
+            WrongUsage("option value missing - " + arg);
+        else if(arg == "t" || arg == "target")
+            target = args[i];
+        else if(arg == "h" || arg == "holdout")
+            holdout = std::atoi(args[i]);
+        else
+            WrongUsage("unknown argument - " + arg);
+    }
+
+    if(samples.empty())
+        WrongUsage("no perf db records loaded");
+    if(holdout < 2)
+        WrongUsage("holdout shall be at least 2");
+
+    Report(samples, holdout, std::cout);
+
+    if(!target.empty())
+    {
+        const auto model = Fit(samples);
+        std::ofstream out(target);
+        Generate(model, out);
+        std::cout << "Generated " << model.size() << " records of " << samples.size() << " into "
+                  << target << std::endl;
+    }
+}
@@ -0,0 +1,174 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/allocator_pool.hpp>
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_ALLOCATOR_POOL_LIMIT)
+
+namespace miopen {
+
+/// Deleter context of a pooled buffer.
+struct AllocatorPool::BlockRef
+{
+    std::shared_ptr<AllocatorPool> pool;
+    std::size_t size;
+};
+
+AllocatorPool::AllocatorPool(const Allocator& allocator_, std::size_t limit_)
+    : allocator(allocator_), limit(limit_)
+{
+}
+
+AllocatorPool::~AllocatorPool() { TrimUnsafe(0); }
+
+std::size_t AllocatorPool::GetSizeClass(std::size_t sz)
+{
+    const std::size_t min_step = 512;
+    std::size_t p              = 1;
+    while(p <= sz / 2)
+        p *= 2;
+    const auto step = std::max(p / 4, min_step);
+    return (sz + step - 1) / step * step;
+}
+
+std::size_t AllocatorPool::GetDefaultLimit()
+{
+    return static_cast<std::size_t>(miopen::Value(MIOPEN_ALLOCATOR_POOL_LIMIT{})) << 20;
+}
+
+Allocator::ManageDataPtr AllocatorPool::Allocate(std::size_t sz)
+{
+    if(sz == 0)
+        return allocator(sz);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    ++stats.requests;
+
+    const auto size = limit == 0 ? sz : GetSizeClass(sz);
+    Data_t data     = nullptr;
+
+    const auto best = cached.lower_bound(size);
+    if(best != cached.end() && best->first <= 2 * size)
+    {
+        ++stats.hits;
+        data = best->second;
+        stats.bytes_cached -= best->first;
+        stats.bytes_in_use += best->first;
+        auto ref = new BlockRef{shared_from_this(), best->first};
+        cached.erase(best);
+        return Allocator::ManageDataPtr{data, AllocatorDeleter{&AllocatorPool::Deallocate, ref}};
+    }
+
+    if(limit != 0 && stats.bytes_in_use + stats.bytes_cached + size > limit)
+        TrimUnsafe(limit > size ? limit - size : 0);
+
+    try
+    {
+        data = allocator(size).release();
+    }
+    catch(...)
+    {
+        // Out of memory is likely; retry without the cached blocks.
+        if(cached.empty())
+            throw;
+        MIOPEN_LOG_I2("Allocator pool: allocation of " << size << " bytes failed, trimming");
+        TrimUnsafe(0);
+        data = allocator(size).release();
+    }
+    ++stats.allocations;
+    stats.bytes_in_use += size;
+    stats.peak_bytes = std::max(stats.peak_bytes, stats.bytes_in_use + stats.bytes_cached);
+
+    auto ref = new BlockRef{shared_from_this(), size};
+    return Allocator::ManageDataPtr{data, AllocatorDeleter{&AllocatorPool::Deallocate, ref}};
+}
+
+void AllocatorPool::Deallocate(void* context, void* data)
+{
+    std::unique_ptr<BlockRef> ref{static_cast<BlockRef*>(context)};
+    ref->pool->Release(DataCast(data), ref->size);
+}
+
+void AllocatorPool::Release(Data_t data, std::size_t size)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    stats.bytes_in_use -= size;
+    if(limit == 0 || stats.bytes_in_use + stats.bytes_cached + size > limit)
+    {
+        Free(data);
+        return;
+    }
+    cached.emplace(size, data);
+    stats.bytes_cached += size;
+}
+
+void AllocatorPool::Free(Data_t data)
+{
+    ++stats.deallocations;
+    AllocatorDeleter{allocator.deallocator, allocator.context}(data);
+}
+
+void AllocatorPool::TrimUnsafe(std::size_t target)
+{
+    while(!cached.empty() && stats.bytes_in_use + stats.bytes_cached > target)
+    {
+        const auto largest = std::prev(cached.end());
+        stats.bytes_cached -= largest->first;
+        Free(largest->second);
+        cached.erase(largest);
+    }
+}
+
+void AllocatorPool::Trim()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    TrimUnsafe(0);
+}
+
+void AllocatorPool::SetLimit(std::size_t limit_)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    limit = limit_;
+    TrimUnsafe(limit);
+}
+
+std::size_t AllocatorPool::GetLimit() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return limit;
+}
+
+AllocatorPoolStatistics AllocatorPool::GetStatistics() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+} // namespace miopen
@@ -0,0 +1,222 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/activ.hpp>
+#include <miopen/capture.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/env.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/lrn.hpp>
+#include <miopen/pooling.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/visit_float.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+namespace miopen {
+namespace capture {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_CAPTURE_FILE)
+
+namespace {
+
+struct CaptureFile
+{
+    std::mutex mutex;
+    std::ofstream file;
+    std::unique_ptr<Writer> writer;
+    std::unordered_map<const void*, std::int64_t> buffer_ids;
+
+    CaptureFile(const char* path) : file(path, std::ios::binary | std::ios::trunc)
+    {
+        if(file)
+            writer.reset(new Writer{file});
+        else
+            MIOPEN_LOG_E("Cannot open capture file " << path);
+    }
+
+    static CaptureFile& Get()
+    {
+        static CaptureFile capture{GetStringEnv(MIOPEN_CAPTURE_FILE{})};
+        return capture;
+    }
+};
+
+bool StartsWith(const char* s, const char* prefix)
+{
+    return std::strncmp(s, prefix, std::strlen(prefix)) == 0;
+}
+
+bool IsWorkspace(const char* name)
+{
+    return std::strstr(name, "orkSpace") != nullptr || std::strstr(name, "orkspace") != nullptr ||
+           std::strstr(name, "eserveSpace") != nullptr;
+}
+
+} // namespace
+
+bool IsCapturing()
+{
+    static const bool enabled = [] {
+        const auto path = GetStringEnv(MIOPEN_CAPTURE_FILE{});
+        return path != nullptr && *path != '\0';
+    }();
+    return enabled;
+}
+
+Recorder::Recorder(const char* name) { call.name = name; }
+
+Recorder::~Recorder()
+{
+    ReadScales();
+    auto& capture = CaptureFile::Get();
+    std::lock_guard<std::mutex> lock(capture.mutex);
+    if(capture.writer == nullptr)
+        return;
+    capture.writer->Write(call);
+    capture.file.flush();
+}
+
+Arg& Recorder::NewArg(const char* name, Kind kind)
+{
+    call.args.emplace_back();
+    auto& arg = call.args.back();
+    arg.name  = name;
+    arg.kind  = kind;
+    return arg;
+}
+
+void Recorder::AddInt(const char* name, std::int64_t x) { NewArg(name, Kind::Int).ints = {x}; }
+
+void Recorder::AddFloat(const char* name, double x) { NewArg(name, Kind::Float).floats = {x}; }
+
+void Recorder::AddPointer(const char* name, bool not_null)
+{
+    NewArg(name, not_null ? Kind::Pointer : Kind::Null);
+}
+
+void Recorder::ReadScales()
+{
+    if(scales.empty())
+        return;
+    // The API reads the scaling factors as the type of the data tensors.
+    const auto tensor = std::find_if(
+        call.args.begin(), call.args.end(), [](const Arg& arg) { return arg.kind == Kind::Tensor; });
+    const auto type =
+        tensor == call.args.end() ? miopenFloat : static_cast<miopenDataType_t>(tensor->ints[0]);
+    visit_float(type, [&](auto as_float) {
+        for(auto&& scale : scales)
+            call.args[scale.first].floats = {static_cast<double>(*as_float(scale.second))};
+    });
+    scales.clear();
+}
+
+void Recorder::Add(const char* name, miopenTensorDescriptor_t x)
+{
+    if(x == nullptr)
+        return AddPointer(name, false);
+    const auto& desc = deref(x);
+    auto& arg        = NewArg(name, Kind::Tensor);
+    arg.ints         = {desc.GetType(), desc.GetSize()};
+    arg.ints.insert(arg.ints.end(), desc.GetLengths().begin(), desc.GetLengths().end());
+    arg.ints.insert(arg.ints.end(), desc.GetStrides().begin(), desc.GetStrides().end());
+    last_tensor_size = desc.GetNumBytes();
+}
+
+void Recorder::Add(const char* name, miopenConvolutionDescriptor_t x)
+{
+    if(x == nullptr)
+        return AddPointer(name, false);
+    const auto& desc = deref(x);
+    NewArg(name, Kind::Convolution).ints = {desc.mode,
+                                            desc.pad_h,
+                                            desc.pad_w,
+                                            desc.u,
+                                            desc.v,
+                                            desc.dilation_h,
+                                            desc.dilation_w,
+                                            desc.paddingMode};
+}
+
+void Recorder::Add(const char* name, miopenPoolingDescriptor_t x)
+{
+    if(x == nullptr)
+        return AddPointer(name, false);
+    const auto& desc = deref(x);
+    auto& arg        = NewArg(name, Kind::Pooling);
+    arg.ints         = {desc.GetMode(), desc.GetPaddingMode(), desc.GetSize()};
+    for(auto&& v : {desc.GetLengths(), desc.GetPads(), desc.GetStrides()})
+        arg.ints.insert(arg.ints.end(), v.begin(), v.end());
+}
+
+void Recorder::Add(const char* name, miopenLRNDescriptor_t x)
+{
+    if(x == nullptr)
+        return AddPointer(name, false);
+    const auto& desc = deref(x);
+    auto& arg        = NewArg(name, Kind::LRN);
+    arg.ints         = {desc.GetMode(), desc.GetN()};
+    arg.floats       = {desc.GetAlpha(), desc.GetBeta(), desc.GetK()};
+}
+
+void Recorder::Add(const char* name, miopenActivationDescriptor_t x)
+{
+    if(x == nullptr)
+        return AddPointer(name, false);
+    const auto& desc = deref(x);
+    auto& arg        = NewArg(name, Kind::Activation);
+    arg.ints         = {desc.GetMode()};
+    arg.floats       = {desc.GetAlpha(), desc.GetBeta(), desc.GetGamma()};
+}
+
+void Recorder::Add(const char* name, const void* x)
+{
+    if(x == nullptr)
+        return AddPointer(name, false);
+    // Scaling factors are host pointers to the data type, read by ReadScales().
+    if(StartsWith(name, "alpha") || StartsWith(name, "beta"))
+    {
+        scales.emplace_back(call.args.size(), x);
+        NewArg(name, Kind::Float);
+        return;
+    }
+
+    std::int64_t id = 0;
+    {
+        auto& capture = CaptureFile::Get();
+        std::lock_guard<std::mutex> lock(capture.mutex);
+        id = capture.buffer_ids.emplace(x, capture.buffer_ids.size()).first->second;
+    }
+    const auto size = IsWorkspace(name) ? 0 : static_cast<std::int64_t>(last_tensor_size);
+    NewArg(name, Kind::Buffer).ints = {id, size};
+}
+
+} // namespace capture
+} // namespace miopen
@@ -2,6 +2,9 @@
 #include <miopen/logger.hpp>
 #include <miopen/env.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace miopen {
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_CHECK_NUMERICS)
@@ -26,15 +29,37 @@ bool checkNumericsImpl(
 {
     int numElements = dDesc.GetElementSize();
 
+    const int computeStats = (mode & CheckNumerics::ComputeStats);
+
+    CheckNumericsResult abnormal_h;
+
+#if MIOPEN_BACKEND_CPU
+    // Host buffers are scanned in place, with the same results as the kernel.
+    const auto* values = static_cast<const float*>(data);
+    for(int i = 0; i < numElements; i++)
+    {
+        const float v = values[i];
+        if(computeStats != 0)
+        {
+            abnormal_h.sum += v;
+            abnormal_h.absSum += std::fabs(v);
+            abnormal_h.min = std::min(abnormal_h.min, v);
+            abnormal_h.max = std::max(abnormal_h.max, v);
+        }
+        if(v == 0.0f)
+            abnormal_h.hasZero = 1;
+        if(std::isnan(v))
+            abnormal_h.hasNan = 1;
+        if(std::isinf(v))
+            abnormal_h.hasInf = 1;
+    }
+    (void)handle;
+#else
     // TODO - some constants we should get from the device:
     const int blockSize             = 256;
     const int numBlocks             = handle.GetMaxComputeUnits() * 6;
     const size_t numGlobalWorkItems = blockSize * numBlocks;
 
-    const int computeStats = (mode & CheckNumerics::ComputeStats);
-
-    CheckNumericsResult abnormal_h;
-
     auto abnormal_d =
         handle.Create(sizeof(CheckNumericsResult)); // TODO - someday avoid slow malloc/free here
     handle.WriteTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
@@ -47,6 +72,7 @@ bool checkNumericsImpl(
         data, numElements, abnormal_d.get(), computeStats);
 
     handle.ReadTo(&abnormal_h, abnormal_d, sizeof(CheckNumericsResult));
+#endif
 
     bool isAbnormal = (abnormal_h.hasNan != 0) || (abnormal_h.hasInf != 0);
 
@@ -27,6 +27,11 @@
 #include <miopen/solver.hpp>
 #include <miopen/env.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/gemm_chunk.hpp>
+#include <miopen/workspace_cache.hpp>
+
+#include <limits>
+#include <sstream>
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_DIRECT)
 
@@ -182,14 +187,20 @@ ConvolutionDescriptor::GetForwardOutputDim(const TensorDescriptor& inputTensorDe
 size_t ConvolutionDescriptor::ForwardGetWorkSpaceSizeGEMM(Handle& handle,
                                                           const TensorDescriptor& wDesc,
                                                           const TensorDescriptor& yDesc) const
+{
+    return ForwardGetWorkSpaceSizeGEMM(handle, wDesc, yDesc, 1);
+}
+
+size_t ConvolutionDescriptor::ForwardGetWorkSpaceSizeGEMM(Handle& handle,
+                                                          const TensorDescriptor& wDesc,
+                                                          const TensorDescriptor& yDesc,
+                                                          int chunk) const
 {
     int out_h, out_w;
     std::tie(std::ignore, std::ignore, out_h, out_w) = miopen::tien<4>(yDesc.GetLengths());
 
-    int wei_c, wei_h, wei_w;
-    std::tie(std::ignore, wei_c, wei_h, wei_w) = miopen::tien<4>(wDesc.GetLengths());
-
-    size_t workspace_size = wei_c * wei_h * wei_w * out_h * out_w * GetTypeSize(yDesc.GetType());
+    int wei_n, wei_c, wei_h, wei_w;
+    std::tie(wei_n, wei_c, wei_h, wei_w) = miopen::tien<4>(wDesc.GetLengths());
 
     // No workspace is needed for 1x1_stride=1 convolutions
     if(wei_h == 1 && wei_w == 1 && u == 1 && v == 1 && pad_h == 0 && pad_w == 0)
@@ -198,12 +209,35 @@ size_t ConvolutionDescriptor::ForwardGetWorkSpaceSizeGEMM(Handle& handle,
     }
 
     // gfx803 devices have 4gb-6gb memory
-    if(workspace_size > (1 << 30) && handle.GetDeviceName() == "gfx803")
-    {
-        workspace_size = 0;
-    }
+    const size_t limit = handle.GetDeviceName() == "gfx803" ? size_t{1} << 30
+                                                            : std::numeric_limits<size_t>::max();
+    return GetGemmChunkWorkSpaceSize(wei_c * wei_h * wei_w * out_h * out_w,
+                                     wei_n * out_h * out_w,
+                                     chunk,
+                                     GetTypeSize(yDesc.GetType()),
+                                     limit);
+}
+
+int ConvolutionDescriptor::ForwardGetGemmChunkSize(Handle& handle,
+                                                   const TensorDescriptor& wDesc,
+                                                   const TensorDescriptor& yDesc,
+                                                   size_t workSpaceSize) const
+{
+    int out_n, out_h, out_w;
+    std::tie(out_n, std::ignore, out_h, out_w) = miopen::tien<4>(yDesc.GetLengths());
+
+    int wei_n, wei_c, wei_h, wei_w;
+    std::tie(wei_n, wei_c, wei_h, wei_w) = miopen::tien<4>(wDesc.GetLengths());
 
-    return workspace_size;
+    // gfx803 devices have 4gb-6gb memory
+    if(handle.GetDeviceName() == "gfx803")
+        workSpaceSize = std::min<size_t>(workSpaceSize, 1 << 30);
+
+    return GetGemmChunkSize(out_n,
+                            wei_c * wei_h * wei_w * out_h * out_w,
+                            wei_n * out_h * out_w,
+                            GetTypeSize(yDesc.GetType()),
+                            workSpaceSize);
 }
 
 size_t
@@ -561,21 +595,70 @@ size_t ConvolutionDescriptor::BackwardDataGetWorkSpaceSizeGEMMTranspose(
 
 size_t ConvolutionDescriptor::BackwardWeightsGetWorkSpaceSizeGEMM(
     Handle& handle, const TensorDescriptor& dyDesc, const TensorDescriptor& dwDesc) const
+{
+    return BackwardWeightsGetWorkSpaceSizeGEMM(handle, dyDesc, dwDesc, 1);
+}
+
+size_t ConvolutionDescriptor::BackwardWeightsGetWorkSpaceSizeGEMM(Handle& handle,
+                                                                  const TensorDescriptor& dyDesc,
+                                                                  const TensorDescriptor& dwDesc,
+                                                                  int chunk) const
 {
     int out_h, out_w;
     std::tie(std::ignore, std::ignore, out_h, out_w) = miopen::tien<4>(dyDesc.GetLengths());
-    int wei_c, wei_h, wei_w;
-    std::tie(std::ignore, wei_c, wei_h, wei_w) = miopen::tien<4>(dwDesc.GetLengths());
-    size_t gemm_size = wei_c * wei_h * wei_w * out_h * out_w * GetTypeSize(dyDesc.GetType());
+    int wei_n, wei_c, wei_h, wei_w;
+    std::tie(wei_n, wei_c, wei_h, wei_w) = miopen::tien<4>(dwDesc.GetLengths());
 
     // gfx803 devices have limited memory
     // TODO: be graceful, need to ensure we can execute a config on the GPU
     // what if both the algos require > (1 << 30) memory
-    if(handle.GetDeviceName() == "gfx803" && gemm_size > (1 << 30))
-        gemm_size = 0;
+    const size_t limit = handle.GetDeviceName() == "gfx803" ? size_t{1} << 30
+                                                            : std::numeric_limits<size_t>::max();
+    return GetGemmChunkWorkSpaceSize(wei_c * wei_h * wei_w * out_h * out_w,
+                                     wei_n * out_h * out_w,
+                                     chunk,
+                                     GetTypeSize(dyDesc.GetType()),
+                                     limit);
+}
 
-    return gemm_size;
+int ConvolutionDescriptor::BackwardWeightsGetGemmChunkSize(Handle& handle,
+                                                           const TensorDescriptor& dyDesc,
+                                                           const TensorDescriptor& dwDesc,
+                                                           size_t workSpaceSize) const
+{
+    int out_n, out_h, out_w;
+    std::tie(out_n, std::ignore, out_h, out_w) = miopen::tien<4>(dyDesc.GetLengths());
+    int wei_n, wei_c, wei_h, wei_w;
+    std::tie(wei_n, wei_c, wei_h, wei_w) = miopen::tien<4>(dwDesc.GetLengths());
+
+    // gfx803 devices have limited memory
+    if(handle.GetDeviceName() == "gfx803")
+        workSpaceSize = std::min<size_t>(workSpaceSize, 1 << 30);
+
+    return GetGemmChunkSize(out_n,
+                            wei_c * wei_h * wei_w * out_h * out_w,
+                            wei_n * out_h * out_w,
+                            GetTypeSize(dyDesc.GetType()),
+                            workSpaceSize);
+}
+
+#if !MIOPEN_BACKEND_CPU
+/// PerfDb key does not include horizontal dilation.
+template <class T>
+static size_t GetCachedMaxWorkspaceSize(Handle& handle, T& construct_params)
+{
+    std::ostringstream key;
+    key << handle.GetDeviceName() << '_' << handle.GetMaxComputeUnits() << '-';
+    construct_params.getContext().Serialize(key);
+    key << '-' << construct_params.getContext().kernel_dilation0;
+
+    return WorkspaceSizeCache::GetInstance().Get(key.str(), Db::GetGeneration(), [&]() {
+        const auto sz = GetMaxWorkspaceSize(construct_params);
+        MIOPEN_LOG_I2(key.str() << ": " << sz);
+        return sz;
+    });
 }
+#endif
 
 size_t ConvolutionDescriptor::ForwardBackwardDataGetWorkSpaceSizeDirect(
     Handle& handle,
@@ -584,7 +667,15 @@ size_t ConvolutionDescriptor::ForwardBackwardDataGetWorkSpaceSizeDirect(
     const TensorDescriptor& wDesc,
     int direction) const // 1: Forward, 0: BackwardData
 {
-
+#if MIOPEN_BACKEND_CPU
+    // The host backend has no direct kernels
+    (void)handle;
+    (void)xDesc;
+    (void)yDesc;
+    (void)wDesc;
+    (void)direction;
+    return 0;
+#else
     if(!IsDirectSupported(wDesc) || miopen::IsDisabled(MIOPEN_DEBUG_CONV_DIRECT{}))
         return 0;
 
@@ -599,22 +690,13 @@ size_t ConvolutionDescriptor::ForwardBackwardDataGetWorkSpaceSizeDirect(
 
     try
     {
-        const auto ss = FindAllSolutions(construct_params);
-        size_t sz     = 0;
-        for(const auto& solution : ss)
-        {
-            if(sz < solution.workspce_sz)
-            {
-                MIOPEN_LOG_I2(sz << " < " << solution.workspce_sz);
-                sz = solution.workspce_sz;
-            }
-        }
-        return sz;
+        return GetCachedMaxWorkspaceSize(handle, construct_params);
     }
     catch(const miopen::Exception&)
     {
         return 0;
     }
+#endif
 }
 
 size_t
@@ -623,6 +705,14 @@ ConvolutionDescriptor::BackwardWeightsGetWorkSpaceSizeDirect(Handle& handle,
                                                              const TensorDescriptor& xDesc,
                                                              const TensorDescriptor& dwDesc) const
 {
+#if MIOPEN_BACKEND_CPU
+    // The host backend has no direct kernels
+    (void)handle;
+    (void)dyDesc;
+    (void)xDesc;
+    (void)dwDesc;
+    return 0;
+#else
     mlo_construct_BwdWrW2D construct_params(0); // backward with regards to weights
     construct_params.setDoSearch(false);
     construct_params.setStream(&handle);
@@ -634,22 +724,13 @@ ConvolutionDescriptor::BackwardWeightsGetWorkSpaceSizeDirect(Handle& handle,
 
     try
     {
-        const auto ss = FindAllSolutions(construct_params);
-        size_t sz     = 0;
-        for(const auto& solution : ss)
-        {
-            if(sz < solution.workspce_sz)
-            {
-                MIOPEN_LOG_I2(sz << " < " << solution.workspce_sz);
-                sz = solution.workspce_sz;
-            }
-        }
-        return sz;
+        return GetCachedMaxWorkspaceSize(handle, construct_params);
     }
     catch(const miopen::Exception&)
     {
         return 0;
     }
+#endif
 }
 
 size_t ConvolutionDescriptor::ConvolutionBackwardWeightsGetWorkSpaceSize(
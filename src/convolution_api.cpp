@@ -108,7 +108,7 @@ miopenConvolutionForwardGetWorkSpaceSize(miopenHandle_t handle,
                                          size_t* workSpaceSize)
 {
 
-    MIOPEN_LOG_FUNCTION(wDesc, yDesc, convDesc, workSpaceSize);
+    MIOPEN_LOG_FUNCTION(wDesc, xDesc, convDesc, yDesc, workSpaceSize);
     miopen::try_([&] {
         miopen::deref(workSpaceSize) =
             miopen::deref(convDesc).ForwardGetWorkSpaceSize(miopen::deref(handle),
@@ -167,6 +167,26 @@ miopenFindConvolutionForwardAlgorithm(miopenHandle_t handle,
     });
 }
 
+extern "C" miopenStatus_t
+miopenConvolutionForwardGetImmediateAlgorithm(miopenHandle_t handle,
+                                              const miopenTensorDescriptor_t wDesc,
+                                              const miopenTensorDescriptor_t xDesc,
+                                              const miopenConvolutionDescriptor_t convDesc,
+                                              const miopenTensorDescriptor_t yDesc,
+                                              size_t workSpaceSize,
+                                              miopenConvFwdAlgorithm_t* algo)
+{
+    MIOPEN_LOG_FUNCTION(wDesc, xDesc, convDesc, yDesc, workSpaceSize, algo);
+    return miopen::try_([&] {
+        miopen::deref(algo) =
+            miopen::deref(convDesc).GetImmediateConvFwdAlgorithm(miopen::deref(handle),
+                                                                 miopen::deref(xDesc),
+                                                                 miopen::deref(wDesc),
+                                                                 miopen::deref(yDesc),
+                                                                 workSpaceSize);
+    });
+}
+
 extern "C" miopenStatus_t miopenConvolutionForward(miopenHandle_t handle,
                                                    const void* alpha,
                                                    const miopenTensorDescriptor_t xDesc,
@@ -295,6 +315,26 @@ miopenFindConvolutionBackwardDataAlgorithm(miopenHandle_t handle,
     });
 }
 
+extern "C" miopenStatus_t
+miopenConvolutionBackwardDataGetImmediateAlgorithm(miopenHandle_t handle,
+                                                   const miopenTensorDescriptor_t dyDesc,
+                                                   const miopenTensorDescriptor_t wDesc,
+                                                   const miopenConvolutionDescriptor_t convDesc,
+                                                   const miopenTensorDescriptor_t dxDesc,
+                                                   size_t workSpaceSize,
+                                                   miopenConvBwdDataAlgorithm_t* algo)
+{
+    MIOPEN_LOG_FUNCTION(dyDesc, wDesc, convDesc, dxDesc, workSpaceSize, algo);
+    return miopen::try_([&] {
+        miopen::deref(algo) =
+            miopen::deref(convDesc).GetImmediateConvBwdDataAlgorithm(miopen::deref(handle),
+                                                                     miopen::deref(dyDesc),
+                                                                     miopen::deref(wDesc),
+                                                                     miopen::deref(dxDesc),
+                                                                     workSpaceSize);
+    });
+}
+
 extern "C" miopenStatus_t
 miopenConvolutionBackwardData(miopenHandle_t handle,
                               const void* alpha,
@@ -459,6 +499,26 @@ miopenFindConvolutionBackwardWeightsAlgorithm(miopenHandle_t handle,
     });
 }
 
+extern "C" miopenStatus_t
+miopenConvolutionBackwardWeightsGetImmediateAlgorithm(miopenHandle_t handle,
+                                                      const miopenTensorDescriptor_t dyDesc,
+                                                      const miopenTensorDescriptor_t xDesc,
+                                                      const miopenConvolutionDescriptor_t convDesc,
+                                                      const miopenTensorDescriptor_t dwDesc,
+                                                      size_t workSpaceSize,
+                                                      miopenConvBwdWeightsAlgorithm_t* algo)
+{
+    MIOPEN_LOG_FUNCTION(dyDesc, xDesc, convDesc, dwDesc, workSpaceSize, algo);
+    return miopen::try_([&] {
+        miopen::deref(algo) =
+            miopen::deref(convDesc).GetImmediateConvBwdWeightsAlgorithm(miopen::deref(handle),
+                                                                        miopen::deref(dyDesc),
+                                                                        miopen::deref(xDesc),
+                                                                        miopen::deref(dwDesc),
+                                                                        workSpaceSize);
+    });
+}
+
 extern "C" miopenStatus_t
 miopenConvolutionBackwardWeights(miopenHandle_t handle,
                                  const void* alpha,
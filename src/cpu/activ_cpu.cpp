@@ -0,0 +1,144 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#include <miopen/activ.hpp>
+#include <miopen/activ_host.hpp>
+#include <miopen/float_equal.hpp>
+#include <miopen/host_loops.hpp>
+#include <miopen/host_timer.hpp>
+#include <miopen/visit_float.hpp>
+
+namespace miopen {
+
+namespace {
+
+void CheckScales(const void* alpha, const void* beta)
+{
+    if(!float_equal(*(static_cast<const float*>(alpha)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(beta)), 0))
+    {
+        MIOPEN_THROW("Only alpha=1 and beta=0 is supported");
+    }
+}
+
+} // namespace
+
+miopenStatus_t ActivationDescriptor::Forward(Handle& handle,
+                                             const void* alpha,
+                                             const TensorDescriptor& xDesc,
+                                             ConstData_t x,
+                                             const void* beta,
+                                             const TensorDescriptor& yDesc,
+                                             Data_t y,
+                                             size_t xOffset,
+                                             size_t yOffset)
+{
+    CheckScales(alpha, beta);
+    if(xDesc.GetLengths() != yDesc.GetLengths())
+        MIOPEN_THROW(miopenStatusBadParm, "Activation tensors do not match");
+    if(xDesc.GetType() != yDesc.GetType())
+        MIOPEN_THROW(miopenStatusBadParm, "Activation tensor types do not match");
+
+    HostKernelTimer timer{handle, "ActivationForward"};
+    const auto loops =
+        host::MakeLoops<2>(xDesc.GetLengths(), {{host::Strides(xDesc), host::Strides(yDesc)}});
+    const auto sx = loops.strides[0].back();
+    const auto sy = loops.strides[1].back();
+
+    visit_float(xDesc.GetType(), [&](auto as_float) {
+        using T       = typename decltype(as_float)::type;
+        const auto px = as_float(x) + xOffset;
+        const auto py = as_float(y) + yOffset;
+        host::VisitActivation<host::HostAcc<T, T>>(
+            mode, GetAlpha(), GetBeta(), GetGamma(), [&](auto fwd, auto) {
+                host::ForEachRun(loops,
+                                 [&](const std::array<std::ptrdiff_t, 2>& o, std::size_t n) {
+                                     host::ActivationForwardRun(
+                                         fwd, px + o[0], sx, py + o[1], sy, n);
+                                 });
+            });
+    });
+    return miopenStatusSuccess;
+}
+
+miopenStatus_t ActivationDescriptor::Backward(Handle& handle,
+                                              const void* alpha,
+                                              const TensorDescriptor& yDesc,
+                                              ConstData_t y,
+                                              const TensorDescriptor& dyDesc,
+                                              ConstData_t dy,
+                                              const TensorDescriptor& xDesc,
+                                              ConstData_t x,
+                                              const void* beta,
+                                              const TensorDescriptor& dxDesc,
+                                              Data_t dx,
+                                              size_t yOffset,
+                                              size_t dyOffset,
+                                              size_t xOffset,
+                                              size_t dxOffset)
+{
+    CheckScales(alpha, beta);
+    const auto& lens = dxDesc.GetLengths();
+    if(xDesc.GetLengths() != lens || yDesc.GetLengths() != lens || dyDesc.GetLengths() != lens)
+        MIOPEN_THROW(miopenStatusBadParm, "Activation tensors do not match");
+
+    HostKernelTimer timer{handle, "ActivationBackward"};
+    const auto loops = host::MakeLoops<4>(lens,
+                                          {{host::Strides(yDesc),
+                                            host::Strides(dyDesc),
+                                            host::Strides(xDesc),
+                                            host::Strides(dxDesc)}});
+    const auto sy  = loops.strides[0].back();
+    const auto sdy = loops.strides[1].back();
+    const auto sx  = loops.strides[2].back();
+    const auto sdx = loops.strides[3].back();
+
+    visit_float(dxDesc.GetType(), [&](auto as_float) {
+        using T        = typename decltype(as_float)::type;
+        const auto py  = as_float(y) + yOffset;
+        const auto pdy = as_float(dy) + dyOffset;
+        const auto px  = as_float(x) + xOffset;
+        const auto pdx = as_float(dx) + dxOffset;
+        host::VisitActivation<host::HostAcc<T, T>>(
+            mode, GetAlpha(), GetBeta(), GetGamma(), [&](auto, auto bwd) {
+                host::ForEachRun(loops,
+                                 [&](const std::array<std::ptrdiff_t, 4>& o, std::size_t n) {
+                                     host::ActivationBackwardRun(bwd,
+                                                                 py + o[0],
+                                                                 sy,
+                                                                 pdy + o[1],
+                                                                 sdy,
+                                                                 px + o[2],
+                                                                 sx,
+                                                                 pdx + o[3],
+                                                                 sdx,
+                                                                 n);
+                                 });
+            });
+    });
+    return miopenStatusSuccess;
+}
+
+} // namespace miopen
@@ -0,0 +1,301 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/batch_norm.hpp>
+#include <miopen/batchnorm_host.hpp>
+#include <miopen/check_numerics.hpp>
+#include <miopen/float_equal.hpp>
+#include <miopen/host_timer.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/visit_float.hpp>
+
+namespace miopen {
+
+namespace {
+
+host::BatchNormGroups MakeGroups(miopenBatchNormMode_t bn_mode, const TensorDescriptor& xDesc)
+{
+    int n, c, h, w;
+    std::tie(n, c, h, w) = tien<4>(xDesc.GetLengths());
+    return {bn_mode == miopenBNSpatial,
+            std::size_t(n),
+            std::size_t(c),
+            std::size_t(h),
+            std::size_t(w)};
+}
+
+void CheckDescriptors(const TensorDescriptor& xDesc,
+                      const TensorDescriptor& yDesc,
+                      const TensorDescriptor& bnDesc)
+{
+    if(xDesc.GetSize() != yDesc.GetSize() || xDesc.GetSize() != bnDesc.GetSize())
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(xDesc.GetType() != yDesc.GetType() || xDesc.GetType() != bnDesc.GetType())
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(!xDesc.IsPacked() || !yDesc.IsPacked())
+    {
+        MIOPEN_LOG_E("Only fully packed tensors supported.");
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(xDesc.GetSize() < 3)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+}
+
+} // namespace
+
+void BatchNormForwardTraining(Handle& handle,
+                              miopenBatchNormMode_t bn_mode,
+                              const void* alpha,
+                              const void* beta,
+                              const TensorDescriptor& xDesc,
+                              ConstData_t x,
+                              const TensorDescriptor& yDesc,
+                              Data_t y,
+                              const TensorDescriptor& bnScaleBiasMeanVarDesc,
+                              ConstData_t bnScale,
+                              ConstData_t bnBias,
+                              double expAvgFactor,
+                              Data_t resultRunningMean,
+                              Data_t resultRunningVariance,
+                              double epsilon,
+                              Data_t resultSaveMean,
+                              Data_t resultSaveInvVariance)
+{
+    if(x == nullptr || y == nullptr || bnScale == nullptr || bnBias == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckDescriptors(xDesc, yDesc, bnScaleBiasMeanVarDesc);
+    if(!float_equal(*(static_cast<const float*>(alpha)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(beta)), 0.0))
+    {
+        MIOPEN_THROW("Only alpha=1 and beta=0 is supported");
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, xDesc, x);
+        miopen::checkNumericsInput(handle, bnScaleBiasMeanVarDesc, bnScale);
+        miopen::checkNumericsInput(handle, bnScaleBiasMeanVarDesc, bnBias);
+    }
+
+    const bool resultsave    = resultSaveMean != nullptr && resultSaveInvVariance != nullptr;
+    const bool resultrunning = resultRunningMean != nullptr && resultRunningVariance != nullptr;
+
+    {
+        HostKernelTimer timer{handle, "miopenBatchNormForwardTraining"};
+        visit_float(xDesc.GetType(), [&](auto as_float) {
+            host::BatchNormForwardTraining(MakeGroups(bn_mode, xDesc),
+                                           as_float(x),
+                                           as_float(y),
+                                           as_float(bnScale),
+                                           as_float(bnBias),
+                                           expAvgFactor,
+                                           as_float(resultRunningMean),
+                                           as_float(resultRunningVariance),
+                                           epsilon,
+                                           as_float(resultSaveMean),
+                                           as_float(resultSaveInvVariance));
+        });
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, yDesc, y);
+        if(resultrunning)
+        {
+            miopen::checkNumericsOutput(handle, bnScaleBiasMeanVarDesc, resultRunningMean);
+            miopen::checkNumericsOutput(handle, bnScaleBiasMeanVarDesc, resultRunningVariance);
+        }
+        if(resultsave)
+        {
+            miopen::checkNumericsOutput(handle, bnScaleBiasMeanVarDesc, resultSaveMean);
+            miopen::checkNumericsOutput(handle, bnScaleBiasMeanVarDesc, resultSaveInvVariance);
+        }
+    }
+}
+
+void BatchNormForwardInference(Handle& handle,
+                               miopenBatchNormMode_t bn_mode,
+                               const void* alpha,
+                               const void* beta,
+                               const TensorDescriptor& xDesc,
+                               ConstData_t x,
+                               const TensorDescriptor& yDesc,
+                               Data_t y,
+                               const TensorDescriptor& bnScaleBiasMeanVarDesc,
+                               ConstData_t bnScale,
+                               ConstData_t bnBias,
+                               ConstData_t estimatedMean,
+                               ConstData_t estimatedVariance,
+                               double epsilon)
+{
+    // Without estimates everything is recomputed, like the kernels do
+    if(estimatedMean == nullptr || estimatedVariance == nullptr)
+    {
+        MIOPEN_LOG_I2("Call to fwd train from forward inference:: ");
+        BatchNormForwardTraining(handle,
+                                 bn_mode,
+                                 alpha,
+                                 beta,
+                                 xDesc,
+                                 x,
+                                 yDesc,
+                                 y,
+                                 bnScaleBiasMeanVarDesc,
+                                 bnScale,
+                                 bnBias,
+                                 0,
+                                 nullptr,
+                                 nullptr,
+                                 epsilon,
+                                 nullptr,
+                                 nullptr);
+        return;
+    }
+
+    if(x == nullptr || y == nullptr || bnScale == nullptr || bnBias == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckDescriptors(xDesc, yDesc, bnScaleBiasMeanVarDesc);
+    if(!float_equal(*(static_cast<const float*>(alpha)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(beta)), 0))
+    {
+        MIOPEN_LOG_E("Only alpha=1 and beta=0 is supported");
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, xDesc, x);
+        miopen::checkNumericsInput(handle, bnScaleBiasMeanVarDesc, bnScale);
+        miopen::checkNumericsInput(handle, bnScaleBiasMeanVarDesc, bnBias);
+        miopen::checkNumericsInput(handle, bnScaleBiasMeanVarDesc, estimatedMean);
+        miopen::checkNumericsInput(handle, bnScaleBiasMeanVarDesc, estimatedVariance);
+    }
+
+    {
+        HostKernelTimer timer{handle, "miopenBatchNormalizationForwardInference"};
+        visit_float(xDesc.GetType(), [&](auto as_float) {
+            host::BatchNormForwardInference(MakeGroups(bn_mode, xDesc),
+                                            as_float(x),
+                                            as_float(y),
+                                            as_float(bnScale),
+                                            as_float(bnBias),
+                                            as_float(estimatedMean),
+                                            as_float(estimatedVariance),
+                                            epsilon);
+        });
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, yDesc, y);
+    }
+}
+
+void BatchNormBackward(Handle& handle,
+                       miopenBatchNormMode_t bn_mode,
+                       const void* alphaDataDiff,
+                       const void* betaDataDiff,
+                       const void* alphaParamDiff,
+                       const void* betaParamDiff,
+                       const TensorDescriptor& xDesc,
+                       ConstData_t x,
+                       const TensorDescriptor& dyDesc,
+                       ConstData_t dy,
+                       const TensorDescriptor& dxDesc,
+                       Data_t dx,
+                       const TensorDescriptor& bnScaleBiasDiffDesc,
+                       ConstData_t bnScale,
+                       Data_t resultBnScaleDiff,
+                       Data_t resultBnBiasDiff,
+                       double epsilon,
+                       ConstData_t savedMean,
+                       ConstData_t savedInvVariance)
+{
+    if(x == nullptr || dy == nullptr || bnScale == nullptr || dx == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckDescriptors(xDesc, dyDesc, bnScaleBiasDiffDesc);
+    if(dxDesc.GetType() != dyDesc.GetType() || !dxDesc.IsPacked())
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(!float_equal(*(static_cast<const float*>(alphaDataDiff)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(betaDataDiff)), 0))
+    {
+        MIOPEN_LOG_E("Only alphaDataDiff=1 and betaDataDiff=0 is supported");
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(!float_equal(*(static_cast<const float*>(alphaParamDiff)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(betaParamDiff)), 0))
+    {
+        MIOPEN_LOG_E("Only alphaParamDiff=1 and betaParamDiff=0 is supported");
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+
+    const bool useSaved = savedMean != nullptr && savedInvVariance != nullptr;
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, xDesc, x);
+        miopen::checkNumericsInput(handle, dyDesc, dy);
+        miopen::checkNumericsInput(handle, bnScaleBiasDiffDesc, bnScale);
+        if(useSaved)
+        {
+            miopen::checkNumericsInput(handle, bnScaleBiasDiffDesc, savedMean);
+            miopen::checkNumericsInput(handle, bnScaleBiasDiffDesc, savedInvVariance);
+        }
+    }
+
+    {
+        HostKernelTimer timer{handle, "miopenBatchNormBackward"};
+        visit_float(xDesc.GetType(), [&](auto as_float) {
+            host::BatchNormBackward(MakeGroups(bn_mode, xDesc),
+                                    as_float(x),
+                                    as_float(dy),
+                                    as_float(dx),
+                                    as_float(bnScale),
+                                    as_float(resultBnScaleDiff),
+                                    as_float(resultBnBiasDiff),
+                                    epsilon,
+                                    as_float(savedMean),
+                                    as_float(savedInvVariance));
+        });
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, dxDesc, dx);
+        miopen::checkNumericsOutput(handle, bnScaleBiasDiffDesc, resultBnScaleDiff);
+        miopen::checkNumericsOutput(handle, bnScaleBiasDiffDesc, resultBnBiasDiff);
+    }
+}
+
+} // namespace miopen
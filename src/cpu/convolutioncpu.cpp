@@ -0,0 +1,791 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/check_numerics.hpp>
+#include <miopen/convolution.hpp>
+#include <miopen/env.hpp>
+#include <miopen/fft_host.hpp>
+#include <miopen/float_equal.hpp>
+#include <miopen/gemm_host.hpp>
+#include <miopen/host_timer.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/parallel_for.hpp>
+#include <miopen/winograd_host.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CPU_WINOGRAD_F2X3)
+
+namespace {
+
+struct AutoEnableProfiling
+{
+    AutoEnableProfiling(Handle& x) : h(x)
+    {
+        prev_state = h.IsProfilingEnabled();
+        h.EnableProfiling();
+    }
+
+    ~AutoEnableProfiling()
+    {
+        h.EnableProfiling(prev_state);
+        h.ResetKernelTime();
+    }
+
+    private:
+    Handle& h;
+    bool prev_state;
+};
+
+/// A convolution from a c x in_h x in_w image to a k x out_h x out_w one with a k x c x r x s
+/// filter. Transposed convolutions are run as the convolution they transpose, so "in" is the
+/// side with wei_c channels in both modes.
+///
+/// All paths are im2col + host::Gemm on packed NCHW float tensors. The columns of an image are
+/// (c * r + i) * s + j rows of out_h * out_w values.
+struct ConvGeometry
+{
+    int n, c, in_h, in_w, k, r, s, out_h, out_w;
+    int pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w;
+
+    ConvGeometry(const ConvolutionDescriptor& conv,
+                 const TensorDescriptor& inDesc,
+                 const TensorDescriptor& wDesc,
+                 const TensorDescriptor& outDesc)
+        : pad_h(conv.pad_h),
+          pad_w(conv.pad_w),
+          stride_h(conv.u),
+          stride_w(conv.v),
+          dilation_h(conv.dilation_h),
+          dilation_w(conv.dilation_w)
+    {
+        std::tie(n, c, in_h, in_w)                       = tien<4>(inDesc.GetLengths());
+        std::tie(k, std::ignore, r, s)                   = tien<4>(wDesc.GetLengths());
+        std::tie(std::ignore, std::ignore, out_h, out_w) = tien<4>(outDesc.GetLengths());
+    }
+
+    std::size_t InSize() const { return std::size_t(c) * in_h * in_w; }
+    std::size_t OutSize() const { return std::size_t(k) * out_h * out_w; }
+    std::size_t ColRows() const { return std::size_t(c) * r * s; }
+    std::size_t ColCols() const { return std::size_t(out_h) * out_w; }
+
+    /// 1x1 filters without padding or stride read the image itself as columns.
+    bool IsIdentity() const
+    {
+        return r == 1 && s == 1 && pad_h == 0 && pad_w == 0 && stride_h == 1 && stride_w == 1;
+    }
+
+    /// Calls f(row, in_offset, col_offset) for every column element backed by the image.
+    template <class F>
+    void ForEachTap(F f) const
+    {
+        for(int ci = 0; ci < c; ci++)
+            for(int i = 0; i < r; i++)
+                for(int j = 0; j < s; j++)
+                {
+                    const std::size_t row = (std::size_t(ci) * r + i) * s + j;
+                    for(int y = 0; y < out_h; y++)
+                    {
+                        const int h = y * stride_h - pad_h + i * dilation_h;
+                        if(h < 0 || h >= in_h)
+                            continue;
+                        for(int x = 0; x < out_w; x++)
+                        {
+                            const int w = x * stride_w - pad_w + j * dilation_w;
+                            if(w >= 0 && w < in_w)
+                                f((std::size_t(ci) * in_h + h) * in_w + w,
+                                  row * ColCols() + std::size_t(y) * out_w + x);
+                        }
+                    }
+                }
+    }
+
+    void Im2Col(const float* in, float* col) const
+    {
+        std::fill(col, col + ColRows() * ColCols(), 0.0f);
+        ForEachTap([&](std::size_t i, std::size_t o) { col[o] = in[i]; });
+    }
+
+    /// Scatters the columns back into a zeroed image.
+    void Col2Im(const float* col, float* in) const
+    {
+        std::fill(in, in + InSize(), 0.0f);
+        ForEachTap([&](std::size_t i, std::size_t o) { in[i] += col[o]; });
+    }
+
+    /// Calls f(image) for every image. Images are spread over ParallelFor when there are enough
+    /// of them, otherwise each GEMM spreads its rows.
+    template <class F>
+    void ForEachImage(F f) const
+    {
+        if(std::size_t(n) >= ParallelForThreads())
+            ParallelFor(n, 1, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; i++)
+                    f(i);
+            });
+        else
+            for(int i = 0; i < n; i++)
+                f(i);
+    }
+
+    void Forward(const float* in, const float* w, float* out) const
+    {
+        ForEachImage([&](std::size_t i) {
+            std::vector<float> col;
+            const float* b = in + i * InSize();
+            if(!IsIdentity())
+            {
+                col.resize(ColRows() * ColCols());
+                Im2Col(b, col.data());
+                b = col.data();
+            }
+            host::Gemm(false,
+                       false,
+                       k,
+                       ColCols(),
+                       ColRows(),
+                       1.0f,
+                       w,
+                       ColRows(),
+                       b,
+                       ColCols(),
+                       0.0f,
+                       out + i * OutSize(),
+                       ColCols());
+        });
+    }
+
+    void BackwardData(const float* dout, const float* w, float* din) const
+    {
+        ForEachImage([&](std::size_t i) {
+            std::vector<float> col;
+            float* b = din + i * InSize();
+            if(!IsIdentity())
+            {
+                col.resize(ColRows() * ColCols());
+                b = col.data();
+            }
+            host::Gemm(true,
+                       false,
+                       ColRows(),
+                       ColCols(),
+                       k,
+                       1.0f,
+                       w,
+                       ColRows(),
+                       dout + i * OutSize(),
+                       ColCols(),
+                       0.0f,
+                       b,
+                       ColCols());
+            if(!IsIdentity())
+                Col2Im(col.data(), din + i * InSize());
+        });
+    }
+
+    /// Images are accumulated one after another into dw, each GEMM spreads its rows.
+    void BackwardWeights(const float* dout, const float* in, float* dw) const
+    {
+        std::vector<float> col(IsIdentity() ? 0 : ColRows() * ColCols());
+        for(int i = 0; i < n; i++)
+        {
+            const float* b = in + i * InSize();
+            if(!IsIdentity())
+            {
+                Im2Col(b, col.data());
+                b = col.data();
+            }
+            host::Gemm(false,
+                       true,
+                       k,
+                       ColRows(),
+                       ColCols(),
+                       1.0f,
+                       dout + i * OutSize(),
+                       ColCols(),
+                       b,
+                       ColCols(),
+                       i == 0 ? 0.0f : 1.0f,
+                       dw,
+                       ColRows());
+        }
+    }
+};
+
+void CheckScales(const void* alpha, const void* beta)
+{
+    if(!float_equal(*(static_cast<const float*>(alpha)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(beta)), 0))
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented, "Only alpha=1 and beta=0 is supported");
+    }
+}
+
+void CheckTensors(const TensorDescriptor& aDesc,
+                  const TensorDescriptor& bDesc,
+                  const TensorDescriptor& wDesc)
+{
+    if(aDesc.GetSize() != bDesc.GetSize() || aDesc.GetSize() != wDesc.GetSize())
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(aDesc.GetType() != bDesc.GetType() || aDesc.GetType() != wDesc.GetType())
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(aDesc.GetSize() < 3)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(aDesc.GetType() != miopenFloat)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only float convolutions are supported by the CPU backend");
+    }
+    if(!aDesc.IsPacked() || !bDesc.IsPacked() || !wDesc.IsPacked())
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only packed tensors are supported by the CPU backend");
+    }
+}
+
+void CheckFindArgs(int requestAlgoCount, int* returnedAlgoCount, miopenConvAlgoPerf_t* perfResults)
+{
+    if(returnedAlgoCount == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "returnedAlgoCount cannot be nullptr");
+    if(perfResults == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "perfResults cannot be nullptr");
+    if(requestAlgoCount < 1)
+        MIOPEN_THROW(miopenStatusBadParm, "requestAlgoCount cannot be < 1");
+}
+
+const float* AsFloat(ConstData_t p) { return static_cast<const float*>(p); }
+float* AsFloat(Data_t p) { return static_cast<float*>(p); }
+
+/// F(4x4,3x3) needs 2.25 times fewer multiplications than F(2x2,3x3), whose transforms lose
+/// less precision. MIOPEN_DEBUG_CPU_WINOGRAD_F2X3 selects the latter.
+host::WinogradTile GetWinogradTile()
+{
+    return miopen::IsEnabled(MIOPEN_DEBUG_CPU_WINOGRAD_F2X3{}) ? host::WinogradTile::F2x3
+                                                                : host::WinogradTile::F4x3;
+}
+
+/// Runs the 3x3 stride-1 convolution of in into out with Winograd. backward is set for the
+/// transposing directions: backward data, and forward of transposed convolutions.
+void RunWinograd(const ConvolutionDescriptor& conv,
+                 bool backward,
+                 const TensorDescriptor& inDesc,
+                 ConstData_t in,
+                 const TensorDescriptor& wDesc,
+                 ConstData_t w,
+                 const TensorDescriptor& outDesc,
+                 Data_t out)
+{
+    int n, in_h, in_w, wei_k, wei_c, out_h, out_w;
+    std::tie(n, std::ignore, in_h, in_w)             = tien<4>(inDesc.GetLengths());
+    std::tie(wei_k, wei_c, std::ignore, std::ignore) = tien<4>(wDesc.GetLengths());
+    std::tie(std::ignore, std::ignore, out_h, out_w) = tien<4>(outDesc.GetLengths());
+
+    const host::WinogradConv3x3 winograd{GetWinogradTile(), wei_k, wei_c, AsFloat(w), backward};
+    winograd.Run(n, in_h, in_w, conv.pad_h, conv.pad_w, out_h, out_w, AsFloat(in), AsFloat(out));
+}
+
+/// Runs the stride-1 convolution of in into out by FFT, backward as for RunWinograd.
+void RunFFT(const ConvolutionDescriptor& conv,
+            bool backward,
+            const TensorDescriptor& inDesc,
+            ConstData_t in,
+            const TensorDescriptor& wDesc,
+            ConstData_t w,
+            const TensorDescriptor& outDesc,
+            Data_t out)
+{
+    int n, in_h, in_w, wei_k, wei_c, wei_h, wei_w, out_h, out_w;
+    std::tie(n, std::ignore, in_h, in_w)             = tien<4>(inDesc.GetLengths());
+    std::tie(wei_k, wei_c, wei_h, wei_w)             = tien<4>(wDesc.GetLengths());
+    std::tie(std::ignore, std::ignore, out_h, out_w) = tien<4>(outDesc.GetLengths());
+
+    const host::FFTConv fft{
+        wei_k, wei_c, wei_h, wei_w, in_h, in_w, conv.pad_h, conv.pad_w, AsFloat(w), backward};
+    if(fft.OutHeight() != out_h || fft.OutWidth() != out_w)
+        MIOPEN_THROW(miopenStatusBadParm, "Output tensor does not match the convolution");
+    fft.Run(n, AsFloat(in), AsFloat(out));
+}
+
+struct TimedAlgo
+{
+    int algo;
+    const char* name;
+    float time;
+};
+
+/// Sorts the timed algorithms fastest first and returns how many of them are reported.
+int RankAlgos(std::vector<TimedAlgo>& timed, int requestAlgoCount)
+{
+    std::stable_sort(timed.begin(), timed.end(), [](const TimedAlgo& a, const TimedAlgo& b) {
+        return a.time < b.time;
+    });
+    return std::min<int>(requestAlgoCount, timed.size());
+}
+
+} // namespace
+
+void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
+                                                 const TensorDescriptor& xDesc,
+                                                 ConstData_t x,
+                                                 const TensorDescriptor& wDesc,
+                                                 ConstData_t w,
+                                                 const TensorDescriptor& yDesc,
+                                                 ConstData_t y,
+                                                 const int requestAlgoCount,
+                                                 int* returnedAlgoCount,
+                                                 miopenConvAlgoPerf_t* perfResults,
+                                                 Data_t workSpace,
+                                                 size_t workSpaceSize,
+                                                 bool /*exhaustiveSearch*/) const
+{
+    MIOPEN_LOG_I2("");
+    if(x == nullptr || w == nullptr || y == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "Buffers cannot be NULL");
+    CheckFindArgs(requestAlgoCount, returnedAlgoCount, perfResults);
+
+    // The algorithms are timed into a scratch output, like the kernels are
+    AutoEnableProfiling enableProfiling{handle};
+    auto tmp_y        = handle.Create(yDesc.GetElementSize() * GetTypeSize(yDesc.GetType()));
+    const float alpha = 1.0f;
+    const float beta  = 0.0f;
+    std::vector<TimedAlgo> timed;
+    const auto run = [&](miopenConvFwdAlgorithm_t algo, const char* name) {
+        ConvolutionForward(handle,
+                           &alpha,
+                           xDesc,
+                           x,
+                           wDesc,
+                           w,
+                           algo,
+                           &beta,
+                           yDesc,
+                           tmp_y.get(),
+                           workSpace,
+                           workSpaceSize);
+        timed.push_back({algo, name, handle.GetKernelTime()});
+        MIOPEN_LOG_I(name << "\t" << timed.back().time << "\t0");
+    };
+    run(miopenConvolutionFwdAlgoGEMM, "miopenConvolutionFwdAlgoGEMM");
+    if(host::IsWinogradApplicable(*this, wDesc, mode == miopenTranspose))
+        run(miopenConvolutionFwdAlgoWinograd, "miopenConvolutionFwdAlgoWinograd");
+    if(host::IsFFTApplicable(*this, wDesc, mode == miopenTranspose))
+        run(miopenConvolutionFwdAlgoFFT, "miopenConvolutionFwdAlgoFFT");
+
+    *returnedAlgoCount = RankAlgos(timed, requestAlgoCount);
+    for(int i = 0; i < *returnedAlgoCount; i++)
+    {
+        perfResults[i].fwd_algo = static_cast<miopenConvFwdAlgorithm_t>(timed[i].algo);
+        perfResults[i].time     = timed[i].time;
+        perfResults[i].memory   = 0;
+    }
+}
+
+miopenConvFwdAlgorithm_t ConvolutionDescriptor::GetImmediateConvFwdAlgorithm(
+    Handle& /*handle*/,
+    const TensorDescriptor& xDesc,
+    const TensorDescriptor& wDesc,
+    const TensorDescriptor& /*yDesc*/,
+    size_t workSpaceSize) const
+{
+    MIOPEN_LOG_I2("workspace = " << workSpaceSize);
+    if(xDesc.GetType() != miopenFloat)
+        MIOPEN_THROW("Fwd Convolution cannot be executed due to incorrect params");
+    if(host::IsWinogradApplicable(*this, wDesc, mode == miopenTranspose))
+        return miopenConvolutionFwdAlgoWinograd;
+    return miopenConvolutionFwdAlgoGEMM;
+}
+
+void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
+                                               const void* alpha,
+                                               const TensorDescriptor& xDesc,
+                                               ConstData_t x,
+                                               const TensorDescriptor& wDesc,
+                                               ConstData_t w,
+                                               miopenConvFwdAlgorithm_t algo,
+                                               const void* beta,
+                                               const TensorDescriptor& yDesc,
+                                               Data_t y,
+                                               Data_t /*workSpace*/,
+                                               size_t /*workSpaceSize*/) const
+{
+    MIOPEN_LOG_I2("algo = " << algo);
+    if(x == nullptr || w == nullptr || y == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckTensors(xDesc, yDesc, wDesc);
+    CheckScales(alpha, beta);
+    const bool winograd = algo == miopenConvolutionFwdAlgoWinograd &&
+                          host::IsWinogradApplicable(*this, wDesc, mode == miopenTranspose);
+    const bool fft = algo == miopenConvolutionFwdAlgoFFT &&
+                     host::IsFFTApplicable(*this, wDesc, mode == miopenTranspose);
+    if(algo != miopenConvolutionFwdAlgoGEMM && !winograd && !fft)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only GEMM, 3x3 Winograd and stride-1 FFT convolutions are supported by the "
+                     "CPU backend");
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, xDesc, x);
+        miopen::checkNumericsInput(handle, wDesc, w);
+    }
+
+    if(winograd)
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionFwdAlgoWinograd"};
+        RunWinograd(*this, mode == miopenTranspose, xDesc, x, wDesc, w, yDesc, y);
+    }
+    else if(fft)
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionFwdAlgoFFT"};
+        RunFFT(*this, mode == miopenTranspose, xDesc, x, wDesc, w, yDesc, y);
+    }
+    else
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionFwdAlgoGEMM"};
+        if(mode == miopenTranspose)
+            ConvGeometry{*this, yDesc, wDesc, xDesc}.BackwardData(
+                AsFloat(x), AsFloat(w), AsFloat(y));
+        else
+            ConvGeometry{*this, xDesc, wDesc, yDesc}.Forward(AsFloat(x), AsFloat(w), AsFloat(y));
+    }
+
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, yDesc, y);
+    }
+}
+
+void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
+                                                     const TensorDescriptor& dyDesc,
+                                                     ConstData_t dy,
+                                                     const TensorDescriptor& wDesc,
+                                                     ConstData_t w,
+                                                     const TensorDescriptor& dxDesc,
+                                                     ConstData_t dx,
+                                                     const int requestAlgoCount,
+                                                     int* returnedAlgoCount,
+                                                     miopenConvAlgoPerf_t* perfResults,
+                                                     Data_t workSpace,
+                                                     size_t workSpaceSize,
+                                                     bool /*exhaustiveSearch*/) const
+{
+    MIOPEN_LOG_I2("");
+    if(dx == nullptr || w == nullptr || dy == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "Buffers cannot be NULL");
+    CheckFindArgs(requestAlgoCount, returnedAlgoCount, perfResults);
+
+    AutoEnableProfiling enableProfiling{handle};
+    auto tmp_dx       = handle.Create(dxDesc.GetElementSize() * GetTypeSize(dxDesc.GetType()));
+    const float alpha = 1.0f;
+    const float beta  = 0.0f;
+    std::vector<TimedAlgo> timed;
+    const auto run = [&](miopenConvBwdDataAlgorithm_t algo, const char* name) {
+        ConvolutionBackwardData(handle,
+                                &alpha,
+                                dyDesc,
+                                dy,
+                                wDesc,
+                                w,
+                                algo,
+                                &beta,
+                                dxDesc,
+                                tmp_dx.get(),
+                                workSpace,
+                                workSpaceSize);
+        timed.push_back({algo, name, handle.GetKernelTime()});
+        MIOPEN_LOG_I(name << "\t" << timed.back().time << "\t0");
+    };
+    run(miopenConvolutionBwdDataAlgoGEMM, "miopenConvolutionBwdDataAlgoGEMM");
+    if(host::IsWinogradApplicable(*this, wDesc, mode != miopenTranspose))
+        run(miopenConvolutionBwdDataAlgoWinograd, "miopenConvolutionBwdDataAlgoWinograd");
+    if(host::IsFFTApplicable(*this, wDesc, mode != miopenTranspose))
+        run(miopenConvolutionBwdDataAlgoFFT, "miopenConvolutionBwdDataAlgoFFT");
+
+    *returnedAlgoCount = RankAlgos(timed, requestAlgoCount);
+    for(int i = 0; i < *returnedAlgoCount; i++)
+    {
+        perfResults[i].bwd_data_algo = static_cast<miopenConvBwdDataAlgorithm_t>(timed[i].algo);
+        perfResults[i].time          = timed[i].time;
+        perfResults[i].memory        = 0;
+    }
+}
+
+miopenConvBwdDataAlgorithm_t ConvolutionDescriptor::GetImmediateConvBwdDataAlgorithm(
+    Handle& /*handle*/,
+    const TensorDescriptor& dyDesc,
+    const TensorDescriptor& wDesc,
+    const TensorDescriptor& /*dxDesc*/,
+    size_t workSpaceSize) const
+{
+    MIOPEN_LOG_I2("workspace = " << workSpaceSize);
+    if(dyDesc.GetType() != miopenFloat)
+        MIOPEN_THROW("Backward Data Convolution cannot be executed due to incorrect params");
+    if(host::IsWinogradApplicable(*this, wDesc, mode != miopenTranspose))
+        return miopenConvolutionBwdDataAlgoWinograd;
+    return miopenConvolutionBwdDataAlgoGEMM;
+}
+
+void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
+                                                    const void* alpha,
+                                                    const TensorDescriptor& dyDesc,
+                                                    ConstData_t dy,
+                                                    const TensorDescriptor& wDesc,
+                                                    ConstData_t w,
+                                                    miopenConvBwdDataAlgorithm_t algo,
+                                                    const void* beta,
+                                                    const TensorDescriptor& dxDesc,
+                                                    Data_t dx,
+                                                    Data_t /*workSpace*/,
+                                                    size_t /*workSpaceSize*/) const
+{
+    MIOPEN_LOG_I2("algo = " << algo);
+    if(dx == nullptr || w == nullptr || dy == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckTensors(dyDesc, dxDesc, wDesc);
+    CheckScales(alpha, beta);
+    const bool winograd = algo == miopenConvolutionBwdDataAlgoWinograd &&
+                          host::IsWinogradApplicable(*this, wDesc, mode != miopenTranspose);
+    const bool fft = algo == miopenConvolutionBwdDataAlgoFFT &&
+                     host::IsFFTApplicable(*this, wDesc, mode != miopenTranspose);
+    if(algo != miopenConvolutionBwdDataAlgoGEMM && !winograd && !fft)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only GEMM, 3x3 Winograd and stride-1 FFT convolutions are supported by the "
+                     "CPU backend");
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, dyDesc, dy);
+        miopen::checkNumericsInput(handle, wDesc, w);
+    }
+
+    if(winograd)
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionBwdDataAlgoWinograd"};
+        RunWinograd(*this, mode != miopenTranspose, dyDesc, dy, wDesc, w, dxDesc, dx);
+    }
+    else if(fft)
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionBwdDataAlgoFFT"};
+        RunFFT(*this, mode != miopenTranspose, dyDesc, dy, wDesc, w, dxDesc, dx);
+    }
+    else
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionBwdDataAlgoGEMM"};
+        if(mode == miopenTranspose)
+            ConvGeometry{*this, dyDesc, wDesc, dxDesc}.Forward(
+                AsFloat(dy), AsFloat(w), AsFloat(dx));
+        else
+            ConvGeometry{*this, dxDesc, wDesc, dyDesc}.BackwardData(
+                AsFloat(dy), AsFloat(w), AsFloat(dx));
+    }
+
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, dxDesc, dx);
+    }
+}
+
+void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
+                                                        const TensorDescriptor& dyDesc,
+                                                        ConstData_t dy,
+                                                        const TensorDescriptor& xDesc,
+                                                        ConstData_t x,
+                                                        const TensorDescriptor& dwDesc,
+                                                        ConstData_t dw,
+                                                        const int requestAlgoCount,
+                                                        int* returnedAlgoCount,
+                                                        miopenConvAlgoPerf_t* perfResults,
+                                                        Data_t workSpace,
+                                                        size_t workSpaceSize,
+                                                        bool /*exhaustiveSearch*/) const
+{
+    MIOPEN_LOG_I2("");
+    if(x == nullptr || dw == nullptr || dy == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "Buffers cannot be NULL");
+    CheckFindArgs(requestAlgoCount, returnedAlgoCount, perfResults);
+
+    AutoEnableProfiling enableProfiling{handle};
+    auto tmp_dw       = handle.Create(dwDesc.GetElementSize() * GetTypeSize(dwDesc.GetType()));
+    const float alpha = 1.0f;
+    const float beta  = 0.0f;
+    ConvolutionBackwardWeights(handle,
+                               &alpha,
+                               dyDesc,
+                               dy,
+                               xDesc,
+                               x,
+                               miopenConvolutionBwdWeightsAlgoGEMM,
+                               &beta,
+                               dwDesc,
+                               tmp_dw.get(),
+                               workSpace,
+                               workSpaceSize);
+
+    *returnedAlgoCount              = 1;
+    perfResults[0].bwd_weights_algo = miopenConvolutionBwdWeightsAlgoGEMM;
+    perfResults[0].time             = handle.GetKernelTime();
+    perfResults[0].memory           = 0;
+    MIOPEN_LOG_I("miopenConvolutionBwdWeightsAlgoGEMM\t" << perfResults[0].time << "\t0");
+}
+
+miopenConvBwdWeightsAlgorithm_t ConvolutionDescriptor::GetImmediateConvBwdWeightsAlgorithm(
+    Handle& /*handle*/,
+    const TensorDescriptor& dyDesc,
+    const TensorDescriptor& /*xDesc*/,
+    const TensorDescriptor& /*dwDesc*/,
+    size_t workSpaceSize) const
+{
+    MIOPEN_LOG_I2("workspace = " << workSpaceSize);
+    if(dyDesc.GetType() != miopenFloat)
+        MIOPEN_THROW("Backward Weights Convolution cannot be executed due to incorrect params");
+    return miopenConvolutionBwdWeightsAlgoGEMM;
+}
+
+void ConvolutionDescriptor::ConvolutionBackwardWeights(Handle& handle,
+                                                       const void* alpha,
+                                                       const TensorDescriptor& dyDesc,
+                                                       ConstData_t dy,
+                                                       const TensorDescriptor& xDesc,
+                                                       ConstData_t x,
+                                                       miopenConvBwdWeightsAlgorithm_t algo,
+                                                       const void* beta,
+                                                       const TensorDescriptor& dwDesc,
+                                                       Data_t dw,
+                                                       Data_t /*workSpace*/,
+                                                       size_t /*workSpaceSize*/) const
+{
+    MIOPEN_LOG_I2("algo = " << algo);
+    if(x == nullptr || dw == nullptr || dy == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckTensors(dyDesc, xDesc, dwDesc);
+    if(dyDesc.GetLengths()[0] != xDesc.GetLengths()[0])
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckScales(alpha, beta);
+    if(algo != miopenConvolutionBwdWeightsAlgoGEMM)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only GEMM convolutions are supported by the CPU backend");
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, dyDesc, dy);
+        miopen::checkNumericsInput(handle, xDesc, x);
+    }
+
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionBwdWeightsAlgoGEMM"};
+        if(mode == miopenTranspose)
+            ConvGeometry{*this, dyDesc, dwDesc, xDesc}.BackwardWeights(
+                AsFloat(x), AsFloat(dy), AsFloat(dw));
+        else
+            ConvGeometry{*this, xDesc, dwDesc, dyDesc}.BackwardWeights(
+                AsFloat(dy), AsFloat(x), AsFloat(dw));
+    }
+
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, dwDesc, dw);
+    }
+}
+
+void ConvolutionBackwardBias(Handle& handle,
+                             const void* alpha,
+                             const TensorDescriptor& dyDesc,
+                             ConstData_t dy,
+                             const void* beta,
+                             const TensorDescriptor& dbDesc,
+                             Data_t db)
+{
+    if(dy == nullptr || db == nullptr)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(dyDesc.GetLengths()[1] != dbDesc.GetLengths()[1])
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    if(!float_equal(*(static_cast<const float*>(alpha)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(beta)), 0))
+    {
+        MIOPEN_THROW("Only alpha=1 and beta=0 is supported");
+    }
+    if(dyDesc.GetType() != miopenFloat)
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Only float convolutions are supported by the CPU backend");
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, dyDesc, dy);
+    }
+
+    {
+        HostKernelTimer timer{handle, "miopenConvolutionBwdBias"};
+        int out_n, out_c, out_h, out_w, stride_n, stride_c, stride_h, stride_w;
+        std::tie(out_n, out_c, out_h, out_w)             = tien<4>(dyDesc.GetLengths());
+        std::tie(stride_n, stride_c, stride_h, stride_w) = tien<4>(dyDesc.GetStrides());
+        const auto pdy = AsFloat(dy);
+        const auto pdb = AsFloat(db);
+        const auto dbs = dbDesc.GetStrides()[1];
+
+        ParallelFor(out_c, 1, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t c = begin; c < end; c++)
+            {
+                double sum = 0;
+                for(int i = 0; i < out_n; i++)
+                    for(int h = 0; h < out_h; h++)
+                        for(int w = 0; w < out_w; w++)
+                            sum += pdy[i * stride_n + c * stride_c + h * stride_h + w * stride_w];
+                pdb[c * dbs] = static_cast<float>(sum);
+            }
+        });
+    }
+
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, dbDesc, db);
+    }
+}
+
+} // namespace miopen
@@ -0,0 +1,66 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/gemm_host.hpp>
+#include <miopen/host_timer.hpp>
+
+namespace miopen {
+
+void RunGemmGeometryRNN(Handle& handle,
+                        ConstData_t A,
+                        ConstData_t B,
+                        Data_t C,
+                        int M,
+                        int N,
+                        int K,
+                        float alpha,
+                        float beta,
+                        bool tA,
+                        bool tB,
+                        bool tC,
+                        int lda,
+                        int ldb,
+                        int ldc,
+                        int a_offset,
+                        int b_offset,
+                        int c_offset,
+                        bool /*isDataColMajor*/,
+                        std::string& /*network_config*/,
+                        float /*timeout*/)
+{
+    HostKernelTimer timer{handle, "miopenRNNAlgoGEMM"};
+    const auto a = static_cast<const float*>(A) + a_offset;
+    const auto b = static_cast<const float*>(B) + b_offset;
+    const auto c = static_cast<float*>(C) + c_offset;
+
+    // A transposed C is op(B)^T * op(A)^T
+    if(tC)
+        host::Gemm(!tB, !tA, N, M, K, alpha, b, ldb, a, lda, beta, c, ldc);
+    else
+        host::Gemm(tA, tB, M, N, K, alpha, a, lda, b, ldb, beta, c, ldc);
+}
+
+} // namespace miopen
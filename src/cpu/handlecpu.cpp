@@ -0,0 +1,231 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#include <miopen/config.h>
+#include <miopen/errors.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/handle_lock.hpp>
+#include <miopen/parallel_for.hpp>
+#include <miopen/per_thread.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace miopen {
+
+// Buffers are aligned for the widest vector loads of the host kernels.
+constexpr std::size_t host_buffer_alignment = 64;
+
+void* default_allocator(void*, size_t sz)
+{
+    if(sz == 0)
+        return nullptr;
+    void* result = nullptr;
+#ifdef _WIN32
+    result = _aligned_malloc(sz, host_buffer_alignment);
+#else
+    if(posix_memalign(&result, host_buffer_alignment, sz) != 0)
+        result = nullptr;
+#endif
+    if(result == nullptr)
+        MIOPEN_THROW(miopenStatusAllocFailed, "Error allocating host buffer: " + std::to_string(sz));
+    return result;
+}
+
+void default_deallocator(void*, void* mem)
+{
+#ifdef _WIN32
+    _aligned_free(mem);
+#else
+    std::free(mem);
+#endif
+}
+
+// Ops run synchronously on the calling thread (and the threads of ParallelFor), so the stream
+// is only an opaque value handed back by GetStream().
+struct HandleImpl
+{
+    // Cached buffers go back to the allocator while the handle is alive.
+    ~HandleImpl()
+    {
+        if(pool != nullptr)
+            pool->SetLimit(0);
+    }
+
+    miopenAcceleratorQueue_t stream = nullptr;
+    PerThread<miopenAcceleratorQueue_t> thread_streams;
+    Allocator allocator{};
+    std::shared_ptr<AllocatorPool> pool;
+    std::atomic<bool> enable_profiling{false};
+    PerThread<float> profiling_result;
+};
+
+Handle::Handle(miopenAcceleratorQueue_t stream) : impl(new HandleImpl())
+{
+    this->impl->stream = stream;
+    this->SetAllocator(nullptr, nullptr, nullptr);
+}
+
+Handle::Handle() : impl(new HandleImpl()) { this->SetAllocator(nullptr, nullptr, nullptr); }
+
+Handle::Handle(Handle&&) noexcept = default;
+Handle::~Handle()                 = default;
+
+void Handle::SetStream(miopenAcceleratorQueue_t streamID) const { this->impl->stream = streamID; }
+
+void Handle::SetThreadStream(miopenAcceleratorQueue_t streamID) const
+{
+    if(streamID == nullptr)
+        this->impl->thread_streams.Erase();
+    else
+        this->impl->thread_streams.Get() = streamID;
+}
+
+miopenAcceleratorQueue_t Handle::GetStream() const
+{
+    const auto thread_stream = impl->thread_streams.Find();
+    return thread_stream != nullptr ? *thread_stream : impl->stream;
+}
+
+void Handle::SetAllocator(miopenAllocatorFunction allocator,
+                          miopenDeallocatorFunction deallocator,
+                          void* allocatorContext) const
+{
+    if(allocator == nullptr && allocatorContext != nullptr)
+    {
+        MIOPEN_THROW("Allocator context can not be used with the default allocator");
+    }
+    this->impl->allocator.allocator   = allocator == nullptr ? default_allocator : allocator;
+    this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
+
+    this->impl->allocator.context = allocatorContext;
+
+    // Buffers still in use keep the previous pool, which frees them on release.
+    auto limit = AllocatorPool::GetDefaultLimit();
+    if(this->impl->pool != nullptr)
+    {
+        limit = this->impl->pool->GetLimit();
+        this->impl->pool->SetLimit(0);
+    }
+    this->impl->pool = std::make_shared<AllocatorPool>(this->impl->allocator, limit);
+}
+
+void Handle::SetAllocatorPoolLimit(std::size_t limit) const { this->impl->pool->SetLimit(limit); }
+
+void Handle::TrimAllocatorPool() const { this->impl->pool->Trim(); }
+
+AllocatorPoolStatistics Handle::GetAllocatorPoolStatistics() const
+{
+    return this->impl->pool->GetStatistics();
+}
+
+void Handle::EnableProfiling(bool enable) { this->impl->enable_profiling = enable; }
+
+void Handle::ResetKernelTime() { this->impl->profiling_result.Get() = 0.0; }
+void Handle::AccumKernelTime(float curr_time) { this->impl->profiling_result.Get() += curr_time; }
+
+float Handle::GetKernelTime() const { return this->impl->profiling_result.Get(); }
+
+bool Handle::IsProfilingEnabled() const { return this->impl->enable_profiling; }
+
+KernelInvoke Handle::AddKernel(const std::string&,
+                               const std::string&,
+                               const std::string&,
+                               const std::string& kernel_name,
+                               const std::vector<size_t>&,
+                               const std::vector<size_t>&,
+                               const std::string&,
+                               std::size_t)
+{
+    MIOPEN_THROW(miopenStatusNotImplemented,
+                 "Kernels are not supported by the CPU backend: " + kernel_name);
+}
+
+void Handle::ClearKernels(const std::string&, const std::string&) {}
+
+std::vector<Kernel> Handle::GetKernelsImpl(const std::string&, const std::string&) { return {}; }
+
+KernelInvoke Handle::Run(Kernel k) { return k.Invoke(this->GetStream()); }
+
+Program Handle::LoadProgram(const std::string& program_name, std::string, bool)
+{
+    MIOPEN_THROW(miopenStatusNotImplemented,
+                 "Kernels are not supported by the CPU backend: " + program_name);
+}
+
+void Handle::Finish() const {}
+
+void Handle::Flush() const {}
+
+std::size_t Handle::GetLocalMemorySize() { return 0; }
+
+std::size_t Handle::GetMaxComputeUnits() { return ParallelForThreads(); }
+
+std::string Handle::GetDeviceName() { return "cpu"; }
+
+Allocator::ManageDataPtr Handle::Create(std::size_t sz)
+{
+    MIOPEN_HANDLE_LOCK
+    return this->impl->pool->Allocate(sz);
+}
+
+Allocator::ManageDataPtr&
+Handle::WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz)
+{
+    MIOPEN_HANDLE_LOCK
+    if(sz != 0)
+        std::memcpy(ddata.get(), data, sz);
+    return ddata;
+}
+
+void Handle::ReadTo(void* data, const Allocator::ManageDataPtr& ddata, std::size_t sz)
+{
+    MIOPEN_HANDLE_LOCK
+    if(sz != 0)
+        std::memcpy(data, ddata.get(), sz);
+}
+
+void Handle::Copy(ConstData_t src, Data_t dest, std::size_t size)
+{
+    MIOPEN_HANDLE_LOCK
+    if(size != 0 && src != dest)
+        std::memmove(dest, src, size);
+}
+
+shared<Data_t> Handle::CreateSubBuffer(Data_t data, std::size_t offset, std::size_t)
+{
+    auto cdata = reinterpret_cast<char*>(data);
+    return {cdata + offset, null_deleter{}};
+}
+
+shared<ConstData_t> Handle::CreateSubBuffer(ConstData_t data, std::size_t offset, std::size_t)
+{
+    auto cdata = reinterpret_cast<const char*>(data);
+    return {cdata + offset, null_deleter{}};
+}
+
+} // namespace miopen
@@ -0,0 +1,129 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/lrn.hpp>
+#include <miopen/float_equal.hpp>
+#include <miopen/host_timer.hpp>
+#include <miopen/lrn_host.hpp>
+#include <miopen/visit_float.hpp>
+
+#include <algorithm>
+
+namespace miopen {
+
+namespace {
+
+/// The host LRN of NCHW tensors with the lengths of desc.
+host::LRNGeometry MakeGeometry(const LRNDescriptor& lrn, const TensorDescriptor& desc)
+{
+    int n, c, h, w;
+    std::tie(n, c, h, w) = tien<4>(desc.GetLengths());
+    return {lrn.GetMode() == miopenLRNCrossChannel, static_cast<int>(lrn.GetN()), n, c, h, w};
+}
+
+void CopyStrides(const TensorDescriptor& desc, std::array<std::size_t, 4>& strides)
+{
+    std::copy(desc.GetStrides().begin(), desc.GetStrides().end(), strides.begin());
+}
+
+} // namespace
+
+miopenStatus_t LRNDescriptor::Forward(Handle& handle,
+                                      const void* /*alpha*/,
+                                      const TensorDescriptor& xDesc,
+                                      ConstData_t x,
+                                      const void* /*beta*/,
+                                      const TensorDescriptor& yDesc,
+                                      Data_t y,
+                                      bool do_backward,
+                                      Data_t workSpace) const
+{
+    if(float_equal(static_cast<float>(GetK()), 0.0))
+        MIOPEN_THROW("Expect non-zero bias/K");
+    if(do_backward && workSpace == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "Workspace is required to do backwards");
+
+    HostKernelTimer timer{handle, "miopenLRNForward"};
+    auto g = MakeGeometry(*this, xDesc);
+    CopyStrides(xDesc, g.x_strides);
+    CopyStrides(yDesc, g.y_strides);
+    // The workspace holds the scale laid out like y
+    CopyStrides(yDesc, g.scale_strides);
+
+    visit_float(xDesc.GetType(), [&](auto as_float) {
+        using T = typename decltype(as_float)::type;
+        host::LRNForward(g,
+                         GetAlpha(),
+                         GetBeta(),
+                         GetK(),
+                         as_float(x),
+                         as_float(y),
+                         static_cast<T*>(do_backward ? workSpace : nullptr));
+    });
+    return miopenStatusSuccess;
+}
+
+miopenStatus_t LRNDescriptor::Backward(Handle& handle,
+                                       const void* /*alpha*/,
+                                       const TensorDescriptor& yDesc,
+                                       ConstData_t y,
+                                       const TensorDescriptor& dyDesc,
+                                       ConstData_t dy,
+                                       const TensorDescriptor& xDesc,
+                                       ConstData_t x,
+                                       const void* /*beta*/,
+                                       const TensorDescriptor& dxDesc,
+                                       Data_t dx,
+                                       ConstData_t workSpace) const
+{
+    if(float_equal(GetK(), 0.0))
+        MIOPEN_THROW("Expect non-zero bias/K");
+    if(workSpace == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "Workspace is required to do backwards");
+
+    HostKernelTimer timer{handle, "miopenLRNBackward"};
+    auto g = MakeGeometry(*this, xDesc);
+    CopyStrides(xDesc, g.x_strides);
+    CopyStrides(yDesc, g.y_strides);
+    CopyStrides(yDesc, g.scale_strides);
+    CopyStrides(dxDesc, g.dx_strides);
+    CopyStrides(dyDesc, g.dy_strides);
+
+    visit_float(xDesc.GetType(), [&](auto as_float) {
+        using T = typename decltype(as_float)::type;
+        host::LRNBackward(g,
+                          GetAlpha(),
+                          GetBeta(),
+                          as_float(y),
+                          as_float(dy),
+                          as_float(x),
+                          static_cast<const T*>(workSpace),
+                          as_float(dx));
+    });
+    return miopenStatusSuccess;
+}
+
+} // namespace miopen
@@ -0,0 +1,171 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#include <miopen/check_numerics.hpp>
+#include <miopen/float_equal.hpp>
+#include <miopen/host_timer.hpp>
+#include <miopen/pooling.hpp>
+#include <miopen/pooling_host.hpp>
+#include <miopen/visit_float.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace miopen {
+
+namespace {
+
+/// The host pooling of NCHW tensors xDesc (or dxDesc) and yDesc (or dyDesc).
+host::PoolingGeometry MakeGeometry(const PoolingDescriptor& pooling,
+                                   const TensorDescriptor& xDesc,
+                                   const TensorDescriptor& yDesc)
+{
+    int n, c, in_h, in_w, out_h, out_w, window_h, window_w, pad_h, pad_w, stride_h, stride_w;
+    std::tie(n, c, in_h, in_w)                       = tien<4>(xDesc.GetLengths());
+    std::tie(std::ignore, std::ignore, out_h, out_w) = tien<4>(yDesc.GetLengths());
+    std::tie(window_h, window_w)                     = tien<2>(pooling.GetLengths());
+    std::tie(pad_h, pad_w)                           = tien<2>(pooling.GetPads());
+    std::tie(stride_h, stride_w)                     = tien<2>(pooling.GetStrides());
+    host::PoolingGeometry g{
+        n, c, in_h, in_w, out_h, out_w, window_h, window_w, pad_h, pad_w, stride_h, stride_w};
+    std::copy(xDesc.GetStrides().begin(), xDesc.GetStrides().end(), g.in_strides.begin());
+    std::copy(yDesc.GetStrides().begin(), yDesc.GetStrides().end(), g.out_strides.begin());
+    return g;
+}
+
+void CheckScales(const void* alpha, const void* beta)
+{
+    if(!float_equal(*(static_cast<const float*>(alpha)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(beta)), 0))
+    {
+        MIOPEN_THROW("Only alpha=1 and beta=0 is supported");
+    }
+}
+
+} // namespace
+
+std::size_t PoolingDescriptor::GetWorkSpaceSize(const TensorDescriptor& tensorDesc) const
+{
+    return tensorDesc.GetElementSize() * sizeof(uint8_t);
+}
+
+miopenStatus_t PoolingDescriptor::Forward(Handle& handle,
+                                          const void* alpha,
+                                          const TensorDescriptor& xDesc,
+                                          ConstData_t x,
+                                          const void* beta,
+                                          const TensorDescriptor& yDesc,
+                                          Data_t y,
+                                          bool do_backward,
+                                          Data_t workSpace,
+                                          size_t /*workSpaceSize*/) const
+{
+    CheckScales(alpha, beta);
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, xDesc, x);
+    }
+    if(((lens[0] * lens[1]) >= std::numeric_limits<uint16_t>::max()) && do_backward)
+    {
+        MIOPEN_THROW("Pooling window too large to do backwards");
+    }
+    if(mode == miopenPoolingMax && do_backward && workSpace == nullptr)
+    {
+        throw std::invalid_argument(
+            "workSpace cannot be NULL in Forward Pooling MAX mode when backward pass is requested");
+    }
+
+    {
+        HostKernelTimer timer{handle, "PoolingForward"};
+        const auto g     = MakeGeometry(*this, xDesc, yDesc);
+        const bool max   = mode == miopenPoolingMax;
+        const auto index = static_cast<uint8_t*>(max && do_backward ? workSpace : nullptr);
+        visit_float(xDesc.GetType(), [&](auto as_float) {
+            host::PoolingForward(g, max, as_float(x), as_float(y), index);
+        });
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, yDesc, y);
+    }
+
+    return miopenStatusSuccess;
+}
+
+miopenStatus_t PoolingDescriptor::Backward(Handle& handle,
+                                           const void* alpha,
+                                           const TensorDescriptor& yDesc,
+                                           ConstData_t y,
+                                           const TensorDescriptor& dyDesc,
+                                           ConstData_t dy,
+                                           const TensorDescriptor& xDesc,
+                                           ConstData_t x,
+                                           const void* beta,
+                                           const TensorDescriptor& dxDesc,
+                                           Data_t dx,
+                                           ConstData_t workSpace) const
+{
+    CheckScales(alpha, beta);
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, dyDesc, dy);
+    }
+    if(((lens[0] * lens[1]) >= std::numeric_limits<uint16_t>::max()))
+    {
+        MIOPEN_THROW("Pooling window too large to do backwards");
+    }
+    if(mode == miopenPoolingMax && workSpace == nullptr)
+    {
+        throw std::invalid_argument("workSpace cannot be NULL in Backward Pooling MAX mode");
+    }
+
+    {
+        HostKernelTimer timer{handle, "PoolingBackward"};
+        const auto g   = MakeGeometry(*this, dxDesc, dyDesc);
+        const bool max = mode == miopenPoolingMax;
+        // x and y pick the argmax of windows too large for the 8 bit workspace
+        const bool same_layout =
+            xDesc.GetStrides() == dxDesc.GetStrides() && yDesc.GetStrides() == dyDesc.GetStrides();
+        visit_float(dxDesc.GetType(), [&](auto as_float) {
+            host::PoolingBackward(g,
+                                  max,
+                                  as_float(dy),
+                                  as_float(dx),
+                                  static_cast<const uint8_t*>(workSpace),
+                                  same_layout ? as_float(x) : nullptr,
+                                  same_layout ? as_float(y) : nullptr);
+        });
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, dxDesc, dx);
+    }
+
+    return miopenStatusSuccess;
+}
+
+} // namespace miopen
@@ -0,0 +1,107 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#include <miopen/check_numerics.hpp>
+#include <miopen/float_equal.hpp>
+#include <miopen/host_timer.hpp>
+#include <miopen/softmax.hpp>
+#include <miopen/softmax_host.hpp>
+#include <miopen/visit_float.hpp>
+
+#include <algorithm>
+
+namespace miopen {
+
+namespace {
+
+host::SoftmaxGeometry MakeGeometry(const TensorDescriptor& desc)
+{
+    int n, c, h, w;
+    std::tie(n, c, h, w) = tien<4>(desc.GetLengths());
+    host::SoftmaxGeometry g{n, c, h, w};
+    std::copy(desc.GetStrides().begin(), desc.GetStrides().end(), g.y_strides.begin());
+    g.dx_strides = g.y_strides;
+    return g;
+}
+
+void CheckScales(const void* alpha, const void* beta)
+{
+    if(!float_equal(*(static_cast<const float*>(alpha)), 1.0) ||
+       !float_equal(*(static_cast<const float*>(beta)), 0))
+    {
+        MIOPEN_THROW("Only alpha=1 and beta=0 is supported");
+    }
+}
+
+} // namespace
+
+miopenStatus_t SoftmaxForward(
+    Handle& handle, const void* alpha, const void* beta, const TensorDescriptor& yDesc, Data_t y)
+{
+    CheckScales(alpha, beta);
+    {
+        HostKernelTimer timer{handle, "SoftmaxForward"};
+        visit_float(yDesc.GetType(), [&](auto as_float) {
+            host::SoftmaxForward(MakeGeometry(yDesc), as_float(y));
+        });
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, yDesc, y);
+    }
+    return miopenStatusSuccess;
+}
+
+miopenStatus_t SoftmaxBackward(Handle& handle,
+                               const void* alpha,
+                               const TensorDescriptor& yDesc,
+                               ConstData_t y,
+                               const void* beta,
+                               const TensorDescriptor& dxDesc,
+                               Data_t dx)
+{
+    if(yDesc != dxDesc)
+    {
+        MIOPEN_THROW(miopenStatusBadParm);
+    }
+    CheckScales(alpha, beta);
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsInput(handle, yDesc, y);
+    }
+    {
+        HostKernelTimer timer{handle, "SoftmaxBackward"};
+        visit_float(dxDesc.GetType(), [&](auto as_float) {
+            host::SoftmaxBackward(MakeGeometry(dxDesc), as_float(y), as_float(dx));
+        });
+    }
+    if(miopen::CheckNumericsEnabled() != 0)
+    {
+        miopen::checkNumericsOutput(handle, dxDesc, dx);
+    }
+    return miopenStatusSuccess;
+}
+
+} // namespace miopen
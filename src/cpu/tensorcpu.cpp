@@ -0,0 +1,90 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#include <miopen/host_timer.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tensor_ops.hpp>
+#include <miopen/tensor_ops_host.hpp>
+
+namespace miopen {
+
+void ScaleTensor(
+    Handle& handle, const TensorDescriptor& yDesc, Data_t y, const void* alpha, int offset)
+{
+    HostKernelTimer timer{handle, "ScaleTensor"};
+    host::ScaleTensor(yDesc, y, alpha, offset);
+}
+
+void SetTensor(
+    Handle& handle, const TensorDescriptor& yDesc, Data_t y, const void* alpha, int offset)
+{
+    HostKernelTimer timer{handle, "SetTensor"};
+    host::SetTensor(yDesc, y, alpha, offset);
+}
+
+void OpTensor(Handle& handle,
+              miopenTensorOp_t tensorOp,
+              const void* alpha0,
+              const TensorDescriptor& aTensorDesc,
+              ConstData_t ATensor,
+              const void* alpha1,
+              const TensorDescriptor& bTensorDesc,
+              ConstData_t BTensor,
+              const void* beta,
+              const TensorDescriptor& cTensorDesc,
+              Data_t CTensor,
+              const size_t Aoffset,
+              const size_t Boffset,
+              const size_t Coffset)
+{
+    HostKernelTimer timer{handle, "OpTensor"};
+    host::OpTensor(tensorOp,
+                   alpha0,
+                   aTensorDesc,
+                   ATensor,
+                   alpha1,
+                   bTensorDesc,
+                   BTensor,
+                   beta,
+                   cTensorDesc,
+                   CTensor,
+                   Aoffset,
+                   Boffset,
+                   Coffset);
+}
+
+void CopyTensor(Handle& handle,
+                const TensorDescriptor& srcDesc,
+                ConstData_t src,
+                const TensorDescriptor& dstDesc,
+                Data_t dst,
+                int srcOffset,
+                int dstOffset)
+{
+    HostKernelTimer timer{handle, "CopyTensor"};
+    host::CopyTensor(srcDesc, src, dstDesc, dst, srcOffset, dstOffset);
+}
+
+} // namespace miopen
@@ -29,6 +29,7 @@
 #include <miopen/lock_file.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/md5.hpp>
+#include <miopen/trace.hpp>
 
 #include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <boost/filesystem.hpp>
@@ -37,6 +38,7 @@
 #include <boost/optional.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstdio>
@@ -95,11 +97,20 @@ Db::Db(const std::string& filename_, bool is_system)
 
 static std::chrono::seconds GetLockTimeout() { return std::chrono::seconds{60}; }
 
+static std::atomic<std::size_t>& DbGeneration()
+{
+    static std::atomic<std::size_t> generation{0};
+    return generation;
+}
+
+std::size_t Db::GetGeneration() { return DbGeneration().load(); }
+
 using exclusive_lock = std::unique_lock<LockFile>;
 using shared_lock    = std::shared_lock<LockFile>;
 
 boost::optional<DbRecord> Db::FindRecord(const std::string& key)
 {
+    MIOPEN_TRACE_SCOPE("db", "Db::FindRecord " << filename);
     const auto lock = shared_lock(lock_file, GetLockTimeout());
     MIOPEN_VALIDATE_LOCK(lock);
     return FindRecordUnsafe(key, nullptr);
@@ -289,6 +300,7 @@ bool Db::FlushUnsafe(const DbRecord& record, const RecordPositions* pos)
         std::rename(temp_name.c_str(), filename.c_str());
         /// \todo What if rename fails? Thou shalt not loose the original file.
     }
+    ++DbGeneration();
     return true;
 }
 
@@ -0,0 +1,448 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/fft_host.hpp>
+#include <miopen/gemm_host.hpp>
+#include <miopen/parallel_for.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <utility>
+
+namespace miopen {
+namespace host {
+
+namespace {
+
+// Plain complex arithmetic: std::complex multiplies through the NaN-checking runtime helper
+struct Complex
+{
+    float re;
+    float im;
+};
+
+inline Complex operator+(Complex a, Complex b) { return {a.re + b.re, a.im + b.im}; }
+inline Complex operator-(Complex a, Complex b) { return {a.re - b.re, a.im - b.im}; }
+inline Complex Mul(Complex a, Complex b)
+{
+    return {a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re};
+}
+inline Complex Conj(Complex a) { return {a.re, -a.im}; }
+
+/// Smallest 2^a 3^b that is at least n.
+int FFTSize(int n)
+{
+    int best = 1;
+    while(best < n)
+        best *= 2;
+    for(int p3 = 3; p3 < 2 * n; p3 *= 3)
+        for(int x = p3; x < best; x *= 2)
+            if(x >= n)
+            {
+                best = x;
+                break;
+            }
+    return best;
+}
+
+// Bytes of spectra and products that Run keeps for one group of images.
+constexpr std::size_t group_bytes = std::size_t{64} << 20;
+
+} // namespace
+
+/// A Stockham FFT of length n = 2^a 3^b, which needs no bit reversal and reads and writes
+/// consecutive elements in every pass.
+struct FFTPlan1D
+{
+    int n;
+    std::vector<int> radices;
+    /// Per pass with radix R after a span of ns, (R - 1) forward twiddles for each of the ns
+    /// butterfly positions.
+    std::vector<std::vector<Complex>> twiddles;
+
+    explicit FFTPlan1D(int pn) : n(pn)
+    {
+        int rest = n;
+        while(rest % 3 == 0)
+        {
+            radices.push_back(3);
+            rest /= 3;
+        }
+        while(rest % 2 == 0)
+        {
+            radices.push_back(2);
+            rest /= 2;
+        }
+        if(rest != 1)
+            MIOPEN_THROW("FFT size must be of the form 2^a 3^b");
+
+        int ns = 1;
+        for(int radix : radices)
+        {
+            std::vector<Complex> tw(std::size_t(ns) * (radix - 1));
+            for(int k = 0; k < ns; k++)
+                for(int r = 1; r < radix; r++)
+                {
+                    const double angle = -2 * M_PI * r * k / (double(ns) * radix);
+                    tw[k * (radix - 1) + r - 1] = {static_cast<float>(std::cos(angle)),
+                                                   static_cast<float>(std::sin(angle))};
+                }
+            twiddles.push_back(std::move(tw));
+            ns *= radix;
+        }
+    }
+
+    /// Transforms batch sequences in place, element e of sequence b being x[e * batch + b].
+    /// work holds as many values. The inverse is not scaled.
+    void Run(Complex* x, Complex* work, std::size_t batch, bool inverse) const
+    {
+        const float sin60 = (inverse ? 1.0f : -1.0f) * 0.866025403784438646763723f;
+        Complex* in       = x;
+        Complex* out      = work;
+        std::size_t ns    = 1;
+        for(std::size_t pass = 0; pass < radices.size(); pass++)
+        {
+            const std::size_t radix  = radices[pass];
+            const std::size_t stride = n / radix;
+            for(std::size_t j = 0; j < stride; j++)
+            {
+                const std::size_t k = j % ns;
+                const std::size_t o = (j / ns) * ns * radix + k;
+                const Complex* tw   = twiddles[pass].data() + k * (radix - 1);
+                const Complex* a    = in + j * batch;
+                Complex* y          = out + o * batch;
+                if(radix == 2)
+                {
+                    const Complex w1 = inverse ? Conj(tw[0]) : tw[0];
+                    const Complex* b = a + stride * batch;
+                    Complex* y1      = y + ns * batch;
+                    for(std::size_t i = 0; i < batch; i++)
+                    {
+                        const Complex v1 = Mul(b[i], w1);
+                        y[i]             = a[i] + v1;
+                        y1[i]            = a[i] - v1;
+                    }
+                }
+                else
+                {
+                    const Complex w1 = inverse ? Conj(tw[0]) : tw[0];
+                    const Complex w2 = inverse ? Conj(tw[1]) : tw[1];
+                    const Complex* b = a + stride * batch;
+                    const Complex* c = b + stride * batch;
+                    Complex* y1      = y + ns * batch;
+                    Complex* y2      = y1 + ns * batch;
+                    for(std::size_t i = 0; i < batch; i++)
+                    {
+                        const Complex v1 = Mul(b[i], w1);
+                        const Complex v2 = Mul(c[i], w2);
+                        const Complex t1 = v1 + v2;
+                        const Complex t2 = {a[i].re - 0.5f * t1.re, a[i].im - 0.5f * t1.im};
+                        const Complex d  = {sin60 * (v1.re - v2.re), sin60 * (v1.im - v2.im)};
+                        y[i]             = a[i] + t1;
+                        y1[i]            = {t2.re - d.im, t2.im + d.re};
+                        y2[i]            = {t2.re + d.im, t2.im - d.re};
+                    }
+                }
+            }
+            std::swap(in, out);
+            ns *= radix;
+        }
+        if(in != x)
+            std::copy(in, in + std::size_t(n) * batch, x);
+    }
+};
+
+/// The real 2-D FFT of h x w tiles. A spectrum holds the h x (w / 2 + 1) non-redundant bins.
+struct FFTPlan2D
+{
+    int h;
+    int w;
+    FFTPlan1D cols;
+    FFTPlan1D rows;
+
+    FFTPlan2D(int ph, int pw) : h(ph), w(pw), cols(ph), rows(pw) {}
+
+    std::size_t Width() const { return w / 2 + 1; }
+    std::size_t Bins() const { return h * Width(); }
+    /// Complex values of scratch that Forward and Inverse need.
+    std::size_t WorkSize() const { return Bins() + 2 * std::size_t(w); }
+
+    /// Transforms the ph x pw plane placed at (oy, ox) of a zero tile. Two real rows are
+    /// transformed at once as the real and imaginary parts of one complex row.
+    void Forward(const float* plane, int ph, int pw, int oy, int ox, Complex* spectrum, Complex* work)
+        const
+    {
+        const std::size_t wc = Width();
+        Complex* z           = work;
+        Complex* zw          = work + w;
+        const auto row       = [&](int y) { return y - oy >= 0 && y - oy < ph; };
+        for(int y = 0; y < h; y += 2)
+        {
+            Complex* sa = spectrum + y * wc;
+            Complex* sb = y + 1 < h ? sa + wc : nullptr;
+            if(!row(y) && (y + 1 >= h || !row(y + 1)))
+            {
+                std::fill(sa, sa + wc, Complex{0, 0});
+                if(sb != nullptr)
+                    std::fill(sb, sb + wc, Complex{0, 0});
+                continue;
+            }
+            std::fill(z, z + w, Complex{0, 0});
+            for(int x = 0; x < pw; x++)
+            {
+                if(row(y))
+                    z[x + ox].re = plane[std::size_t(y - oy) * pw + x];
+                if(y + 1 < h && row(y + 1))
+                    z[x + ox].im = plane[std::size_t(y + 1 - oy) * pw + x];
+            }
+            rows.Run(z, zw, 1, false);
+            // Split the spectra of the two rows by their symmetry
+            for(std::size_t k = 0; k < wc; k++)
+            {
+                const Complex zk = z[k];
+                const Complex zn = Conj(z[(w - k) % w]);
+                sa[k]            = {0.5f * (zk.re + zn.re), 0.5f * (zk.im + zn.im)};
+                if(sb != nullptr)
+                    sb[k] = {0.5f * (zk.im - zn.im), -0.5f * (zk.re - zn.re)};
+            }
+        }
+        cols.Run(spectrum, work, wc, false);
+    }
+
+    /// Transforms a spectrum back, scaled, and writes its first oh x ow values to plane.
+    void Inverse(Complex* spectrum, float* plane, int oh, int ow, Complex* work) const
+    {
+        const std::size_t wc = Width();
+        cols.Run(spectrum, work, wc, true);
+
+        Complex* z        = work;
+        Complex* zw       = work + w;
+        const float scale = 1.0f / (float(h) * w);
+        for(int y = 0; y < oh; y += 2)
+        {
+            const Complex* sa = spectrum + y * wc;
+            const Complex* sb = y + 1 < h ? sa + wc : nullptr;
+            for(int k = 0; k < w; k++)
+            {
+                const bool low  = std::size_t(k) < wc;
+                const Complex a = low ? sa[k] : Conj(sa[w - k]);
+                const Complex b =
+                    sb == nullptr ? Complex{0, 0} : (low ? sb[k] : Conj(sb[w - k]));
+                z[k] = {a.re - b.im, a.im + b.re};
+            }
+            rows.Run(z, zw, 1, true);
+            for(int x = 0; x < ow; x++)
+            {
+                plane[std::size_t(y) * ow + x] = z[x].re * scale;
+                if(y + 1 < oh)
+                    plane[std::size_t(y + 1) * ow + x] = z[x].im * scale;
+            }
+        }
+    }
+};
+
+namespace {
+
+std::shared_ptr<const FFTPlan2D> GetPlan(int h, int w)
+{
+    static std::mutex mutex;
+    static std::map<std::pair<int, int>, std::shared_ptr<const FFTPlan2D>> plans;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& plan = plans[std::make_pair(h, w)];
+    if(plan == nullptr)
+        plan = std::make_shared<FFTPlan2D>(h, w);
+    return plan;
+}
+
+} // namespace
+
+FFTConv::FFTConv(int pk,
+                 int pc,
+                 int pr,
+                 int ps,
+                 int pin_h,
+                 int pin_w,
+                 int ppad_h,
+                 int ppad_w,
+                 const float* w,
+                 bool backward)
+    : k(backward ? pc : pk),
+      c(backward ? pk : pc),
+      r(pr),
+      s(ps),
+      in_h(pin_h),
+      in_w(pin_w),
+      // The transposed convolution pads by the filter overhang the forward one did not use
+      pad_h(backward ? pr - 1 - ppad_h : ppad_h),
+      pad_w(backward ? ps - 1 - ppad_w : ppad_w)
+{
+    if(pad_h < 0 || pad_w < 0)
+        MIOPEN_THROW(miopenStatusBadParm, "FFT convolution needs non-negative pads");
+    out_h = in_h + 2 * pad_h - r + 1;
+    out_w = in_w + 2 * pad_w - s + 1;
+    if(out_h < 1 || out_w < 1)
+        MIOPEN_THROW(miopenStatusBadParm, "The filter is larger than the padded input");
+
+    // Tiles hold the padded input, so the circular correlation does not wrap into the outputs
+    plan = GetPlan(FFTSize(in_h + 2 * pad_h), FFTSize(in_w + 2 * pad_w));
+
+    const std::size_t bins = plan->Bins();
+    const std::size_t ld   = 2 * std::size_t(c);
+    wf.resize(bins * k * ld);
+    ParallelFor(std::size_t(k) * c, 1, [&](std::size_t begin, std::size_t end) {
+        std::vector<float> filter(std::size_t(r) * s);
+        std::vector<Complex> spectrum(bins);
+        std::vector<Complex> work(plan->WorkSize());
+        for(std::size_t i = begin; i < end; i++)
+        {
+            const std::size_t ko = i / c;
+            const std::size_t ci = i % c;
+            // Backward data convolves with the flipped filter of the swapped channels
+            const float* f = backward ? w + (ci * pc + ko) * r * s : w + (ko * pc + ci) * r * s;
+            for(int y = 0; y < r; y++)
+                for(int x = 0; x < s; x++)
+                    filter[y * s + x] =
+                        backward ? f[std::size_t(r - 1 - y) * s + s - 1 - x] : f[y * s + x];
+
+            plan->Forward(filter.data(), r, s, 0, 0, spectrum.data(), work.data());
+            for(std::size_t bin = 0; bin < bins; bin++)
+            {
+                wf[(bin * k + ko) * ld + ci]     = spectrum[bin].re;
+                wf[(bin * k + ko) * ld + c + ci] = spectrum[bin].im;
+            }
+        }
+    });
+}
+
+std::size_t FFTConv::TileSize() const { return plan->Bins(); }
+
+std::size_t FFTConv::SpectraSize(int n) const
+{
+    return plan->Bins() * 2 * sizeof(float) * (std::size_t(n) * c + std::size_t(k) * c);
+}
+
+void FFTConv::Run(int n, const float* in, float* out) const
+{
+    const std::size_t bins     = plan->Bins();
+    const std::size_t ld       = 2 * std::size_t(c);
+    const std::size_t in_size  = std::size_t(c) * in_h * in_w;
+    const std::size_t out_size = std::size_t(k) * out_h * out_w;
+    // Per frequency, the spectra of a group take 2g x 2c values and the products 2g x k
+    const std::size_t per_image = bins * (2 * ld + 2 * std::size_t(k)) * sizeof(float);
+    const int group = std::max(1, std::min<int>(n, group_bytes / per_image));
+
+    std::vector<float> xf(bins * 2 * group * ld);
+    std::vector<float> yf(bins * 2 * group * k);
+
+    for(int first = 0; first < n; first += group)
+    {
+        const std::size_t g = std::min(group, n - first);
+
+        // Per frequency, rows [Xr | Xi] of the images over [Xi | -Xr], so that one real GEMM
+        // with [Wr | Wi] gives the real parts of X conj(W) over the imaginary parts
+        ParallelFor(g * c, 1, [&](std::size_t begin, std::size_t end) {
+            std::vector<Complex> spectrum(bins);
+            std::vector<Complex> work(plan->WorkSize());
+            for(std::size_t i = begin; i < end; i++)
+            {
+                const std::size_t img = i / c;
+                const std::size_t ci  = i % c;
+                plan->Forward(in + (first + img) * in_size + ci * in_h * in_w,
+                              in_h,
+                              in_w,
+                              pad_h,
+                              pad_w,
+                              spectrum.data(),
+                              work.data());
+                for(std::size_t bin = 0; bin < bins; bin++)
+                {
+                    float* x   = &xf[(bin * 2 * g + img) * ld];
+                    float* xs  = x + g * ld;
+                    x[ci]      = spectrum[bin].re;
+                    x[c + ci]  = spectrum[bin].im;
+                    xs[ci]     = spectrum[bin].im;
+                    xs[c + ci] = -spectrum[bin].re;
+                }
+            }
+        });
+
+        ParallelFor(bins, 1, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t bin = begin; bin < end; bin++)
+                Gemm(false,
+                     true,
+                     2 * g,
+                     k,
+                     ld,
+                     1.0f,
+                     &xf[bin * 2 * g * ld],
+                     ld,
+                     &wf[bin * k * ld],
+                     ld,
+                     0.0f,
+                     &yf[bin * 2 * g * k],
+                     k);
+        });
+
+        ParallelFor(g * k, 1, [&](std::size_t begin, std::size_t end) {
+            std::vector<Complex> spectrum(bins);
+            std::vector<Complex> work(plan->WorkSize());
+            for(std::size_t i = begin; i < end; i++)
+            {
+                const std::size_t img = i / k;
+                const std::size_t ko  = i % k;
+                for(std::size_t bin = 0; bin < bins; bin++)
+                    spectrum[bin] = {yf[(bin * 2 * g + img) * k + ko],
+                                     yf[(bin * 2 * g + g + img) * k + ko]};
+                plan->Inverse(spectrum.data(),
+                              out + (first + img) * out_size + ko * out_h * out_w,
+                              out_h,
+                              out_w,
+                              work.data());
+            }
+        });
+    }
+}
+
+bool IsFFTApplicable(const ConvolutionDescriptor& conv,
+                     const TensorDescriptor& wDesc,
+                     bool backward)
+{
+    const auto& lens = wDesc.GetLengths();
+    if(lens.size() != 4 || lens[2] < 5 || lens[3] < 5)
+        return false;
+    if(conv.u != 1 || conv.v != 1 || conv.dilation_h != 1 || conv.dilation_w != 1)
+        return false;
+    if(conv.pad_h < 0 || conv.pad_w < 0)
+        return false;
+    return !backward || (std::size_t(conv.pad_h) < lens[2] && std::size_t(conv.pad_w) < lens[3]);
+}
+
+} // namespace host
+} // namespace miopen
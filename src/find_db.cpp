@@ -0,0 +1,120 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/find_db.hpp>
+#include <miopen/db_path.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+
+namespace miopen {
+
+FindDb::FindDb(const std::string& installed_path, const std::string& user_path, std::string key_)
+    : db(installed_path, user_path), key(std::move(key_))
+{
+}
+
+FindDb::FindDb(Handle& handle, std::string key_)
+    : FindDb(GetInstalledPath(handle), GetUserPath(handle), std::move(key_))
+{
+}
+
+static std::string GetDeviceFileName(Handle& handle)
+{
+    return handle.GetDeviceName() + "_" + std::to_string(handle.GetMaxComputeUnits());
+}
+
+std::string FindDb::GetInstalledPath(Handle& handle)
+{
+    return GetDbPath() + "/" + GetDeviceFileName(handle) + ".cd.fdb.txt";
+}
+
+std::string FindDb::GetUserPath(Handle& handle)
+{
+    return GetUserDbPath() + "/" + GetDeviceFileName(handle) + ".cd.ufdb.txt";
+}
+
+boost::optional<FindDbResults> FindDb::Load(const std::vector<std::string>& algorithms,
+                                            const std::size_t workspace_limit,
+                                            const bool require_searched)
+{
+    const auto record = db.FindRecord(Key{key});
+    if(!record)
+        return boost::none;
+
+    FindDbResults results;
+    for(const auto& algorithm : algorithms)
+    {
+        FindDbData data;
+        if(!record->GetValues(algorithm, data))
+            continue;
+        if(require_searched && data.searched == 0)
+        {
+            MIOPEN_LOG_I("Find Db: record is not auto-tuned: " << key);
+            return boost::none;
+        }
+        if(data.workspace_limit < workspace_limit)
+        {
+            MIOPEN_LOG_I("Find Db: record is measured with less workspace: " << key);
+            return boost::none;
+        }
+        if(data.workspace > workspace_limit)
+            continue;
+        results.emplace_back(algorithm, data);
+    }
+    if(results.empty())
+        return boost::none;
+
+    std::stable_sort(results.begin(), results.end(), [](const auto& l, const auto& r) {
+        return l.second.time < r.second.time;
+    });
+    return results;
+}
+
+boost::optional<FindDbData> FindDb::Load(const std::string& algorithm)
+{
+    const auto record = db.FindRecord(Key{key});
+    if(!record)
+        return boost::none;
+
+    FindDbData data;
+    if(!record->GetValues(algorithm, data))
+        return boost::none;
+    return data;
+}
+
+bool FindDb::Store(const FindDbResults& results)
+{
+    DbRecord record(Key{key});
+    for(const auto& result : results)
+        record.SetValues(result.first, result.second);
+    return db.StoreRecord(record);
+}
+
+bool FindDb::Remove() { return db.RemoveRecord(Key{key}); }
+
+} // namespace miopen
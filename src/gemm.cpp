@@ -165,7 +165,8 @@ GemmGeometry CreateGemmGeometryConvBwdWeights(const TensorDescriptor& dyDesc,
                                               const TensorDescriptor& xDesc,
                                               const TensorDescriptor& dwDesc,
                                               bool isDataColMajor,
-                                              std::string& network_config)
+                                              std::string& network_config,
+                                              int chunk)
 {
     int in_n, in_c, in_h, in_w;
     std::tie(in_n, in_c, in_h, in_w) = tien<4>(xDesc.GetLengths());
@@ -179,7 +180,7 @@ GemmGeometry CreateGemmGeometryConvBwdWeights(const TensorDescriptor& dyDesc,
     // GEMM
     int N       = in_c * wei_h * wei_w;
     int M       = wei_n;
-    int K       = out_h * out_w;
+    int K       = chunk * out_h * out_w;
     bool tA     = false;
     bool tB     = true;
     bool tC     = false;
@@ -209,7 +210,8 @@ GemmGeometry CreateGemmGeometryConvFwd(const TensorDescriptor& xDesc,
                                        const TensorDescriptor& wDesc,
                                        const TensorDescriptor& yDesc,
                                        bool isDataColMajor,
-                                       std::string& network_config)
+                                       std::string& network_config,
+                                       int chunk)
 {
     int in_n, in_c, in_h, in_w;
     std::tie(in_n, in_c, in_h, in_w) = tien<4>(xDesc.GetLengths());
@@ -223,7 +225,7 @@ GemmGeometry CreateGemmGeometryConvFwd(const TensorDescriptor& xDesc,
     // GEMM
     int K       = in_c * wei_h * wei_w;
     int M       = wei_n;
-    int N       = out_h * out_w;
+    int N       = chunk * out_h * out_w;
     float alpha = 1.0;
     float beta  = 0.0;
     bool tA     = false;
@@ -330,16 +332,13 @@ GemmGeometry CreateMIOpenGemmGeometry(int M,
 
 GemmGeometry GetGemmGeometry(Handle& handle, std::string algorithm_name, std::string network_config)
 {
-    auto gemm_iterator = handle.geo_map.find(std::make_pair(algorithm_name, network_config));
-    if(gemm_iterator != handle.geo_map.end())
-    {
-        return *gemm_iterator->second;
-    }
-    else
+    GemmGeometry gg;
+    if(!FindGemmGeometry(handle, std::make_pair(algorithm_name, network_config), gg))
     {
         MIOPEN_THROW("looking for gemm kernel (does not exist): " + algorithm_name + ", " +
                      network_config);
     }
+    return gg;
 }
 
 GemmGeometry CreateGemmGeometryRNN(int M,
@@ -391,12 +390,7 @@ GemmGeometry ScanGemmGeometryRNN(Handle& handle,
     auto gg = CreateGemmGeometryRNN(
         M, N, K, alpha, beta, tA, tB, tC, lda, ldb, ldc, isDataColMajor, network_config);
 
-    auto gemm_iterator = handle.geo_map.find(std::make_pair("miopenRNNAlgoGEMM", network_config));
-    if(gemm_iterator != handle.geo_map.end())
-    {
-        gg = *gemm_iterator->second;
-    }
-    else
+    if(!FindGemmGeometry(handle, std::make_pair("miopenRNNAlgoGEMM", network_config), gg))
     {
         gg.FindSolution(timeout, handle, A, B, C, false);
     }
@@ -23,11 +23,21 @@
  * SOFTWARE.
  *
  *******************************************************************************/
+#include <miopen/db.hpp>
+#include <miopen/db_path.hpp>
 #include <miopen/float_equal.hpp>
 #include <miopen/gemm_geometry.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
 #include <regex>
 
 #if MIOPEN_USE_MIOPENGEMM
+#if MIOPEN_BACKEND_OPENCL
+#include <miopengemm/bundle.hpp>
+#include <miopengemm/hyperparams.hpp>
+#include <miopengemm/outputwriter.hpp>
+#endif
+
 namespace miopen {
 
 // so that MIOpen works whether or not recent MIOpenGEMM changes pulled:
@@ -54,11 +64,145 @@ void set_offsets_to_uint(std::string& clstr)
 
 void GemmGeometry::EnableBetaKernel(bool enable) { beta_kern_req = enable; }
 
+// Registers the kernels of a MIOpenGEMM solution under the geometry and caches the
+// geometry in the handle.
+template <class Kernels>
+static void AddGemmKernels(GemmGeometry& gg, Handle& handle, const Kernels& v_tgks)
+{
+    // jn : the main kernel is at the back of the solution vector
+    std::string kernel_clstring = v_tgks.back().kernstr;
+    tempfix::set_offsets_to_uint(kernel_clstring);
+
+    std::string kernel_name    = v_tgks.back().fname;
+    std::string network_config = gg.tgg.get_networkconfig_string();
+    size_t local_work_size     = v_tgks.back().local_work_size;
+    size_t global_work_size    = v_tgks.back().global_work_size;
+
+    std::vector<size_t> vld{local_work_size, 1, 1};
+    std::vector<size_t> vgd{global_work_size, 1, 1};
+
+    handle.AddKernel(
+        gg.algorithm_name, network_config, kernel_clstring, kernel_name, vld, vgd, "");
+
+    if(v_tgks.size() == 2)
+    {
+        gg.beta_kern_returned = true;
+    }
+
+    // jn : case where the beta kernel is part of the solution
+    if(v_tgks.size() == 2 && !miopen::float_equal(gg.beta, 1))
+    {
+        std::string beta_program_name = v_tgks[0].kernstr;
+        tempfix::set_offsets_to_uint(beta_program_name);
+
+        std::string beta_kernel_name = v_tgks[0].fname;
+        local_work_size              = v_tgks[0].local_work_size;
+        global_work_size             = v_tgks[0].global_work_size;
+
+        gg.EnableBetaKernel(true);
+
+        vld[0] = local_work_size;
+        vgd[0] = global_work_size;
+
+        handle.AddKernel(
+            gg.algorithm_name + "_beta",
+            network_config, // jn : different network_configs require different beta kernels
+            beta_program_name,
+            beta_kernel_name,
+            vld,
+            vgd,
+            "");
+    }
+    AddGemmGeometry(handle, std::make_pair(gg.algorithm_name, network_config), gg);
+}
+
+bool FindGemmGeometry(Handle& handle, const GemmKey& key, GemmGeometry& gg)
+{
+    std::lock_guard<std::mutex> lock(*handle.geo_map_mutex);
+    const auto it = handle.geo_map.find(key);
+    if(it == handle.geo_map.end())
+        return false;
+    gg = *it->second;
+    return true;
+}
+
+void AddGemmGeometry(Handle& handle, const GemmKey& key, const GemmGeometry& gg)
+{
+    std::lock_guard<std::mutex> lock(*handle.geo_map_mutex);
+    handle.geo_map[key] = std::make_unique<GemmGeometry>(gg);
+}
+
+#if MIOPEN_BACKEND_OPENCL
+// The perf db files of the device, shared with the solvers.
+static std::string GetGemmDbPath(Handle& handle, const std::string& directory, const char* ext)
+{
+    return directory + "/" + handle.GetDeviceName() + "_" +
+           std::to_string(handle.GetMaxComputeUnits()) + ext;
+}
+
+static MultiFileDb GetGemmDb(Handle& handle)
+{
+    return {GetGemmDbPath(handle, GetDbPath(), ".cd.pdb.txt"),
+            GetGemmDbPath(handle, GetUserDbPath(), ".cd.updb.txt")};
+}
+
+// Determinism restricts the hyper-parameters MIOpenGEMM may select, so such
+// solutions are recorded separately.
+static std::string GetGemmDbId(bool enforce_determinism)
+{
+    return enforce_determinism ? "MIOpenGEMM_deterministic" : "MIOpenGEMM";
+}
+#endif
+
+bool GemmGeometry::LoadSolution(Handle& handle, bool enforce_determinism)
+{
+#if MIOPEN_BACKEND_OPENCL
+    const auto network_config = tgg.get_networkconfig_string();
+
+    GemmDbData data;
+    if(!GetGemmDb(handle).Load(network_config, GetGemmDbId(enforce_determinism), data))
+        return false;
+
+    // jn : generate the kernels of the recorded hyper-parameters, no search
+    decltype(MIOpenGEMM::Solution::v_tgks) v_tgks;
+    try
+    {
+        MIOpenGEMM::owrite::Writer mowri(MIOpenGEMM::Ver::E::SILENT, "");
+        v_tgks = MIOpenGEMM::kerngen::get_bundle(
+                     MIOpenGEMM::HyPas(data.hyper_params), tgg, mowri, false)
+                     .v_tgks;
+    }
+    catch(const std::exception& ex)
+    {
+        MIOPEN_LOG_W("Perf Db: invalid MIOpenGEMM record " << network_config << ": "
+                                                           << ex.what());
+        return false;
+    }
+
+    if(v_tgks.empty() || (v_tgks.size() == 2) != (data.beta_kern_returned != 0))
+    {
+        MIOPEN_LOG_W("Perf Db: MIOpenGEMM record does not match its kernels: " << network_config);
+        return false;
+    }
+
+    MIOPEN_LOG_I2("Perf Db: MIOpenGEMM record loaded: " << network_config);
+    AddGemmKernels(*this, handle, v_tgks);
+    return true;
+#else
+    (void)handle;
+    (void)enforce_determinism;
+    return false;
+#endif
+}
+
 void GemmGeometry::FindSolution(
     float time, Handle& handle, ConstData_t a, ConstData_t b, Data_t c, bool enforce_determinism)
 {
 
 #if MIOPEN_BACKEND_OPENCL
+    if(LoadSolution(handle, enforce_determinism))
+        return;
+
     // jn : print search results to terminal
     bool miopengemm_verbose = false;
 
@@ -75,6 +219,13 @@ void GemmGeometry::FindSolution(
                                                  tgg,
                                                  miopengemm_verbose,
                                                  miopengemm_warnings);
+
+    GemmDbData data;
+    data.hyper_params       = soln.get_hyper_param_string();
+    data.beta_kern_returned = soln.v_tgks.size() == 2 ? 1 : 0;
+    if(!GetGemmDb(handle).Update(
+           tgg.get_networkconfig_string(), GetGemmDbId(enforce_determinism), data))
+        MIOPEN_LOG_W("Perf Db: failed to store MIOpenGEMM record");
 #else
     (void)time;
     (void)a;
@@ -87,51 +238,7 @@ void GemmGeometry::FindSolution(
     MIOpenGEMM::Solution soln = MIOpenGEMM::get_default(tgg);
 #endif
 
-    // jn : the main kernel is at the back of the solution vector
-    std::string kernel_clstring = soln.v_tgks.back().kernstr;
-    tempfix::set_offsets_to_uint(kernel_clstring);
-
-    std::string kernel_name    = soln.v_tgks.back().fname;
-    std::string network_config = tgg.get_networkconfig_string();
-    size_t local_work_size     = soln.v_tgks.back().local_work_size;
-    size_t global_work_size    = soln.v_tgks.back().global_work_size;
-
-    std::vector<size_t> vld{local_work_size, 1, 1};
-    std::vector<size_t> vgd{global_work_size, 1, 1};
-
-    handle.AddKernel(algorithm_name, network_config, kernel_clstring, kernel_name, vld, vgd, "");
-
-    if(soln.v_tgks.size() == 2)
-    {
-        beta_kern_returned = true;
-    }
-
-    // jn : case where the beta kernel is part of the solution
-    if(soln.v_tgks.size() == 2 && !miopen::float_equal(beta, 1))
-    {
-        std::string beta_program_name = soln.v_tgks[0].kernstr;
-        tempfix::set_offsets_to_uint(beta_program_name);
-
-        std::string beta_kernel_name = soln.v_tgks[0].fname;
-        local_work_size              = soln.v_tgks[0].local_work_size;
-        global_work_size             = soln.v_tgks[0].global_work_size;
-
-        EnableBetaKernel(true);
-
-        vld[0] = local_work_size;
-        vgd[0] = global_work_size;
-
-        handle.AddKernel(
-            algorithm_name + "_beta",
-            network_config, // jn : different network_configs require different beta kernels
-            beta_program_name,
-            beta_kernel_name,
-            vld,
-            vgd,
-            "");
-    }
-    handle.geo_map[std::make_pair(algorithm_name, network_config)] =
-        std::make_unique<GemmGeometry>(*this);
+    AddGemmKernels(*this, handle, soln.v_tgks);
 }
 
 void GemmGeometry::RunGemm(Handle& handle,
@@ -0,0 +1,500 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#include <miopen/errors.hpp>
+#include <miopen/gemm_host.hpp>
+#include <miopen/parallel_for.hpp>
+
+#include <algorithm>
+#include <vector>
+
+// The SIMD micro-kernels are compiled for their instruction set with target attributes and
+// picked at run time, so the library does not need to be built for a particular CPU.
+#if(defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define MIOPEN_GEMM_HOST_X86 1
+#include <immintrin.h>
+#else
+#define MIOPEN_GEMM_HOST_X86 0
+#endif
+
+namespace miopen {
+namespace host {
+
+namespace {
+
+// Rows of C computed by one call of a micro-kernel.
+constexpr std::size_t MR = 6;
+// Widest register block, NR of the AVX-512 micro-kernel.
+constexpr std::size_t max_nr = 32;
+// Cache blocks: a KC x NR sliver of op(B) stays in L1, an MC x KC block of op(A) in L2 and a
+// KC x NC panel of op(B) in L3.
+constexpr std::size_t KC = 256;
+constexpr std::size_t MC = 16 * MR;
+constexpr std::size_t NC = 4096;
+// Tiles of C per thread, so that tiles of uneven cost still balance.
+constexpr std::size_t tiles_per_thread = 4;
+// Multiply-adds below which the product stays on the calling thread.
+constexpr std::size_t gemm_grain = 1 << 18;
+// Elements of C scaled by beta as one piece of work.
+constexpr std::size_t scale_grain = 1 << 15;
+
+/// ab = a * b for an MR x kc sliver a of op(A) and a kc x nr sliver b of op(B), both packed
+/// along k. ab is MR x nr, row-major.
+using MicroKernel = void (*)(std::size_t kc, const float* a, const float* b, float* ab);
+
+struct KernelInfo
+{
+    std::size_t nr;
+    MicroKernel run;
+};
+
+void MicroKernelScalar(std::size_t kc, const float* a, const float* b, float* ab)
+{
+    constexpr std::size_t NR = 16;
+    float acc[MR][NR]        = {};
+    for(std::size_t k = 0; k < kc; k++, a += MR, b += NR)
+        for(std::size_t i = 0; i < MR; i++)
+            for(std::size_t j = 0; j < NR; j++)
+                acc[i][j] += a[i] * b[j];
+    std::copy(&acc[0][0], &acc[0][0] + MR * NR, ab);
+}
+
+#if MIOPEN_GEMM_HOST_X86
+// 6 x 2 accumulators of 8 floats
+__attribute__((target("avx2,fma"))) void
+MicroKernelAvx2(std::size_t kc, const float* a, const float* b, float* ab)
+{
+    constexpr std::size_t NR = 16;
+    __m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+    __m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+    __m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+    __m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+    __m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+    __m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+    for(std::size_t k = 0; k < kc; k++, a += MR, b += NR)
+    {
+        const __m256 b0 = _mm256_loadu_ps(b);
+        const __m256 b1 = _mm256_loadu_ps(b + 8);
+        __m256 x        = _mm256_broadcast_ss(a + 0);
+        c00             = _mm256_fmadd_ps(x, b0, c00);
+        c01             = _mm256_fmadd_ps(x, b1, c01);
+        x               = _mm256_broadcast_ss(a + 1);
+        c10             = _mm256_fmadd_ps(x, b0, c10);
+        c11             = _mm256_fmadd_ps(x, b1, c11);
+        x               = _mm256_broadcast_ss(a + 2);
+        c20             = _mm256_fmadd_ps(x, b0, c20);
+        c21             = _mm256_fmadd_ps(x, b1, c21);
+        x               = _mm256_broadcast_ss(a + 3);
+        c30             = _mm256_fmadd_ps(x, b0, c30);
+        c31             = _mm256_fmadd_ps(x, b1, c31);
+        x               = _mm256_broadcast_ss(a + 4);
+        c40             = _mm256_fmadd_ps(x, b0, c40);
+        c41             = _mm256_fmadd_ps(x, b1, c41);
+        x               = _mm256_broadcast_ss(a + 5);
+        c50             = _mm256_fmadd_ps(x, b0, c50);
+        c51             = _mm256_fmadd_ps(x, b1, c51);
+    }
+    _mm256_storeu_ps(ab + 0 * NR, c00);
+    _mm256_storeu_ps(ab + 0 * NR + 8, c01);
+    _mm256_storeu_ps(ab + 1 * NR, c10);
+    _mm256_storeu_ps(ab + 1 * NR + 8, c11);
+    _mm256_storeu_ps(ab + 2 * NR, c20);
+    _mm256_storeu_ps(ab + 2 * NR + 8, c21);
+    _mm256_storeu_ps(ab + 3 * NR, c30);
+    _mm256_storeu_ps(ab + 3 * NR + 8, c31);
+    _mm256_storeu_ps(ab + 4 * NR, c40);
+    _mm256_storeu_ps(ab + 4 * NR + 8, c41);
+    _mm256_storeu_ps(ab + 5 * NR, c50);
+    _mm256_storeu_ps(ab + 5 * NR + 8, c51);
+}
+
+// 6 x 2 accumulators of 16 floats
+__attribute__((target("avx512f"))) void
+MicroKernelAvx512(std::size_t kc, const float* a, const float* b, float* ab)
+{
+    constexpr std::size_t NR = 32;
+    __m512 c00 = _mm512_setzero_ps(), c01 = _mm512_setzero_ps();
+    __m512 c10 = _mm512_setzero_ps(), c11 = _mm512_setzero_ps();
+    __m512 c20 = _mm512_setzero_ps(), c21 = _mm512_setzero_ps();
+    __m512 c30 = _mm512_setzero_ps(), c31 = _mm512_setzero_ps();
+    __m512 c40 = _mm512_setzero_ps(), c41 = _mm512_setzero_ps();
+    __m512 c50 = _mm512_setzero_ps(), c51 = _mm512_setzero_ps();
+    for(std::size_t k = 0; k < kc; k++, a += MR, b += NR)
+    {
+        const __m512 b0 = _mm512_loadu_ps(b);
+        const __m512 b1 = _mm512_loadu_ps(b + 16);
+        __m512 x        = _mm512_set1_ps(a[0]);
+        c00             = _mm512_fmadd_ps(x, b0, c00);
+        c01             = _mm512_fmadd_ps(x, b1, c01);
+        x               = _mm512_set1_ps(a[1]);
+        c10             = _mm512_fmadd_ps(x, b0, c10);
+        c11             = _mm512_fmadd_ps(x, b1, c11);
+        x               = _mm512_set1_ps(a[2]);
+        c20             = _mm512_fmadd_ps(x, b0, c20);
+        c21             = _mm512_fmadd_ps(x, b1, c21);
+        x               = _mm512_set1_ps(a[3]);
+        c30             = _mm512_fmadd_ps(x, b0, c30);
+        c31             = _mm512_fmadd_ps(x, b1, c31);
+        x               = _mm512_set1_ps(a[4]);
+        c40             = _mm512_fmadd_ps(x, b0, c40);
+        c41             = _mm512_fmadd_ps(x, b1, c41);
+        x               = _mm512_set1_ps(a[5]);
+        c50             = _mm512_fmadd_ps(x, b0, c50);
+        c51             = _mm512_fmadd_ps(x, b1, c51);
+    }
+    _mm512_storeu_ps(ab + 0 * NR, c00);
+    _mm512_storeu_ps(ab + 0 * NR + 16, c01);
+    _mm512_storeu_ps(ab + 1 * NR, c10);
+    _mm512_storeu_ps(ab + 1 * NR + 16, c11);
+    _mm512_storeu_ps(ab + 2 * NR, c20);
+    _mm512_storeu_ps(ab + 2 * NR + 16, c21);
+    _mm512_storeu_ps(ab + 3 * NR, c30);
+    _mm512_storeu_ps(ab + 3 * NR + 16, c31);
+    _mm512_storeu_ps(ab + 4 * NR, c40);
+    _mm512_storeu_ps(ab + 4 * NR + 16, c41);
+    _mm512_storeu_ps(ab + 5 * NR, c50);
+    _mm512_storeu_ps(ab + 5 * NR + 16, c51);
+}
+#endif
+
+KernelInfo GetKernel(GemmIsa isa)
+{
+    if(static_cast<int>(isa) > static_cast<int>(GemmHostIsa()))
+        MIOPEN_THROW(miopenStatusNotImplemented, "The GEMM instruction set is not supported");
+    switch(isa)
+    {
+#if MIOPEN_GEMM_HOST_X86
+    case GemmIsa::Avx512: return {32, MicroKernelAvx512};
+    case GemmIsa::Avx2: return {16, MicroKernelAvx2};
+#else
+    case GemmIsa::Avx512:
+    case GemmIsa::Avx2:
+#endif
+    case GemmIsa::Scalar: break;
+    }
+    return {16, MicroKernelScalar};
+}
+
+/// Packs rows [i0, i0 + mc) and columns [k0, k0 + kc) of op(A) as slivers of MR rows, each
+/// stored column after column. The last sliver is padded with zeros.
+void PackA(bool transA,
+           const float* A,
+           std::size_t lda,
+           std::size_t i0,
+           std::size_t mc,
+           std::size_t k0,
+           std::size_t kc,
+           float* pa)
+{
+    for(std::size_t s = 0; s < mc; s += MR)
+    {
+        const std::size_t mr = std::min(MR, mc - s);
+        for(std::size_t k = 0; k < kc; k++)
+        {
+            for(std::size_t i = 0; i < mr; i++)
+            {
+                const std::size_t row = i0 + s + i;
+                const std::size_t col = k0 + k;
+                pa[i] = transA ? A[col * lda + row] : A[row * lda + col];
+            }
+            std::fill(pa + mr, pa + MR, 0.0f);
+            pa += MR;
+        }
+    }
+}
+
+/// Packs rows [k0, k0 + kc) and columns [j0 + s * nr, j0 + e * nr) of op(B), clipped to
+/// j0 + nc, as slivers of nr columns, each stored row after row. The last sliver is padded
+/// with zeros. pb is the start of the panel.
+void PackB(bool transB,
+           const float* B,
+           std::size_t ldb,
+           std::size_t k0,
+           std::size_t kc,
+           std::size_t j0,
+           std::size_t nc,
+           std::size_t nr,
+           std::size_t s,
+           std::size_t e,
+           float* pb)
+{
+    for(; s < e; s++)
+    {
+        float* p             = pb + s * kc * nr;
+        const std::size_t jb = s * nr;
+        const std::size_t n  = std::min(nr, nc - jb);
+        for(std::size_t k = 0; k < kc; k++)
+        {
+            if(transB)
+                for(std::size_t j = 0; j < n; j++)
+                    p[j] = B[(j0 + jb + j) * ldb + k0 + k];
+            else
+                std::copy_n(B + (k0 + k) * ldb + j0 + jb, n, p);
+            std::fill(p + n, p + nr, 0.0f);
+            p += nr;
+        }
+    }
+}
+
+void ScaleC(std::size_t M, std::size_t N, float beta, float* C, std::size_t ldc)
+{
+    ParallelFor(M, std::max<std::size_t>(scale_grain / N, 1), [&](std::size_t b, std::size_t e) {
+        for(std::size_t i = b; i < e; i++)
+        {
+            float* c = C + i * ldc;
+            if(beta == 0)
+                std::fill_n(c, N, 0.0f);
+            else
+                for(std::size_t j = 0; j < N; j++)
+                    c[j] *= beta;
+        }
+    });
+}
+
+std::size_t DivUp(std::size_t x, std::size_t y) { return (x + y - 1) / y; }
+
+/// C[:, jc, jc + nc) += alpha * op(A)[:, pc, pc + kc) * pb, the panel of rows [pc, pc + kc) and
+/// columns [jc, jc + nc) of op(B) packed by PackB. Tiles of C run in parallel when parallel is
+/// set.
+void MultiplyPanel(const KernelInfo& kernel,
+                   bool transA,
+                   std::size_t M,
+                   float alpha,
+                   const float* A,
+                   std::size_t lda,
+                   std::size_t pc,
+                   std::size_t kc,
+                   std::size_t jc,
+                   std::size_t nc,
+                   const float* pb,
+                   float* C,
+                   std::size_t ldc,
+                   bool parallel)
+{
+    const std::size_t nr       = kernel.nr;
+    const std::size_t slivers  = DivUp(nc, nr);
+    const std::size_t m_blocks = DivUp(M, MC);
+    // Tiles are an MC block of rows by a chunk of slivers, enough of them for every thread
+    std::size_t chunks = std::min(
+        slivers,
+        std::max<std::size_t>(DivUp(tiles_per_thread * ParallelForThreads(), m_blocks), 1));
+    const std::size_t per_chunk = DivUp(slivers, chunks);
+    chunks                      = DivUp(slivers, per_chunk);
+    const std::size_t tiles     = m_blocks * chunks;
+
+    ParallelFor(tiles, parallel ? 1 : tiles, [&](std::size_t begin, std::size_t end) {
+        thread_local std::vector<float> pa;
+        pa.resize(MC * KC);
+        float ab[MR * max_nr];
+        std::size_t packed = m_blocks;
+        for(std::size_t t = begin; t < end; t++)
+        {
+            // Consecutive tiles share their block of op(A)
+            const std::size_t ib = t / chunks;
+            const std::size_t i0 = ib * MC;
+            const std::size_t mc = std::min(MC, M - i0);
+            if(packed != ib)
+            {
+                PackA(transA, A, lda, i0, mc, pc, kc, pa.data());
+                packed = ib;
+            }
+
+            const std::size_t s0 = (t % chunks) * per_chunk;
+            const std::size_t s1 = std::min(slivers, s0 + per_chunk);
+            for(std::size_t s = s0; s < s1; s++)
+            {
+                const std::size_t j = s * nr;
+                const std::size_t n = std::min(nr, nc - j);
+                const float* b_slvr = pb + s * kc * nr;
+                for(std::size_t r = 0; r < mc; r += MR)
+                {
+                    const std::size_t m = std::min(MR, mc - r);
+                    kernel.run(kc, pa.data() + r * kc, b_slvr, ab);
+                    float* c = C + (i0 + r) * ldc + jc + j;
+                    for(std::size_t i = 0; i < m; i++)
+                        for(std::size_t jj = 0; jj < n; jj++)
+                            c[i * ldc + jj] += alpha * ab[i * nr + jj];
+                }
+            }
+        }
+    });
+}
+
+} // namespace
+
+GemmIsa GemmHostIsa()
+{
+#if MIOPEN_GEMM_HOST_X86
+    static const GemmIsa isa = []() {
+        if(__builtin_cpu_supports("avx512f"))
+            return GemmIsa::Avx512;
+        if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return GemmIsa::Avx2;
+        return GemmIsa::Scalar;
+    }();
+    return isa;
+#else
+    return GemmIsa::Scalar;
+#endif
+}
+
+void Gemm(bool transA,
+          bool transB,
+          std::size_t M,
+          std::size_t N,
+          std::size_t K,
+          float alpha,
+          const float* A,
+          std::size_t lda,
+          const float* B,
+          std::size_t ldb,
+          float beta,
+          float* C,
+          std::size_t ldc)
+{
+    Gemm(GemmHostIsa(), transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+void Gemm(GemmIsa isa,
+          bool transA,
+          bool transB,
+          std::size_t M,
+          std::size_t N,
+          std::size_t K,
+          float alpha,
+          const float* A,
+          std::size_t lda,
+          const float* B,
+          std::size_t ldb,
+          float beta,
+          float* C,
+          std::size_t ldc)
+{
+    const auto kernel = GetKernel(isa);
+    if(M == 0 || N == 0)
+        return;
+    // The micro-kernels accumulate into C, so beta is applied once up front.
+    if(beta != 1)
+        ScaleC(M, N, beta, C, ldc);
+    if(K == 0 || alpha == 0)
+        return;
+
+    const std::size_t nr        = kernel.nr;
+    const std::size_t threads   = ParallelForThreads();
+    const bool parallel         = M * N * K >= gemm_grain;
+    const std::size_t max_panel = DivUp(std::min(N, NC), nr);
+    std::vector<float> pb(KC * max_panel * nr);
+
+    for(std::size_t jc = 0; jc < N; jc += NC)
+    {
+        const std::size_t nc      = std::min(NC, N - jc);
+        const std::size_t slivers = DivUp(nc, nr);
+        for(std::size_t pc = 0; pc < K; pc += KC)
+        {
+            const std::size_t kc = std::min(KC, K - pc);
+            ParallelFor(slivers,
+                        parallel ? DivUp(slivers, threads) : slivers,
+                        [&](std::size_t s, std::size_t e) {
+                            PackB(transB, B, ldb, pc, kc, jc, nc, nr, s, e, pb.data());
+                        });
+            MultiplyPanel(
+                kernel, transA, M, alpha, A, lda, pc, kc, jc, nc, pb.data(), C, ldc, parallel);
+        }
+    }
+}
+
+GemmPackedB::GemmPackedB(
+    bool transB, std::size_t pk, std::size_t pn, const float* B, std::size_t ldb)
+    : GemmPackedB(GemmHostIsa(), transB, pk, pn, B, ldb)
+{
+}
+
+GemmPackedB::GemmPackedB(
+    GemmIsa pisa, bool transB, std::size_t pk, std::size_t pn, const float* B, std::size_t ldb)
+    : isa(pisa), k(pk), n(pn)
+{
+    const std::size_t nr = GetKernel(isa).nr;
+    // The panels of op(B) in the order Gemm visits them, each padded to whole slivers
+    std::size_t size = 0;
+    for(std::size_t jc = 0; jc < n; jc += NC)
+        size += k * DivUp(std::min(NC, n - jc), nr) * nr;
+    data.resize(size);
+
+    float* pb = data.data();
+    for(std::size_t jc = 0; jc < n; jc += NC)
+    {
+        const std::size_t nc      = std::min(NC, n - jc);
+        const std::size_t slivers = DivUp(nc, nr);
+        for(std::size_t pc = 0; pc < k; pc += KC)
+        {
+            const std::size_t kc = std::min(KC, k - pc);
+            ParallelFor(slivers,
+                        std::max<std::size_t>(gemm_grain / (kc * nr), 1),
+                        [&](std::size_t s, std::size_t e) {
+                            PackB(transB, B, ldb, pc, kc, jc, nc, nr, s, e, pb);
+                        });
+            pb += kc * slivers * nr;
+        }
+    }
+}
+
+void Gemm(bool transA,
+          std::size_t M,
+          float alpha,
+          const float* A,
+          std::size_t lda,
+          const GemmPackedB& B,
+          float beta,
+          float* C,
+          std::size_t ldc)
+{
+    const auto kernel   = GetKernel(B.isa);
+    const std::size_t N = B.n;
+    const std::size_t K = B.k;
+    if(M == 0 || N == 0)
+        return;
+    if(beta != 1)
+        ScaleC(M, N, beta, C, ldc);
+    if(K == 0 || alpha == 0)
+        return;
+
+    const std::size_t nr = kernel.nr;
+    const bool parallel  = M * N * K >= gemm_grain;
+    const float* pb      = B.data.data();
+    for(std::size_t jc = 0; jc < N; jc += NC)
+    {
+        const std::size_t nc      = std::min(NC, N - jc);
+        const std::size_t slivers = DivUp(nc, nr);
+        for(std::size_t pc = 0; pc < K; pc += KC)
+        {
+            const std::size_t kc = std::min(KC, K - pc);
+            MultiplyPanel(kernel, transA, M, alpha, A, lda, pc, kc, jc, nc, pb, C, ldc, parallel);
+            pb += kc * slivers * nr;
+        }
+    }
+}
+
+} // namespace host
+} // namespace miopen
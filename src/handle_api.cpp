@@ -73,6 +73,12 @@ extern "C" miopenStatus_t miopenGetStream(miopenHandle_t handle, miopenAccelerat
     return miopen::try_([&] { miopen::deref(streamID) = miopen::deref(handle).GetStream(); });
 }
 
+extern "C" miopenStatus_t miopenSetThreadStream(miopenHandle_t handle,
+                                                miopenAcceleratorQueue_t streamID)
+{
+    return miopen::try_([&] { miopen::deref(handle).SetThreadStream(streamID); });
+}
+
 extern "C" miopenStatus_t miopenSetAllocator(miopenHandle_t handle,
                                              miopenAllocatorFunction allocator,
                                              miopenDeallocatorFunction deallocator,
@@ -82,6 +88,16 @@ extern "C" miopenStatus_t miopenSetAllocator(miopenHandle_t handle,
         [&] { miopen::deref(handle).SetAllocator(allocator, deallocator, allocatorContext); });
 }
 
+extern "C" miopenStatus_t miopenSetAllocatorPoolLimit(miopenHandle_t handle, size_t limit)
+{
+    return miopen::try_([&] { miopen::deref(handle).SetAllocatorPoolLimit(limit); });
+}
+
+extern "C" miopenStatus_t miopenTrimAllocatorPool(miopenHandle_t handle)
+{
+    return miopen::try_([&] { miopen::deref(handle).TrimAllocatorPool(); });
+}
+
 extern "C" miopenStatus_t miopenDestroy(miopenHandle_t handle)
 {
     return miopen::try_([&] { miopen_destroy_object(handle); });
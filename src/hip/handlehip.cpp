@@ -32,11 +32,14 @@
 #include <boost/filesystem.hpp>
 #include <miopen/handle_lock.hpp>
 #include <miopen/gemm_geometry.hpp>
+#include <miopen/per_thread.hpp>
+#include <miopen/trace.hpp>
 
 #ifndef _WIN32
 #include <unistd.h>
 #endif
 
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <thread>
@@ -125,6 +128,13 @@ struct HandleImpl
 
     HandleImpl() : ctx(get_ctx()) {}
 
+    // Cached buffers go back to the allocator while the context is alive.
+    ~HandleImpl()
+    {
+        if(pool != nullptr)
+            pool->SetLimit(0);
+    }
+
     StreamPtr create_stream()
     {
         hipStream_t result;
@@ -139,7 +149,7 @@ struct HandleImpl
     void elapsed_time(hipEvent_t start, hipEvent_t stop)
     {
         if(enable_profiling)
-            hipEventElapsedTime(&this->profiling_result, start, stop);
+            hipEventElapsedTime(&this->profiling_result.Get(), start, stop);
     }
 
     std::function<void(hipEvent_t, hipEvent_t)> elapsed_time_handler()
@@ -148,6 +158,17 @@ struct HandleImpl
             &HandleImpl::elapsed_time, this, std::placeholders::_1, std::placeholders::_2);
     }
 
+#if MIOPEN_ENABLE_TRACE
+    std::function<void(hipEvent_t, hipEvent_t)> elapsed_time_handler(std::string kernel_name)
+    {
+        return [this, kernel_name](hipEvent_t start, hipEvent_t stop) {
+            this->elapsed_time(start, stop);
+            if(enable_profiling)
+                MIOPEN_TRACE_KERNEL(kernel_name, this->profiling_result.Get());
+        };
+    }
+#endif
+
     void set_ctx()
     {
         miopen::set_ctx(this->ctx);
@@ -157,11 +178,13 @@ struct HandleImpl
             MIOPEN_THROW("Running handle on wrong device");
     }
 
-    bool enable_profiling  = false;
-    StreamPtr stream       = nullptr;
-    float profiling_result = 0.0;
-    int device             = -1;
+    std::atomic<bool> enable_profiling{false};
+    StreamPtr stream = nullptr;
+    PerThread<StreamPtr> thread_streams;
+    PerThread<float> profiling_result;
+    int device = -1;
     Allocator allocator{};
+    std::shared_ptr<AllocatorPool> pool;
     KernelCache cache;
     hipCtx_t ctx;
 };
@@ -200,7 +223,19 @@ void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
     this->impl->stream = HandleImpl::reference_stream(streamID);
 }
 
-miopenAcceleratorQueue_t Handle::GetStream() const { return impl->stream.get(); }
+void Handle::SetThreadStream(miopenAcceleratorQueue_t streamID) const
+{
+    if(streamID == nullptr)
+        this->impl->thread_streams.Erase();
+    else
+        this->impl->thread_streams.Get() = HandleImpl::reference_stream(streamID);
+}
+
+miopenAcceleratorQueue_t Handle::GetStream() const
+{
+    const auto thread_stream = impl->thread_streams.Find();
+    return thread_stream != nullptr ? thread_stream->get() : impl->stream.get();
+}
 
 void Handle::SetAllocator(miopenAllocatorFunction allocator,
                           miopenDeallocatorFunction deallocator,
@@ -210,17 +245,35 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
     this->impl->allocator.deallocator = deallocator == nullptr ? default_deallocator : deallocator;
 
     this->impl->allocator.context = allocatorContext;
+
+    // Buffers still in use keep the previous pool, which frees them on release.
+    auto limit = AllocatorPool::GetDefaultLimit();
+    if(this->impl->pool != nullptr)
+    {
+        limit = this->impl->pool->GetLimit();
+        this->impl->pool->SetLimit(0);
+    }
+    this->impl->pool = std::make_shared<AllocatorPool>(this->impl->allocator, limit);
+}
+
+void Handle::SetAllocatorPoolLimit(std::size_t limit) const { this->impl->pool->SetLimit(limit); }
+
+void Handle::TrimAllocatorPool() const { this->impl->pool->Trim(); }
+
+AllocatorPoolStatistics Handle::GetAllocatorPoolStatistics() const
+{
+    return this->impl->pool->GetStatistics();
 }
 
 void Handle::EnableProfiling(bool enable) { this->impl->enable_profiling = enable; }
 
-float Handle::GetKernelTime() const { return this->impl->profiling_result; }
+float Handle::GetKernelTime() const { return this->impl->profiling_result.Get(); }
 
 Allocator::ManageDataPtr Handle::Create(std::size_t sz)
 {
     MIOPEN_HANDLE_LOCK
     this->Finish();
-    return this->impl->allocator(sz);
+    return this->impl->pool->Allocate(sz);
 }
 Allocator::ManageDataPtr&
 Handle::WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz)
@@ -270,8 +323,8 @@ void Handle::ClearKernels(const std::string& algorithm, const std::string& netwo
     this->impl->cache.ClearKernels(algorithm, network_config);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config)
+std::vector<Kernel> Handle::GetKernelsImpl(const std::string& algorithm,
+                                           const std::string& network_config)
 {
     return this->impl->cache.GetKernels(algorithm, network_config);
 }
@@ -280,7 +333,13 @@ KernelInvoke Handle::Run(Kernel k)
 {
     this->impl->set_ctx();
     if(this->impl->enable_profiling || MIOPEN_GPU_SYNC)
+    {
+#if MIOPEN_ENABLE_TRACE
+        return k.Invoke(this->GetStream(), this->impl->elapsed_time_handler(k.GetName()));
+#else
         return k.Invoke(this->GetStream(), this->impl->elapsed_time_handler());
+#endif
+    }
     else
         return k.Invoke(this->GetStream());
 }
@@ -289,10 +348,12 @@ Program Handle::LoadProgram(const std::string& program_name, std::string params,
 {
     this->impl->set_ctx();
     params += " -mcpu=" + this->GetDeviceName();
+    MIOPEN_TRACE_SCOPE("compile", "Handle::LoadProgram " << program_name);
     auto cache_file =
         miopen::LoadBinary(this->GetDeviceName(), program_name, params, is_kernel_str);
     if(cache_file.empty())
     {
+        MIOPEN_TRACE_SCOPE("compile", "Compile " << program_name << ' ' << params);
         auto p = HIPOCProgram{program_name, params, is_kernel_str};
 
         // Save to cache
@@ -304,6 +365,7 @@ Program Handle::LoadProgram(const std::string& program_name, std::string params,
     }
     else
     {
+        MIOPEN_TRACE_SCOPE("compile", "Load binary " << cache_file);
         return HIPOCProgram{program_name, cache_file};
     }
 }
@@ -337,8 +399,8 @@ void Handle::Flush() const {}
 
 bool Handle::IsProfilingEnabled() const { return this->impl->enable_profiling; }
 
-void Handle::ResetKernelTime() { this->impl->profiling_result = 0.0; }
-void Handle::AccumKernelTime(float curr_time) { this->impl->profiling_result += curr_time; }
+void Handle::ResetKernelTime() { this->impl->profiling_result.Get() = 0.0; }
+void Handle::AccumKernelTime(float curr_time) { this->impl->profiling_result.Get() += curr_time; }
 
 std::size_t Handle::GetLocalMemorySize()
 {
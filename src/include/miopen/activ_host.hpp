@@ -0,0 +1,199 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_ACTIV_HOST_HPP_
+#define GUARD_MIOPEN_ACTIV_HOST_HPP_
+
+#include <miopen/host_loops.hpp>
+#include <miopen/host_math.hpp>
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+
+namespace miopen {
+namespace host {
+
+// Activations of host tensors, shared by the CPU backend, the driver and the tests.
+//
+// Each mode is a pair of generic functions, the forward y = fwd(x) and the derivative
+// dx = bwd(dy, x, y), written with the functions of host_math.hpp and selects, which Transform
+// runs over packs of values in vector registers. Contiguous runs of the accumulation type are
+// transformed in place; other runs go through blocks converted to it. The functions follow
+// MIOpenNeuron.cl, including the power mode, whose derivative does not scale by dy.
+
+// Values of strided or converted runs transformed together.
+constexpr std::size_t activ_block_size = 512;
+// Same as kBNLL_THRESHOLD of MIOpenNeuron.cl.
+constexpr double softrelu_threshold = 50;
+
+/// Calls f(fwd, bwd) with the forward function and the derivative of the mode, generic over T
+/// and packs of T.
+template <class T, class F>
+void VisitActivation(miopenActivationMode_t mode, double alpha, double beta, double gamma, F f)
+{
+    const T a   = alpha;
+    const T b   = beta;
+    const T g   = gamma;
+    const T eps = std::numeric_limits<float>::epsilon();
+    const T zero(0);
+    switch(mode)
+    {
+    case miopenActivationPASTHRU:
+        f([](auto x) { return x; }, [](auto dy, auto, auto) { return dy; });
+        break;
+    case miopenActivationLOGISTIC:
+        f([](auto x) { return 1 / (1 + Exp(-x)); },
+          [](auto dy, auto, auto y) { return dy * y * (1 - y); });
+        break;
+    case miopenActivationTANH:
+        f([=](auto x) { return b * Tanh(a * x); },
+          [=](auto dy, auto, auto y) { return dy * a * (b - y * y / b); });
+        break;
+    case miopenActivationRELU:
+        f([=](auto x) { return x > 0 ? x : zero; },
+          [=](auto dy, auto x, auto) { return x > 0 ? dy : zero; });
+        break;
+    case miopenActivationSOFTRELU:
+        f([=](auto x) { return (x > 0 ? x : zero) + Log1p(Exp(x > 0 ? -x : x)); },
+          [](auto dy, auto x, auto) {
+              const auto e = Exp(x < T(softrelu_threshold) ? x : T(softrelu_threshold));
+              return dy * e / (e + 1);
+          });
+        break;
+    case miopenActivationABS:
+        f([](auto x) { return x < 0 ? -x : x; },
+          [](auto dy, auto x, auto) { return x > 0 ? dy : -dy; });
+        break;
+    case miopenActivationPOWER:
+        f(
+            [=](auto x) {
+                const auto v = a + b * x;
+                return v <= eps ? zero : Exp(g * Log(v));
+            },
+            [=](auto, auto x, auto y) {
+                const auto v = a + b * x;
+                return v <= eps ? zero : g * b * y / v;
+            });
+        break;
+    case miopenActivationCLIPPEDRELU:
+        f([=](auto x) { return x > 0 ? (x < a ? x : a) : zero; },
+          [=](auto dy, auto x, auto) { return x > 0 ? (x <= a ? dy : zero) : zero; });
+        break;
+    case miopenActivationLEAKYRELU:
+        f([=](auto x) { return x > 0 ? x : x * a; },
+          [=](auto dy, auto x, auto) { return x > 0 ? dy : dy * a; });
+        break;
+    case miopenActivationELU:
+        f([=](auto x) { return x > 0 ? x : a * Expm1(x); },
+          [=](auto dy, auto x, auto y) { return x > 0 ? dy : dy * (y + a); });
+        break;
+    }
+}
+
+namespace detail {
+
+/// The n values of src, `stride` apart, as contiguous values of T: src itself when it already is,
+/// otherwise converted into buffer.
+template <class T, class S>
+const T* Contiguous(const S* src, std::ptrdiff_t stride, std::size_t n, T* buffer)
+{
+    if(std::is_same<S, T>{} && stride == 1)
+        return reinterpret_cast<const T*>(src);
+    for(std::size_t i = 0; i < n; i++)
+        buffer[i] = static_cast<T>(src[i * stride]);
+    return buffer;
+}
+
+/// Where to transform n values of dst, `stride` apart: dst itself when it is contiguous T,
+/// otherwise buffer, to be stored with Store.
+template <class T, class D>
+T* Destination(D* dst, std::ptrdiff_t stride, T* buffer)
+{
+    return std::is_same<D, T>{} && stride == 1 ? reinterpret_cast<T*>(dst) : buffer;
+}
+
+template <class T, class D>
+void Store(const T* result, D* dst, std::ptrdiff_t stride, std::size_t n)
+{
+    if(static_cast<const void*>(result) == static_cast<const void*>(dst))
+        return;
+    for(std::size_t i = 0; i < n; i++)
+        dst[i * stride] = static_cast<D>(result[i]);
+}
+
+} // namespace detail
+
+/// y = fwd(x) for a run of n values, `sx` and `sy` apart.
+template <class X, class Y, class Fwd>
+void ActivationForwardRun(
+    Fwd fwd, const X* x, std::ptrdiff_t sx, Y* y, std::ptrdiff_t sy, std::size_t n)
+{
+    using Acc = HostAcc<X, Y>;
+    std::array<Acc, activ_block_size> xb, yb;
+    for(std::size_t i = 0; i < n; i += activ_block_size)
+    {
+        const std::size_t m = std::min(activ_block_size, n - i);
+        const Acc* xs       = detail::Contiguous(x + i * sx, sx, m, xb.data());
+        Acc* ys             = detail::Destination(y + i * sy, sy, yb.data());
+        Transform(m, fwd, ys, xs);
+        detail::Store(ys, y + i * sy, sy, m);
+    }
+}
+
+/// dx = bwd(dy, x, y) for a run of n values, each tensor with its own stride.
+template <class T, class Bwd>
+void ActivationBackwardRun(Bwd bwd,
+                           const T* y,
+                           std::ptrdiff_t sy,
+                           const T* dy,
+                           std::ptrdiff_t sdy,
+                           const T* x,
+                           std::ptrdiff_t sx,
+                           T* dx,
+                           std::ptrdiff_t sdx,
+                           std::size_t n)
+{
+    using Acc = HostAcc<T, T>;
+    std::array<Acc, activ_block_size> yb, dyb, xb, dxb;
+    for(std::size_t i = 0; i < n; i += activ_block_size)
+    {
+        const std::size_t m = std::min(activ_block_size, n - i);
+        const Acc* ys       = detail::Contiguous(y + i * sy, sy, m, yb.data());
+        const Acc* dys      = detail::Contiguous(dy + i * sdy, sdy, m, dyb.data());
+        const Acc* xs       = detail::Contiguous(x + i * sx, sx, m, xb.data());
+        Acc* dxs            = detail::Destination(dx + i * sdx, sdx, dxb.data());
+        Transform(m, bwd, dxs, dys, xs, ys);
+        detail::Store(dxs, dx + i * sdx, sdx, m);
+    }
+}
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_ACTIV_HOST_HPP_
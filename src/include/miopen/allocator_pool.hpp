@@ -0,0 +1,107 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_ALLOCATOR_POOL_HPP_
+#define GUARD_MIOPEN_ALLOCATOR_POOL_HPP_
+
+#include <miopen/allocator.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace miopen {
+
+struct AllocatorPoolStatistics
+{
+    /// Number of Allocate() calls.
+    std::size_t requests = 0;
+    /// Requests served from cached blocks.
+    std::size_t hits = 0;
+    /// Calls of the underlying allocator and deallocator.
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+    std::size_t bytes_in_use  = 0;
+    std::size_t bytes_cached  = 0;
+    /// High-water mark of bytes held from the underlying allocator (in use + cached).
+    std::size_t peak_bytes = 0;
+};
+
+/// Caching layer over an Allocator (the default one or a miopenSetAllocator() callback).
+///
+/// Requests are rounded up to size classes (four per power of two) and released
+/// buffers are kept for reuse instead of being returned to the underlying allocator.
+/// A request is served by the smallest cached block which fits and is at most twice
+/// as large. `limit` caps the bytes the pool holds from the underlying allocator:
+/// cached blocks are freed (largest first) before it is exceeded and released
+/// buffers are freed immediately while it is exceeded. A limit of 0 disables
+/// caching; requests then go straight to the underlying allocator.
+///
+/// Buffers keep the pool alive, so they may outlive the owner of the pool.
+class AllocatorPool : public std::enable_shared_from_this<AllocatorPool>
+{
+    public:
+    AllocatorPool(const Allocator& allocator_, std::size_t limit_ = 0);
+    AllocatorPool(const AllocatorPool&) = delete;
+    AllocatorPool& operator=(const AllocatorPool&) = delete;
+    ~AllocatorPool();
+
+    Allocator::ManageDataPtr Allocate(std::size_t sz);
+
+    /// Returns all the cached blocks to the underlying allocator.
+    void Trim();
+
+    /// Sets the limit and trims the cache down to it.
+    void SetLimit(std::size_t limit_);
+    std::size_t GetLimit() const;
+
+    AllocatorPoolStatistics GetStatistics() const;
+
+    static std::size_t GetSizeClass(std::size_t sz);
+
+    /// Limit of new handles, from MIOPEN_ALLOCATOR_POOL_LIMIT (in megabytes).
+    static std::size_t GetDefaultLimit();
+
+    private:
+    struct BlockRef;
+
+    void Release(Data_t data, std::size_t size);
+    void Free(Data_t data);
+    /// Frees cached blocks, largest first, until at most `target` bytes are held.
+    void TrimUnsafe(std::size_t target);
+    static void Deallocate(void* context, void* data);
+
+    Allocator allocator;
+    std::size_t limit;
+    mutable std::mutex mutex;
+    std::multimap<std::size_t, Data_t> cached;
+    AllocatorPoolStatistics stats;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_ALLOCATOR_POOL_HPP_
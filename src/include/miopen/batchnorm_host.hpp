@@ -0,0 +1,431 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_BATCHNORM_HOST_HPP_
+#define GUARD_MIOPEN_BATCHNORM_HOST_HPP_
+
+#include <miopen/host_loops.hpp>
+#include <miopen/parallel_for.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace miopen {
+namespace host {
+
+// Batch norm of packed NCHW host tensors, shared by the CPU backend, the driver and the tests.
+//
+// Statistics take one pass over memory: blocks that stay in cache give their mean and sum of
+// squared deviations, and the blocks are merged pairwise (Chan, Golub and LeVeque), so that the
+// variance never comes from the difference of two large sums. The results follow the kernels of
+// batchnormocl.cpp: normalization uses the biased variance, the running variance is updated with
+// the unbiased one, and the saved inverse variance is 1 / sqrt(variance + epsilon).
+
+// Elements whose statistics are computed from cache before they are merged.
+constexpr std::size_t bn_block_size = 4096;
+// Independent partial sums of a reduction, which the compiler keeps in vector registers.
+constexpr std::size_t bn_lanes = 8;
+
+/// Count, mean and sum of squared deviations of a set of values.
+struct MeanM2
+{
+    double count = 0;
+    double mean  = 0;
+    double m2    = 0;
+
+    void Merge(const MeanM2& b)
+    {
+        const double total = count + b.count;
+        if(total == 0)
+            return;
+        const double delta = b.mean - mean;
+        mean += delta * b.count / total;
+        m2 += b.m2 + delta * delta * count * b.count / total;
+        count = total;
+    }
+
+    /// The biased variance, which normalization uses.
+    double Variance() const { return count > 0 ? m2 / count : 0; }
+};
+
+/// Sums f(i) for i < n over bn_lanes partial sums.
+template <class F>
+double LaneSum(std::size_t n, F f)
+{
+    double lanes[bn_lanes] = {};
+    std::size_t i          = 0;
+    for(; i + bn_lanes <= n; i += bn_lanes)
+        for(std::size_t j = 0; j < bn_lanes; j++)
+            lanes[j] += f(i + j);
+    double sum = 0;
+    for(; i < n; i++)
+        sum += f(i);
+    for(double lane : lanes)
+        sum += lane;
+    return sum;
+}
+
+/// Statistics of n consecutive values, a cached block at a time.
+template <class X>
+MeanM2 ContiguousMeanM2(const X* x, std::size_t n)
+{
+    MeanM2 result;
+    for(std::size_t first = 0; first < n; first += bn_block_size)
+    {
+        const X* b = x + first;
+        MeanM2 block;
+        block.count = std::min(bn_block_size, n - first);
+        block.mean  = LaneSum(block.count, [&](std::size_t i) { return double(b[i]); }) /
+                     block.count;
+        block.m2 = LaneSum(block.count, [&](std::size_t i) {
+            const double d = double(b[i]) - block.mean;
+            return d * d;
+        });
+        result.Merge(block);
+    }
+    return result;
+}
+
+/// Packed NCHW batch norm seen as groups of elements sharing one scale and bias: a channel in
+/// spatial mode, a single (c, h, w) position in per activation mode. Member m of group g lives at
+/// (m / inner) * image + g * inner + m % inner.
+struct BatchNormGroups
+{
+    bool spatial;
+    std::size_t n, groups, inner, image, members;
+
+    BatchNormGroups(bool pspatial, std::size_t pn, std::size_t c, std::size_t h, std::size_t w)
+        : spatial(pspatial),
+          n(pn),
+          groups(spatial ? c : c * h * w),
+          inner(spatial ? h * w : 1),
+          image(c * h * w),
+          members(pn * inner)
+    {
+    }
+
+    /// Running variance uses the unbiased estimate like the kernels.
+    double Unbiased(double variance) const
+    {
+        return members == 1 ? variance : variance * members / (members - 1);
+    }
+
+    /// Calls f(i, g) for every element i of group g. Groups of single positions are walked a run
+    /// of positions of one image at a time, other groups a run of one image of the group at a
+    /// time, so that f sees consecutive elements either way.
+    template <class F>
+    void ForEachElement(F f) const
+    {
+        if(inner == 1)
+        {
+            const std::size_t blocks = (groups + bn_block_size - 1) / bn_block_size;
+            ParallelFor(n * blocks,
+                        std::max<std::size_t>(host_parallel_grain / bn_block_size, 1),
+                        [&](std::size_t begin, std::size_t end) {
+                            for(std::size_t item = begin; item < end; item++)
+                            {
+                                const std::size_t b     = item / blocks;
+                                const std::size_t first = item % blocks * bn_block_size;
+                                const std::size_t last  = std::min(first + bn_block_size, groups);
+                                for(std::size_t g = first; g < last; g++)
+                                    f(b * image + g, g);
+                            }
+                        });
+            return;
+        }
+        ParallelFor(n * groups,
+                    std::max<std::size_t>(host_parallel_grain / inner, 1),
+                    [&](std::size_t begin, std::size_t end) {
+                        for(std::size_t item = begin; item < end; item++)
+                        {
+                            const std::size_t g    = item % groups;
+                            const std::size_t base = item / groups * image + g * inner;
+                            for(std::size_t m = 0; m < inner; m++)
+                                f(base + m, g);
+                        }
+                    });
+    }
+
+    /// Calls f(first, last) for blocks of groups of single positions, spread over ParallelFor.
+    template <class F>
+    void ForEachPositionBlock(F f) const
+    {
+        const std::size_t blocks = (groups + bn_block_size - 1) / bn_block_size;
+        ParallelFor(blocks,
+                    std::max<std::size_t>(host_parallel_grain / (bn_block_size * n), 1),
+                    [&](std::size_t begin, std::size_t end) {
+                        for(std::size_t block = begin; block < end; block++)
+                            f(block * bn_block_size,
+                              std::min((block + 1) * bn_block_size, groups));
+                    });
+    }
+
+    /// Calls f(g, offset) for every image of every group, offset being that of the first of the
+    /// inner consecutive elements of the group in the image, and returns the results of the images
+    /// merged per group in image order.
+    template <class R, class F>
+    std::vector<R> ReduceImages(F f) const
+    {
+        std::vector<R> partial(groups * n);
+        ParallelFor(groups * n,
+                    std::max<std::size_t>(host_parallel_grain / inner, 1),
+                    [&](std::size_t begin, std::size_t end) {
+                        for(std::size_t item = begin; item < end; item++)
+                        {
+                            const std::size_t g = item / n;
+                            const std::size_t b = item % n;
+                            partial[item]       = f(g, b * image + g * inner);
+                        }
+                    });
+        std::vector<R> result(groups);
+        for(std::size_t g = 0; g < groups; g++)
+            for(std::size_t b = 0; b < n; b++)
+                result[g].Merge(partial[g * n + b]);
+        return result;
+    }
+};
+
+/// Mean and biased variance of every group. Groups of single positions update a Welford
+/// estimate per position image by image, other groups merge the statistics of their images.
+template <class X>
+std::vector<MeanM2> BatchNormStatistics(const BatchNormGroups& bn, const X* x)
+{
+    if(bn.inner > 1)
+        return bn.ReduceImages<MeanM2>([&](std::size_t, std::size_t offset) {
+            return ContiguousMeanM2(x + offset, bn.inner);
+        });
+
+    std::vector<MeanM2> stats(bn.groups);
+    bn.ForEachPositionBlock([&](std::size_t first, std::size_t last) {
+        std::vector<double> mean(last - first, 0.0);
+        std::vector<double> m2(last - first, 0.0);
+        for(std::size_t b = 0; b < bn.n; b++)
+        {
+            const X* xb         = x + b * bn.image + first;
+            const double weight = 1.0 / (b + 1);
+            for(std::size_t p = 0; p < last - first; p++)
+            {
+                const double v     = xb[p];
+                const double delta = v - mean[p];
+                mean[p] += delta * weight;
+                m2[p] += delta * (v - mean[p]);
+            }
+        }
+        for(std::size_t p = 0; p < last - first; p++)
+        {
+            stats[first + p].count = bn.n;
+            stats[first + p].mean  = mean[p];
+            stats[first + p].m2    = m2[p];
+        }
+    });
+    return stats;
+}
+
+/// Normalizes x into y with the batch statistics. The running and saved statistics are written
+/// when their pointers are not null.
+template <class X, class Y>
+void BatchNormForwardTraining(const BatchNormGroups& bn,
+                              const X* x,
+                              Y* y,
+                              const X* scale,
+                              const X* bias,
+                              double expAvgFactor,
+                              Y* running_mean,
+                              Y* running_variance,
+                              double epsilon,
+                              Y* saved_mean,
+                              Y* saved_inv_variance)
+{
+    using Acc        = HostAcc<X, Y>;
+    const auto stats = BatchNormStatistics(bn, x);
+    std::vector<Acc> mean(bn.groups), s(bn.groups), t(bn.groups);
+    for(std::size_t g = 0; g < bn.groups; g++)
+    {
+        const double variance = stats[g].Variance();
+        const double invvar   = 1.0 / std::sqrt(variance + epsilon);
+        if(saved_mean != nullptr && saved_inv_variance != nullptr)
+        {
+            saved_mean[g]         = static_cast<Y>(stats[g].mean);
+            saved_inv_variance[g] = static_cast<Y>(invvar);
+        }
+        if(running_mean != nullptr && running_variance != nullptr)
+        {
+            running_mean[g] = static_cast<Y>((1 - expAvgFactor) * double(running_mean[g]) +
+                                             expAvgFactor * stats[g].mean);
+            running_variance[g] =
+                static_cast<Y>((1 - expAvgFactor) * double(running_variance[g]) +
+                               expAvgFactor * bn.Unbiased(variance));
+        }
+        mean[g] = static_cast<Acc>(stats[g].mean);
+        s[g]    = static_cast<Acc>(double(scale[g]) * invvar);
+        t[g]    = static_cast<Acc>(bias[g]);
+    }
+    bn.ForEachElement([&](std::size_t i, std::size_t g) {
+        y[i] = static_cast<Y>((static_cast<Acc>(x[i]) - mean[g]) * s[g] + t[g]);
+    });
+}
+
+/// Normalizes x into y with estimated statistics.
+template <class X, class Y>
+void BatchNormForwardInference(const BatchNormGroups& bn,
+                               const X* x,
+                               Y* y,
+                               const X* scale,
+                               const X* bias,
+                               const Y* estimated_mean,
+                               const Y* estimated_variance,
+                               double epsilon)
+{
+    using Acc = HostAcc<X, Y>;
+    std::vector<Acc> mean(bn.groups), s(bn.groups), t(bn.groups);
+    for(std::size_t g = 0; g < bn.groups; g++)
+    {
+        mean[g] = static_cast<Acc>(estimated_mean[g]);
+        s[g] = static_cast<Acc>(double(scale[g]) / std::sqrt(double(estimated_variance[g]) + epsilon));
+        t[g] = static_cast<Acc>(bias[g]);
+    }
+    bn.ForEachElement([&](std::size_t i, std::size_t g) {
+        y[i] = static_cast<Y>((static_cast<Acc>(x[i]) - mean[g]) * s[g] + t[g]);
+    });
+}
+
+/// Gradients of the normalization with the saved statistics, or with statistics recomputed from
+/// x when saved_mean or saved_inv_variance is null. dscale and dbias may be null.
+template <class X, class Y>
+void BatchNormBackward(const BatchNormGroups& bn,
+                       const X* x,
+                       const X* dy,
+                       Y* dx,
+                       const X* scale,
+                       Y* dscale,
+                       Y* dbias,
+                       double epsilon,
+                       const Y* saved_mean,
+                       const Y* saved_inv_variance)
+{
+    using Acc = HostAcc<X, Y>;
+    std::vector<double> mean(bn.groups), invvar(bn.groups);
+    if(saved_mean != nullptr && saved_inv_variance != nullptr)
+    {
+        for(std::size_t g = 0; g < bn.groups; g++)
+        {
+            mean[g]   = saved_mean[g];
+            invvar[g] = saved_inv_variance[g];
+        }
+    }
+    else
+    {
+        const auto stats = BatchNormStatistics(bn, x);
+        for(std::size_t g = 0; g < bn.groups; g++)
+        {
+            mean[g]   = stats[g].mean;
+            invvar[g] = 1.0 / std::sqrt(stats[g].Variance() + epsilon);
+        }
+    }
+
+    // Sums of dy and of dy (x - mean) over every group
+    struct Sums
+    {
+        double dy   = 0;
+        double dyxc = 0;
+        void Merge(const Sums& b)
+        {
+            dy += b.dy;
+            dyxc += b.dyxc;
+        }
+    };
+    std::vector<Sums> sums;
+    if(bn.inner > 1)
+    {
+        sums = bn.ReduceImages<Sums>([&](std::size_t g, std::size_t offset) {
+            const X* xb  = x + offset;
+            const X* dyb = dy + offset;
+            const double m = mean[g];
+            Sums r;
+            r.dy   = LaneSum(bn.inner, [&](std::size_t i) { return double(dyb[i]); });
+            r.dyxc = LaneSum(bn.inner,
+                             [&](std::size_t i) { return double(dyb[i]) * (double(xb[i]) - m); });
+            return r;
+        });
+    }
+    else
+    {
+        sums.resize(bn.groups);
+        bn.ForEachPositionBlock([&](std::size_t first, std::size_t last) {
+            for(std::size_t b = 0; b < bn.n; b++)
+            {
+                const X* xb  = x + b * bn.image;
+                const X* dyb = dy + b * bn.image;
+                for(std::size_t g = first; g < last; g++)
+                {
+                    sums[g].dy += double(dyb[g]);
+                    sums[g].dyxc += double(dyb[g]) * (double(xb[g]) - mean[g]);
+                }
+            }
+        });
+    }
+
+    // dx = a dy + b (x - mean) + d per group
+    const double count = bn.members;
+    std::vector<Acc> cm(bn.groups), ca(bn.groups), cb(bn.groups), cd(bn.groups);
+    for(std::size_t g = 0; g < bn.groups; g++)
+    {
+        const double gamma       = scale[g];
+        const double sum_dy_xhat = sums[g].dyxc * invvar[g];
+        if(dbias != nullptr)
+            dbias[g] = static_cast<Y>(sums[g].dy);
+        if(dscale != nullptr)
+            dscale[g] = static_cast<Y>(sum_dy_xhat);
+
+        cm[g] = static_cast<Acc>(mean[g]);
+        if(bn.spatial)
+        {
+            ca[g] = static_cast<Acc>(gamma * invvar[g]);
+            cb[g] = static_cast<Acc>(-gamma * invvar[g] * invvar[g] * sum_dy_xhat / count);
+            cd[g] = static_cast<Acc>(-gamma * invvar[g] * sums[g].dy / count);
+        }
+        else
+        {
+            // Per activation keeps the kernel's form, the summed gradient stands in for the
+            // element one
+            const double dxhat    = gamma * sums[g].dy;
+            const double dxhathat = gamma * sum_dy_xhat;
+            ca[g]                 = 0;
+            cb[g]                 = static_cast<Acc>(-invvar[g] * invvar[g] * dxhathat / count);
+            cd[g]                 = static_cast<Acc>(invvar[g] * (count - 1) / count * dxhat);
+        }
+    }
+    bn.ForEachElement([&](std::size_t i, std::size_t g) {
+        dx[i] = static_cast<Y>(ca[g] * static_cast<Acc>(dy[i]) +
+                               cb[g] * (static_cast<Acc>(x[i]) - cm[g]) + cd[g]);
+    });
+}
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_BATCHNORM_HOST_HPP_
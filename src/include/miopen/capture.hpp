@@ -0,0 +1,274 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_CAPTURE_HPP
+#define GUARD_MIOPEN_CAPTURE_HPP
+
+#include <miopen/miopen.h>
+
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+namespace capture {
+
+/// Capture of API calls, enabled by MIOPEN_CAPTURE_FILE=<path>. Every call which is logged by
+/// MIOPEN_LOG_FUNCTION is appended to the file with its arguments. Descriptors are stored by
+/// value. For data buffers, an id (equal for equal pointers) and the size taken from the
+/// preceding tensor descriptor are stored, but not their contents. Buffers named like
+/// workspaces get the size 0; the size is in the argument which follows them.
+/// `MIOpenDriver replay` re-issues the calls on synthetic buffers.
+///
+/// File format:
+///     file := magic call*
+///     call := name varint(number of args) arg*
+///     arg  := name kind varint(n) zigzag(int)*n varint(m) double*m
+///     name := varint(id), followed by varint(size) chars if the id appears the first time
+/// varints are LEB128, doubles are 8 bytes in the byte order of the host.
+enum class Kind : unsigned char
+{
+    Null,        // nullptr
+    Int,         // ints: value
+    Float,       // floats: value. Host scalars passed by pointer like alpha and beta.
+    Pointer,     // Any other pointer, e.g. an output argument.
+    Buffer,      // ints: id, size in bytes
+    Tensor,      // ints: type, number of dims, lengths..., strides...
+    Convolution, // ints: mode, pad_h, pad_w, u, v, dilation_h, dilation_w, padding mode
+    Pooling,     // ints: mode, padding mode, number of dims, lengths..., pads..., strides...
+    LRN,         // ints: mode, n; floats: alpha, beta, k
+    Activation,  // ints: mode; floats: alpha, beta, gamma
+};
+
+constexpr const char* magic = "MIOpenCapture1\n";
+
+struct Arg
+{
+    std::string name;
+    Kind kind = Kind::Null;
+    std::vector<std::int64_t> ints;
+    std::vector<double> floats;
+};
+
+struct Call
+{
+    std::string name;
+    std::vector<Arg> args;
+
+    const Arg* Find(const std::string& arg_name) const
+    {
+        for(auto&& arg : args)
+            if(arg.name == arg_name)
+                return &arg;
+        return nullptr;
+    }
+};
+
+class Writer
+{
+    public:
+    Writer(std::ostream& os_) : os(os_) { os << magic; }
+
+    void Write(const Call& call)
+    {
+        WriteName(call.name);
+        WriteUInt(call.args.size());
+        for(auto&& arg : call.args)
+        {
+            WriteName(arg.name);
+            os.put(static_cast<char>(arg.kind));
+            WriteUInt(arg.ints.size());
+            for(auto x : arg.ints)
+                WriteUInt((static_cast<std::uint64_t>(x) << 1) ^
+                          static_cast<std::uint64_t>(x >> 63));
+            WriteUInt(arg.floats.size());
+            for(auto x : arg.floats)
+                os.write(reinterpret_cast<const char*>(&x), sizeof(x));
+        }
+    }
+
+    private:
+    void WriteUInt(std::uint64_t x)
+    {
+        for(; x >= 0x80; x >>= 7)
+            os.put(static_cast<char>((x & 0x7f) | 0x80));
+        os.put(static_cast<char>(x));
+    }
+
+    void WriteName(const std::string& name)
+    {
+        const auto inserted = names.emplace(name, names.size());
+        WriteUInt(inserted.first->second);
+        if(inserted.second)
+        {
+            WriteUInt(name.size());
+            os.write(name.data(), name.size());
+        }
+    }
+
+    std::ostream& os;
+    std::unordered_map<std::string, std::uint64_t> names;
+};
+
+class Reader
+{
+    public:
+    Reader(std::istream& is_) : is(is_)
+    {
+        std::string header(std::strlen(magic), '\0');
+        is.read(&header[0], header.size());
+        valid = is && header == magic;
+    }
+
+    /// false if the stream does not start with the capture header.
+    bool IsValid() const { return valid; }
+
+    /// Reads the next call. Returns false at the end of the stream or on a truncated call.
+    bool Read(Call& call)
+    {
+        if(!valid || is.peek() == std::char_traits<char>::eof())
+            return false;
+        call.name = ReadName();
+        call.args.resize(ReadUInt());
+        for(auto& arg : call.args)
+        {
+            arg.name = ReadName();
+            arg.kind = static_cast<Kind>(is.get());
+            arg.ints.resize(ReadUInt());
+            for(auto& x : arg.ints)
+            {
+                const auto u = ReadUInt();
+                x = static_cast<std::int64_t>(u >> 1) ^ -static_cast<std::int64_t>(u & 1);
+            }
+            arg.floats.resize(ReadUInt());
+            for(auto& x : arg.floats)
+                is.read(reinterpret_cast<char*>(&x), sizeof(x));
+        }
+        return static_cast<bool>(is);
+    }
+
+    private:
+    std::uint64_t ReadUInt()
+    {
+        std::uint64_t x = 0;
+        for(int shift = 0; is && shift < 64; shift += 7)
+        {
+            const auto c = is.get();
+            x |= static_cast<std::uint64_t>(c & 0x7f) << shift;
+            if((c & 0x80) == 0)
+                break;
+        }
+        return x;
+    }
+
+    std::string ReadName()
+    {
+        const auto id = ReadUInt();
+        if(id < names.size())
+            return names[id];
+        std::string name(ReadUInt(), '\0');
+        is.read(&name[0], name.size());
+        names.push_back(name);
+        return name;
+    }
+
+    std::istream& is;
+    std::vector<std::string> names;
+    bool valid = false;
+};
+
+/// \return true if MIOPEN_CAPTURE_FILE is set.
+bool IsCapturing();
+
+/// Collects the arguments of an API call and appends the call to the capture when destroyed.
+class Recorder
+{
+    public:
+    Recorder(const char* name);
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+    ~Recorder();
+
+    void Add(const char* name, miopenTensorDescriptor_t x);
+    void Add(const char* name, miopenConvolutionDescriptor_t x);
+    void Add(const char* name, miopenPoolingDescriptor_t x);
+    void Add(const char* name, miopenLRNDescriptor_t x);
+    void Add(const char* name, miopenActivationDescriptor_t x);
+    void Add(const char* name, const void* x);
+
+    template <class T,
+              typename std::enable_if<(std::is_integral<T>{} || std::is_enum<T>{}), int>::type = 0>
+    void Add(const char* name, const T& x)
+    {
+        AddInt(name, static_cast<std::int64_t>(x));
+    }
+
+    template <class T, typename std::enable_if<(std::is_floating_point<T>{}), int>::type = 0>
+    void Add(const char* name, const T& x)
+    {
+        AddFloat(name, x);
+    }
+
+    template <class T, typename std::enable_if<(not std::is_void<T>{}), int>::type = 0>
+    void Add(const char* name, T* x)
+    {
+        AddPointer(name, x != nullptr);
+    }
+
+    private:
+    Arg& NewArg(const char* name, Kind kind);
+    void AddInt(const char* name, std::int64_t x);
+    void AddFloat(const char* name, double x);
+    void AddPointer(const char* name, bool not_null);
+    void ReadScales();
+
+    Call call;
+    std::size_t last_tensor_size = 0;
+    // Indices of the scaling factors in call.args and their pointers. They have the type of the
+    // data, which is only known once the tensors of the call have been added.
+    std::vector<std::pair<std::size_t, const void*>> scales;
+};
+
+} // namespace capture
+} // namespace miopen
+
+#define MIOPEN_CAPTURE_EACH(param) miopen_capture.Add(#param, param);
+
+/// Appends the call of the enclosing API function to the capture. See capture::IsCapturing().
+#define MIOPEN_CAPTURE_FUNCTION(...)                             \
+    if(miopen::capture::IsCapturing())                           \
+    {                                                            \
+        miopen::capture::Recorder miopen_capture{__func__};      \
+        MIOPEN_PP_EACH_ARGS(MIOPEN_CAPTURE_EACH, __VA_ARGS__)    \
+    }
+
+#endif
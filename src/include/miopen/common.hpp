@@ -59,5 +59,16 @@ using ManageDataPtr = MIOPEN_MANAGE_PTR(void, hipFree);
 inline Data_t DataCast(void* p) { return p; }
 
 inline ConstData_t DataCast(const void* p) { return p; }
-#endif // OpenCL vs hip
+
+#elif MIOPEN_BACKEND_CPU
+#include <cstdlib>
+
+using Data_t        = void*;
+using ConstData_t   = const void*;
+using ManageDataPtr = MIOPEN_MANAGE_PTR(void, free);
+
+inline Data_t DataCast(void* p) { return p; }
+
+inline ConstData_t DataCast(const void* p) { return p; }
+#endif // OpenCL vs hip vs cpu
 #endif // GUARD_MIOPEN_COMMON_HPP_
@@ -29,6 +29,7 @@
 #include <functional>
 #include <miopen/common.hpp>
 #include <miopen/conv_algo_name.hpp>
+#include <miopen/find_db.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/miopen.h>
 #include <miopen/perf_field.hpp>
@@ -100,6 +101,19 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                        const TensorDescriptor& wDesc,
                                        const TensorDescriptor& yDesc) const;
 
+    // Workspace of the im2col + GEMM path when `chunk` images share one GEMM.
+    size_t ForwardGetWorkSpaceSizeGEMM(Handle& handle,
+                                       const TensorDescriptor& wDesc,
+                                       const TensorDescriptor& yDesc,
+                                       int chunk) const;
+
+    // Largest number of images the im2col + GEMM path can batch into one GEMM
+    // with the given workspace, or 0 if the path does not fit at all.
+    int ForwardGetGemmChunkSize(Handle& handle,
+                                const TensorDescriptor& wDesc,
+                                const TensorDescriptor& yDesc,
+                                size_t workSpaceSize) const;
+
     size_t ForwardGetWorkSpaceSizeGEMMTranspose(const TensorDescriptor& xDesc,
                                                 const TensorDescriptor& yDesc) const;
 
@@ -142,6 +156,27 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                               size_t workSpaceSize,
                               bool exhaustiveSearch) const;
 
+    /// Times the algorithms (or just the one selected) and builds their kernels.
+    std::vector<PerfField> MeasureConvFwdAlgorithms(Handle& handle,
+                                                    const TensorDescriptor& xDesc,
+                                                    ConstData_t x,
+                                                    const TensorDescriptor& wDesc,
+                                                    ConstData_t w,
+                                                    const TensorDescriptor& yDesc,
+                                                    Data_t workSpace,
+                                                    size_t workSpaceSize,
+                                                    bool exhaustiveSearch,
+                                                    const FindDbSelection& only,
+                                                    FindDbSolvers& solvers) const;
+
+    /// Immediate mode: the algorithm to use without Find(). Prefers the find-db record,
+    /// otherwise ranks the applicable algorithms heuristically within workSpaceSize.
+    miopenConvFwdAlgorithm_t GetImmediateConvFwdAlgorithm(Handle& handle,
+                                                          const TensorDescriptor& xDesc,
+                                                          const TensorDescriptor& wDesc,
+                                                          const TensorDescriptor& yDesc,
+                                                          size_t workSpaceSize) const;
+
     int FindWinogradKernel(Handle& handle,
                            const TensorDescriptor& xDesc,
                            const TensorDescriptor& wDesc,
@@ -186,6 +221,10 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                               size_t workSpaceSize,
                               bool timed = false) const;
 
+    bool IsFFTKernelBuilt(Handle& handle,
+                          const TensorDescriptor& xDesc,
+                          const TensorDescriptor& yDesc) const;
+
     std::vector<miopen::solver::ConvSolution>
     FindDataDirectSolutions(Handle& handle,
                             const TensorDescriptor& xDesc,
@@ -239,6 +278,24 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                   size_t workSpaceSize,
                                   bool exhaustiveSearch) const;
 
+    std::vector<PerfField> MeasureConvBwdDataAlgorithms(Handle& handle,
+                                                        const TensorDescriptor& dyDesc,
+                                                        ConstData_t dy,
+                                                        const TensorDescriptor& wDesc,
+                                                        ConstData_t w,
+                                                        const TensorDescriptor& dxDesc,
+                                                        Data_t workSpace,
+                                                        size_t workSpaceSize,
+                                                        bool exhaustiveSearch,
+                                                        const FindDbSelection& only,
+                                                        FindDbSolvers& solvers) const;
+
+    miopenConvBwdDataAlgorithm_t GetImmediateConvBwdDataAlgorithm(Handle& handle,
+                                                                  const TensorDescriptor& dyDesc,
+                                                                  const TensorDescriptor& wDesc,
+                                                                  const TensorDescriptor& dxDesc,
+                                                                  size_t workSpaceSize) const;
+
     void ConvolutionBackwardData(Handle& handle,
                                  const void* alpha,
                                  const TensorDescriptor& dyDesc,
@@ -261,6 +318,16 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                                const TensorDescriptor& dyDesc,
                                                const TensorDescriptor& dwDesc) const;
 
+    size_t BackwardWeightsGetWorkSpaceSizeGEMM(Handle& handle,
+                                               const TensorDescriptor& dyDesc,
+                                               const TensorDescriptor& dwDesc,
+                                               int chunk) const;
+
+    int BackwardWeightsGetGemmChunkSize(Handle& handle,
+                                        const TensorDescriptor& dyDesc,
+                                        const TensorDescriptor& dwDesc,
+                                        size_t workSpaceSize) const;
+
     size_t BackwardWeightsGetWorkSpaceSizeDirect(Handle& handle,
                                                  const TensorDescriptor& dyDesc,
                                                  const TensorDescriptor& xDesc,
@@ -280,6 +347,25 @@ struct ConvolutionDescriptor : miopenConvolutionDescriptor
                                      size_t workSpaceSize,
                                      bool exhaustiveSearch) const;
 
+    std::vector<PerfField> MeasureConvBwdWeightsAlgorithms(Handle& handle,
+                                                           const TensorDescriptor& dyDesc,
+                                                           ConstData_t dy,
+                                                           const TensorDescriptor& xDesc,
+                                                           ConstData_t x,
+                                                           const TensorDescriptor& dwDesc,
+                                                           Data_t workSpace,
+                                                           size_t workSpaceSize,
+                                                           bool exhaustiveSearch,
+                                                           const FindDbSelection& only,
+                                                           FindDbSolvers& solvers) const;
+
+    miopenConvBwdWeightsAlgorithm_t
+    GetImmediateConvBwdWeightsAlgorithm(Handle& handle,
+                                        const TensorDescriptor& dyDesc,
+                                        const TensorDescriptor& xDesc,
+                                        const TensorDescriptor& dwDesc,
+                                        size_t workSpaceSize) const;
+
     void ConvolutionBackwardWeights(Handle& handle,
                                     const void* alpha,
                                     const TensorDescriptor& dyDesc,
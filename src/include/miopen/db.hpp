@@ -31,6 +31,7 @@
 
 #include <boost/optional.hpp>
 
+#include <cstddef>
 #include <string>
 
 namespace boost {
@@ -135,6 +136,10 @@ class Db
         return record->GetValues(id, values);
     }
 
+    /// Returns a number which is incremented each time a record of any Db is written by this
+    /// process. Allows to invalidate data derived from db contents.
+    static std::size_t GetGeneration();
+
     private:
     std::string filename;
     LockFile& lock_file;
@@ -0,0 +1,109 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_FFT_HOST_HPP_
+#define GUARD_MIOPEN_FFT_HOST_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace miopen {
+
+struct ConvolutionDescriptor;
+struct TensorDescriptor;
+
+namespace host {
+
+struct FFTPlan2D;
+
+/// A stride-1 convolution of packed NCHW float tensors by FFT, for filters of any size.
+///
+/// Input planes are zero-padded to tiles of fft_h x fft_w, with sizes of the form 2^a 3^b,
+/// and transformed by a real-to-complex 2-D FFT. For every frequency the spectra are multiplied
+/// with the conjugated filter spectra over the channels by host::Gemm, and the products are
+/// transformed back. The FFT plans are cached per tile size, the filter spectra are computed
+/// when the object is made.
+class FFTConv
+{
+    public:
+    /// w is a k x c x r x s filter, in is in_h x in_w and the pads are those of the convolution
+    /// descriptor. For backward data the object runs the transposed convolution, with the
+    /// filter flipped and its k and c swapped, and in is dy.
+    FFTConv(int k,
+            int c,
+            int r,
+            int s,
+            int in_h,
+            int in_w,
+            int pad_h,
+            int pad_w,
+            const float* w,
+            bool backward = false);
+
+    /// out (n x OutputChannels() x OutHeight() x OutWidth()) = in (n x InputChannels() x
+    /// in_h x in_w) convolved with the filter. Images are transformed a group at a time, so that
+    /// their spectra stay within a bounded buffer.
+    void Run(int n, const float* in, float* out) const;
+
+    int OutputChannels() const { return k; }
+    int InputChannels() const { return c; }
+    int OutHeight() const { return out_h; }
+    int OutWidth() const { return out_w; }
+
+    /// Complex values in the spectrum of one tile, fft_h * (fft_w / 2 + 1), which
+    /// FFTConvParams::TileSize gives for the GPU kernels.
+    std::size_t TileSize() const;
+
+    /// Bytes of input and filter spectra of n images, as Run would keep them for one group.
+    std::size_t SpectraSize(int n) const;
+
+    private:
+    int k;
+    int c;
+    int r;
+    int s;
+    int in_h;
+    int in_w;
+    int pad_h;
+    int pad_w;
+    int out_h;
+    int out_w;
+    std::shared_ptr<const FFTPlan2D> plan;
+    /// Per frequency, a k x 2c matrix of the real and imaginary parts of the filter spectra.
+    std::vector<float> wf;
+};
+
+/// Whether FFTConv can run conv with the filter wDesc: unit strides and dilations, and for
+/// backward data pads smaller than the filter. Filters smaller than 5x5 are left to GEMM and
+/// Winograd, which are faster for them.
+bool IsFFTApplicable(const ConvolutionDescriptor& conv,
+                     const TensorDescriptor& wDesc,
+                     bool backward);
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_FFT_HOST_HPP_
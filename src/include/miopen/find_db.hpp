@@ -0,0 +1,155 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_FIND_DB_HPP_
+#define GUARD_MIOPEN_FIND_DB_HPP_
+
+#include <miopen/db.hpp>
+#include <miopen/serializable.hpp>
+
+#include <boost/optional.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+/// Result of one algorithm as measured by Find().
+struct FindDbData : solver::Serializable<FindDbData>
+{
+    float time            = 0.0f;
+    std::size_t workspace = 0;
+    /// Workspace size which was available to Find() when the result was measured.
+    std::size_t workspace_limit = 0;
+    /// For algorithms implemented by several solvers (e.g. Direct): the fastest solver.
+    std::string solver_id;
+    /// 1 if kernels were auto-tuned (exhaustiveSearch) during the measurement.
+    int searched = 0;
+
+    FindDbData() = default;
+    FindDbData(float time_,
+               std::size_t workspace_,
+               std::size_t workspace_limit_,
+               std::string solver_id_,
+               bool searched_)
+        : time(time_),
+          workspace(workspace_),
+          workspace_limit(workspace_limit_),
+          solver_id(std::move(solver_id_)),
+          searched(searched_ ? 1 : 0)
+    {
+    }
+
+    template <class Self, class F>
+    static void Visit(Self&& self, F f)
+    {
+        f(self.time, "time");
+        f(self.workspace, "workspace");
+        f(self.workspace_limit, "workspace_limit");
+        f(self.solver_id, "solver_id");
+        f(self.searched, "searched");
+    }
+};
+
+/// Pairs of algorithm name and its result, fastest first.
+using FindDbResults = std::vector<std::pair<std::string, FindDbData>>;
+
+/// Restricts Find() to the algorithm and solver known to be the fastest.
+/// Default-constructed object allows everything.
+struct FindDbSelection
+{
+    std::string algorithm;
+    std::string solver_id;
+
+    bool IsAlgorithmAllowed(const std::string& name) const
+    {
+        return algorithm.empty() || algorithm == name;
+    }
+    bool IsSolverAllowed(const std::string& id) const
+    {
+        return solver_id.empty() || solver_id == id;
+    }
+};
+
+/// Solvers selected by Find(), per algorithm name.
+using FindDbSolvers = std::unordered_map<std::string, std::string>;
+
+/// Persistent cache of Find() results.
+///
+/// Find() measures every applicable algorithm, which involves building all their
+/// kernels. The find-db keeps the sorted results per problem config and device, so
+/// that subsequent Find() calls (also in other processes) can return them right away
+/// and build only the kernels of the algorithm that is going to be used.
+///
+/// The format is the one of PerfDb: KEY is the problem config, IDs are algorithm
+/// names and VALUES are FindDbData. Like PerfDb, there is a read-only system
+/// find-db and a user find-db, both per device; new results go to the user one.
+class FindDb
+{
+    public:
+    FindDb(const std::string& installed_path, const std::string& user_path, std::string key_);
+    FindDb(Handle& handle, std::string key_);
+
+    /// Returns results recorded for the listed algorithms which fit into workspace_limit,
+    /// fastest first. Returns none if there is no such results, or if the record is not
+    /// good enough for the caller: it was measured with less workspace available (so
+    /// some algorithms may be missing), or not auto-tuned while require_searched is set.
+    boost::optional<FindDbResults> Load(const std::vector<std::string>& algorithms,
+                                        std::size_t workspace_limit,
+                                        bool require_searched);
+
+    /// Returns the recorded result of one algorithm regardless of the workspace
+    /// it was measured with. Used to pick the solver when Find() was not run.
+    boost::optional<FindDbData> Load(const std::string& algorithm);
+
+    /// Replaces the record with the provided results.
+    bool Store(const FindDbResults& results);
+
+    /// Removes the record from the user find-db.
+    bool Remove();
+
+    static std::string GetInstalledPath(Handle& handle);
+    static std::string GetUserPath(Handle& handle);
+
+    private:
+    struct Key
+    {
+        const std::string& str;
+        void Serialize(std::ostream& stream) const { stream << str; }
+    };
+
+    MultiFileDb db;
+    std::string key;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_FIND_DB_HPP_
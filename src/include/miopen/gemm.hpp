@@ -44,7 +44,8 @@ GemmGeometry CreateGemmGeometryConvBwdWeights(const TensorDescriptor& dyDesc,
                                               const TensorDescriptor& xDesc,
                                               const TensorDescriptor& dwDesc,
                                               bool isDataColMajor,
-                                              std::string& network_config);
+                                              std::string& network_config,
+                                              int chunk = 1);
 
 GemmGeometry CreateGemmGeometryConvBwdData(const TensorDescriptor& dyDesc,
                                            const TensorDescriptor& wDesc,
@@ -62,7 +63,8 @@ GemmGeometry CreateGemmGeometryConvFwd(const TensorDescriptor& xDesc,
                                        const TensorDescriptor& wDesc,
                                        const TensorDescriptor& yDesc,
                                        bool isDataColMajor,
-                                       std::string& network_config);
+                                       std::string& network_config,
+                                       int chunk = 1);
 
 GemmGeometry CreateGemmGeometryConvFwdCNHW(const TensorDescriptor& xDesc,
                                            const TensorDescriptor& wDesc,
@@ -0,0 +1,107 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_MIOPEN_GEMM_CHUNK_HPP_
+#define GUARD_MIOPEN_GEMM_CHUNK_HPP_
+
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace miopen {
+
+// The im2col + GEMM convolution paths can process several images per GEMM:
+// im2col writes `chunk` images side by side into one column buffer of
+// (C*R*S) x (chunk*out_h*out_w) and a single GEMM covers the whole chunk.
+//
+// `col_size` is the number of column elements of one image (C*R*S*out_h*out_w)
+// and `out_size` the number of elements of the other GEMM operand of one image
+// (K*out_h*out_w). A chunk of one image reads and writes the user tensor
+// directly, so it only needs the column buffer. Larger chunks also stage that
+// operand in CNHW layout right after the column buffer.
+inline std::size_t GetGemmChunkWorkSpaceSize(std::size_t col_size,
+                                             std::size_t out_size,
+                                             int chunk,
+                                             std::size_t type_size)
+{
+    if(chunk < 1)
+        return 0;
+    const auto n = static_cast<std::size_t>(chunk);
+    if(n == 1)
+        return col_size * type_size;
+    return (col_size + out_size) * n * type_size;
+}
+
+// The workspace of a chunk on a device which caps the workspace at `limit`
+// bytes, as gfx803 does. A single image over the cap reports 0, which the GEMM
+// paths have always done there. Larger chunks over the cap cannot be used, so
+// they report a size that no workspace satisfies.
+inline std::size_t GetGemmChunkWorkSpaceSize(std::size_t col_size,
+                                             std::size_t out_size,
+                                             int chunk,
+                                             std::size_t type_size,
+                                             std::size_t limit)
+{
+    const auto size = GetGemmChunkWorkSpaceSize(col_size, out_size, chunk, type_size);
+    if(size <= limit)
+        return size;
+    return chunk > 1 ? std::numeric_limits<std::size_t>::max() : 0;
+}
+
+// Chunk sizes the GEMM paths may use for a batch of `batch_n` images, smallest
+// first. The batch runs in chunks of that size; when the size does not divide
+// the batch, the last chunk is smaller and needs a GEMM geometry of its own.
+// Only the smallest size giving each number of GEMMs is listed, as a larger one
+// would take more workspace for the same number of GEMMs.
+inline std::vector<int> GetGemmChunkSizes(int batch_n)
+{
+    std::vector<int> sizes;
+    for(int gemms = batch_n; gemms >= 1; --gemms)
+    {
+        const int chunk = (batch_n + gemms - 1) / gemms;
+        if(sizes.empty() || sizes.back() != chunk)
+            sizes.push_back(chunk);
+    }
+    return sizes;
+}
+
+// Picks the largest chunk whose workspace fits into `workspace_size` bytes.
+// Returns 0 when even a single image does not fit.
+inline int GetGemmChunkSize(int batch_n,
+                            std::size_t col_size,
+                            std::size_t out_size,
+                            std::size_t type_size,
+                            std::size_t workspace_size)
+{
+    int best = 0;
+    for(auto chunk : GetGemmChunkSizes(batch_n))
+        if(GetGemmChunkWorkSpaceSize(col_size, out_size, chunk, type_size) <= workspace_size)
+            best = chunk;
+    return best;
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_GEMM_CHUNK_HPP_
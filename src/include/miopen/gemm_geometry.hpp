@@ -28,6 +28,7 @@
 
 #include <miopen/config.h>
 #include <miopen/kernel_cache.hpp>
+#include <miopen/serializable.hpp>
 #include <miopen/tensor.hpp>
 
 #if MIOPEN_USE_MIOPENGEMM
@@ -37,6 +38,23 @@
 
 namespace miopen {
 
+/// MIOpenGEMM solution kept in the perf db under the network config of its geometry,
+/// so that the kernels can be rebuilt in later processes without another search.
+struct GemmDbData : solver::Serializable<GemmDbData>
+{
+    /// Kernel hyper-parameters selected by MIOpenGEMM::find().
+    std::string hyper_params;
+    /// 1 if the solution has a separate beta kernel.
+    int beta_kern_returned = 0;
+
+    template <class Self, class F>
+    static void Visit(Self&& self, F f)
+    {
+        f(self.hyper_params, "hyper_params");
+        f(self.beta_kern_returned, "beta_kern_returned");
+    }
+};
+
 struct GemmGeometry
 {
     std::string algorithm_name;
@@ -66,6 +84,10 @@ struct GemmGeometry
 
     void EnableBetaKernel(bool enable);
 
+    /// Builds the kernels of the solution recorded in the perf db for this geometry.
+    /// Returns false if there is no usable record.
+    bool LoadSolution(Handle& handle, bool enforce_determinism);
+
     void FindSolution(float time,
                       Handle& handle,
                       ConstData_t a,
@@ -82,6 +104,10 @@ struct GemmGeometry
                  int c_offset);
 };
 
+/// Access to Handle::geo_map which is safe when the handle is used from several threads.
+bool FindGemmGeometry(Handle& handle, const GemmKey& key, GemmGeometry& gg);
+void AddGemmGeometry(Handle& handle, const GemmKey& key, const GemmGeometry& gg);
+
 } // namespace miopen
 #endif // MIOPEN_USE_MIOPENGEMM
 
@@ -0,0 +1,165 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_MIOPEN_GEMM_HOST_HPP_
+#define GUARD_MIOPEN_GEMM_HOST_HPP_
+
+#include <miopen/common.hpp>
+#include <miopen/config.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct Handle;
+
+namespace host {
+
+/// Instruction sets of the micro-kernels of Gemm.
+enum class GemmIsa
+{
+    Scalar,
+    Avx2,
+    Avx512,
+};
+
+/// The widest instruction set of the host that Gemm has a micro-kernel for.
+GemmIsa GemmHostIsa();
+
+/// C = alpha * op(A) * op(B) + beta * C for row-major float matrices in host memory, where
+/// op(A) is M x K, op(B) is K x N and op(X) is X or its transpose. lda, ldb and ldc are the
+/// distances between consecutive rows of the stored matrices. C is not read when beta is 0.
+///
+/// Panels of op(A) and op(B) are packed into cache-sized blocks and multiplied by a register
+/// blocked micro-kernel. Tiles of C are spread over ParallelFor.
+void Gemm(bool transA,
+          bool transB,
+          std::size_t M,
+          std::size_t N,
+          std::size_t K,
+          float alpha,
+          const float* A,
+          std::size_t lda,
+          const float* B,
+          std::size_t ldb,
+          float beta,
+          float* C,
+          std::size_t ldc);
+
+/// Gemm with the micro-kernel for isa, which the host must support.
+void Gemm(GemmIsa isa,
+          bool transA,
+          bool transB,
+          std::size_t M,
+          std::size_t N,
+          std::size_t K,
+          float alpha,
+          const float* A,
+          std::size_t lda,
+          const float* B,
+          std::size_t ldb,
+          float beta,
+          float* C,
+          std::size_t ldc);
+
+class GemmPackedB;
+
+/// C = alpha * op(A) * B + beta * C, where op(A) is M x B.Rows() and B was packed once by
+/// GemmPackedB. Saves the packing of op(B) when many products share it.
+void Gemm(bool transA,
+          std::size_t M,
+          float alpha,
+          const float* A,
+          std::size_t lda,
+          const GemmPackedB& B,
+          float beta,
+          float* C,
+          std::size_t ldc);
+
+/// op(B) of Gemm, K x N, packed into the panels of the micro-kernel, such as the weights an
+/// RNN multiplies its hidden state with at every time step.
+class GemmPackedB
+{
+    public:
+    GemmPackedB(bool transB, std::size_t K, std::size_t N, const float* B, std::size_t ldb);
+
+    /// Packed for the micro-kernel of isa, which the host must support.
+    GemmPackedB(
+        GemmIsa isa, bool transB, std::size_t K, std::size_t N, const float* B, std::size_t ldb);
+
+    std::size_t Rows() const { return k; }
+    std::size_t Columns() const { return n; }
+
+    private:
+    friend void Gemm(bool transA,
+                     std::size_t M,
+                     float alpha,
+                     const float* A,
+                     std::size_t lda,
+                     const GemmPackedB& B,
+                     float beta,
+                     float* C,
+                     std::size_t ldc);
+
+    GemmIsa isa;
+    std::size_t k;
+    std::size_t n;
+    std::vector<float> data;
+};
+
+} // namespace host
+
+#if MIOPEN_BACKEND_CPU
+/// The MIOpenGEMM entry point of the RNN code, run by host::Gemm. A, B and C are row-major with
+/// element offsets, tC stores C transposed. isDataColMajor, network_config and timeout only
+/// matter to MIOpenGEMM.
+void RunGemmGeometryRNN(Handle& handle,
+                        ConstData_t A,
+                        ConstData_t B,
+                        Data_t C,
+                        int M,
+                        int N,
+                        int K,
+                        float alpha,
+                        float beta,
+                        bool tA,
+                        bool tB,
+                        bool tC,
+                        int lda,
+                        int ldb,
+                        int ldc,
+                        int a_offset,
+                        int b_offset,
+                        int c_offset,
+                        bool isDataColMajor,
+                        std::string& network_config,
+                        float timeout);
+#endif
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_GEMM_HOST_HPP_
@@ -34,9 +34,25 @@
 #include <limits>
 #include <iterator>
 #include <chrono>
+#include <algorithm>
+#include <utility>
 
+#include <miopen/env.hpp>
 #include <miopen/logger.hpp>
 #include <miopen/handle.hpp>
+#include <miopen/rank.hpp>
+#include <miopen/trace.hpp>
+
+/// Set to 0/disable to make GenericSearch ignore the cost models provided
+/// by Solvers (i.e. to visit all the configs in lexicographic order).
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_SEARCH_MODEL)
+/// If the Solver provides a cost model, measure only this many
+/// best-scored configs. 0 (default) means "measure all".
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_SEARCH_MODEL_TOP_K)
+/// If the Solver provides a cost model, stop the search after this many
+/// consecutive measurements which did not improve the best time.
+/// 0 (default) means "never stop early".
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_SEARCH_MODEL_EARLY_STOP)
 
 namespace miopen {
 namespace solver {
@@ -250,6 +266,68 @@ inline size_t divide_round_plus_inf(const size_t x, const unsigned y)
     return x / y;
 }
 
+template <class Solver, class Context, class PerformanceConfig>
+auto EstimateCostImpl(rank<1>, const Solver& s, const Context& c, const PerformanceConfig& p)
+    -> decltype(s.EstimatePerformanceConfigCost(c, p), std::pair<bool, double>())
+{
+    return {true, s.EstimatePerformanceConfigCost(c, p)};
+}
+
+template <class Solver, class Context, class PerformanceConfig>
+std::pair<bool, double>
+EstimateCostImpl(rank<0>, const Solver&, const Context&, const PerformanceConfig&)
+{
+    return {false, 0.0};
+}
+
+/// Returns {true, cost} if Solver provides a cost model, {false, 0} otherwise.
+template <class Solver, class Context, class PerformanceConfig>
+std::pair<bool, double>
+EstimateCost(const Solver& s, const Context& c, const PerformanceConfig& p)
+{
+    return EstimateCostImpl(rank<1>{}, s, c, p);
+}
+
+/// Collects all the configs from the container. If the Solver provides a cost
+/// model, then configs are sorted by the estimated cost (the most promising
+/// first) and only top_k of them are kept (0 means "keep all").
+/// Lexicographic order is preserved among configs with equal cost.
+template <class Solver, class Context, class Container>
+auto GetSearchOrder(const Solver& s,
+                    const Context& context,
+                    const Container& all_configs,
+                    const std::size_t top_k,
+                    bool& is_model_guided)
+    -> std::vector<typename std::decay<decltype(*all_configs.begin())>::type>
+{
+    using PerformanceConfig = typename std::decay<decltype(*all_configs.begin())>::type;
+    std::vector<std::pair<double, PerformanceConfig>> scored;
+    is_model_guided = true;
+    for(const auto& config : all_configs)
+    {
+        const auto cost = EstimateCost(s, context, config);
+        is_model_guided = is_model_guided && cost.first;
+        scored.emplace_back(cost.second, config);
+    }
+
+    if(is_model_guided)
+    {
+        std::stable_sort(
+            scored.begin(),
+            scored.end(),
+            [](const std::pair<double, PerformanceConfig>& l,
+               const std::pair<double, PerformanceConfig>& r) { return l.first < r.first; });
+        if(top_k != 0 && top_k < scored.size())
+            scored.resize(top_k);
+    }
+
+    std::vector<PerformanceConfig> ordered;
+    ordered.reserve(scored.size());
+    for(const auto& item : scored)
+        ordered.push_back(item.second);
+    return ordered;
+}
+
 enum class SearchTweak
 {
     None,
@@ -265,6 +343,9 @@ enum class SearchTweak
 ///   - Its return type shall be suitable for instantiation of the ComputedContainer.
 /// * GetSolution shall be implemented.
 /// * RunAndMeasureSolution shall be implemented.
+/// * EstimatePerformanceConfigCost may be implemented (see SolverBase).
+///   If it is, configs are measured in the order of increasing estimated cost,
+///   and the search can be pruned (see MIOPEN_DEBUG_SEARCH_MODEL_* env.vars).
 ///
 /// clang-format-off
 /// -----------------------------------------------
@@ -291,6 +372,7 @@ auto GenericSearch(const Solver s,
                    const SearchTweak tweak = SearchTweak::None)
     -> decltype(s.GetPerformanceConfig(context))
 {
+    MIOPEN_TRACE_SCOPE("search", "GenericSearch " << SolverDbId(s));
     using PerformanceConfig = decltype(s.GetPerformanceConfig(context));
     PerformanceConfig best_config;
     const auto default_solution = s.GetSolution(context, s.GetPerformanceConfig(context));
@@ -335,9 +417,22 @@ auto GenericSearch(const Solver s,
     const bool useSpare  = (main_size == 0);
 
     const ComputedContainer<PerformanceConfig, Context> all_configs = useSpare ? spare : main;
-    const int n_runs_total = useSpare ? spare_size : main_size;
+    const int n_configs_total = useSpare ? spare_size : main_size;
+
+    bool is_model_guided = false;
+    const auto use_model = !miopen::IsDisabled(MIOPEN_DEBUG_SEARCH_MODEL{});
+    const auto top_k     = std::max(0, Value(MIOPEN_DEBUG_SEARCH_MODEL_TOP_K{}));
+    const auto early_stop = std::max(0, Value(MIOPEN_DEBUG_SEARCH_MODEL_EARLY_STOP{}));
+    const auto search_order =
+        use_model ? GetSearchOrder(s, context, all_configs, top_k, is_model_guided)
+                  : std::vector<PerformanceConfig>(all_configs.begin(), all_configs.end());
+    const int n_runs_total = search_order.size();
     MIOPEN_LOG_W(SolverDbId(s) << ": Searching the best solution among " << n_runs_total
+                               << (n_runs_total != n_configs_total
+                                       ? " (of " + std::to_string(n_configs_total) + ")"
+                                       : "")
                                << (useSpare ? " (spare)" : "")
+                               << (is_model_guided ? " (model-guided)" : "")
                                << "...");
 
     bool is_passed   = false; // left false only if all iterations failed.
@@ -349,8 +444,18 @@ auto GenericSearch(const Solver s,
     heartbeat.Start();
 
     profile_h.EnableProfiling(true);
-    for(const auto& current_config : all_configs)
+    for(const auto& current_config : search_order)
     {
+        if(is_model_guided && early_stop > 0 && is_passed &&
+           n_current - n_best >= static_cast<size_t>(early_stop))
+        {
+            MIOPEN_LOG_W("No improvement during last " << (n_current - n_best)
+                                                       << " runs, stopping early at #"
+                                                       << n_current);
+            break;
+        }
+
+        MIOPEN_TRACE_SCOPE("search", SolverDbId(s) << " #" << n_current << ' ' << current_config);
         float elapsed_time = 0.0f;
         int ret            = 0;
         MIOPEN_LOG_I2('#' << n_current << '/' << n_failed << '/' << n_runs_total << ' '
@@ -446,7 +551,7 @@ auto GenericSearch(const Solver s,
     }
 
     profile_h.EnableProfiling(false);
-    MIOPEN_LOG_W("Done: " << n_runs_total << '/' << n_failed << '/' << n_runs_total << ", best #"
+    MIOPEN_LOG_W("Done: " << n_current << '/' << n_failed << '/' << n_runs_total << ", best #"
                           << n_best
                           << ' '
                           << best_time
@@ -35,8 +35,9 @@
 #include <miopen/miopen.h>
 #include <miopen/object.hpp>
 #include <miopen/allocator.hpp>
+#include <miopen/allocator_pool.hpp>
 #include <miopen/simple_hash.hpp>
-#include <boost/range/adaptor/transformed.hpp>
+#include <mutex>
 #include <vector>
 #include <unordered_map>
 
@@ -48,6 +49,13 @@ struct GemmGeometry;
 using GemmKey = std::pair<std::string, std::string>;
 #endif
 
+/// Handle may be used from several host threads at once. Kernel and program caches
+/// are shared between the threads, while kernel time (see EnableProfiling()) is
+/// accumulated per thread. By default all threads enqueue to the stream of the handle;
+/// SetThreadStream() sets a separate stream for the calling thread.
+///
+/// Changing the stream, the allocator or profiling mode of the handle, as well as
+/// ClearKernels(), shall not be done concurrently with other calls.
 struct Handle : miopenHandle
 {
 
@@ -56,13 +64,22 @@ struct Handle : miopenHandle
     Handle(Handle&&) noexcept;
     ~Handle();
 
+    /// Returns the stream of the calling thread, if set, or the stream of the handle.
     miopenAcceleratorQueue_t GetStream() const;
     void SetStream(miopenAcceleratorQueue_t streamID) const;
+    /// Sets the stream used by the calling thread only. nullptr resets it to the
+    /// stream of the handle.
+    void SetThreadStream(miopenAcceleratorQueue_t streamID) const;
 
     void SetAllocator(miopenAllocatorFunction allocator,
                       miopenDeallocatorFunction deallocator,
                       void* allocatorContext) const;
 
+    /// Caching of buffers returned by Create(), see AllocatorPool.
+    void SetAllocatorPoolLimit(std::size_t limit) const;
+    void TrimAllocatorPool() const;
+    AllocatorPoolStatistics GetAllocatorPoolStatistics() const;
+
     void EnableProfiling(bool enable = true);
 
     void ResetKernelTime();
@@ -82,10 +99,13 @@ struct Handle : miopenHandle
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config);
 
-    auto GetKernels(const std::string& algorithm, const std::string& network_config)
+    std::vector<KernelInvoke> GetKernels(const std::string& algorithm,
+                                         const std::string& network_config)
     {
-        return this->GetKernelsImpl(algorithm, network_config) |
-               boost::adaptors::transformed([this](Kernel k) { return this->Run(k); });
+        std::vector<KernelInvoke> result;
+        for(auto&& k : this->GetKernelsImpl(algorithm, network_config))
+            result.push_back(this->Run(k));
+        return result;
     }
     KernelInvoke GetKernel(const std::string& algorithm, const std::string& network_config)
     {
@@ -99,8 +119,8 @@ struct Handle : miopenHandle
     }
 
     KernelInvoke Run(Kernel k);
-    const std::vector<Kernel>& GetKernelsImpl(const std::string& algorithm,
-                                              const std::string& network_config);
+    std::vector<Kernel> GetKernelsImpl(const std::string& algorithm,
+                                       const std::string& network_config);
 
     Program LoadProgram(const std::string& program_name, std::string params, bool is_kernel_str);
 
@@ -119,7 +139,7 @@ struct Handle : miopenHandle
     WriteTo(const void* data, Allocator::ManageDataPtr& ddata, std::size_t sz);
     void ReadTo(void* data, const Allocator::ManageDataPtr& ddata, std::size_t sz);
     shared<Data_t> CreateSubBuffer(Data_t data, std::size_t offset, std::size_t size);
-#if MIOPEN_BACKEND_HIP
+#if MIOPEN_BACKEND_HIP || MIOPEN_BACKEND_CPU
     shared<ConstData_t> CreateSubBuffer(ConstData_t data, std::size_t offset, std::size_t size);
 #endif
 
@@ -148,7 +168,9 @@ struct Handle : miopenHandle
 
     std::unique_ptr<HandleImpl> impl;
 #if MIOPEN_USE_MIOPENGEMM
+    /// Shall be accessed under geo_map_mutex, see FindGemmGeometry().
     std::unordered_map<GemmKey, std::unique_ptr<GemmGeometry>, SimpleHash> geo_map;
+    std::unique_ptr<std::mutex> geo_map_mutex{new std::mutex};
 #endif
 };
 } // namespace miopen
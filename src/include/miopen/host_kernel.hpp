@@ -0,0 +1,75 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_HOST_KERNEL_HPP
+#define GUARD_MIOPEN_HOST_KERNEL_HPP
+
+#include <miopen/errors.hpp>
+
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+// The CPU backend has no device code: the ops call host functions directly. These types only
+// keep the kernel interface of Handle compiling; launching a kernel is an error.
+
+struct HostKernelInvoke
+{
+    std::string name;
+
+    HostKernelInvoke() {}
+    HostKernelInvoke(const std::string& pname) : name(pname) {}
+
+    template <class... Ts>
+    void operator()(Ts...) const
+    {
+        MIOPEN_THROW(miopenStatusNotImplemented,
+                     "Kernels are not supported by the CPU backend: " + name);
+    }
+
+    const std::string& GetName() const { return name; }
+};
+
+struct HostKernel
+{
+    std::string name;
+
+    HostKernel() {}
+    HostKernel(const std::string& kernel_name) : name(kernel_name) {}
+
+    HostKernelInvoke Invoke(void*) const { return HostKernelInvoke{name}; }
+
+    const std::string& GetName() const { return name; }
+};
+
+struct HostProgram
+{
+};
+
+} // namespace miopen
+
+#endif
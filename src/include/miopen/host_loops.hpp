@@ -0,0 +1,210 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_HOST_LOOPS_HPP_
+#define GUARD_MIOPEN_HOST_LOOPS_HPP_
+
+#include <miopen/parallel_for.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace miopen {
+namespace host {
+
+// Loop nests over host tensors shared by the host implementations of the elementwise ops.
+
+// Elements of the innermost loop handled as one piece of work, so that a single long loop is
+// still spread over the threads.
+constexpr std::size_t run_block_size = 4096;
+// Elements below which the work of a host engine stays on the calling thread, where waking the
+// threads would cost more than it saves.
+constexpr std::size_t host_parallel_grain = 32768;
+
+/// The type host engines compute in: float when all data is float, otherwise double.
+template <class X, class Y>
+using HostAcc = typename std::
+    conditional<std::is_same<X, float>{} && std::is_same<Y, float>{}, float, double>::type;
+
+/// Loop nest over N tensors, outermost loop first. A stride of 0 broadcasts the tensor.
+template <std::size_t N>
+struct Loops
+{
+    std::vector<std::size_t> lens;
+    std::array<std::vector<std::ptrdiff_t>, N> strides;
+};
+
+/// Drops dimensions of length 1 and merges a dimension into the preceding one when it is
+/// contiguous with it in every tensor, as GetConsistentFlattenedTensorDescriptors does, except
+/// that zero (broadcast) strides are allowed.
+template <std::size_t N>
+Loops<N> MakeLoops(const std::vector<std::size_t>& lens,
+                   const std::array<std::vector<std::ptrdiff_t>, N>& strides)
+{
+    Loops<N> loops;
+    for(std::size_t d = 0; d < lens.size(); d++)
+    {
+        if(lens[d] == 1)
+            continue;
+        bool contiguous = not loops.lens.empty();
+        for(std::size_t i = 0; i < N && contiguous; i++)
+            contiguous = loops.strides[i].back() ==
+                         strides[i][d] * static_cast<std::ptrdiff_t>(lens[d]);
+        if(contiguous)
+        {
+            loops.lens.back() *= lens[d];
+            for(std::size_t i = 0; i < N; i++)
+                loops.strides[i].back() = strides[i][d];
+        }
+        else
+        {
+            loops.lens.push_back(lens[d]);
+            for(std::size_t i = 0; i < N; i++)
+                loops.strides[i].push_back(strides[i][d]);
+        }
+    }
+    if(loops.lens.empty())
+    {
+        loops.lens.push_back(1);
+        for(std::size_t i = 0; i < N; i++)
+            loops.strides[i].push_back(1);
+    }
+    return loops;
+}
+
+inline std::vector<std::ptrdiff_t> Strides(const TensorDescriptor& desc)
+{
+    return {desc.GetStrides().begin(), desc.GetStrides().end()};
+}
+
+/// Calls f(offsets, n) for every run of at most run_block_size elements of the innermost loop,
+/// where offsets are the positions of its first element in the tensors.
+template <std::size_t N, class F>
+void ForEachRun(const Loops<N>& loops, F f)
+{
+    const auto& lens         = loops.lens;
+    const std::size_t outers = lens.size() - 1;
+    const std::size_t inner  = lens.back();
+    const std::size_t block  = std::min(inner, run_block_size);
+    const std::size_t blocks = (inner + block - 1) / block;
+    std::size_t rows         = 1;
+    for(std::size_t d = 0; d < outers; d++)
+        rows *= lens[d];
+
+    ParallelFor(rows * blocks,
+                std::max<std::size_t>(host_parallel_grain / block, 1),
+                [&](std::size_t begin, std::size_t end) {
+                    std::vector<std::size_t> index(outers);
+                    std::size_t row = begin / blocks;
+                    std::size_t b   = begin % blocks;
+                    for(std::size_t d = outers; d-- > 0;)
+                    {
+                        index[d] = row % lens[d];
+                        row /= lens[d];
+                    }
+
+                    for(std::size_t w = begin; w < end; w++)
+                    {
+                        std::array<std::ptrdiff_t, N> offsets;
+                        for(std::size_t i = 0; i < N; i++)
+                        {
+                            offsets[i] =
+                                static_cast<std::ptrdiff_t>(b * block) * loops.strides[i].back();
+                            for(std::size_t d = 0; d < outers; d++)
+                                offsets[i] +=
+                                    static_cast<std::ptrdiff_t>(index[d]) * loops.strides[i][d];
+                        }
+                        f(offsets, std::min(block, inner - b * block));
+
+                        if(++b < blocks)
+                            continue;
+                        b = 0;
+                        for(std::size_t d = outers; d-- > 0;)
+                        {
+                            if(++index[d] < lens[d])
+                                break;
+                            index[d] = 0;
+                        }
+                    }
+                });
+}
+
+/// Converts pixels [first, last) of the plane at src, with strides in n, c, h, w order, into dst.
+template <class T, class S>
+void LoadPixels(const S* src,
+                const std::array<std::size_t, 4>& strides,
+                int w,
+                std::size_t first,
+                std::size_t last,
+                T* dst)
+{
+    for(std::size_t p = first; p < last;)
+    {
+        const std::size_t j   = p % w;
+        const std::size_t run = std::min(w - j, last - p);
+        const S* s            = src + (p / w) * strides[2] + j * strides[3];
+        if(strides[3] == 1)
+            std::transform(s, s + run, dst, [](S v) { return static_cast<T>(v); });
+        else
+            for(std::size_t t = 0; t < run; t++)
+                dst[t] = static_cast<T>(s[t * strides[3]]);
+        dst += run;
+        p += run;
+    }
+}
+
+/// Converts src into pixels [first, last) of the plane at dst, with strides in n, c, h, w order.
+template <class T, class D>
+void StorePixels(const T* src,
+                 const std::array<std::size_t, 4>& strides,
+                 int w,
+                 std::size_t first,
+                 std::size_t last,
+                 D* dst)
+{
+    for(std::size_t p = first; p < last;)
+    {
+        const std::size_t j   = p % w;
+        const std::size_t run = std::min(w - j, last - p);
+        D* d                  = dst + (p / w) * strides[2] + j * strides[3];
+        if(strides[3] == 1)
+            std::transform(src, src + run, d, [](T v) { return static_cast<D>(v); });
+        else
+            for(std::size_t t = 0; t < run; t++)
+                d[t * strides[3]] = static_cast<D>(src[t]);
+        src += run;
+        p += run;
+    }
+}
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_HOST_LOOPS_HPP_
@@ -0,0 +1,395 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_HOST_MATH_HPP_
+#define GUARD_MIOPEN_HOST_MATH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace miopen {
+namespace host {
+
+// Elementary functions for the host implementations, written to vectorize.
+//
+// The libm functions are calls the compiler keeps scalar, and a loop over branch-free code still
+// stays scalar when it compares floats, since the comparisons may trap. These are templates over
+// a value type that is either a float or double or a pack of them in a vector register, written
+// with the vector extensions of gcc and clang: a range reduction, a polynomial and selects for the
+// special values, the same code for every lane. The reductions and most polynomials are those of
+// Cephes; e^r in double is its Taylor series. Exp and Log are within 1 ulp of the exact result,
+// Expm1, Log1p and Tanh within 3, also for denormal results and arguments. NaN propagates and
+// infinities map as in libm.
+//
+// Transform runs a generic function of such values over arrays, a pack at a time, and
+// ForEachPack walks arrays the same way for loops that read and write several of them.
+
+#if defined(__GNUC__) && (!defined(__clang__) || __clang_major__ >= 10)
+#define MIOPEN_HOST_MATH_PACKS 1
+#else
+#define MIOPEN_HOST_MATH_PACKS 0
+#endif
+
+/// Values of T processed together by Transform: 16 bytes, an SSE register, where the compiler has
+/// the vector extensions.
+template <class T>
+struct Pack
+{
+    static constexpr std::size_t size = 1;
+    using type                        = T;
+};
+
+#if MIOPEN_HOST_MATH_PACKS
+template <>
+struct Pack<float>
+{
+    static constexpr std::size_t size = 4;
+    typedef float type __attribute__((vector_size(16)));
+};
+
+template <>
+struct Pack<double>
+{
+    static constexpr std::size_t size = 2;
+    typedef double type __attribute__((vector_size(16)));
+};
+#endif
+
+namespace detail {
+
+/// The scalar type of the lanes of V and the integer type of the same layout.
+template <class V>
+struct Lanes;
+
+template <>
+struct Lanes<float>
+{
+    using scalar  = float;
+    using integer = std::int32_t;
+};
+
+template <>
+struct Lanes<double>
+{
+    using scalar  = double;
+    using integer = std::int64_t;
+};
+
+#if MIOPEN_HOST_MATH_PACKS
+template <>
+struct Lanes<Pack<float>::type>
+{
+    using scalar  = float;
+    using integer = std::int32_t __attribute__((vector_size(16)));
+};
+
+template <>
+struct Lanes<Pack<double>::type>
+{
+    using scalar  = double;
+    using integer = std::int64_t __attribute__((vector_size(16)));
+};
+#endif
+
+template <class V>
+using Integer = typename Lanes<V>::integer;
+
+template <class To, class From>
+To BitCast(From v)
+{
+    static_assert(sizeof(To) == sizeof(From), "Bit casts keep the size");
+    To r;
+    std::memcpy(&r, &v, sizeof(r));
+    return r;
+}
+
+// 1.5 * 2^23 and 1.5 * 2^52: adding them rounds to an integer held in the low mantissa bits.
+constexpr float round_magic_f  = 12582912.0f;
+constexpr double round_magic_d = 6755399441055744.0;
+
+/// 2^k for the normal exponents k.
+template <class V>
+V Pow2(Integer<V> k, float)
+{
+    return BitCast<V>((k + 127) << 23);
+}
+
+template <class V>
+V Pow2(Integer<V> k, double)
+{
+    return BitCast<V>((k + 1023) << 52);
+}
+
+/// k as a float, for |k| < 2^22, without the conversion instructions SSE2 lacks for 64 bits.
+template <class V>
+V ToFloat(Integer<V> k, float)
+{
+    return BitCast<V>(k + BitCast<std::int32_t>(round_magic_f)) - round_magic_f;
+}
+
+template <class V>
+V ToFloat(Integer<V> k, double)
+{
+    return BitCast<V>(k + BitCast<std::int64_t>(round_magic_d)) - round_magic_d;
+}
+
+/// e^x = 2^k (em1 + 1) for Exp and Expm1.
+template <class V>
+struct ExpParts
+{
+    V em1;
+    Integer<V> k;
+};
+
+/// x = k ln 2 + r with |r| <= ln 2 / 2, and e^r - 1 a polynomial in r, for x clamped to where
+/// the results round to 0 and infinity.
+template <class V>
+ExpParts<V> ReduceExp(V x, float)
+{
+    const V c = x < -104.0f ? -104.0f : (x > 89.0f ? 89.0f : x);
+    const V t = c * 1.44269504088896341f + round_magic_f;
+    const V n = t - round_magic_f;
+    const V r = c - n * 0.693359375f + n * 2.12194440e-4f;
+
+    V p = r * 1.9875691500e-4f + 1.3981999507e-3f;
+    p   = p * r + 8.3334519073e-3f;
+    p   = p * r + 4.1665795894e-2f;
+    p   = p * r + 1.6666665459e-1f;
+    p   = p * r + 5.0000001201e-1f;
+    return {p * r * r + r, BitCast<Integer<V>>(t) - BitCast<std::int32_t>(round_magic_f)};
+}
+
+template <class V>
+ExpParts<V> ReduceExp(V x, double)
+{
+    const V c = x < -746.0 ? -746.0 : (x > 710.0 ? 710.0 : x);
+    const V t = c * 1.4426950408889634073599 + round_magic_d;
+    const V n = t - round_magic_d;
+    const V r = c - n * 6.93145751953125e-1 - n * 1.42860682030941723212e-6;
+
+    // e^r - 1 = r + r^2 (1/2! + r (1/3! + ... + r / 13!))
+    V p = r * 1.60590438368216133e-10 + 2.08767569878681002e-09;
+    p   = p * r + 2.50521083854417202e-08;
+    p   = p * r + 2.75573192239858883e-07;
+    p   = p * r + 2.75573192239858925e-06;
+    p   = p * r + 2.48015873015873016e-05;
+    p   = p * r + 1.98412698412698413e-04;
+    p   = p * r + 1.38888888888888894e-03;
+    p   = p * r + 8.33333333333333322e-03;
+    p   = p * r + 4.16666666666666644e-02;
+    p   = p * r + 1.66666666666666657e-01;
+    p   = p * r + 5.00000000000000000e-01;
+    return {p * r * r + r, BitCast<Integer<V>>(t) - BitCast<std::int64_t>(round_magic_d)};
+}
+
+/// log x for positive, finite x, as x = 2^e m with sqrt(1/2) <= m < sqrt(2) and log m a
+/// polynomial in m - 1.
+template <class V>
+V FiniteLog(V x, float)
+{
+    const auto denormal = x < std::numeric_limits<float>::min();
+    const Integer<V> bits = BitCast<Integer<V>>(denormal ? x * 8388608.0f : x); // 2^23
+    const V m0            = BitCast<V>((bits & 0x007fffff) | 0x3f000000);       // [1/2, 1)
+    const auto low        = m0 < 0.707106781186547524f;
+    const V e             = ToFloat<V>(((bits >> 23) & 0xff) - 126, float{}) -
+                (denormal ? 23.0f : 0.0f) - (low ? 1.0f : 0.0f);
+    const V m = (low ? m0 + m0 : m0) - 1.0f;
+    const V z = m * m;
+
+    V p = m * 7.0376836292e-2f - 1.1514610310e-1f;
+    p   = p * m + 1.1676998740e-1f;
+    p   = p * m - 1.2420140846e-1f;
+    p   = p * m + 1.4249322787e-1f;
+    p   = p * m - 1.6668057665e-1f;
+    p   = p * m + 2.0000714765e-1f;
+    p   = p * m - 2.4999993993e-1f;
+    p   = p * m + 3.3333331174e-1f;
+    p   = p * m * z - e * 2.12194440e-4f - 0.5f * z;
+    return m + p + e * 0.693359375f;
+}
+
+template <class V>
+V FiniteLog(V x, double)
+{
+    const auto denormal   = x < std::numeric_limits<double>::min();
+    const Integer<V> bits = BitCast<Integer<V>>(denormal ? x * 4503599627370496.0 : x); // 2^52
+    const V m0 = BitCast<V>((bits & 0x000fffffffffffffLL) | 0x3fe0000000000000LL); // [1/2, 1)
+    const auto low = m0 < 0.707106781186547524;
+    const V e      = ToFloat<V>(((bits >> 52) & 0x7ff) - 1022, double{}) -
+                (denormal ? 52.0 : 0.0) - (low ? 1.0 : 0.0);
+    const V m = (low ? m0 + m0 : m0) - 1.0;
+    const V z = m * m;
+
+    // log(1 + m) = m - m^2 / 2 + m^3 P(m) / Q(m)
+    const V p = ((((m * 1.01875663804580931796e-4 + 4.97494994976747001425e-1) * m +
+                   4.70579119878881725854e0) *
+                      m +
+                  1.44989225341610930846e1) *
+                     m +
+                 1.79368678507819816313e1) *
+                    m +
+                7.70838733755885391666e0;
+    const V q = ((((m + 1.12873587189167450590e1) * m + 4.52279145837532221105e1) * m +
+                  8.29875266912776603211e1) *
+                     m +
+                 7.11544750618563894466e1) *
+                    m +
+                2.31251620126765340583e1;
+    const V r = m * z * p / q - e * 2.121944400546905827679e-4 - 0.5 * z;
+    return m + r + e * 0.693359375;
+}
+
+/// tanh x for |x| < 0.625.
+template <class V>
+V SmallTanh(V x, float)
+{
+    const V z = x * x;
+    V p       = z * -5.70498872745e-3f + 2.06390887954e-2f;
+    p         = p * z - 5.37397155531e-2f;
+    p         = p * z + 1.33314422036e-1f;
+    p         = p * z - 3.33332819422e-1f;
+    return p * z * x + x;
+}
+
+template <class V>
+V SmallTanh(V x, double)
+{
+    const V z = x * x;
+    const V p =
+        (z * -9.64399179425052238628e-1 - 9.92877231001918586564e1) * z - 1.61468768441708447952e3;
+    const V q = ((z + 1.12811678491632931402e2) * z + 2.23548839060100448583e3) * z +
+                4.84406305325125486048e3;
+    return x + x * z * p / q;
+}
+
+template <class V>
+using Scalar = typename Lanes<V>::scalar;
+
+} // namespace detail
+
+/// e^x. 2^k is applied in two halves, so that denormal results and overflow round as a single
+/// product would.
+template <class V>
+V Exp(V x)
+{
+    using T       = detail::Scalar<V>;
+    const auto e  = detail::ReduceExp(x, T{});
+    const auto k1 = e.k >> 1;
+    const V y     = (e.em1 + 1) * detail::Pow2<V>(k1, T{}) * detail::Pow2<V>(e.k - k1, T{});
+    return x != x ? x : y;
+}
+
+/// Natural logarithm.
+template <class V>
+V Log(V x)
+{
+    using T     = detail::Scalar<V>;
+    const T inf = std::numeric_limits<T>::infinity();
+    const V y   = detail::FiniteLog(x, T{});
+    return x > 0 ? (x == inf ? x : y) : (x == 0 ? -inf : std::numeric_limits<T>::quiet_NaN());
+}
+
+/// e^x - 1, as 2^k (e^r - 1) + 2^k - 1 while 2^k - 1 is exact, so that nothing cancels near 0.
+template <class V>
+V Expm1(V x)
+{
+    using T       = detail::Scalar<V>;
+    const auto e  = detail::ReduceExp(x, T{});
+    const auto k1 = e.k >> 1;
+    const V s1    = detail::Pow2<V>(k1, T{});
+    const V s2    = detail::Pow2<V>(e.k - k1, T{});
+    const V small = e.em1 * s1 * s2 + (s1 * s2 - 1);
+    const V large = (e.em1 + 1) * s1 * s2 - 1;
+    const V y     = e.k > std::numeric_limits<T>::digits ? large : small;
+    return x != x ? x : y;
+}
+
+/// log(1 + x), as log(u) x / (u - 1) with u = 1 + x, which cancels the rounding of u.
+template <class V>
+V Log1p(V x)
+{
+    const V u = 1 + x;
+    const V y = Log(u) * x / (u - 1);
+    return u == 1 ? x : (u == std::numeric_limits<detail::Scalar<V>>::infinity() ? u : y);
+}
+
+/// tanh x, as 1 - 2 / (e^2|x| + 1) with the sign of x, and a polynomial near 0 where that cancels.
+template <class V>
+V Tanh(V x)
+{
+    using T   = detail::Scalar<V>;
+    const V a = x < 0 ? -x : x;
+    const V y = a < T(0.625) ? detail::SmallTanh(a, T{}) : 1 - 2 / (Exp(a + a) + 1);
+    return x < 0 ? -y : (x != x ? x : y);
+}
+
+/// The value of V, a scalar or a pack, at src, which need not be aligned.
+template <class V, class T>
+V Load(const T* src)
+{
+    V r;
+    std::memcpy(&r, src, sizeof(r));
+    return r;
+}
+
+/// Stores v, a scalar or a pack, at dst, which need not be aligned.
+template <class T, class V>
+void Store(T* dst, V v)
+{
+    std::memcpy(dst, &v, sizeof(v));
+}
+
+/// Calls f(i, P{}) for i = 0, Pack<T>::size, ... with P the pack of T, then f(i, T{}) for each
+/// value left at the end of n. f loads and stores its values at i with Load<P> and Store, so one
+/// pass can read and write several arrays.
+template <class T, class F>
+void ForEachPack(std::size_t n, F f)
+{
+    using P                  = typename Pack<T>::type;
+    constexpr auto sz        = Pack<T>::size;
+    const std::size_t packed = n - n % sz;
+    for(std::size_t i = 0; i < packed; i += sz)
+        f(i, P{});
+    for(std::size_t i = packed; i < n; i++)
+        f(i, T{});
+}
+
+/// dst[i] = f(src[i]...) for n values of contiguous arrays of T, with f called on packs of values
+/// and on the scalars left at the end.
+template <class T, class F, class... Src>
+void Transform(std::size_t n, F f, T* dst, const Src*... src)
+{
+    ForEachPack<T>(n, [&](std::size_t i, auto v) {
+        using V = decltype(v);
+        Store(dst + i, f(Load<V>(src + i)...));
+    });
+}
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_HOST_MATH_HPP_
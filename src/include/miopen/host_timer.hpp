@@ -0,0 +1,69 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_MIOPEN_HOST_TIMER_HPP_
+#define GUARD_MIOPEN_HOST_TIMER_HPP_
+
+#include <miopen/handle.hpp>
+#include <miopen/trace.hpp>
+
+#include <chrono>
+
+namespace miopen {
+
+/// Reports a host implementation of an op the way the GPU backends report a kernel: when
+/// profiling is enabled, the kernel time of the calling thread becomes the time between the
+/// construction and the destruction of the timer, and the op is traced under name.
+struct HostKernelTimer
+{
+    using clock = std::chrono::steady_clock;
+
+    HostKernelTimer(Handle& phandle, const char* pname)
+        : handle(phandle), name(pname), start(clock::now())
+    {
+    }
+
+    HostKernelTimer(const HostKernelTimer&) = delete;
+    HostKernelTimer& operator=(const HostKernelTimer&) = delete;
+
+    ~HostKernelTimer()
+    {
+        if(!handle.IsProfilingEnabled())
+            return;
+        const float ms = std::chrono::duration<float, std::milli>(clock::now() - start).count();
+        handle.ResetKernelTime();
+        handle.AccumKernelTime(ms);
+        MIOPEN_TRACE_KERNEL(name, ms);
+    }
+
+    private:
+    Handle& handle;
+    const char* name;
+    clock::time_point start;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_HOST_TIMER_HPP_
@@ -0,0 +1,218 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_INLINE_VECTOR_HPP_
+#define GUARD_MIOPEN_INLINE_VECTOR_HPP_
+
+#include <miopen/errors.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace miopen {
+
+/// A vector with a fixed capacity of N elements stored inline, so that creating and copying it
+/// never allocates. Throws when the capacity would be exceeded. Converts to and compares with
+/// std::vector, so it can replace one in interfaces without changing the callers.
+template <class T, std::size_t N>
+class InlineVector
+{
+    public:
+    using value_type             = T;
+    using size_type              = std::size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = T*;
+    using const_iterator         = const T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    InlineVector() = default;
+
+    explicit InlineVector(size_type n, const T& value = T{}) { resize(n, value); }
+
+    InlineVector(std::initializer_list<T> values) : InlineVector(values.begin(), values.end()) {}
+
+    template <class Iterator,
+              class = typename std::iterator_traits<Iterator>::iterator_category>
+    InlineVector(Iterator first, Iterator last)
+    {
+        for(; first != last; ++first)
+            push_back(static_cast<T>(*first));
+    }
+
+    InlineVector(const std::vector<T>& values) // NOLINT
+        : InlineVector(values.begin(), values.end())
+    {
+    }
+
+    operator std::vector<T>() const { return {begin(), end()}; } // NOLINT
+
+    static constexpr size_type capacity() { return N; }
+    size_type size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    iterator begin() { return values.data(); }
+    iterator end() { return values.data() + count; }
+    const_iterator begin() const { return values.data(); }
+    const_iterator end() const { return values.data() + count; }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator{end()}; }
+    reverse_iterator rend() { return reverse_iterator{begin()}; }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator{end()}; }
+    const_reverse_iterator rend() const { return const_reverse_iterator{begin()}; }
+
+    T* data() { return values.data(); }
+    const T* data() const { return values.data(); }
+    reference operator[](size_type i) { return values[i]; }
+    const_reference operator[](size_type i) const { return values[i]; }
+    reference front() { return values[0]; }
+    const_reference front() const { return values[0]; }
+    reference back() { return values[count - 1]; }
+    const_reference back() const { return values[count - 1]; }
+
+    reference at(size_type i)
+    {
+        if(i >= count)
+            MIOPEN_THROW("InlineVector index out of range");
+        return values[i];
+    }
+
+    const_reference at(size_type i) const
+    {
+        if(i >= count)
+            MIOPEN_THROW("InlineVector index out of range");
+        return values[i];
+    }
+
+    void push_back(const T& value)
+    {
+        if(count == N)
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "More than " + std::to_string(N) + " elements in InlineVector");
+        values[count++] = value;
+    }
+
+    void pop_back() { values[--count] = T{}; }
+
+    void resize(size_type n, const T& value = T{})
+    {
+        if(n > N)
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "More than " + std::to_string(N) + " elements in InlineVector");
+        if(n > count)
+            std::fill(values.begin() + count, values.begin() + n, value);
+        else
+            std::fill(values.begin() + n, values.begin() + count, T{});
+        count = n;
+    }
+
+    void clear() { resize(0); }
+
+    private:
+    // Elements past count stay value-initialized.
+    std::array<T, N> values{};
+    size_type count = 0;
+};
+
+template <class T, std::size_t N, class Range>
+bool RangeEqual(const InlineVector<T, N>& x, const Range& y)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <class T, std::size_t N>
+bool operator==(const InlineVector<T, N>& x, const InlineVector<T, N>& y)
+{
+    return RangeEqual(x, y);
+}
+
+template <class T, std::size_t N>
+bool operator!=(const InlineVector<T, N>& x, const InlineVector<T, N>& y)
+{
+    return !(x == y);
+}
+
+template <class T, std::size_t N>
+bool operator<(const InlineVector<T, N>& x, const InlineVector<T, N>& y)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <class T, std::size_t N>
+bool operator>(const InlineVector<T, N>& x, const InlineVector<T, N>& y)
+{
+    return y < x;
+}
+
+template <class T, std::size_t N>
+bool operator<=(const InlineVector<T, N>& x, const InlineVector<T, N>& y)
+{
+    return !(y < x);
+}
+
+template <class T, std::size_t N>
+bool operator>=(const InlineVector<T, N>& x, const InlineVector<T, N>& y)
+{
+    return !(x < y);
+}
+
+template <class T, std::size_t N, class A>
+bool operator==(const InlineVector<T, N>& x, const std::vector<T, A>& y)
+{
+    return RangeEqual(x, y);
+}
+
+template <class T, std::size_t N, class A>
+bool operator==(const std::vector<T, A>& x, const InlineVector<T, N>& y)
+{
+    return RangeEqual(y, x);
+}
+
+template <class T, std::size_t N, class A>
+bool operator!=(const InlineVector<T, N>& x, const std::vector<T, A>& y)
+{
+    return !(x == y);
+}
+
+template <class T, std::size_t N, class A>
+bool operator!=(const std::vector<T, A>& x, const InlineVector<T, N>& y)
+{
+    return !(x == y);
+}
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_INLINE_VECTOR_HPP_
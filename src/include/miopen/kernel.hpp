@@ -53,6 +53,16 @@ using Kernel       = HIPOCKernel;
 using KernelInvoke = HIPOCKernelInvoke;
 using Program      = HIPOCProgram;
 
+} // namespace miopen
+
+#elif MIOPEN_BACKEND_CPU
+#include <miopen/host_kernel.hpp>
+
+namespace miopen {
+using Kernel       = HostKernel;
+using KernelInvoke = HostKernelInvoke;
+using Program      = HostProgram;
+
 } // namespace miopen
 #endif
 
@@ -47,6 +47,7 @@
 #include <miopen/kernel.hpp>
 #include <miopen/simple_hash.hpp>
 #include <miopen/miopen.h>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -56,6 +57,8 @@ namespace miopen {
 /**
  * @brief The KernelCache class Build and cache kernels
  *
+ * Thread-safe. Programs are built without holding the lock, so a program requested
+ * by several threads at once may get built more than once; one of the results is kept.
  */
 class KernelCache
 {
@@ -79,12 +82,13 @@ class KernelCache
 
     void ClearKernels(const std::string& algorithm, const std::string& network_config);
 
-    const std::vector<Kernel>& GetKernels(const std::string& algorithm,
-                                          const std::string& network_config);
+    /// Returns a copy, as the kernels may be changed by other threads.
+    std::vector<Kernel> GetKernels(const std::string& algorithm, const std::string& network_config);
 
     KernelCache();
 
     private:
+    std::mutex mutex;
     KernelMap kernel_map;
     ProgramMap program_map;
 };
@@ -32,8 +32,18 @@
 #include <iostream>
 
 namespace miopen {
+
+struct ConvolutionContext;
+
 namespace solver {
 
+/// The search space consists of two disjoint parts, one per kernel:
+/// * 1x1 filters (ConvOclDirectFwd1x1): in_tile0 == in_tile1 == grp_tile1 == 1,
+///   n_stacks == 0, out_pix_tile1 holds the kernel version;
+/// * all other filters (ConvOclDirectFwd): grp_tile0/1 are derived from
+///   in_tile0/1 and out_pix_tile0/1.
+/// SetNextValue() visits both parts in the order of the former hand-written
+/// search loops, IsValid() applies the pruning rules of these loops.
 struct LegacyPerformanceConfig : Serializable<LegacyPerformanceConfig>
 {
     int grp_tile1       = 0;
@@ -46,6 +56,13 @@ struct LegacyPerformanceConfig : Serializable<LegacyPerformanceConfig>
     int n_in_data_tiles = 0;
     int n_stacks        = 0;
 
+    LegacyPerformanceConfig() = default;
+    LegacyPerformanceConfig(bool spare);
+
+    bool SetNextValue();
+    bool IsValid(const ConvolutionContext& config) const;
+    bool operator==(const LegacyPerformanceConfig& other) const;
+
     template <class Solution>
     void CopyTo(Solution& iud) const
     {
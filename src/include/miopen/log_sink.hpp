@@ -0,0 +1,92 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_LOG_SINK_HPP
+#define GUARD_MIOPEN_LOG_SINK_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace miopen {
+
+/// Destination of the messages produced by MIOPEN_LOG* macros.
+/// Methods are never called by several threads at once.
+struct LogSink
+{
+    virtual ~LogSink() = default;
+    virtual void Write(const std::string& message) = 0;
+    virtual void Flush() {}
+};
+
+/// Writes to std::cerr. Used unless MIOPEN_LOG_FILE is set.
+struct StderrLogSink : LogSink
+{
+    void Write(const std::string& message) override;
+};
+
+/// Writes to a file. Once the file grows over max_size bytes, it is renamed to <path>.1,
+/// older files are shifted up to <path>.<max_files>, and a new file is started.
+/// max_size == 0 disables rotation.
+class FileLogSink : public LogSink
+{
+    public:
+    FileLogSink(const std::string& path_, std::size_t max_size_ = 0, std::size_t max_files_ = 1);
+
+    void Write(const std::string& message) override;
+    void Flush() override;
+
+    private:
+    void Rotate();
+
+    std::string path;
+    std::size_t max_size;
+    std::size_t max_files;
+    std::size_t size = 0;
+    std::ofstream file;
+};
+
+/// Replaces the sink. Pending messages are written to the previous sink first.
+void SetLogSink(std::unique_ptr<LogSink> sink);
+
+/// In the asynchronous mode (initially set by MIOPEN_LOG_ASYNC) the logging thread only
+/// formats the message text and puts it into its own lock-free ring buffer. The prefix
+/// (platform, level and function name) is formatted and the message is written to the sink
+/// by a background thread. When a buffer is full, errors and warnings wait for a while;
+/// other messages are dropped and counted.
+void SetLogAsync(bool enable);
+bool IsLogAsync();
+
+/// Blocks until the messages logged by the calling thread so far are written to the sink.
+void LogFlush();
+
+/// Number of messages dropped because of a full ring buffer.
+std::size_t LogDroppedCount();
+
+} // namespace miopen
+
+#endif
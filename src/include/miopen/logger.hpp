@@ -28,8 +28,11 @@
 
 #include <array>
 #include <iostream>
+#include <miopen/capture.hpp>
 #include <miopen/each_args.hpp>
+#include <miopen/trace.hpp>
 #include <sstream>
+#include <string>
 #include <type_traits>
 
 // Helper macros to output a cmdline argument for the driver
@@ -228,33 +231,42 @@ std::ostream& LogParam(std::ostream& os, std::string name, const T& x)
     os << name << " = " << get_object(x);
     return os;
 }
-#define MIOPEN_LOG_FUNCTION_EACH(param) miopen::LogParam(std::cerr, #param, param) << std::endl;
+#define MIOPEN_LOG_FUNCTION_EACH(param) miopen::LogParam(miopen_log_ss, #param, param) << '\n';
 
-#define MIOPEN_LOG_FUNCTION(...)                                                                \
-    if(miopen::IsLoggingTraceDetailed())                                                        \
-    {                                                                                           \
-        std::cerr << miopen::PlatformName() << ": " << __PRETTY_FUNCTION__ << "{" << std::endl; \
-        MIOPEN_PP_EACH_ARGS(MIOPEN_LOG_FUNCTION_EACH, __VA_ARGS__)                              \
-        std::cerr << "}" << std::endl;                                                          \
+#define MIOPEN_LOG_FUNCTION(...)                                                         \
+    MIOPEN_TRACE_FUNCTION("api");                                                        \
+    MIOPEN_CAPTURE_FUNCTION(__VA_ARGS__)                                                 \
+    if(miopen::IsLoggingTraceDetailed())                                                 \
+    {                                                                                    \
+        std::ostringstream miopen_log_ss;                                                \
+        miopen_log_ss << miopen::PlatformName() << ": " << __PRETTY_FUNCTION__ << "{\n"; \
+        MIOPEN_PP_EACH_ARGS(MIOPEN_LOG_FUNCTION_EACH, __VA_ARGS__)                       \
+        miopen_log_ss << "}\n";                                                          \
+        miopen::LogWrite(miopen_log_ss.str());                                           \
     }
 #else
-#define MIOPEN_LOG_FUNCTION(...)
+#define MIOPEN_LOG_FUNCTION(...) MIOPEN_TRACE_FUNCTION("api")
 #endif
 
 std::string LoggingParseFunction(const char* func, const char* pretty_func);
 
-#define MIOPEN_LOG(level, ...)                                                              \
-    do                                                                                      \
-    {                                                                                       \
-        if(miopen::IsLogging(level))                                                        \
-        {                                                                                   \
-            std::stringstream miopen_log_ss;                                                \
-            miopen_log_ss << miopen::PlatformName() << ": " << LoggingLevelToCString(level) \
-                          << " [" << miopen::LoggingParseFunction(                          \
-                                         __func__, __PRETTY_FUNCTION__) /* NOLINT */        \
-                          << "] " << __VA_ARGS__ << std::endl;                              \
-            std::cerr << miopen_log_ss.str();                                               \
-        }                                                                                   \
+/// Passes a message to the sink (see log_sink.hpp). The prefix made of the platform,
+/// level and function name may be formatted later by the logger thread, so func and
+/// pretty_func shall point to static strings like __func__.
+void LogWrite(LoggingLevel level, const char* func, const char* pretty_func, std::string message);
+/// Passes a message which is formatted completely.
+void LogWrite(std::string message);
+
+#define MIOPEN_LOG(level, ...)                                                           \
+    do                                                                                   \
+    {                                                                                    \
+        if(miopen::IsLogging(level))                                                     \
+        {                                                                                \
+            std::ostringstream miopen_log_ss;                                            \
+            miopen_log_ss << __VA_ARGS__;                                                \
+            miopen::LogWrite(                                                            \
+                level, __func__, __PRETTY_FUNCTION__ /* NOLINT */, miopen_log_ss.str()); \
+        }                                                                                \
     } while(false)
 
 #define MIOPEN_LOG_E(...) MIOPEN_LOG(miopen::LoggingLevel::Error, __VA_ARGS__)
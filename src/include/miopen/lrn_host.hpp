@@ -0,0 +1,504 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_LRN_HOST_HPP_
+#define GUARD_MIOPEN_LRN_HOST_HPP_
+
+#include <miopen/float_equal.hpp>
+#include <miopen/host_loops.hpp>
+#include <miopen/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace miopen {
+namespace host {
+
+// Local response normalization of NCHW host tensors, shared by the CPU backend, the driver and the
+// tests.
+//
+// Every output is scaled by a power of the sum of squares over a window, across channels or
+// within a channel. The window sums slide: each is the previous one plus the value entering the
+// window minus the value leaving it, a fixed cost per element whatever the window size. Across
+// channels a block of pixels slides over the channels together. Within a channel the sums run
+// along the rows of a plane held transposed, then down its columns, so that both passes run over
+// contiguous values in vector registers. Images and blocks run in parallel.
+//
+// The windows follow the kernels of MIOpenLRNFwd.cl and MIOpenLRNBwd.cl, with
+// pad = area - (area - 1) / 2 - 1: the window of a channel ends pad channels after it, the window
+// of a pixel within a channel starts pad values before it, and the latter is averaged over its
+// size clipped at the far padding only. The two differ for even areas.
+
+// Values in a block of pixels normalized across channels together, over all its channels.
+constexpr std::size_t lrn_block_size = 8192;
+
+/// Lengths, window and layout of an LRN. Every tensor has its own element strides, in n, c, h, w
+/// order; the scale workspace is one of them.
+struct LRNGeometry
+{
+    int n, c, h, w;
+    int area, pad;
+    bool across;
+    std::array<std::size_t, 4> x_strides, y_strides, scale_strides, dx_strides, dy_strides;
+
+    /// Packed strides for all tensors.
+    LRNGeometry(bool pacross, int parea, int pn, int pc, int ph, int pw)
+        : n(pn),
+          c(pc),
+          h(ph),
+          w(pw),
+          area(parea),
+          pad(parea - (parea - 1) / 2 - 1),
+          across(pacross),
+          x_strides{{std::size_t(c) * h * w, std::size_t(h) * w, std::size_t(w), 1}},
+          y_strides(x_strides),
+          scale_strides(x_strides),
+          dx_strides(x_strides),
+          dy_strides(x_strides)
+    {
+    }
+
+    /// Positions from o to the end of its window: the window of o covers
+    /// [o + lead - area + 1, o + lead] along its axis.
+    int Lead() const { return across ? pad : area - 1 - pad; }
+
+    /// Positions covered by the window of position i along an axis of this length, counting the
+    /// padding before the axis but not past pad values after it.
+    int Extent(int i, int length) const { return std::min(area, length + 2 * pad - i); }
+
+    /// Calls f(scratch, image, channel) for every plane, spread over ParallelFor, with a Scratch
+    /// made once per task.
+    template <class Scratch, class F>
+    void ForEachPlane(F f) const
+    {
+        const std::size_t work = std::size_t(h) * w;
+        ParallelFor(std::size_t(n) * c,
+                    std::max<std::size_t>(host_parallel_grain / (work + 1), 1),
+                    [&](std::size_t begin, std::size_t end) {
+                        Scratch scratch;
+                        for(std::size_t i = begin; i < end; i++)
+                            f(scratch, int(i / c), int(i % c));
+                    });
+    }
+
+    /// Calls f(scratch, image, first, last) for blocks of pixels [first, last) of every image,
+    /// spread over ParallelFor, with a Scratch made once per task.
+    template <class Scratch, class F>
+    void ForEachBlock(F f) const
+    {
+        const std::size_t pixels = std::size_t(h) * w;
+        const std::size_t block  = std::min(std::max<std::size_t>(lrn_block_size / c, 16), pixels);
+        const std::size_t blocks = (pixels + block - 1) / block;
+        ParallelFor(std::size_t(n) * blocks,
+                    std::max<std::size_t>(host_parallel_grain / (block * c + 1), 1),
+                    [&](std::size_t begin, std::size_t end) {
+                        Scratch scratch;
+                        for(std::size_t i = begin; i < end; i++)
+                        {
+                            const std::size_t first = (i % blocks) * block;
+                            f(scratch, int(i / blocks), first, std::min(first + block, pixels));
+                        }
+                    });
+    }
+};
+
+/// dst = sqrt(src), in vector registers, where the compiler keeps the scalar calls for errno.
+inline void SquareRoots(const float* src, float* dst, std::size_t count)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    for(; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_sqrt_ps(_mm_loadu_ps(src + i)));
+#endif
+    for(; i < count; i++)
+        dst[i] = std::sqrt(src[i]);
+}
+
+inline void SquareRoots(const double* src, double* dst, std::size_t count)
+{
+    std::size_t i = 0;
+#ifdef __SSE2__
+    for(; i + 2 <= count; i += 2)
+        _mm_storeu_pd(dst + i, _mm_sqrt_pd(_mm_loadu_pd(src + i)));
+#endif
+    for(; i < count; i++)
+        dst[i] = std::sqrt(src[i]);
+}
+
+/// dst = src^-beta. The powers of the usual betas are taken with square roots, which vectorize
+/// where std::pow does not; 0.75 as 1 / sqrt(src * sqrt(src)).
+template <class T>
+void PowerMinusBeta(const T* src, T* dst, std::size_t count, double beta)
+{
+    if(float_equal(beta, 0.75))
+    {
+        SquareRoots(src, dst, count);
+        for(std::size_t i = 0; i < count; i++)
+            dst[i] *= src[i];
+        SquareRoots(dst, dst, count);
+        for(std::size_t i = 0; i < count; i++)
+            dst[i] = 1 / dst[i];
+    }
+    else if(float_equal(beta, 0.5))
+    {
+        SquareRoots(src, dst, count);
+        for(std::size_t i = 0; i < count; i++)
+            dst[i] = 1 / dst[i];
+    }
+    else if(float_equal(beta, 1.0))
+        for(std::size_t i = 0; i < count; i++)
+            dst[i] = 1 / src[i];
+    else if(float_equal(beta, 0.0))
+        std::fill(dst, dst + count, T(1));
+    else
+        for(std::size_t i = 0; i < count; i++)
+            dst[i] = std::pow(src[i], T(-beta));
+}
+
+/// Sums over the windows [o + lead - window + 1, o + lead], clipped to the sequence, of a sequence
+/// of count positions, each a run of `lanes` values `step` apart in src, into runs of lanes values
+/// in dst. Each sum is the previous one plus the position entering the window minus the one
+/// leaving it. The running sums are kept in double in running, lanes values, since in float the
+/// rounding of every step adds up along long sequences.
+template <class T>
+void SlidingSums(const T* src,
+                 std::size_t step,
+                 std::size_t lanes,
+                 int count,
+                 int window,
+                 int lead,
+                 double* running,
+                 T* dst)
+{
+    std::fill(running, running + lanes, 0.0);
+    for(int p = 0; p <= std::min(lead, count - 1); p++)
+        for(std::size_t l = 0; l < lanes; l++)
+            running[l] += src[p * step + l];
+    std::copy(running, running + lanes, dst);
+    for(int o = 1; o < count; o++)
+    {
+        const int enter = o + lead;
+        const int leave = o + lead - window;
+        const T* e      = src + enter * step;
+        const T* v      = src + leave * step;
+        if(enter < count)
+            for(std::size_t l = 0; l < lanes; l++)
+                running[l] += e[l];
+        if(leave >= 0)
+            for(std::size_t l = 0; l < lanes; l++)
+                running[l] -= v[l];
+        std::copy(running, running + lanes, dst + o * lanes);
+    }
+}
+
+/// Window sums within a plane: columns holds the plane transposed, w runs of h values, and is
+/// overwritten; sums gets the plane row by row. work holds h * w values, running max(h, w).
+template <class T>
+void PlaneWindowSums(const LRNGeometry& g, T* columns, T* work, double* running, T* sums)
+{
+    const std::size_t h = g.h;
+    const std::size_t w = g.w;
+    SlidingSums(columns, h, h, g.w, g.area, g.Lead(), running, work);
+    for(std::size_t i = 0; i < h; i++)
+        for(std::size_t j = 0; j < w; j++)
+            columns[i * w + j] = work[j * h + i];
+    SlidingSums(columns, w, w, g.h, g.area, g.Lead(), running, sums);
+}
+
+/// y = x * (K + alpha * mean of the squares of x over the window)^-beta. When scale is not null it
+/// gets the bases of the powers, which the backward pass takes back.
+template <class X, class Y>
+void LRNForward(
+    const LRNGeometry& g, double alpha, double beta, double K, const X* x, Y* y, Y* scale)
+{
+    using Acc            = HostAcc<X, Y>;
+    const auto& xs       = g.x_strides;
+    const auto& ys       = g.y_strides;
+    const auto& ss       = g.scale_strides;
+    const std::size_t hw = std::size_t(g.h) * g.w;
+
+    if(g.across)
+    {
+        const Acc factor = alpha / g.area;
+
+        struct Scratch
+        {
+            std::vector<Acc> values, squares, sums, power;
+            std::vector<double> running;
+        };
+
+        g.ForEachBlock<Scratch>(
+            [&](Scratch& scratch, int image, std::size_t first, std::size_t last) {
+                const std::size_t count = last - first;
+                auto& values            = scratch.values;
+                auto& squares           = scratch.squares;
+                auto& sums              = scratch.sums;
+                auto& power             = scratch.power;
+                values.resize(g.c * count);
+                squares.resize(values.size());
+                sums.resize(values.size());
+                power.resize(count);
+                scratch.running.resize(count);
+
+                for(int k = 0; k < g.c; k++)
+                    LoadPixels(
+                        x + image * xs[0] + k * xs[1], xs, g.w, first, last, &values[k * count]);
+                for(std::size_t i = 0; i < values.size(); i++)
+                    squares[i] = values[i] * values[i];
+                SlidingSums(squares.data(),
+                            count,
+                            count,
+                            g.c,
+                            g.area,
+                            g.Lead(),
+                            scratch.running.data(),
+                            sums.data());
+
+                for(int k = 0; k < g.c; k++)
+                {
+                    Acc* base     = &sums[k * count];
+                    const Acc* xv = &values[k * count];
+                    for(std::size_t l = 0; l < count; l++)
+                        base[l] = K + base[l] * factor;
+                    PowerMinusBeta(base, power.data(), count, beta);
+                    for(std::size_t l = 0; l < count; l++)
+                        power[l] *= xv[l];
+                    StorePixels(power.data(), ys, g.w, first, last, y + image * ys[0] + k * ys[1]);
+                    if(scale != nullptr)
+                        StorePixels(base, ss, g.w, first, last, scale + image * ss[0] + k * ss[1]);
+                }
+            });
+        return;
+    }
+
+    // alpha over the extent of the windows of every column
+    std::vector<Acc> col_factor(g.w);
+    for(int j = 0; j < g.w; j++)
+        col_factor[j] = alpha / g.Extent(j, g.w);
+
+    struct Scratch
+    {
+        std::vector<Acc> columns, work, sums, row, power;
+        std::vector<double> running;
+    };
+
+    g.ForEachPlane<Scratch>([&](Scratch& scratch, int image, int channel) {
+        auto& columns = scratch.columns;
+        auto& row     = scratch.row;
+        auto& power   = scratch.power;
+        columns.resize(hw);
+        scratch.work.resize(hw);
+        scratch.sums.resize(hw);
+        row.resize(g.w);
+        power.resize(g.w);
+        scratch.running.resize(std::max(g.h, g.w));
+
+        const X* xp = x + image * xs[0] + channel * xs[1];
+        for(int i = 0; i < g.h; i++)
+        {
+            LoadPixels(xp, xs, g.w, i * g.w, (i + 1) * g.w, row.data());
+            for(int j = 0; j < g.w; j++)
+                columns[j * g.h + i] = row[j] * row[j];
+        }
+        PlaneWindowSums(g,
+                        columns.data(),
+                        scratch.work.data(),
+                        scratch.running.data(),
+                        scratch.sums.data());
+
+        for(int i = 0; i < g.h; i++)
+        {
+            const std::size_t first = std::size_t(i) * g.w;
+            Acc* base               = &scratch.sums[first];
+            const Acc row_factor    = Acc(1) / g.Extent(i, g.h);
+            for(int j = 0; j < g.w; j++)
+                base[j] = K + base[j] * (row_factor * col_factor[j]);
+            PowerMinusBeta(base, power.data(), g.w, beta);
+            LoadPixels(xp, xs, g.w, first, first + g.w, row.data());
+            for(int j = 0; j < g.w; j++)
+                power[j] *= row[j];
+            StorePixels(
+                power.data(), ys, g.w, first, first + g.w, y + image * ys[0] + channel * ys[1]);
+            if(scale != nullptr)
+                StorePixels(
+                    base, ss, g.w, first, first + g.w, scale + image * ss[0] + channel * ss[1]);
+        }
+    });
+}
+
+/// dx = dy * scale^-beta - 2 * alpha * beta / window size * x * the sum of y * dy / scale over
+/// the window, for the scale the forward pass saved.
+template <class X, class Y>
+void LRNBackward(const LRNGeometry& g,
+                 double alpha,
+                 double beta,
+                 const X* y,
+                 const X* dy,
+                 const X* x,
+                 const X* scale,
+                 Y* dx)
+{
+    using Acc            = HostAcc<X, Y>;
+    const auto& xs       = g.x_strides;
+    const auto& ys       = g.y_strides;
+    const auto& ss       = g.scale_strides;
+    const auto& dxs      = g.dx_strides;
+    const auto& dys      = g.dy_strides;
+    const std::size_t hw = std::size_t(g.h) * g.w;
+
+    if(g.across)
+    {
+        const Acc factor = 2 * alpha * beta / g.area;
+
+        struct Scratch
+        {
+            std::vector<Acc> bases, gradients, ratios, sums, values, power;
+            std::vector<double> running;
+        };
+
+        g.ForEachBlock<Scratch>(
+            [&](Scratch& scratch, int image, std::size_t first, std::size_t last) {
+                const std::size_t count = last - first;
+                auto& bases             = scratch.bases;
+                auto& gradients         = scratch.gradients;
+                auto& ratios            = scratch.ratios;
+                auto& values            = scratch.values;
+                auto& power             = scratch.power;
+                bases.resize(g.c * count);
+                gradients.resize(bases.size());
+                ratios.resize(bases.size());
+                scratch.sums.resize(bases.size());
+                values.resize(count);
+                power.resize(count);
+                scratch.running.resize(count);
+
+                for(int k = 0; k < g.c; k++)
+                {
+                    Acc* base = &bases[k * count];
+                    Acc* grad = &gradients[k * count];
+                    Acc* r    = &ratios[k * count];
+                    LoadPixels(scale + image * ss[0] + k * ss[1], ss, g.w, first, last, base);
+                    LoadPixels(dy + image * dys[0] + k * dys[1], dys, g.w, first, last, grad);
+                    LoadPixels(y + image * ys[0] + k * ys[1], ys, g.w, first, last, values.data());
+                    for(std::size_t l = 0; l < count; l++)
+                        r[l] = grad[l] * values[l] / base[l];
+                }
+                SlidingSums(ratios.data(),
+                            count,
+                            count,
+                            g.c,
+                            g.area,
+                            g.Lead(),
+                            scratch.running.data(),
+                            scratch.sums.data());
+
+                for(int k = 0; k < g.c; k++)
+                {
+                    const Acc* sum  = &scratch.sums[k * count];
+                    const Acc* grad = &gradients[k * count];
+                    PowerMinusBeta(&bases[k * count], power.data(), count, beta);
+                    LoadPixels(x + image * xs[0] + k * xs[1], xs, g.w, first, last, values.data());
+                    for(std::size_t l = 0; l < count; l++)
+                        power[l] = grad[l] * power[l] - factor * values[l] * sum[l];
+                    StorePixels(
+                        power.data(), dxs, g.w, first, last, dx + image * dxs[0] + k * dxs[1]);
+                }
+            });
+        return;
+    }
+
+    // 2 * alpha * beta over the extent of the windows of every column
+    std::vector<Acc> col_factor(g.w);
+    for(int j = 0; j < g.w; j++)
+        col_factor[j] = 2 * alpha * beta / g.Extent(j, g.w);
+
+    struct Scratch
+    {
+        std::vector<Acc> columns, work, sums, base, grad, values, power;
+        std::vector<double> running;
+    };
+
+    g.ForEachPlane<Scratch>([&](Scratch& scratch, int image, int channel) {
+        auto& columns = scratch.columns;
+        auto& base    = scratch.base;
+        auto& grad    = scratch.grad;
+        auto& values  = scratch.values;
+        auto& power   = scratch.power;
+        columns.resize(hw);
+        scratch.work.resize(hw);
+        scratch.sums.resize(hw);
+        base.resize(g.w);
+        grad.resize(g.w);
+        values.resize(g.w);
+        power.resize(g.w);
+        scratch.running.resize(std::max(g.h, g.w));
+
+        const X* yp  = y + image * ys[0] + channel * ys[1];
+        const X* dyp = dy + image * dys[0] + channel * dys[1];
+        const X* xp  = x + image * xs[0] + channel * xs[1];
+        const X* sp  = scale + image * ss[0] + channel * ss[1];
+        for(int i = 0; i < g.h; i++)
+        {
+            const std::size_t first = std::size_t(i) * g.w;
+            LoadPixels(sp, ss, g.w, first, first + g.w, base.data());
+            LoadPixels(dyp, dys, g.w, first, first + g.w, grad.data());
+            LoadPixels(yp, ys, g.w, first, first + g.w, values.data());
+            for(int j = 0; j < g.w; j++)
+                columns[j * g.h + i] = grad[j] * values[j] / base[j];
+        }
+        PlaneWindowSums(g,
+                        columns.data(),
+                        scratch.work.data(),
+                        scratch.running.data(),
+                        scratch.sums.data());
+
+        for(int i = 0; i < g.h; i++)
+        {
+            const std::size_t first = std::size_t(i) * g.w;
+            const Acc* sum          = &scratch.sums[first];
+            const Acc row_factor    = Acc(1) / g.Extent(i, g.h);
+            LoadPixels(sp, ss, g.w, first, first + g.w, base.data());
+            LoadPixels(dyp, dys, g.w, first, first + g.w, grad.data());
+            LoadPixels(xp, xs, g.w, first, first + g.w, values.data());
+            PowerMinusBeta(base.data(), power.data(), g.w, beta);
+            for(int j = 0; j < g.w; j++)
+                power[j] = grad[j] * power[j] - row_factor * col_factor[j] * values[j] * sum[j];
+            StorePixels(
+                power.data(), dxs, g.w, first, first + g.w, dx + image * dxs[0] + channel * dxs[1]);
+        }
+    });
+}
+
+} // namespace host
+} // namespace miopen
+
+#endif
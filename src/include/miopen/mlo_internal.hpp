@@ -317,6 +317,14 @@ auto FindAllSolutions(T& x) -> decltype(x.FindAllSolutions())
     return x.FindAllSolutions();
 }
 
+template <class T>
+auto GetMaxWorkspaceSize(T& x) -> decltype(x.GetMaxWorkspaceSize())
+{
+    x.setupRocm();
+    x.setupFloats();
+    return x.GetMaxWorkspaceSize();
+}
+
 /// \todo Move this into respective Solution objects. --atamazov
 struct mlo_construct_activ_lrn_pooling_common
 {
@@ -397,6 +405,7 @@ struct mlo_construct_direct2D
 
     miopen::solver::ConvSolution FindSolution();
     std::vector<miopen::solver::ConvSolution> FindAllSolutions();
+    std::size_t GetMaxWorkspaceSize();
     miopen::MultiFileDb GetDb() const;
 
     /*
@@ -795,6 +804,11 @@ struct mlo_construct_direct2D
     // MD: Hack to get the key outside of mlo_internal
     int mloBuildConf_Key(std::string& conf_key) const;
 
+    /*
+    * returns problem config & environment, e.g. for keying dbs outside of mlo_internal
+    */
+    inline const miopen::ConvolutionContext& getContext() const { return _search_params; }
+
     // MD: Where is this being used?
     void getNewInputDescr(std::string& layout,
                           std::string& data_type,
@@ -873,6 +887,7 @@ struct mlo_construct_BwdWrW2D : mlo_construct_direct2D
     }
 
     std::vector<miopen::solver::ConvSolution> FindAllSolutions();
+    std::size_t GetMaxWorkspaceSize();
 };
 
 /*
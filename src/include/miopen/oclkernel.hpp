@@ -33,6 +33,7 @@
 #include <functional>
 #include <memory>
 #include <miopen/miopen.h>
+#include <mutex>
 #include <numeric>
 #include <sstream>
 #include <utility>
@@ -90,10 +91,15 @@ struct OCLKernelInvoke
     std::array<size_t, 3> global_work_dim    = {};
     std::array<size_t, 3> local_work_dim     = {};
     std::function<void(cl_event&)> callback;
+    /// Kernel arguments are the state of cl_kernel, which is shared between threads.
+    std::shared_ptr<std::mutex> args_mutex = nullptr;
 
     template <class... Ts>
     void operator()(const Ts&... xs) const
     {
+        std::unique_lock<std::mutex> lock;
+        if(args_mutex != nullptr)
+            lock = std::unique_lock<std::mutex>(*args_mutex);
         each_args_i(
             std::bind(
                 OCLSetKernelArg{}, kernel.get(), std::placeholders::_1, std::placeholders::_2),
@@ -151,6 +157,7 @@ class OCLKernel
     SharedKernelPtr kernel;
     std::vector<size_t> ldims;
     std::vector<size_t> gdims;
+    std::shared_ptr<std::mutex> args_mutex = std::make_shared<std::mutex>();
 };
 
 } // namespace miopen
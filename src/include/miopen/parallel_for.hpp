@@ -0,0 +1,51 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_PARALLEL_FOR_HPP_
+#define GUARD_MIOPEN_PARALLEL_FOR_HPP_
+
+#include <cstddef>
+#include <functional>
+
+namespace miopen {
+
+/// Number of threads used by ParallelFor, including the calling one. MIOPEN_CPU_THREADS=<n>
+/// overrides the default, which is the number of hardware threads.
+std::size_t ParallelForThreads();
+
+/// Calls f(begin, end) for consecutive ranges which cover [0, n), on a pool of threads shared by
+/// the library. All ranges but the last have grain elements. Returns when all ranges are done
+/// and rethrows the first exception thrown by f.
+///
+/// The calling thread takes part in the work. Nested calls, and calls made while another thread
+/// uses the pool, run on the calling thread alone.
+void ParallelFor(std::size_t n,
+                 std::size_t grain,
+                 const std::function<void(std::size_t begin, std::size_t end)>& f);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PARALLEL_FOR_HPP_
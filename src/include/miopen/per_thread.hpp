@@ -0,0 +1,166 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_MIOPEN_PER_THREAD_HPP_
+#define GUARD_MIOPEN_PER_THREAD_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace miopen {
+
+namespace detail {
+
+struct PerThreadStorage
+{
+    virtual ~PerThreadStorage() = default;
+    virtual void Erase(std::size_t thread) = 0;
+};
+
+/// Identifies the calling thread and erases its instances from all PerThread objects which are
+/// still alive when it exits. Unlike std::thread::id, tokens are never reused.
+class PerThreadExit
+{
+    public:
+    PerThreadExit() : token(NextToken()++) {}
+    PerThreadExit(const PerThreadExit&) = delete;
+    PerThreadExit& operator=(const PerThreadExit&) = delete;
+
+    ~PerThreadExit()
+    {
+        for(auto&& storage : storages)
+        {
+            const auto alive = storage.lock();
+            if(alive)
+                alive->Erase(token);
+        }
+    }
+
+    static PerThreadExit& Current()
+    {
+        thread_local PerThreadExit instance;
+        return instance;
+    }
+
+    std::size_t Token() const { return token; }
+
+    void Register(std::weak_ptr<PerThreadStorage> storage)
+    {
+        // Forget objects which were destroyed in the meantime, e.g. handles created in a loop.
+        storages.erase(std::remove_if(storages.begin(),
+                                      storages.end(),
+                                      [](const std::weak_ptr<PerThreadStorage>& x) {
+                                          return x.expired();
+                                      }),
+                       storages.end());
+        storages.push_back(std::move(storage));
+    }
+
+    private:
+    static std::atomic<std::size_t>& NextToken()
+    {
+        static std::atomic<std::size_t> next{0};
+        return next;
+    }
+
+    std::size_t token;
+    std::vector<std::weak_ptr<PerThreadStorage>> storages;
+};
+
+} // namespace detail
+
+/// Keeps a separate instance of T for each thread which accesses it.
+///
+/// Unlike thread_local variables, instances belong to the object (e.g. to a handle)
+/// and are destroyed together with it, or when their thread exits, whichever comes first.
+/// An instance shall only be used by its thread.
+template <class T>
+class PerThread
+{
+    public:
+    PerThread() = default;
+    PerThread(const PerThread&) = delete;
+    PerThread& operator=(const PerThread&) = delete;
+
+    /// Returns the instance of the calling thread. Creates it if there is none.
+    T& Get()
+    {
+        auto& thread = detail::PerThreadExit::Current();
+        std::lock_guard<std::mutex> lock(storage->mutex);
+        const auto inserted = storage->values.emplace(thread.Token(), T{});
+        if(inserted.second)
+        {
+            ++storage->count;
+            thread.Register(storage);
+        }
+        // References to elements of unordered_map survive insertions by other threads.
+        return inserted.first->second;
+    }
+
+    /// Returns the instance of the calling thread or nullptr if there is none.
+    T* Find()
+    {
+        if(Empty())
+            return nullptr;
+        const auto token = detail::PerThreadExit::Current().Token();
+        std::lock_guard<std::mutex> lock(storage->mutex);
+        const auto it = storage->values.find(token);
+        return it == storage->values.end() ? nullptr : &it->second;
+    }
+
+    /// Destroys the instance of the calling thread.
+    void Erase() { storage->Erase(detail::PerThreadExit::Current().Token()); }
+
+    /// Lock-free check allowing to skip the lookup when per-thread instances are not used.
+    bool Empty() const { return storage->count == 0; }
+
+    std::size_t Size() const { return storage->count; }
+
+    private:
+    // Shared with the exit hooks of the threads, which may outlive the object.
+    struct Storage : detail::PerThreadStorage
+    {
+        void Erase(std::size_t thread) override
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            count -= values.erase(thread);
+        }
+
+        std::mutex mutex;
+        std::unordered_map<std::size_t, T> values;
+        std::atomic<std::size_t> count{0};
+    };
+
+    std::shared_ptr<Storage> storage = std::make_shared<Storage>();
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PER_THREAD_HPP_
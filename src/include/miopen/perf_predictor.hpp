@@ -0,0 +1,95 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_PERF_PREDICTOR_HPP_
+#define GUARD_MIOPEN_PERF_PREDICTOR_HPP_
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace miopen {
+
+struct ConvolutionContext;
+
+/// Predicts default performance configs from the tuned answers stored in the
+/// installed perf dbs. Used when the perf db has no record for the problem.
+///
+/// The model is a nearest-neighbour lookup over a condensed subset of perf db
+/// records, generated offline by the perfdbfit tool (see perfdbfit/) into
+/// perf_predictor_tables.cpp. Only records of the same solver and with the same
+/// "signature" (filter size, pads, strides, dilations, bias, layout, data type and
+/// direction) are considered neighbours. The distance is measured in log2 space
+/// over the remaining (size) fields of the problem.
+
+/// Size fields of a problem: n_inputs, in_height, in_width, n_outputs, batch_sz.
+using PerfPredictorFeatures = std::array<int, 5>;
+
+struct PerfPredictorRecord
+{
+    const char* device; // E.g. "gfx900_64", as in the perf db file name.
+    const char* solver; // SolverDbId.
+    const char* signature;
+    PerfPredictorFeatures features;
+    const char* values; // Serialized performance config.
+};
+
+/// Problem config in the form used by the predictor.
+struct PerfPredictorKey
+{
+    std::string signature;
+    PerfPredictorFeatures features;
+};
+
+/// Parses a perf db key (see ProblemDescription::Serialize).
+/// Returns false if the key is malformed.
+bool ParsePerfDbKey(const std::string& key, PerfPredictorKey& result);
+
+double PerfPredictorDistance(const PerfPredictorFeatures& lhs, const PerfPredictorFeatures& rhs);
+
+/// Returns serialized performance configs of at most max_n nearest records, nearest first,
+/// without duplicates. Records must be sorted by (device, solver, signature).
+/// If there are no records for the device, records for other devices of the same
+/// architecture (e.g. "gfx900_56" for "gfx900_64") are used.
+std::vector<std::string> PredictPerformanceConfigs(const PerfPredictorRecord* records,
+                                                   std::size_t n_records,
+                                                   const std::string& device,
+                                                   const std::string& solver_id,
+                                                   const PerfPredictorKey& key,
+                                                   std::size_t max_n);
+
+/// Same as above, uses the generated tables and the device of the context.
+/// Returns nothing if the predictor is disabled by MIOPEN_DEBUG_PERF_PREDICTOR=0.
+std::vector<std::string> PredictPerformanceConfigs(const ConvolutionContext& context,
+                                                   const std::string& solver_id);
+
+/// Generated tables, sorted by (device, solver, signature).
+const PerfPredictorRecord* GetPerfPredictorRecords(std::size_t& n_records);
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_PERF_PREDICTOR_HPP_
@@ -0,0 +1,638 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_POOLING_HOST_HPP_
+#define GUARD_MIOPEN_POOLING_HOST_HPP_
+
+#include <miopen/float_equal.hpp>
+#include <miopen/host_loops.hpp>
+#include <miopen/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace miopen {
+namespace host {
+
+// 2D max and average pooling of NCHW host tensors, shared by the CPU backend, the driver and the
+// tests.
+//
+// Small windows are scanned in place, one window offset at a time over a whole output row, so
+// that the loops run along the output width in vector registers. Larger windows are separable: a
+// horizontal pass reduces every padded input row to one value per output column, and a vertical
+// pass reduces those rows over the window height. Long windows take the running maximum of van
+// Herk and Gil-Werman, a fixed number of comparisons per element whatever the window size,
+// instead of a scan per output. Planes run in parallel.
+//
+// The results follow the kernels of MIOpenPooling.cl: averages divide by the part of the window
+// inside the input, and the argmax of a max window is its row-major offset in the whole window,
+// the first one on ties, truncated to the 8 bits PoolingDescriptor::GetWorkSpaceSize reserves.
+// A window with no value above the lowest float, such as one over padding only, gets
+// pooling_no_index.
+
+constexpr uint8_t pooling_no_index = 0xFF;
+// Windows at least this long, and three times their stride, use the running maximum.
+constexpr int pooling_running_window = 12;
+
+/// Lengths and layout of a 2D pooling. Input-side tensors (x, dx) and output-side tensors (y, dy
+/// and the argmax workspace) each have their own element strides, in n, c, h, w order.
+struct PoolingGeometry
+{
+    int n, c, in_h, in_w, out_h, out_w;
+    int window_h, window_w, pad_h, pad_w, stride_h, stride_w;
+    std::array<std::size_t, 4> in_strides, out_strides;
+
+    /// Packed strides on both sides.
+    PoolingGeometry(int pn,
+                    int pc,
+                    int pin_h,
+                    int pin_w,
+                    int pout_h,
+                    int pout_w,
+                    int pwindow_h,
+                    int pwindow_w,
+                    int ppad_h,
+                    int ppad_w,
+                    int pstride_h,
+                    int pstride_w)
+        : n(pn),
+          c(pc),
+          in_h(pin_h),
+          in_w(pin_w),
+          out_h(pout_h),
+          out_w(pout_w),
+          window_h(pwindow_h),
+          window_w(pwindow_w),
+          pad_h(ppad_h),
+          pad_w(ppad_w),
+          stride_h(pstride_h),
+          stride_w(pstride_w),
+          in_strides{
+              {std::size_t(c) * in_h * in_w, std::size_t(in_h) * in_w, std::size_t(in_w), 1}},
+          out_strides{
+              {std::size_t(c) * out_h * out_w, std::size_t(out_h) * out_w, std::size_t(out_w), 1}}
+    {
+    }
+
+    int WindowSize() const { return window_h * window_w; }
+
+    /// Rows and columns of the padded input that some window reads.
+    int PaddedHeight() const { return (out_h - 1) * stride_h + window_h; }
+    int PaddedWidth() const { return (out_w - 1) * stride_w + window_w; }
+
+    /// Input positions a window covers along one axis, at most 0 when it only covers padding.
+    static int Covered(int first, int window, int length)
+    {
+        return std::min(first + window, length) - std::max(first, 0);
+    }
+
+    /// The divisor of an average: the number of input values in the window, at least 1.
+    int PoolSize(int i, int j) const
+    {
+        const int rows = Covered(i * stride_h - pad_h, window_h, in_h);
+        const int cols = Covered(j * stride_w - pad_w, window_w, in_w);
+        return std::max(std::max(rows, 0) * std::max(cols, 0), 1);
+    }
+
+    /// Calls f(scratch, image, channel) for every plane, spread over ParallelFor, with a Scratch
+    /// made once per task.
+    template <class Scratch, class F>
+    void ForEachPlane(F f) const
+    {
+        const std::size_t work = std::size_t(in_h) * in_w + std::size_t(out_h) * out_w;
+        ParallelFor(std::size_t(n) * c,
+                    std::max<std::size_t>(host_parallel_grain / (work + 1), 1),
+                    [&](std::size_t begin, std::size_t end) {
+                        Scratch scratch;
+                        for(std::size_t i = begin; i < end; i++)
+                            f(scratch, int(i / c), int(i % c));
+                    });
+    }
+};
+
+/// Whether the window is large enough to be reduced by rows and columns separately.
+inline bool UseSeparable(const PoolingGeometry& g)
+{
+    return g.WindowSize() > 2 * (g.window_h + g.window_w);
+}
+
+/// Whether a window of this length and stride takes the running maximum.
+inline bool UseRunningMax(int window, int stride)
+{
+    return window >= pooling_running_window && window >= 3 * stride;
+}
+
+/// Keeps the larger of m and v, m on ties, with the argument a or va that goes with it. The blend
+/// is arithmetic, which the compiler vectorizes where it would branch on a select of the argument.
+template <class T>
+inline void KeepMax(T& m, int& a, T v, int va)
+{
+    const int greater = v > m;
+    m                 = greater ? v : m;
+    a += (va - a) * greater;
+}
+
+/// Maximum of the windows o * stride .. o * stride + window - 1 over a sequence of positions,
+/// each a run of `lanes` values `step` apart in src, with the van Herk / Gil-Werman blocks: within
+/// blocks of `window` positions, suffix maxima from the left edge and prefix maxima up to the right
+/// edge of a window cover it in two halves. The position of the maximum, the first on ties, goes
+/// to arg as position * scale plus src_arg of the source when src_arg is given.
+///
+/// dst and arg hold outputs runs of lanes values; work holds 2 * positions * lanes values and
+/// work_arg as many ints.
+template <class T>
+void RunningMax(const T* src,
+                const int* src_arg,
+                std::size_t step,
+                std::size_t lanes,
+                int window,
+                int stride,
+                int outputs,
+                int scale,
+                T* dst,
+                int* arg,
+                T* work,
+                int* work_arg)
+{
+    const int positions = (outputs - 1) * stride + window;
+    T* suffix           = work;
+    T* prefix           = work + std::size_t(positions) * lanes;
+    int* suffix_arg     = work_arg;
+    int* prefix_arg     = work_arg + std::size_t(positions) * lanes;
+    const auto source   = [&](int p, std::size_t l) {
+        return p * scale + (src_arg != nullptr ? src_arg[p * step + l] : 0);
+    };
+
+    for(int first = 0; first < positions; first += window)
+    {
+        const int last = std::min(first + window, positions) - 1;
+        for(std::size_t l = 0; l < lanes; l++)
+        {
+            prefix[first * lanes + l]     = src[first * step + l];
+            prefix_arg[first * lanes + l] = source(first, l);
+            suffix[last * lanes + l]      = src[last * step + l];
+            suffix_arg[last * lanes + l]  = source(last, l);
+        }
+        for(int p = first + 1; p <= last; p++)
+        {
+            const T* s            = src + p * step;
+            T* pm                 = prefix + p * lanes;
+            int* pa               = prefix_arg + p * lanes;
+            const T* before       = pm - lanes;
+            const int* before_arg = pa - lanes;
+            for(std::size_t l = 0; l < lanes; l++)
+            {
+                pm[l] = before[l];
+                pa[l] = before_arg[l];
+                KeepMax(pm[l], pa[l], s[l], source(p, l));
+            }
+        }
+        for(int p = last - 1; p >= first; p--)
+        {
+            const T* s           = src + p * step;
+            T* sm                = suffix + p * lanes;
+            int* sa              = suffix_arg + p * lanes;
+            const T* after       = sm + lanes;
+            const int* after_arg = sa + lanes;
+            for(std::size_t l = 0; l < lanes; l++)
+            {
+                sm[l] = s[l];
+                sa[l] = source(p, l);
+                KeepMax(sm[l], sa[l], after[l], after_arg[l]);
+            }
+        }
+    }
+
+    for(int o = 0; o < outputs; o++)
+    {
+        const int left   = o * stride;
+        const T* sm      = suffix + left * lanes;
+        const int* sa    = suffix_arg + left * lanes;
+        const T* pm      = prefix + (left + window - 1) * lanes;
+        const int* pa    = prefix_arg + (left + window - 1) * lanes;
+        T* d             = dst + o * lanes;
+        int* a           = arg + o * lanes;
+        const int offset = left * scale;
+        for(std::size_t l = 0; l < lanes; l++)
+        {
+            d[l] = sm[l];
+            a[l] = sa[l];
+            KeepMax(d[l], a[l], pm[l], pa[l]);
+            a[l] -= offset;
+        }
+    }
+}
+
+/// Maximum or sum over t < window of the runs of count values at src + offsets[t], into dst. The
+/// maximum puts t * scale in arg, plus src_arg at the same offset when src_arg is given.
+template <class T>
+void ScanWindows(const T* src,
+                 const int* src_arg,
+                 const std::size_t* offsets,
+                 int window,
+                 int scale,
+                 std::size_t count,
+                 bool max,
+                 T* dst,
+                 int* arg)
+{
+    std::copy(src + offsets[0], src + offsets[0] + count, dst);
+    if(src_arg != nullptr)
+        std::copy(src_arg + offsets[0], src_arg + offsets[0] + count, arg);
+    else
+        std::fill(arg, arg + count, 0);
+    for(int t = 1; t < window; t++)
+    {
+        const T* s     = src + offsets[t];
+        const int base = t * scale;
+        if(!max)
+            for(std::size_t j = 0; j < count; j++)
+                dst[j] += s[j];
+        else if(src_arg == nullptr)
+            for(std::size_t j = 0; j < count; j++)
+                KeepMax(dst[j], arg[j], s[j], base);
+        else
+        {
+            const int* sa = src_arg + offsets[t];
+            for(std::size_t j = 0; j < count; j++)
+                KeepMax(dst[j], arg[j], s[j], base + sa[j]);
+        }
+    }
+}
+
+/// Writes the output rows of a plane from out and out_arg, rows `pitch` values apart: maxima with
+/// their argmax, or sums over their divisors.
+template <class T, class Y>
+void StorePooled(const PoolingGeometry& g,
+                 bool max,
+                 int image,
+                 int channel,
+                 const T* out,
+                 const int* out_arg,
+                 std::size_t pitch,
+                 Y* y,
+                 uint8_t* index)
+{
+    const T lowest           = std::numeric_limits<float>::lowest();
+    const std::size_t ow     = g.out_w;
+    const std::size_t y_step = g.out_strides[3];
+    for(int i = 0; i < g.out_h; i++)
+    {
+        const T* v        = out + i * pitch;
+        const int* a      = out_arg + i * pitch;
+        const std::size_t yi = image * g.out_strides[0] + channel * g.out_strides[1] +
+                               i * g.out_strides[2];
+        if(!max)
+        {
+            for(std::size_t j = 0; j < ow; j++)
+                y[yi + j * y_step] = static_cast<Y>(v[j] / g.PoolSize(i, j));
+            continue;
+        }
+        for(std::size_t j = 0; j < ow; j++)
+            y[yi + j * y_step] = static_cast<Y>(v[j]);
+        if(index != nullptr)
+            for(std::size_t j = 0; j < ow; j++)
+                index[yi + j * y_step] =
+                    v[j] > lowest ? static_cast<uint8_t>(a[j]) : pooling_no_index;
+    }
+}
+
+/// Pooling with every window scanned: for each window offset, one pass over an output row takes
+/// the input values at that offset, skipping the outputs for which it falls into the padding.
+template <class X, class Y>
+void PoolingForwardDirect(const PoolingGeometry& g, bool max, const X* x, Y* y, uint8_t* index)
+{
+    using Acc                = HostAcc<X, Y>;
+    const std::size_t ow     = g.out_w;
+    const std::size_t x_step = g.in_strides[3];
+    const std::size_t step   = g.stride_w * x_step;
+
+    // Outputs [first_out[t], last_out[t]) read an input column at window column t
+    std::vector<std::size_t> first_out(g.window_w), last_out(g.window_w);
+    for(int t = 0; t < g.window_w; t++)
+    {
+        const int shift = g.pad_w - t;
+        first_out[t]    = shift > 0 ? (shift + g.stride_w - 1) / g.stride_w : 0;
+        last_out[t]     = g.in_w + shift > 0
+                          ? std::min<std::size_t>((g.in_w - 1 + shift) / g.stride_w + 1, ow)
+                          : 0;
+    }
+
+    struct Scratch
+    {
+        std::vector<Acc> out;
+        std::vector<int> out_arg;
+    };
+
+    g.ForEachPlane<Scratch>([&](Scratch& scratch, int image, int channel) {
+        auto& out     = scratch.out;
+        auto& out_arg = scratch.out_arg;
+        out.assign(std::size_t(g.out_h) * ow, max ? std::numeric_limits<float>::lowest() : 0);
+        out_arg.assign(out.size(), 0);
+
+        const X* xp = x + image * g.in_strides[0] + channel * g.in_strides[1];
+        for(int i = 0; i < g.out_h; i++)
+        {
+            Acc* m       = out.data() + i * ow;
+            int* a       = out_arg.data() + i * ow;
+            const int h0 = i * g.stride_h - g.pad_h;
+            for(int th = std::max(-h0, 0); th < std::min(g.window_h, g.in_h - h0); th++)
+                for(int tw = 0; tw < g.window_w; tw++)
+                {
+                    const std::size_t first = first_out[tw];
+                    const std::size_t last  = last_out[tw];
+                    const X* s = xp + (h0 + th) * g.in_strides[2] +
+                                 (first * g.stride_w + tw - g.pad_w) * x_step;
+                    const int offset = th * g.window_w + tw;
+                    if(max)
+                        for(std::size_t j = first; j < last; j++)
+                            KeepMax(m[j], a[j], Acc(s[(j - first) * step]), offset);
+                    else
+                        for(std::size_t j = first; j < last; j++)
+                            m[j] += Acc(s[(j - first) * step]);
+                }
+        }
+        StorePooled(g, max, image, channel, out.data(), out_arg.data(), ow, y, index);
+    });
+}
+
+/// Pooling by separate passes along rows and along columns, taking running maxima of long windows.
+template <class X, class Y>
+void PoolingForwardSeparable(const PoolingGeometry& g, bool max, const X* x, Y* y, uint8_t* index)
+{
+    using Acc            = HostAcc<X, Y>;
+    const Acc padding    = max ? std::numeric_limits<float>::lowest() : 0;
+    const int rows       = g.PaddedHeight();
+    const int cols       = g.PaddedWidth();
+    const std::size_t ow = g.out_w;
+    const bool run_w     = max && UseRunningMax(g.window_w, g.stride_w);
+    const bool run_h     = max && UseRunningMax(g.window_h, g.stride_h);
+
+    // The padded plane is split by column modulo the stride, so that the windows of consecutive
+    // outputs read consecutive values, and its rows are scanned as one sequence of `pitch` values
+    // apart. Values past the outputs of a row are computed and left unused.
+    const int phases         = run_w ? 1 : g.stride_w;
+    const std::size_t pitch  = (cols + phases - 1) / phases;
+    const std::size_t region = rows * pitch;
+    const int first_col      = g.pad_w;
+    const int last_col       = std::min(cols, g.pad_w + g.in_w);
+    std::vector<std::size_t> col_offsets(g.window_w), row_offsets(g.window_h);
+    for(int t = 0; t < g.window_w; t++)
+        col_offsets[t] = (t % phases) * region + t / phases;
+    for(int t = 0; t < g.window_h; t++)
+        row_offsets[t] = t * pitch;
+    // Output rows reduced by one scan: all of them for unit strides
+    const int batch = g.stride_h == 1 ? g.out_h : 1;
+
+    // The padded plane, the row reductions, the outputs and the running maxima
+    struct Scratch
+    {
+        std::vector<Acc> plane, reduced, out, work;
+        std::vector<int> reduced_arg, out_arg, work_arg;
+    };
+
+    g.ForEachPlane<Scratch>([&](Scratch& scratch, int image, int channel) {
+        auto& plane       = scratch.plane;
+        auto& reduced     = scratch.reduced;
+        auto& reduced_arg = scratch.reduced_arg;
+        auto& out         = scratch.out;
+        auto& out_arg     = scratch.out_arg;
+        plane.assign(phases * region, padding);
+        reduced.resize(region);
+        reduced_arg.resize(region);
+        out.resize(std::size_t(g.out_h) * pitch);
+        out_arg.resize(out.size());
+        const std::size_t work_size = 2 * std::max(run_w ? pitch : 0, run_h ? region : 0);
+        scratch.work.resize(work_size);
+        scratch.work_arg.resize(work_size);
+
+        const X* xp              = x + image * g.in_strides[0] + channel * g.in_strides[1];
+        const std::size_t x_step = g.in_strides[3];
+        for(int h = 0; h < g.in_h && h + g.pad_h < rows; h++)
+        {
+            const X* xr = xp + h * g.in_strides[2];
+            for(int phase = 0; phase < phases; phase++)
+            {
+                int w      = first_col + (phase - first_col % phases + phases) % phases;
+                Acc* d     = plane.data() + phase * region + (h + g.pad_h) * pitch + w / phases;
+                const X* s = xr + (w - g.pad_w) * x_step;
+                for(; w < last_col; w += phases, s += phases * x_step)
+                    *d++ = Acc(*s);
+            }
+        }
+
+        if(!run_w)
+            ScanWindows<Acc>(plane.data(),
+                             nullptr,
+                             col_offsets.data(),
+                             g.window_w,
+                             1,
+                             region - pitch + ow,
+                             max,
+                             reduced.data(),
+                             reduced_arg.data());
+        else
+            for(int r = 0; r < rows; r++)
+                RunningMax<Acc>(plane.data() + r * pitch,
+                                nullptr,
+                                1,
+                                1,
+                                g.window_w,
+                                g.stride_w,
+                                g.out_w,
+                                1,
+                                reduced.data() + r * pitch,
+                                reduced_arg.data() + r * pitch,
+                                scratch.work.data(),
+                                scratch.work_arg.data());
+
+        if(run_h)
+            RunningMax<Acc>(reduced.data(),
+                            reduced_arg.data(),
+                            pitch,
+                            pitch,
+                            g.window_h,
+                            g.stride_h,
+                            g.out_h,
+                            g.window_w,
+                            out.data(),
+                            out_arg.data(),
+                            scratch.work.data(),
+                            scratch.work_arg.data());
+        else
+            for(int i = 0; i < g.out_h; i += batch)
+                ScanWindows<Acc>(reduced.data() + i * g.stride_h * pitch,
+                                 reduced_arg.data() + i * g.stride_h * pitch,
+                                 row_offsets.data(),
+                                 g.window_h,
+                                 g.window_w,
+                                 (batch - 1) * pitch + ow,
+                                 max,
+                                 out.data() + i * pitch,
+                                 out_arg.data() + i * pitch);
+
+        StorePooled(g, max, image, channel, out.data(), out_arg.data(), pitch, y, index);
+    });
+}
+
+/// y = pooling of x. For max pooling with index not null, index gets the argmax of every window.
+template <class X, class Y>
+void PoolingForward(const PoolingGeometry& g, bool max, const X* x, Y* y, uint8_t* index)
+{
+    if(UseSeparable(g))
+        PoolingForwardSeparable(g, max, x, y, index);
+    else
+        PoolingForwardDirect(g, max, x, y, index);
+}
+
+/// dx = the gradient of the pooling for dy. Max pooling takes the argmax from index. Offsets of
+/// windows over 256 values are ambiguous once truncated; when x and y are given (with the strides
+/// of dx and dy) the first offset of the same residue holding y is taken, otherwise the truncated
+/// offset is used like the kernels do.
+template <class X, class Y>
+void PoolingBackward(const PoolingGeometry& g,
+                     bool max,
+                     const X* dy,
+                     Y* dx,
+                     const uint8_t* index,
+                     const X* x = nullptr,
+                     const X* y = nullptr)
+{
+    using Acc             = HostAcc<X, Y>;
+    const int rows        = g.PaddedHeight();
+    const int cols        = g.PaddedWidth();
+    const int window      = g.WindowSize();
+    const auto& xs        = g.in_strides;
+    const auto& ys        = g.out_strides;
+    const bool resolve    = window > 256 && x != nullptr && y != nullptr;
+    const std::size_t ow  = g.out_w;
+    const std::size_t iw  = g.in_w;
+
+    // Row and column of every offset in the window
+    std::vector<int> offset_h(max ? window : 0), offset_w(offset_h.size());
+    for(std::size_t o = 0; o < offset_h.size(); o++)
+    {
+        offset_h[o] = o / g.window_w;
+        offset_w[o] = o % g.window_w;
+    }
+
+    struct Scratch
+    {
+        std::vector<Acc> plane, spread, row, share;
+    };
+
+    g.ForEachPlane<Scratch>([&](Scratch& scratch, int image, int channel) {
+        auto& plane  = scratch.plane;
+        auto& spread = scratch.spread;
+        auto& row    = scratch.row;
+        auto& share  = scratch.share;
+        plane.assign(std::size_t(g.in_h) * iw, Acc(0));
+        const std::size_t xo = image * xs[0] + channel * xs[1];
+        const std::size_t yo = image * ys[0] + channel * ys[1];
+
+        if(max)
+        {
+            for(int i = 0; i < g.out_h; i++)
+            {
+                const int h0         = i * g.stride_h - g.pad_h;
+                const std::size_t yr = yo + i * ys[2];
+                for(int j = 0; j < g.out_w; j++)
+                {
+                    const std::size_t yi = yr + j * ys[3];
+                    int offset           = index[yi];
+                    if(offset >= window)
+                        continue;
+                    const int w0      = j * g.stride_w - g.pad_w;
+                    const auto inside = [&](int o) {
+                        const int h = h0 + offset_h[o];
+                        const int w = w0 + offset_w[o];
+                        return h >= 0 && h < g.in_h && w >= 0 && w < g.in_w;
+                    };
+                    for(int o = offset; resolve && o < window; o += 256)
+                    {
+                        const std::size_t xi =
+                            xo + (h0 + offset_h[o]) * xs[2] + (w0 + offset_w[o]) * xs[3];
+                        if(inside(o) && float_equal(Acc(x[xi]), Acc(y[yi])))
+                        {
+                            offset = o;
+                            break;
+                        }
+                    }
+                    if(inside(offset))
+                        plane[(h0 + offset_h[offset]) * iw + w0 + offset_w[offset]] +=
+                            Acc(dy[yi]);
+                }
+            }
+        }
+        else
+        {
+            // Spread every output over the padded rows of its window, then along the row.
+            spread.assign(std::size_t(rows) * ow, Acc(0));
+            share.resize(ow);
+            row.resize(cols);
+            for(int i = 0; i < g.out_h; i++)
+            {
+                for(std::size_t j = 0; j < ow; j++)
+                    share[j] = Acc(dy[yo + i * ys[2] + j * ys[3]]) / g.PoolSize(i, j);
+                for(int t = 0; t < g.window_h; t++)
+                {
+                    Acc* s = spread.data() + (std::size_t(i) * g.stride_h + t) * ow;
+                    for(std::size_t j = 0; j < ow; j++)
+                        s[j] += share[j];
+                }
+            }
+            for(int h = 0; h < g.in_h; h++)
+            {
+                const int r = h + g.pad_h;
+                if(r >= rows)
+                    break;
+                const Acc* s = spread.data() + std::size_t(r) * ow;
+                std::fill(row.begin(), row.end(), Acc(0));
+                for(int t = 0; t < g.window_w; t++)
+                {
+                    Acc* d = row.data() + t;
+                    for(std::size_t j = 0; j < ow; j++)
+                        d[j * g.stride_w] += s[j];
+                }
+                const int last = std::min(g.in_w, cols - g.pad_w);
+                for(int w = 0; w < last; w++)
+                    plane[h * iw + w] = row[w + g.pad_w];
+            }
+        }
+
+        for(int h = 0; h < g.in_h; h++)
+            for(std::size_t w = 0; w < iw; w++)
+                dx[xo + h * xs[2] + w * xs[3]] = static_cast<Y>(plane[h * iw + w]);
+    });
+}
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_POOLING_HOST_HPP_
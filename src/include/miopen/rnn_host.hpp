@@ -0,0 +1,140 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_RNN_HOST_HPP_
+#define GUARD_MIOPEN_RNN_HOST_HPP_
+
+#include <miopen/gemm_host.hpp>
+#include <miopen/miopen.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace miopen {
+namespace host {
+
+/// The forward pass of a stacked vanilla RNN, LSTM or GRU on float data in host memory, with
+/// the weights, states and reserve space laid out as the RNN API lays them out.
+///
+/// Each layer multiplies its input for all time steps with the input weights in one Gemm, so
+/// only the product with the hidden state is left for each time step. All weight matrices are
+/// packed for Gemm once, when the object is made. After the product of a time step, the gate
+/// nonlinearities and the state updates of a row run in a single pass over packs of the row.
+/// The two directions of a bidirectional layer run in parallel when their per-step products
+/// are too small to be split over threads themselves.
+///
+/// Batches of all time steps are concatenated along the rows of x and y. The batch of a time
+/// step may not exceed the one before it; the backward direction starts the rows it sees for
+/// the first time from hx and cx.
+class RNNForward
+{
+    public:
+    /// w holds the weights and biases as RNNDescriptor lays them out. in_h is the length of the
+    /// input vectors, which must equal hidden when the input is skipped.
+    RNNForward(miopenRNNMode_t mode,
+               int layers,
+               int hidden,
+               int in_h,
+               bool bidirectional,
+               bool biased,
+               bool skip_input,
+               const float* w);
+
+    /// Runs the network on x, sum(batches) x in_h, into y, sum(batches) x Directions() *
+    /// hidden. hx, cx, hy and cy are layers * Directions() x hy_n x hidden, hy_n being at least
+    /// batches[0]. Null hx or cx start the states from zeros without their products and hidden
+    /// biases, as the GPU kernels do; hy and cy may be null. Rows of hy and cy without a time
+    /// step are zeroed. reserve receives ReserveSize(batches) values for the backward passes,
+    /// or is null for inference.
+    void Run(const std::vector<int>& batches,
+             int hy_n,
+             const float* x,
+             const float* hx,
+             const float* cx,
+             float* y,
+             float* hy,
+             float* cy,
+             float* reserve) const;
+
+    int Directions() const { return bidirectional ? 2 : 1; }
+    /// Gate matrices per direction: 1 for the vanilla RNN, 4 for LSTM and 3 for GRU.
+    int Gates() const;
+    /// Values in a row of each half of the reserve space.
+    std::size_t ReserveStride() const;
+    std::size_t ReserveSize(const std::vector<int>& batches) const;
+    /// Values of the weights and biases in w.
+    std::size_t WeightSize() const;
+
+    private:
+    struct Layer
+    {
+        /// Directions() * Gates() * hidden x inputs, empty for a skipped input.
+        std::vector<GemmPackedB> input;
+        /// Per direction, Gates() * hidden x hidden.
+        std::vector<GemmPackedB> hidden;
+        /// Directions() * Gates() * hidden input biases, then as many hidden biases.
+        std::vector<float> bias;
+    };
+
+    /// Offset of the hidden states of a row from the row in the first half of the reserve, for
+    /// rows time steps in all.
+    std::size_t HiddenColumn(std::size_t rows) const;
+
+    void RunLayer(int li,
+                  const std::vector<int>& batches,
+                  const std::vector<std::size_t>& offsets,
+                  int hy_n,
+                  const float* x,
+                  const float* hx,
+                  const float* cx,
+                  float* hy,
+                  float* cy,
+                  float* reserve) const;
+
+    void RunDirection(int li,
+                      int dir,
+                      const std::vector<int>& batches,
+                      const std::vector<std::size_t>& offsets,
+                      int hy_n,
+                      const float* hx,
+                      const float* cx,
+                      float* hy,
+                      float* cy,
+                      float* reserve) const;
+
+    miopenRNNMode_t mode;
+    int layers;
+    int hidden;
+    int in_h;
+    bool bidirectional;
+    bool biased;
+    bool skip_input;
+    std::vector<Layer> weights;
+};
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_RNN_HOST_HPP_
@@ -0,0 +1,153 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_SEARCH_MODEL_HPP_
+#define GUARD_MIOPEN_SEARCH_MODEL_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+
+namespace miopen {
+namespace solver {
+
+/// Analytical cost model used to rank performance configs before the
+/// auto-tune measures them. Everything here is pure host code and does not
+/// require a device, so it can be unit-tested and benchmarked on CPU.
+///
+/// The model is intentionally crude: it does not try to predict absolute
+/// kernel times, only to put the promising configs in front of the
+/// hopeless ones. Absolute numbers are in milliseconds on a "reference"
+/// GCN device, so estimates from different configs are comparable.
+struct GcnReferenceDevice
+{
+    int n_cus                  = 64;
+    int simds_per_cu           = 4;
+    int max_waves_per_simd     = 10;
+    int vgprs_per_simd_lane    = 256;
+    int sgprs_per_simd         = 800;
+    int max_sgprs_per_wave     = 102;
+    std::size_t lds_per_cu     = 64 * 1024;
+    int max_groups_per_cu      = 16;
+    double peak_gflops         = 12000.0; // fp32, fma counted as 2 flops
+    double peak_bandwidth_gbps = 480.0;
+};
+
+/// Resource usage and launch geometry of a kernel, as computed from a
+/// performance config and a problem config.
+struct KernelCostEstimate
+{
+    int vgprs              = 0; // per lane
+    int sgprs              = 0; // per wave
+    std::size_t lds_bytes  = 0; // per work group
+    int waves_per_group    = 1;
+    std::size_t n_groups   = 1; // total number of work groups in the grid
+    int max_waves_per_simd = 0; // kernel-imposed limit (e.g. limit_wave_cnt), 0 means none
+    double flops           = 0.0;
+    double bytes           = 0.0; // global memory traffic
+};
+
+/// Returns max number of resident waves per SIMD, taking into account
+/// VGPR, SGPR and LDS limits. Returns 0 when the kernel cannot run at all.
+inline int EstimateWavesPerSimd(const KernelCostEstimate& k,
+                                const GcnReferenceDevice& dev = GcnReferenceDevice{})
+{
+    if(k.vgprs > dev.vgprs_per_simd_lane || k.sgprs > dev.max_sgprs_per_wave ||
+       k.lds_bytes > dev.lds_per_cu || k.waves_per_group <= 0)
+        return 0;
+    int waves = dev.max_waves_per_simd;
+    if(k.vgprs > 0)
+        waves = std::min(waves, dev.vgprs_per_simd_lane / k.vgprs);
+    if(k.sgprs > 0)
+        waves = std::min(waves, dev.sgprs_per_simd / k.sgprs);
+    if(k.lds_bytes > 0)
+    {
+        const auto groups_per_cu = static_cast<int>(dev.lds_per_cu / k.lds_bytes);
+        const auto waves_per_cu  = groups_per_cu * k.waves_per_group;
+        waves                    = std::min(waves, waves_per_cu / dev.simds_per_cu);
+    }
+    if(k.max_waves_per_simd > 0)
+        waves = std::min(waves, k.max_waves_per_simd);
+    return std::max(waves, 0);
+}
+
+/// Occupancy in (0..1]: resident waves over the hardware maximum.
+inline double EstimateOccupancy(const KernelCostEstimate& k,
+                                const GcnReferenceDevice& dev = GcnReferenceDevice{})
+{
+    return static_cast<double>(EstimateWavesPerSimd(k, dev)) / dev.max_waves_per_simd;
+}
+
+/// Fraction of the machine that does useful work, accounting for the "tail"
+/// of the last incomplete dispatch round and for grids too small to fill
+/// all CUs.
+inline double EstimateDispatchEfficiency(const KernelCostEstimate& k,
+                                         const GcnReferenceDevice& dev = GcnReferenceDevice{})
+{
+    const int waves_per_simd = EstimateWavesPerSimd(k, dev);
+    if(waves_per_simd == 0 || k.n_groups == 0)
+        return 0.0;
+    const auto waves_per_cu  = static_cast<std::size_t>(waves_per_simd) * dev.simds_per_cu;
+    const auto groups_per_cu = std::max<std::size_t>(
+        1,
+        std::min<std::size_t>(dev.max_groups_per_cu, waves_per_cu / k.waves_per_group));
+    const auto groups_per_round = groups_per_cu * dev.n_cus;
+    const auto rounds           = (k.n_groups + groups_per_round - 1) / groups_per_round;
+    return static_cast<double>(k.n_groups) / static_cast<double>(rounds * groups_per_round);
+}
+
+/// Roofline estimate of kernel time in ms.
+inline double EstimateRooflineTime(const double flops,
+                                   const double bytes,
+                                   const GcnReferenceDevice& dev = GcnReferenceDevice{})
+{
+    const double compute_ms = flops / (dev.peak_gflops * 1.0e6);
+    const double memory_ms  = bytes / (dev.peak_bandwidth_gbps * 1.0e6);
+    return std::max(compute_ms, memory_ms);
+}
+
+/// Combines the above into a single cost (estimated time, ms). Lower is better.
+/// Configs that cannot be launched get infinite cost.
+///
+/// Low occupancy is penalized softly: latency hiding saturates at a few
+/// waves per SIMD, so going from 1 to 4 waves matters much more than going
+/// from 6 to 10.
+inline double EstimateKernelCost(const KernelCostEstimate& k,
+                                 const GcnReferenceDevice& dev = GcnReferenceDevice{})
+{
+    const int waves_per_simd = EstimateWavesPerSimd(k, dev);
+    const double efficiency  = EstimateDispatchEfficiency(k, dev);
+    if(waves_per_simd == 0 || efficiency <= 0.0)
+        return std::numeric_limits<double>::max();
+    const double latency_hiding = std::min(1.0, 0.25 + 0.25 * waves_per_simd);
+    return EstimateRooflineTime(k.flops, k.bytes, dev) / (efficiency * latency_hiding);
+}
+
+} // namespace solver
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SEARCH_MODEL_HPP_
@@ -0,0 +1,231 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_SOFTMAX_HOST_HPP_
+#define GUARD_MIOPEN_SOFTMAX_HOST_HPP_
+
+#include <miopen/host_loops.hpp>
+#include <miopen/host_math.hpp>
+#include <miopen/parallel_for.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace miopen {
+namespace host {
+
+// Softmax over the channels of NCHW host tensors, shared by the CPU backend, the driver and the
+// tests.
+//
+// A block of pixels is normalized together: its values are converted channel after channel into
+// a scratch block, with the pixels contiguous, so that the maxima, the exponentials, the sums and
+// the scaling all run along contiguous pixels in vector registers, the exponentials with Exp of
+// host_math.hpp. Each value is read and written once. Images with fewer pixels than
+// softmax_min_pixels, such as the classifier outputs of 1x1 pixel, normalize each pixel along its
+// channels instead. Blocks and pixels run in parallel.
+
+// Values in the scratch block of a block of pixels, over all its channels.
+constexpr std::size_t softmax_block_size = 8192;
+// Pixels per image below which each pixel is normalized along its channels.
+constexpr std::size_t softmax_min_pixels = 16;
+
+/// Lengths and layout of a softmax. Every tensor has its own element strides, in n, c, h, w order.
+struct SoftmaxGeometry
+{
+    int n, c, h, w;
+    std::array<std::size_t, 4> y_strides, dx_strides;
+
+    /// Packed strides for all tensors.
+    SoftmaxGeometry(int pn, int pc, int ph, int pw)
+        : n(pn),
+          c(pc),
+          h(ph),
+          w(pw),
+          y_strides{{std::size_t(c) * h * w, std::size_t(h) * w, std::size_t(w), 1}},
+          dx_strides(y_strides)
+    {
+    }
+
+    std::size_t Pixels() const { return std::size_t(h) * w; }
+
+    /// Calls f(scratch, image, first, last) for blocks of pixels [first, last) of every image,
+    /// spread over ParallelFor, with a Scratch made once per task. A block of a single pixel
+    /// holds all its channels when there are few pixels.
+    template <class Scratch, class F>
+    void ForEachBlock(F f) const
+    {
+        const std::size_t pixels = Pixels();
+        const std::size_t block =
+            pixels < softmax_min_pixels
+                ? 1
+                : std::min(std::max(softmax_block_size / c, softmax_min_pixels), pixels);
+        const std::size_t blocks = (pixels + block - 1) / block;
+        ParallelFor(std::size_t(n) * blocks,
+                    std::max<std::size_t>(host_parallel_grain / (block * c + 1), 1),
+                    [&](std::size_t begin, std::size_t end) {
+                        Scratch scratch;
+                        for(std::size_t i = begin; i < end; i++)
+                        {
+                            const std::size_t first = (i % blocks) * block;
+                            f(scratch, int(i / blocks), first, std::min(first + block, pixels));
+                        }
+                    });
+    }
+};
+
+namespace detail {
+
+/// Converts channel k of pixels [first, last) of image b into dst + k * (last - first), for all
+/// channels k.
+template <class T, class S>
+void LoadChannels(const S* src,
+                  const std::array<std::size_t, 4>& strides,
+                  const SoftmaxGeometry& g,
+                  int b,
+                  std::size_t first,
+                  std::size_t last,
+                  T* dst)
+{
+    const std::size_t len = last - first;
+    if(len == 1)
+    {
+        src += b * strides[0] + (first / g.w) * strides[2] + (first % g.w) * strides[3];
+        for(int k = 0; k < g.c; k++)
+            dst[k] = static_cast<T>(src[k * strides[1]]);
+        return;
+    }
+    for(int k = 0; k < g.c; k++)
+        LoadPixels(src + b * strides[0] + k * strides[1], strides, g.w, first, last, dst + k * len);
+}
+
+template <class T, class D>
+void StoreChannels(const T* src,
+                   const std::array<std::size_t, 4>& strides,
+                   const SoftmaxGeometry& g,
+                   int b,
+                   std::size_t first,
+                   std::size_t last,
+                   D* dst)
+{
+    const std::size_t len = last - first;
+    if(len == 1)
+    {
+        dst += b * strides[0] + (first / g.w) * strides[2] + (first % g.w) * strides[3];
+        for(int k = 0; k < g.c; k++)
+            dst[k * strides[1]] = static_cast<D>(src[k]);
+        return;
+    }
+    for(int k = 0; k < g.c; k++)
+        StorePixels(
+            src + k * len, strides, g.w, first, last, dst + b * strides[0] + k * strides[1]);
+}
+
+} // namespace detail
+
+/// y = softmax(y) over the channels of every pixel.
+template <class T>
+void SoftmaxForward(const SoftmaxGeometry& g, T* y)
+{
+    using Acc      = HostAcc<T, T>;
+    const bool one = g.Pixels() < softmax_min_pixels;
+    g.ForEachBlock<std::vector<Acc>>(
+        [&](std::vector<Acc>& e, int b, std::size_t first, std::size_t last) {
+            const std::size_t len = last - first;
+            e.resize(len * (g.c + 2));
+            Acc* m   = e.data() + len * g.c;
+            Acc* sum = m + len;
+            detail::LoadChannels(y, g.y_strides, g, b, first, last, e.data());
+
+            if(one)
+            {
+                // A single pixel, its channels contiguous in the block.
+                Acc mc = e[0];
+                for(int k = 1; k < g.c; k++)
+                    mc = std::max(mc, e[k]);
+                Transform(g.c, [=](auto v) { return Exp(v - mc); }, e.data(), e.data());
+                Acc s = 0;
+                for(int k = 0; k < g.c; k++)
+                    s += e[k];
+                const Acc inv = 1 / s;
+                for(int k = 0; k < g.c; k++)
+                    e[k] *= inv;
+            }
+            else
+            {
+                std::copy(e.data(), e.data() + len, m);
+                for(int k = 1; k < g.c; k++)
+                    Transform(len, [](auto a, auto v) { return v > a ? v : a; }, m, m, &e[k * len]);
+                std::fill(sum, sum + len, Acc(0));
+                for(int k = 0; k < g.c; k++)
+                {
+                    Acc* ek = &e[k * len];
+                    Transform(len, [](auto v, auto mk) { return Exp(v - mk); }, ek, ek, m);
+                    for(std::size_t i = 0; i < len; i++)
+                        sum[i] += ek[i];
+                }
+                for(std::size_t i = 0; i < len; i++)
+                    sum[i] = 1 / sum[i];
+                for(int k = 0; k < g.c; k++)
+                    for(std::size_t i = 0; i < len; i++)
+                        e[k * len + i] *= sum[i];
+            }
+            detail::StoreChannels(e.data(), g.y_strides, g, b, first, last, y);
+        });
+}
+
+/// dx = y * (dx - sum over the channels of y * dx), the gradient of the softmax y for the
+/// gradient of its output held in dx on entry.
+template <class Y, class DX>
+void SoftmaxBackward(const SoftmaxGeometry& g, const Y* y, DX* dx)
+{
+    using Acc = HostAcc<Y, DX>;
+    g.ForEachBlock<std::vector<Acc>>(
+        [&](std::vector<Acc>& e, int b, std::size_t first, std::size_t last) {
+            const std::size_t len  = last - first;
+            const std::size_t size = len * g.c;
+            e.resize(2 * size + len);
+            Acc* ye  = e.data();
+            Acc* dxe = ye + size;
+            Acc* dot = dxe + size;
+            detail::LoadChannels(y, g.y_strides, g, b, first, last, ye);
+            detail::LoadChannels(dx, g.dx_strides, g, b, first, last, dxe);
+
+            std::fill(dot, dot + len, Acc(0));
+            for(int k = 0; k < g.c; k++)
+                for(std::size_t i = 0; i < len; i++)
+                    dot[i] += ye[k * len + i] * dxe[k * len + i];
+            for(int k = 0; k < g.c; k++)
+                for(std::size_t i = 0; i < len; i++)
+                    dxe[k * len + i] = ye[k * len + i] * (dxe[k * len + i] - dot[i]);
+            detail::StoreChannels(dxe, g.dx_strides, g, b, first, last, dx);
+        });
+}
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_SOFTMAX_HOST_HPP_
@@ -29,6 +29,9 @@
 
 #include <miopen/config.h>
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -41,6 +44,7 @@
 #include <miopen/legacy_exhaustive_search.hpp>
 #include <miopen/env.hpp>
 #include <miopen/type_name.hpp>
+#include <miopen/perf_predictor.hpp>
 #include <miopen/miopen.h>
 #include <miopen/stringutils.hpp> // for IsPureOpenCLSolution()
 
@@ -154,6 +158,25 @@ const std::string& SolverDbId(Solver solver)
     return result;
 }
 
+/// Returns the first valid config predicted from the installed perf dbs
+/// (see perf_predictor.hpp) or, if there is none, the solver's default.
+template <class Solver, class Context>
+auto GetPredictedPerformanceConfig(Solver s, const Context& context)
+    -> decltype(s.GetPerformanceConfig(context))
+{
+    using PerformanceConfig = decltype(s.GetPerformanceConfig(context));
+    for(const auto& values : PredictPerformanceConfigs(context, SolverDbId(s)))
+    {
+        PerformanceConfig config{};
+        if(config.Deserialize(values) && s.IsValidPerformanceConfig(context, config))
+        {
+            MIOPEN_LOG_I("Perf predictor: " << SolverDbId(s) << ": " << config);
+            return config;
+        }
+    }
+    return s.GetPerformanceConfig(context);
+}
+
 template <class Solver, class Context, class Db>
 auto FindSolutionImpl(rank<1>, Solver s, const Context& context, Db& db)
     -> decltype(s.GetSolution(context, s.Search(context)))
@@ -202,7 +225,7 @@ auto FindSolutionImpl(rank<1>, Solver s, const Context& context, Db& db)
             }
         }
     }
-    return s.GetSolution(context, s.GetPerformanceConfig(context));
+    return s.GetSolution(context, GetPredictedPerformanceConfig(s, context));
 }
 
 template <class Solver, class Context, class Db>
@@ -227,6 +250,7 @@ ConvSolution FindSolution(Solver s, const Context& context, Db& db)
     // TODO: This assumes all solutions are ConvSolution
     auto solution      = FindSolutionImpl(rank<1>{}, s, context, db);
     solution.solver_id = SolverDbId(s);
+    assert(!solution.Succeeded() || solution.workspce_sz == s.GetWorkspaceSize(context));
     return solution;
 }
 
@@ -343,6 +367,52 @@ std::vector<Solution> SearchForAllSolutions(const Context& search_params, Db db)
     return ss;
 }
 
+// Returns the largest workspace required by the applicable solvers.
+// Unlike SearchForAllSolutions(), does not build solutions and does not access perf db.
+// May overestimate, as solvers which SearchForAllSolutions() could skip are counted too.
+template <class... Solvers, class Context>
+std::size_t GetMaxWorkspaceSize(const Context& search_params)
+{
+// Using const here causes gcc to ICE
+#if(!defined(__GNUC__) || defined(__clang__))
+    const
+#endif
+        auto no_perf_filtering =
+            miopen::IsDisabled(MIOPEN_DEBUG_AMD_ASM_KERNELS_PERF_FILTERING{}) ||
+            !miopen::IsEnabled(MIOPEN_DEBUG_FIND_FIRST_CONV{});
+
+    std::size_t sz = 0;
+    miopen::each_args(
+        [&](auto solver) {
+            if(solver.IsApplicable(search_params) &&
+               (no_perf_filtering || solver.IsFast(search_params)))
+            {
+                const auto solver_sz = solver.GetWorkspaceSize(search_params);
+                MIOPEN_LOG_I2(SolverDbId(solver) << ": " << solver_sz);
+                sz = std::max(sz, solver_sz);
+            }
+        },
+        Solvers{}...);
+    return sz;
+}
+
+/// A list of solvers, so that searching them and querying their workspace go over the same ones.
+template <class... Solvers>
+struct SolverContainer
+{
+    template <class Context, class Db>
+    static std::vector<ConvSolution> SearchForAllSolutions(const Context& search_params, Db db)
+    {
+        return solver::SearchForAllSolutions<Solvers...>(search_params, db);
+    }
+
+    template <class Context>
+    static std::size_t GetMaxWorkspaceSize(const Context& search_params)
+    {
+        return solver::GetMaxWorkspaceSize<Solvers...>(search_params);
+    }
+};
+
 /// Base class for problem solvers.
 ///
 /// Solvers are to be instantiated as const objects and shall not have any variable
@@ -387,6 +457,11 @@ struct SolverBase
     /// Warning: Non-trivial implementations introduce implicit dependencies between solutions.
     bool IsFast(const Context&) const { return true; }
 
+    /// Returns the size of workspace (in bytes) which GetSolution() would request,
+    /// without building the solution. Shall be pure host code which takes constant time.
+    /// Solvers which need workspace shall override it consistently with GetSolution().
+    std::size_t GetWorkspaceSize(const Context&) const { return 0; }
+
     /// Takes problem config, optimization parameters and other info
     /// and computes information required to build and run the kernel(s).
     /// ConvSolution GetSolution(const ConvolutionContext& params) const;
@@ -395,6 +470,13 @@ struct SolverBase
     /// ConvSolution GetSolution(const ConvolutionContext& params,
     ///                          const PerformanceConfig& config) const;
 
+    /// Optional cost model for the auto-tune. Estimates the cost (the lower, the better)
+    /// of running the kernel(s) with the given performance config, without actually
+    /// running anything. Shall be pure host code. See search_model.hpp for helpers.
+    /// If implemented, GenericSearch measures configs in the order of increasing cost.
+    /// double EstimatePerformanceConfigCost(const ConvolutionContext&,
+    ///                                      const PerformanceConfig&) const;
+
     /// Temporary solver-specific method until we have generic means for running solutions.
     /// int RunAndMeasureSolution(miopen::Handle& profile_h,
     ///                          Data_t bot_ocl_buf,
@@ -428,6 +510,7 @@ struct PerformanceConfigConvAsm3x3U : Serializable<PerformanceConfigConvAsm3x3U>
     bool IsValidValue() const;
     bool SetNextValue();
     bool IsValid(const ConvolutionContext& config) const;
+    int GetVgprCount(const ConvolutionContext& config) const;
     bool operator==(const PerformanceConfigConvAsm3x3U& other) const;
     std::string ToString() const;
 };
@@ -440,6 +523,8 @@ struct ConvAsm3x3U : SolverBase<ConvolutionContext>
     bool IsValidPerformanceConfig(const ConvolutionContext&,
                                   const PerformanceConfigConvAsm3x3U&) const;
     PerformanceConfigConvAsm3x3U Search(const ConvolutionContext&) const;
+    double EstimatePerformanceConfigCost(const ConvolutionContext&,
+                                         const PerformanceConfigConvAsm3x3U&) const;
     ConvSolution GetSolution(const ConvolutionContext& params,
                              const PerformanceConfigConvAsm3x3U& config,
                              bool disableConfigOverrideFromEnv = false) const;
@@ -499,6 +584,8 @@ struct PerformanceConfigConvAsm1x1U : Serializable<PerformanceConfigConvAsm1x1U>
     bool operator==(const PerformanceConfigConvAsm1x1U& other) const;
     std::string ToString() const;
     bool IsValidForProblem(const ConvolutionContext& config) const;
+    int GetVgprCount() const;
+    int GetSgprCount() const;
 };
 
 struct ConvAsm1x1U : SolverBase<ConvolutionContext>
@@ -507,8 +594,11 @@ struct ConvAsm1x1U : SolverBase<ConvolutionContext>
     bool IsValidPerformanceConfig(const ConvolutionContext&,
                                   const PerformanceConfigConvAsm1x1U&) const;
     PerformanceConfigConvAsm1x1U Search(const ConvolutionContext&) const;
+    double EstimatePerformanceConfigCost(const ConvolutionContext&,
+                                         const PerformanceConfigConvAsm1x1U&) const;
     bool IsApplicable(const ConvolutionContext& params) const;
     bool IsFast(const ConvolutionContext& params) const;
+    std::size_t GetWorkspaceSize(const ConvolutionContext& params) const;
     ConvSolution GetSolution(const ConvolutionContext& params,
                              const PerformanceConfigConvAsm1x1U& config,
                              bool disableConfigOverrideFromEnv = false) const;
@@ -564,6 +654,14 @@ struct ConvOclDirectFwdLegacyExhaustiveSearch : SolverBase<ConvolutionContext>
 {
     LegacyPerformanceConfig GetPerformanceConfig(const ConvolutionContext&) const;
     LegacyPerformanceConfig Search(const ConvolutionContext&) const;
+    int RunAndMeasureSolution(miopen::Handle& profile_h,
+                              Data_t bot_ocl_buf,
+                              Data_t top_ocl_buf,
+                              Data_t wei_ocl_buf,
+                              Data_t bias_ocl_buf,
+                              const ConvolutionContext& params,
+                              const ConvSolution& solution,
+                              float& elapsed_time) const;
 };
 
 struct ConvOclDirectFwd : ConvOclDirectFwdLegacyExhaustiveSearch
@@ -571,7 +669,8 @@ struct ConvOclDirectFwd : ConvOclDirectFwdLegacyExhaustiveSearch
     bool IsApplicable(const ConvolutionContext& params) const;
 
     ConvSolution GetSolution(const ConvolutionContext& params,
-                             const LegacyPerformanceConfig& searched_params) const;
+                             const LegacyPerformanceConfig& searched_params,
+                             bool disableConfigOverrideFromEnv = false) const;
     bool IsValidPerformanceConfig(const ConvolutionContext&, const LegacyPerformanceConfig&) const;
 };
 
@@ -579,7 +678,8 @@ struct ConvOclDirectFwd1x1 : ConvOclDirectFwdLegacyExhaustiveSearch
 {
     bool IsApplicable(const ConvolutionContext& params) const;
     ConvSolution GetSolution(const ConvolutionContext& params,
-                             const LegacyPerformanceConfig& searched_params) const;
+                             const LegacyPerformanceConfig& searched_params,
+                             bool disableConfigOverrideFromEnv = false) const;
     bool IsValidPerformanceConfig(const ConvolutionContext&, const LegacyPerformanceConfig&) const
     {
         return true;
@@ -753,6 +853,7 @@ struct ConvAsmBwdWrW1x1 : SolverBase<ConvolutionContext>
     PerformanceConfigConvAsmBwdWrW1x1 Search(const ConvolutionContext&) const;
     bool IsApplicable(const ConvolutionContext& params) const;
     bool IsFast(const ConvolutionContext& params) const;
+    std::size_t GetWorkspaceSize(const ConvolutionContext& params) const;
     ConvSolution GetSolution(const ConvolutionContext& params,
                              const PerformanceConfigConvAsmBwdWrW1x1& config,
                              bool disableConfigOverrideFromEnv = false) const;
@@ -769,18 +870,21 @@ struct ConvAsmBwdWrW1x1 : SolverBase<ConvolutionContext>
 struct ConvOclBwdWrW2 : SolverBase<ConvolutionContext>
 {
     bool IsApplicable(const ConvolutionContext& params) const;
+    std::size_t GetWorkspaceSize(const ConvolutionContext& params) const;
     ConvSolution GetSolution(const ConvolutionContext& params) const;
 };
 
 struct ConvOclBwdWrW53 : SolverBase<ConvolutionContext>
 {
     bool IsApplicable(const ConvolutionContext& params) const;
+    std::size_t GetWorkspaceSize(const ConvolutionContext& params) const;
     ConvSolution GetSolution(const ConvolutionContext& params) const;
 };
 
 struct ConvOclBwdWrW1x1 : SolverBase<ConvolutionContext>
 {
     bool IsApplicable(const ConvolutionContext& params) const;
+    std::size_t GetWorkspaceSize(const ConvolutionContext& params) const;
     ConvSolution GetSolution(const ConvolutionContext& params) const;
 };
 
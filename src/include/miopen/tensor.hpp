@@ -34,6 +34,8 @@
 #include <miopen/each_args.hpp>
 #include <miopen/returns.hpp>
 #include <miopen/errors.hpp>
+#include <miopen/inline_vector.hpp>
+#include <functional>
 #include <vector>
 // TODO(paul): remove this include later
 #include <cstdio>
@@ -82,6 +84,10 @@ inline std::size_t GetTypeSize(miopenDataType_t d)
     MIOPEN_THROW("Unknown data type");
 }
 
+/// Lengths or strides of a tensor. Stored inline, as descriptors are created and copied in the
+/// inner loops of e.g. the RNN layers.
+using TensorDims = InlineVector<std::size_t, 8>;
+
 struct TensorDescriptor : miopenTensorDescriptor
 {
     TensorDescriptor();
@@ -98,7 +104,7 @@ struct TensorDescriptor : miopenTensorDescriptor
 
     template <class Range>
     TensorDescriptor(miopenDataType_t t, const Range& plens)
-        : lens(plens.begin(), plens.end()), packed(true), type(t)
+        : lens(plens.begin(), plens.end()), type(t)
     {
         this->CalculateStrides();
     }
@@ -107,13 +113,14 @@ struct TensorDescriptor : miopenTensorDescriptor
     TensorDescriptor(miopenDataType_t t, const Range1& plens, const Range2& pstrides)
         : lens(plens.begin(), plens.end()), strides(pstrides.begin(), pstrides.end()), type(t)
     {
-        packed = (this->GetElementSize() == this->GetElementSpace());
+        this->CalculateDerivedValues();
     }
 
+    /// Sets packed strides for the lengths.
     void CalculateStrides();
 
-    const std::vector<std::size_t>& GetLengths() const;
-    const std::vector<std::size_t>& GetStrides() const;
+    const TensorDims& GetLengths() const;
+    const TensorDims& GetStrides() const;
     int GetSize() const;
 
     miopenDataType_t GetType() const;
@@ -134,6 +141,9 @@ struct TensorDescriptor : miopenTensorDescriptor
 
     bool IsPacked() const;
 
+    /// Hash of the type, lengths and strides, consistent with operator==.
+    std::size_t GetHash() const;
+
     bool operator==(const TensorDescriptor& rhs) const;
     bool operator!=(const TensorDescriptor& rhs) const;
     bool operator<(const TensorDescriptor& rhs) const;
@@ -144,10 +154,15 @@ struct TensorDescriptor : miopenTensorDescriptor
     friend std::ostream& operator<<(std::ostream& stream, const TensorDescriptor& t);
 
     private:
-    std::vector<std::size_t> lens;
-    std::vector<std::size_t> strides;
+    /// Caches the element size, element space and packed flag. Called by every constructor.
+    void CalculateDerivedValues();
+
+    TensorDims lens;
+    TensorDims strides;
 
-    bool packed;
+    std::size_t element_size  = 0;
+    std::size_t element_space = 0;
+    bool packed               = true;
 
     miopenDataType_t type = miopenFloat;
 };
@@ -156,4 +171,12 @@ struct TensorDescriptor : miopenTensorDescriptor
 
 MIOPEN_DEFINE_OBJECT(miopenTensorDescriptor, miopen::TensorDescriptor)
 
+namespace std {
+template <>
+struct hash<miopen::TensorDescriptor>
+{
+    std::size_t operator()(const miopen::TensorDescriptor& x) const { return x.GetHash(); }
+};
+} // namespace std
+
 #endif // GUARD_MIOPEN_TENSOR_HPP_
@@ -0,0 +1,75 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_TENSOR_OPS_HOST_HPP_
+#define GUARD_MIOPEN_TENSOR_OPS_HOST_HPP_
+
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+
+#include <cstddef>
+
+namespace miopen {
+namespace host {
+
+// Host counterparts of the functions in tensor_ops.hpp, for buffers in host memory. They take
+// the same descriptors, arguments and offsets (in elements) and compute in float. Dimensions
+// which are contiguous in all tensors are collapsed, the innermost loop runs over unit or zero
+// strides where possible, and the outer loops are spread over ParallelFor.
+//
+// Unlike the kernels, OpTensor does not read C when beta is 0.
+
+void ScaleTensor(const TensorDescriptor& yDesc, void* y, const void* alpha, std::size_t offset = 0);
+
+void SetTensor(const TensorDescriptor& yDesc, void* y, const void* alpha, std::size_t offset = 0);
+
+/// C = op(alpha0 * A, alpha1 * B) + beta * C. A and C have the same lengths; each length of B is
+/// either the same or 1, in which case B is broadcast along that dimension.
+void OpTensor(miopenTensorOp_t tensorOp,
+              const void* alpha0,
+              const TensorDescriptor& aTensorDesc,
+              const void* ATensor,
+              const void* alpha1,
+              const TensorDescriptor& bTensorDesc,
+              const void* BTensor,
+              const void* beta,
+              const TensorDescriptor& cTensorDesc,
+              void* CTensor,
+              std::size_t Aoffset = 0,
+              std::size_t Boffset = 0,
+              std::size_t Coffset = 0);
+
+void CopyTensor(const TensorDescriptor& srcDesc,
+                const void* src,
+                const TensorDescriptor& dstDesc,
+                void* dst,
+                std::size_t srcOffset = 0,
+                std::size_t dstOffset = 0);
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_TENSOR_OPS_HOST_HPP_
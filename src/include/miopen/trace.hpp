@@ -0,0 +1,124 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#ifndef GUARD_MIOPEN_TRACE_HPP
+#define GUARD_MIOPEN_TRACE_HPP
+
+#include <miopen/config.h>
+
+#include <sstream>
+#include <string>
+
+/// Timeline tracing. Built in with -DMIOPEN_ENABLE_TRACE=On, otherwise the macros below
+/// expand to nothing. Recording is enabled at runtime by MIOPEN_TRACE_FILE=<path>;
+/// the trace is written there at exit (or by TraceWrite()) in the Chrome trace format,
+/// which can be opened by chrome://tracing or Perfetto.
+///
+/// MIOPEN_TRACE_SCOPE(category, name) records the time until the end of the enclosing
+/// scope. name may be a stream expression like in MIOPEN_LOG; it is evaluated only when
+/// recording is enabled.
+/// MIOPEN_TRACE_FUNCTION(category) does the same, using the name of the function.
+/// MIOPEN_TRACE_KERNEL(name, ms) records a kernel which has just finished in ms milliseconds.
+
+#define MIOPEN_TRACE_PP_CAT(x, y) MIOPEN_TRACE_PP_PRIMITIVE_CAT(x, y)
+#define MIOPEN_TRACE_PP_PRIMITIVE_CAT(x, y) x##y
+
+#if MIOPEN_ENABLE_TRACE
+#define MIOPEN_TRACE_SCOPE(category, ...)                                                   \
+    miopen::TraceScope MIOPEN_TRACE_PP_CAT(miopen_trace_scope_, __LINE__)(category, [&] { \
+        std::ostringstream miopen_trace_ss;                                                 \
+        miopen_trace_ss << __VA_ARGS__;                                                     \
+        return miopen_trace_ss.str();                                                       \
+    })
+#define MIOPEN_TRACE_FUNCTION(category) \
+    miopen::TraceScope MIOPEN_TRACE_PP_CAT(miopen_trace_scope_, __LINE__)(category, __func__)
+#define MIOPEN_TRACE_KERNEL(name, ms) miopen::TraceKernel(name, ms)
+#else
+#define MIOPEN_TRACE_SCOPE(...)
+#define MIOPEN_TRACE_FUNCTION(...)
+#define MIOPEN_TRACE_KERNEL(...)
+#endif
+
+namespace miopen {
+
+/// \return true if events are being recorded.
+bool IsTracing();
+
+/// Microseconds since the start of the recording.
+double TraceNow();
+
+/// Records an event which started at start and lasted for duration (in microseconds).
+void TraceComplete(const char* category, std::string name, double start, double duration);
+
+/// Records a kernel which has just finished. The kernels are shown as a separate process.
+void TraceKernel(const std::string& name, float ms);
+
+/// Writes the events recorded so far to MIOPEN_TRACE_FILE, overwriting it.
+void TraceWrite();
+
+/// Writes the events recorded so far to path in the Chrome trace format.
+void TraceWrite(const std::string& path);
+
+class TraceScope
+{
+    public:
+    template <class F>
+    TraceScope(const char* category_, F name_) : category(category_)
+    {
+        if(IsTracing())
+        {
+            name  = name_();
+            start = TraceNow();
+        }
+    }
+
+    TraceScope(const char* category_, const char* name_) : category(category_)
+    {
+        if(IsTracing())
+        {
+            name  = name_;
+            start = TraceNow();
+        }
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+    ~TraceScope()
+    {
+        if(start >= 0)
+            TraceComplete(category, std::move(name), start, TraceNow() - start);
+    }
+
+    private:
+    const char* category;
+    std::string name;
+    double start = -1;
+};
+
+} // namespace miopen
+
+#endif
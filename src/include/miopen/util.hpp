@@ -52,7 +52,8 @@ float Im2ColGPU(Handle& handle,
                 int stride_w,
                 int dilation_h,
                 int dilation_w,
-                Data_t col);
+                Data_t col,
+                int col_batch = 1);
 
 float Col2ImGPU(Handle& handle,
                 ConstData_t col,
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_MIOPEN_WINOGRAD_HOST_HPP_
+#define GUARD_MIOPEN_WINOGRAD_HOST_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace miopen {
+
+struct ConvolutionDescriptor;
+struct TensorDescriptor;
+
+namespace host {
+
+/// Output tile of the Winograd transforms: F(2x2,3x3) works on 4x4 input tiles, F(4x4,3x3) on
+/// 6x6 ones. The larger tile needs fewer multiplications but loses more precision.
+enum class WinogradTile
+{
+    F2x3,
+    F4x3,
+};
+
+/// A 3x3 stride-1 convolution of packed NCHW float tensors by the Winograd minimal filtering
+/// algorithm. The filters are transformed once when the object is made, so it can be kept and
+/// run on many inputs.
+///
+/// The input tiles of a block of output tiles are transformed into alpha^2 matrices of
+/// c x tiles, multiplied with the transformed k x c filters by host::Gemm, and transformed back.
+/// Blocks of tiles are spread over ParallelFor.
+class WinogradConv3x3
+{
+    public:
+    /// w is a k x c x 3 x 3 filter. For backward data the object runs the transposed
+    /// convolution, with the filter flipped and its k and c swapped.
+    WinogradConv3x3(WinogradTile tile, int k, int c, const float* w, bool backward = false);
+
+    /// out (n x OutputChannels() x out_h x out_w) = in (n x InputChannels() x in_h x in_w)
+    /// convolved with the filter. The pads are those of the convolution descriptor, also for
+    /// backward data, where in is dy and out is dx.
+    void Run(int n,
+             int in_h,
+             int in_w,
+             int pad_h,
+             int pad_w,
+             int out_h,
+             int out_w,
+             const float* in,
+             float* out) const;
+
+    int OutputChannels() const { return k; }
+    int InputChannels() const { return c; }
+
+    private:
+    WinogradTile tile;
+    bool backward;
+    int k;
+    int c;
+    /// alpha^2 matrices of k x c transformed filter taps.
+    std::vector<float> u;
+};
+
+/// Whether WinogradConv3x3 can run conv with the filter wDesc: 3x3 filters, unit strides and
+/// dilations, and for backward data pads of at most 2.
+bool IsWinogradApplicable(const ConvolutionDescriptor& conv,
+                          const TensorDescriptor& wDesc,
+                          bool backward);
+
+} // namespace host
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_WINOGRAD_HOST_HPP_
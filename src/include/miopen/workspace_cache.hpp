@@ -0,0 +1,100 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_MIOPEN_WORKSPACE_CACHE_HPP_
+#define GUARD_MIOPEN_WORKSPACE_CACHE_HPP_
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace miopen {
+
+/// Memoizes results of workspace size queries.
+///
+/// Frameworks query workspace sizes on every iteration, while computing them
+/// involves a walk over all applicable solvers. Records are per key, which shall
+/// identify the problem config, device and direction. All records are dropped
+/// when the generation (see Db::GetGeneration()) differs from the one the cache
+/// has been filled at.
+class WorkspaceSizeCache
+{
+    public:
+    template <class F>
+    std::size_t Get(const std::string& key, std::size_t generation, F compute)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            SetGenerationUnsafe(generation);
+            const auto it = sizes.find(key);
+            if(it != sizes.end())
+                return it->second;
+        }
+
+        // Not holding the lock while computing allows concurrent queries.
+        const std::size_t size = compute();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(current_generation == generation)
+            sizes.emplace(key, size);
+        return size;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        sizes.clear();
+    }
+
+    std::size_t Size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return sizes.size();
+    }
+
+    static WorkspaceSizeCache& GetInstance()
+    {
+        static WorkspaceSizeCache instance;
+        return instance;
+    }
+
+    private:
+    void SetGenerationUnsafe(std::size_t generation)
+    {
+        if(current_generation == generation)
+            return;
+        sizes.clear();
+        current_generation = generation;
+    }
+
+    std::mutex mutex;
+    std::unordered_map<std::string, std::size_t> sizes;
+    std::size_t current_generation = 0;
+};
+
+} // namespace miopen
+
+#endif // GUARD_MIOPEN_WORKSPACE_CACHE_HPP_
@@ -109,8 +109,8 @@ static void dump_kernel_params(const std::string& program_name,
 }
 #endif
 
-const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
-                                                   const std::string& network_config)
+std::vector<Kernel> KernelCache::GetKernels(const std::string& algorithm,
+                                            const std::string& network_config)
 {
 
     std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
@@ -118,7 +118,11 @@ const std::vector<Kernel>& KernelCache::GetKernels(const std::string& algorithm,
     MIOPEN_LOG_I("Key: " << key.first << " \"" << key.second << '\"');
 #endif
 
-    return kernel_map[key];
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = kernel_map.find(key);
+    if(it == kernel_map.end())
+        return {};
+    return it->second;
 }
 
 Kernel KernelCache::AddKernel(Handle& h,
@@ -150,21 +154,27 @@ Kernel KernelCache::AddKernel(Handle& h,
 #endif
 
     Program program;
-
-    auto program_it = program_map.find(std::make_pair(program_name, params));
-    if(program_it != program_map.end())
+    bool found = false;
     {
-        program = program_it->second;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto program_it = program_map.find(std::make_pair(program_name, params));
+        if(program_it != program_map.end())
+        {
+            program = program_it->second;
+            found   = true;
+        }
     }
-    else
+    if(!found)
     {
         const bool is_kernel_str = algorithm.find("GEMM") != std::string::npos;
 #ifndef NDEBUG
         if(!is_kernel_str)
             MIOPEN_LOG_I2("File: " << program_name);
 #endif
+        // Building may take long, other threads shall not wait for it.
         program = h.LoadProgram(program_name, params, is_kernel_str);
-        program_map[std::make_pair(program_name, params)] = program;
+        std::lock_guard<std::mutex> lock(mutex);
+        program = program_map.emplace(std::make_pair(program_name, params), program).first->second;
     }
     Kernel kernel{program, kernel_name, vld, vgd};
     if(!network_config.empty() && !algorithm.empty())
@@ -176,6 +186,7 @@ Kernel KernelCache::AddKernel(Handle& h,
 
 void KernelCache::AddKernel(Key key, Kernel k, std::size_t cache_index)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     auto&& v = kernel_map[key];
     if(cache_index >= v.size())
     {
@@ -188,6 +199,7 @@ void KernelCache::ClearKernels(const std::string& algorithm, const std::string&
 {
     assert(!network_config.empty() && !algorithm.empty());
     const std::pair<std::string, std::string> key = std::make_pair(algorithm, network_config);
+    std::lock_guard<std::mutex> lock(mutex);
     auto&& v = this->kernel_map[key];
     v.clear();
 }
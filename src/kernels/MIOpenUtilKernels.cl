@@ -51,6 +51,16 @@
 #define _FLOAT4 PPCAT(_FLOAT, FOUR)
 #define _FLOAT8 PPCAT(_FLOAT, EIGHT)
 
+// Number of images unrolled side by side into one column buffer. The image is
+// selected by the second dimension of the NDRange, images are IM_BATCH_STRIDE
+// elements apart and each column row holds COL_BATCH * out_h * out_w elements.
+#ifndef COL_BATCH
+#define COL_BATCH 1
+#endif
+#ifndef IM_BATCH_STRIDE
+#define IM_BATCH_STRIDE 0
+#endif
+
 /* Simple GPU implementation - number of threads launced == sizeof im2col buffer
  * Each thread writes one pixel of output. First (out_h*out_w) threads write to
  * the first line (row) of the im2col output.
@@ -111,14 +121,18 @@ kernel void Im2Col(const int data_size_off,
 #define THREADS_PER_CH (256 / NUM_CH_PER_WG)
 
 #if USE_IM_OFF_GUARD
-#define IM_OFF_GUARD(idx) (idx) < data_size_off ? im_off[(idx)] : 0
+#define IM_OFF_GUARD(idx) (idx) < im_size_off ? im_off[(idx)] : 0
 #else
 #define IM_OFF_GUARD(idx) im_off[idx]
 #endif
 
-    global _FLOAT* im_off = im + im_offset;
+    int img               = get_global_id(1);
+    int im_size_off       = data_size_off - img * IM_BATCH_STRIDE;
+    global _FLOAT* im_off = im + im_offset + img * IM_BATCH_STRIDE;
     int lid               = get_local_id(0);
     int gid               = get_group_id(0);
+    int col_stride        = COL_BATCH * out_h * out_w;
+    col += img * out_h * out_w;
 
 #if NUM_IM_BLKS == 1 && STRIDE_GT_1 == 0
 
@@ -145,7 +159,7 @@ kernel void Im2Col(const int data_size_off,
         int out_y     = inner_lid / out_w;
 
         int col_x = out_y * out_w + out_x;
-        int col_y = (gid * NUM_CH_PER_WG + witem_ch) * out_h * out_w * wei_h * wei_w;
+        int col_y = (gid * NUM_CH_PER_WG + witem_ch) * col_stride * wei_h * wei_w;
 
         for(int y = 0; y < wei_h; y++)
         {
@@ -154,10 +168,10 @@ kernel void Im2Col(const int data_size_off,
                 int im_off_h = out_y * stride_h - pad_h + y * dilation_h;
                 int im_off_w = out_x * stride_w - pad_w + x * dilation_w;
                 if(im_off_h >= 0 && im_off_h < h && im_off_w >= 0 && im_off_w < w)
-                    col[col_y + col_x + (y * wei_w + x) * out_h * out_w] =
+                    col[col_y + col_x + (y * wei_w + x) * col_stride] =
                         local_im[witem_ch_offset + (im_off_h)*w + im_off_w];
                 else
-                    col[col_y + col_x + (y * wei_w + x) * out_h * out_w] = 0;
+                    col[col_y + col_x + (y * wei_w + x) * col_stride] = 0;
             }
         }
     }
@@ -203,7 +217,7 @@ kernel void Im2Col(const int data_size_off,
         int out_y = inner_lid / out_cols_wg;
 
         int col_x = (im_y + out_y) * out_w + im_x + out_x;
-        int col_y = (gid / NUM_IM_BLKS) * out_h * out_w * wei_h * wei_w;
+        int col_y = (gid / NUM_IM_BLKS) * col_stride * wei_h * wei_w;
 
         for(int y = 0; y < wei_h; y++)
         {
@@ -211,7 +225,7 @@ kernel void Im2Col(const int data_size_off,
             {
                 int im_off_h = out_y * stride_h + y * dilation_h;
                 int im_off_w = out_x * stride_w + x * dilation_w;
-                col[col_y + col_x + (y * wei_w + x) * out_h * out_w] =
+                col[col_y + col_x + (y * wei_w + x) * col_stride] =
                     local_im[(im_off_h)*im_cols_wg + im_off_w];
             }
         }
@@ -0,0 +1,385 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/env.hpp>
+#include <miopen/log_sink.hpp>
+#include <miopen/logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_LOG_ASYNC)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_LOG_FILE)
+/// Size of the log file in megabytes which triggers rotation. 0 disables it.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_LOG_FILE_SIZE)
+/// Number of rotated log files to keep. 1 by default.
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_LOG_FILE_COUNT)
+
+void StderrLogSink::Write(const std::string& message) { std::cerr << message; }
+
+FileLogSink::FileLogSink(const std::string& path_, std::size_t max_size_, std::size_t max_files_)
+    : path(path_), max_size(max_size_), max_files(std::max<std::size_t>(max_files_, 1))
+{
+    file.open(path, std::ios::app);
+    if(!file)
+        std::cerr << PlatformName() << ": Warning [FileLogSink] Cannot open log file " << path
+                  << std::endl;
+    size = file ? static_cast<std::size_t>(file.tellp()) : 0;
+}
+
+void FileLogSink::Write(const std::string& message)
+{
+    if(!file)
+        return;
+    if(max_size != 0 && size != 0 && size + message.size() > max_size)
+        Rotate();
+    file << message;
+    size += message.size();
+}
+
+void FileLogSink::Flush() { file.flush(); }
+
+void FileLogSink::Rotate()
+{
+    file.close();
+    const auto name = [&](std::size_t n) { return path + "." + std::to_string(n); };
+    std::remove(name(max_files).c_str());
+    for(auto n = max_files; n > 1; --n)
+        std::rename(name(n - 1).c_str(), name(n).c_str());
+    std::rename(path.c_str(), name(1).c_str());
+    file.open(path, std::ios::trunc);
+    size = 0;
+}
+
+namespace {
+
+struct LogRecord
+{
+    LoggingLevel level      = LoggingLevel::Default;
+    const char* func        = nullptr; // nullptr if message is formatted completely.
+    const char* pretty_func = nullptr;
+    std::chrono::steady_clock::time_point time;
+    std::string message;
+};
+
+std::string Format(const LogRecord& record)
+{
+    if(record.func == nullptr)
+        return record.message;
+    return PlatformName() + ": " + LoggingLevelToCString(record.level) + " [" +
+           LoggingParseFunction(record.func, record.pretty_func) + "] " + record.message + "\n";
+}
+
+struct SinkState
+{
+    std::mutex mutex;
+    std::unique_ptr<LogSink> sink;
+
+    SinkState()
+    {
+        const auto path = GetStringEnv(MIOPEN_LOG_FILE{});
+        if(path != nullptr && *path != '\0')
+        {
+            const auto count = Value(MIOPEN_LOG_FILE_COUNT{});
+            sink.reset(new FileLogSink(path,
+                                       std::size_t(Value(MIOPEN_LOG_FILE_SIZE{})) << 20,
+                                       count > 0 ? count : 1));
+        }
+        else
+        {
+            sink.reset(new StderrLogSink{});
+        }
+    }
+
+    void Write(const std::vector<LogRecord>& records)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(auto&& record : records)
+            sink->Write(Format(record));
+        sink->Flush();
+    }
+
+    static SinkState& Get()
+    {
+        static SinkState state;
+        return state;
+    }
+};
+
+/// Single producer, single consumer queue. The producer is the owning thread.
+class LogRing
+{
+    public:
+    static constexpr std::size_t capacity = 1024;
+
+    bool Push(LogRecord&& record)
+    {
+        const auto head = write_pos.load(std::memory_order_relaxed);
+        if(head - read_pos.load(std::memory_order_acquire) == capacity)
+            return false;
+        slots[head % capacity] = std::move(record);
+        write_pos.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <class F>
+    std::size_t Pop(F f)
+    {
+        const auto tail = read_pos.load(std::memory_order_relaxed);
+        const auto head = write_pos.load(std::memory_order_acquire);
+        for(auto i = tail; i != head; ++i)
+            f(std::move(slots[i % capacity]));
+        read_pos.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    std::size_t Size() const
+    {
+        return write_pos.load(std::memory_order_relaxed) -
+               read_pos.load(std::memory_order_relaxed);
+    }
+
+    private:
+    std::vector<LogRecord> slots = std::vector<LogRecord>(capacity);
+    std::atomic<std::size_t> write_pos{0};
+    char padding[64]; // Keeps the positions in different cache lines.
+    std::atomic<std::size_t> read_pos{0};
+};
+
+std::atomic<bool>& AsyncFlag()
+{
+    static std::atomic<bool> flag{IsEnabled(MIOPEN_LOG_ASYNC{})};
+    return flag;
+}
+
+std::atomic<std::size_t>& DroppedCount()
+{
+    static std::atomic<std::size_t> count{0};
+    return count;
+}
+
+class AsyncLogger
+{
+    public:
+    AsyncLogger()
+    {
+        // Constructed first, so destroyed after the logger thread is done.
+        SinkState::Get();
+        thread = std::thread([this] { Run(); });
+    }
+
+    ~AsyncLogger()
+    {
+        AsyncFlag() = false;
+        {
+            std::lock_guard<std::mutex> lock(wake_mutex);
+            stop = true;
+        }
+        wake.notify_one();
+        thread.join();
+        Drain();
+    }
+
+    static AsyncLogger& Get()
+    {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    void Push(LogRecord&& record)
+    {
+        const auto& ring     = ThreadRing();
+        const bool important = record.level != LoggingLevel::Default &&
+                               static_cast<int>(record.level) <=
+                                   static_cast<int>(LoggingLevel::Warning);
+        // Errors and warnings wait up to about 10 ms for the logger thread, others are dropped.
+        for(int attempt = 0; !ring->Push(std::move(record)); ++attempt)
+        {
+            if(!important || attempt == 1000)
+            {
+                ++DroppedCount();
+                return;
+            }
+            wake.notify_one();
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+        }
+        if(ring->Size() > LogRing::capacity / 2)
+            wake.notify_one();
+    }
+
+    /// Writes all messages from the rings to the sink. Returns the number of messages.
+    std::size_t Drain()
+    {
+        std::lock_guard<std::mutex> drain_lock(drain_mutex);
+        std::vector<std::shared_ptr<LogRing>> current;
+        {
+            std::lock_guard<std::mutex> lock(rings_mutex);
+            // Rings of exited threads are dropped once they are drained.
+            rings.erase(std::remove_if(rings.begin(),
+                                       rings.end(),
+                                       [](const std::shared_ptr<LogRing>& ring) {
+                                           return ring.use_count() == 1 && ring->Size() == 0;
+                                       }),
+                        rings.end());
+            current = rings;
+        }
+
+        batch.clear();
+        for(auto&& ring : current)
+            ring->Pop([&](LogRecord&& record) { batch.push_back(std::move(record)); });
+
+        const auto n_dropped = DroppedCount().load();
+        if(n_dropped != reported_dropped)
+        {
+            LogRecord record;
+            record.level       = LoggingLevel::Warning;
+            record.func        = "AsyncLogger";
+            record.pretty_func = record.func;
+            record.time        = std::chrono::steady_clock::now();
+            record.message     = std::to_string(n_dropped - reported_dropped) +
+                             " messages dropped because of overload";
+            batch.push_back(std::move(record));
+            reported_dropped = n_dropped;
+        }
+
+        if(batch.empty())
+            return 0;
+        // Keep the order between the threads.
+        std::stable_sort(batch.begin(), batch.end(), [](const LogRecord& x, const LogRecord& y) {
+            return x.time < y.time;
+        });
+        SinkState::Get().Write(batch);
+        return batch.size();
+    }
+
+    private:
+    const std::shared_ptr<LogRing>& ThreadRing()
+    {
+        thread_local std::shared_ptr<LogRing> ring;
+        if(ring == nullptr)
+        {
+            ring = std::make_shared<LogRing>();
+            std::lock_guard<std::mutex> lock(rings_mutex);
+            rings.push_back(ring);
+        }
+        return ring;
+    }
+
+    void Run()
+    {
+        std::unique_lock<std::mutex> lock(wake_mutex);
+        while(!stop)
+        {
+            lock.unlock();
+            const auto n = Drain();
+            lock.lock();
+            if(n == 0)
+                wake.wait_for(lock, std::chrono::milliseconds(10));
+        }
+    }
+
+    std::mutex rings_mutex;
+    std::vector<std::shared_ptr<LogRing>> rings;
+    std::mutex drain_mutex;
+    std::vector<LogRecord> batch;
+    std::size_t reported_dropped = 0;
+    std::mutex wake_mutex;
+    std::condition_variable wake;
+    bool stop = false;
+    std::thread thread;
+};
+
+void Write(LogRecord&& record)
+{
+    if(AsyncFlag())
+    {
+        record.time = std::chrono::steady_clock::now();
+        AsyncLogger::Get().Push(std::move(record));
+    }
+    else
+    {
+        SinkState::Get().Write({std::move(record)});
+    }
+}
+
+} // namespace
+
+void LogWrite(LoggingLevel level, const char* func, const char* pretty_func, std::string message)
+{
+    LogRecord record;
+    record.level       = level;
+    record.func        = func;
+    record.pretty_func = pretty_func;
+    record.message     = std::move(message);
+    Write(std::move(record));
+}
+
+void LogWrite(std::string message)
+{
+    LogRecord record;
+    record.message = std::move(message);
+    Write(std::move(record));
+}
+
+void SetLogSink(std::unique_ptr<LogSink> sink)
+{
+    LogFlush();
+    auto& state = SinkState::Get();
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.sink->Flush();
+    state.sink = std::move(sink);
+}
+
+void SetLogAsync(bool enable)
+{
+    if(enable)
+        AsyncLogger::Get();
+    else
+        LogFlush();
+    AsyncFlag() = enable;
+}
+
+bool IsLogAsync() { return AsyncFlag(); }
+
+void LogFlush()
+{
+    if(AsyncFlag())
+        AsyncLogger::Get().Drain();
+}
+
+std::size_t LogDroppedCount() { return DroppedCount(); }
+
+} // namespace miopen
@@ -95,6 +95,8 @@ std::string PlatformName()
     return "MIOpen(OpenCL)";
 #elif MIOPEN_BACKEND_HIP
     return "MIOpen(HIP)";
+#elif MIOPEN_BACKEND_CPU
+    return "MIOpen(CPU)";
 #else
     return "MIOpen";
 #endif
@@ -31,7 +31,7 @@
 
 extern "C" miopenStatus_t miopenCreateLRNDescriptor(miopenLRNDescriptor_t* lrnDesc)
 {
-
+    MIOPEN_LOG_FUNCTION(lrnDesc);
     return miopen::try_([&] { miopen::deref(lrnDesc) = new miopen::LRNDescriptor(); });
 }
 
@@ -70,7 +70,7 @@ extern "C" miopenStatus_t miopenGetLRNDescriptor(const miopenLRNDescriptor_t lrn
 extern "C" miopenStatus_t miopenLRNGetWorkSpaceSize(const miopenTensorDescriptor_t yDesc,
                                                     size_t* workSpaceSize)
 {
-
+    MIOPEN_LOG_FUNCTION(yDesc, workSpaceSize);
     // TODO: Supporting size 4 bytes only
     return miopen::try_([&] {
         miopen::deref(workSpaceSize) = miopen::deref(yDesc).GetLengths()[0] *
@@ -55,22 +55,37 @@ miopen::MultiFileDb mlo_construct_direct2D::GetDb() const
     return {db_path(), _search_params.GetUserPerfDbPath()};
 }
 
+// clang-format off
+using DirectFwdSolvers = miopen::solver::SolverContainer<
+    miopen::solver::ConvAsm3x3U,
+    miopen::solver::ConvAsm1x1U,
+    miopen::solver::ConvAsm5x10u2v2f1,
+    miopen::solver::ConvAsm7x7c3h224w224k64u2v2p3q3f1,
+    miopen::solver::ConvAsm5x10u2v2b1,
+    miopen::solver::ConvOclDirectFwd11x11,
+    miopen::solver::ConvOclDirectFwdGen,
+    miopen::solver::ConvOclDirectFwd3x3,
+    miopen::solver::ConvOclDirectFwd1x1,
+    miopen::solver::ConvOclDirectFwd
+>;
+
+using BwdWrWSolvers = miopen::solver::SolverContainer<
+    miopen::solver::ConvAsmBwdWrW1x1,
+    miopen::solver::ConvAsmBwdWrW3x3,
+    miopen::solver::ConvOclBwdWrW2,
+    miopen::solver::ConvOclBwdWrW53,
+    miopen::solver::ConvOclBwdWrW1x1
+>;
+// clang-format on
+
 std::vector<miopen::solver::ConvSolution> mlo_construct_direct2D::FindAllSolutions()
 {
-    // clang-format off
-    return miopen::solver::SearchForAllSolutions<
-        miopen::solver::ConvAsm3x3U,
-        miopen::solver::ConvAsm1x1U,
-        miopen::solver::ConvAsm5x10u2v2f1,
-        miopen::solver::ConvAsm7x7c3h224w224k64u2v2p3q3f1,
-        miopen::solver::ConvAsm5x10u2v2b1,
-        miopen::solver::ConvOclDirectFwd11x11,
-        miopen::solver::ConvOclDirectFwdGen,
-        miopen::solver::ConvOclDirectFwd3x3,
-        miopen::solver::ConvOclDirectFwd1x1,
-        miopen::solver::ConvOclDirectFwd
-    >(_search_params, this->GetDb());
-    // clang-format on
+    return DirectFwdSolvers::SearchForAllSolutions(_search_params, this->GetDb());
+}
+
+std::size_t mlo_construct_direct2D::GetMaxWorkspaceSize()
+{
+    return DirectFwdSolvers::GetMaxWorkspaceSize(_search_params);
 }
 
 miopen::solver::ConvSolution mlo_construct_winograd::FindSolution()
@@ -85,15 +100,12 @@ miopen::solver::ConvSolution mlo_construct_winograd::FindSolution()
 
 std::vector<miopen::solver::ConvSolution> mlo_construct_BwdWrW2D::FindAllSolutions()
 {
-    // clang-format off
-    return miopen::solver::SearchForAllSolutions<
-        miopen::solver::ConvAsmBwdWrW1x1,
-        miopen::solver::ConvAsmBwdWrW3x3,
-        miopen::solver::ConvOclBwdWrW2,
-        miopen::solver::ConvOclBwdWrW53,
-        miopen::solver::ConvOclBwdWrW1x1
-    >(_search_params, this->GetDb());
-    // clang-format on
+    return BwdWrWSolvers::SearchForAllSolutions(_search_params, this->GetDb());
+}
+
+std::size_t mlo_construct_BwdWrW2D::GetMaxWorkspaceSize()
+{
+    return BwdWrWSolvers::GetMaxWorkspaceSize(_search_params);
 }
 
 #if MIOPEN_BACKEND_OPENCL
@@ -27,6 +27,8 @@
 #include <miopen/convolution.hpp>
 #include <miopen/db.hpp>
 #include <miopen/env.hpp>
+#include <miopen/find_controls.hpp>
+#include <miopen/find_db.hpp>
 #include <miopen/util.hpp>
 #include <miopen/solver.hpp>
 #include <miopen/float_equal.hpp>
@@ -40,6 +42,7 @@
 namespace miopen {
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_CONV_DIRECT)
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_FIND_DB)
 
 struct AutoEnableProfiling
 {
@@ -289,6 +292,240 @@ ConvolutionDescriptor::FindDataDirectSolutions(Handle& handle,
     }
 }
 
+/// PerfDb key does not include horizontal dilation and convolution mode.
+static std::string GetFindDbKey(const ConvolutionContext& context, miopenConvolutionMode_t mode)
+{
+    std::ostringstream ss;
+    context.Serialize(ss);
+    ss << '-' << context.kernel_dilation0 << '-' << (mode == miopenTranspose ? 'T' : 'C');
+    return ss.str();
+}
+
+static const std::vector<std::string>& GetFwdAlgorithmNames()
+{
+    static const std::vector<std::string> names = {"miopenConvolutionFwdAlgoGEMM",
+                                                   "miopenConvolutionFwdAlgoDirect",
+                                                   "miopenConvolutionFwdAlgoFFT",
+                                                   "miopenConvolutionFwdAlgoWinograd"};
+    return names;
+}
+
+static const std::vector<std::string>& GetBwdDataAlgorithmNames()
+{
+    static const std::vector<std::string> names = {"miopenConvolutionBwdDataAlgoGEMM",
+                                                   "miopenConvolutionBwdDataAlgoDirect",
+                                                   "miopenConvolutionBwdDataAlgoFFT",
+                                                   "miopenConvolutionBwdDataAlgoWinograd",
+                                                   "miopenTransposeBwdDataAlgoGEMM"};
+    return names;
+}
+
+static const std::vector<std::string>& GetBwdWeightsAlgorithmNames()
+{
+    static const std::vector<std::string> names = {"miopenConvolutionBwdWeightsAlgoGEMM",
+                                                   "miopenConvolutionBwdWeightsAlgoDirect"};
+    return names;
+}
+
+/// Wraps measurements of Find() with find-db lookup and update.
+///
+/// On a find-db hit, measure() is invoked for the fastest recorded algorithm only,
+/// so that only its kernels are built, and then the recorded results are returned.
+/// MIOPEN_FIND_ENFORCE controls the find-db like it controls the PerfDb:
+///  - DB_UPDATE, SEARCH_DB_UPDATE: the record is not loaded but replaced;
+///  - SEARCH (as well as exhaustiveSearch) ignores records that are not auto-tuned;
+///  - DB_CLEAN removes the record and does not write a new one.
+template <class Measure>
+static std::vector<PerfField> FindWithDb(Handle& handle,
+                                         const mlo_construct_direct2D& find_db_params,
+                                         miopenConvolutionMode_t mode,
+                                         const std::vector<std::string>& algorithms,
+                                         Data_t workSpace,
+                                         size_t workSpaceSize,
+                                         bool exhaustiveSearch,
+                                         Measure measure)
+{
+    FindDbSolvers solvers;
+    if(miopen::IsDisabled(MIOPEN_DEBUG_FIND_DB{}))
+        return measure(FindDbSelection{}, solvers);
+
+    const auto& context = find_db_params.getContext();
+    const FindEnforce enforce;
+    const auto workspace_limit = workSpace != nullptr ? workSpaceSize : 0;
+    const bool searched        = exhaustiveSearch || enforce.IsSearch(context);
+    FindDb db{handle, GetFindDbKey(context, mode)};
+
+    if(enforce.IsDbClean(context))
+    {
+        if(db.Remove())
+            MIOPEN_LOG_W("Find Db: record removed, enforce: " << enforce);
+        return measure(FindDbSelection{}, solvers);
+    }
+
+    if(enforce.IsDbUpdate(context))
+    {
+        MIOPEN_LOG_W("Find Db: load skipped, enforce: " << enforce);
+    }
+    else
+    {
+        const auto record = db.Load(algorithms, workspace_limit, searched);
+        if(record)
+        {
+            const auto& best = record->front();
+            const auto built = measure(FindDbSelection{best.first, best.second.solver_id}, solvers);
+            if(std::any_of(built.begin(), built.end(), [&](const PerfField& entry) {
+                   return entry.name == best.first;
+               }))
+            {
+                MIOPEN_LOG_I("Find Db: record loaded, selected: " << best.first);
+                std::vector<PerfField> perf_db;
+                for(const auto& entry : *record)
+                    perf_db.push_back(
+                        PerfField{entry.first, entry.second.time, entry.second.workspace});
+                return perf_db;
+            }
+            MIOPEN_LOG_W("Find Db: " << best.first << " is not available, record ignored");
+            solvers.clear();
+        }
+    }
+
+    const auto perf_db = measure(FindDbSelection{}, solvers);
+    FindDbResults results;
+    for(const auto& entry : perf_db)
+    {
+        results.emplace_back(
+            entry.name,
+            FindDbData{
+                entry.time, entry.workspace, workspace_limit, solvers[entry.name], searched});
+    }
+    if(!results.empty() && !db.Store(results))
+        MIOPEN_LOG_W("Find Db: failed to store record");
+    return perf_db;
+}
+
+/// Immediate mode: the fastest algorithm recorded in the find-db that fits into the workspace.
+static std::string GetImmediateRecordedAlgorithm(Handle& handle,
+                                                 const mlo_construct_direct2D& find_db_params,
+                                                 miopenConvolutionMode_t mode,
+                                                 const std::vector<std::string>& algorithms,
+                                                 size_t workSpaceSize)
+{
+    if(miopen::IsDisabled(MIOPEN_DEBUG_FIND_DB{}))
+        return {};
+
+    FindDb db{handle, GetFindDbKey(find_db_params.getContext(), mode)};
+    const auto record = db.Load(algorithms, workSpaceSize, false);
+    return record ? record->front().first : std::string{};
+}
+
+/// Immediate mode heuristic for the algorithms implemented by several solvers.
+/// Solutions come in the order of expected performance and are already filtered
+/// by IsFast(), so the first one which fits into the workspace is taken. Returns
+/// an empty id if none fits.
+static std::string GetImmediateSolverId(const std::vector<miopen::solver::ConvSolution>& all,
+                                        size_t workSpaceSize)
+{
+    for(const auto& sol : all)
+        if(sol.workspce_sz <= workSpaceSize)
+            return sol.solver_id;
+    return {};
+}
+
+static bool IsWinogradApplicable(Handle& handle,
+                                 const ConvolutionDescriptor& conv,
+                                 const TensorDescriptor& xDesc,
+                                 const TensorDescriptor& wDesc,
+                                 const TensorDescriptor& yDesc,
+                                 int direction)
+{
+    try
+    {
+        mlo_construct_winograd construct_params(direction);
+        construct_params.setStream(&handle);
+        construct_params.setOutputDescFromMLDesc(yDesc);
+        construct_params.setInputDescFromMLDesc(xDesc);
+        construct_params.setWeightDescFromMLDesc(wDesc);
+        construct_params.setConvDescr(conv.pad_h,
+                                      conv.pad_w,
+                                      conv.u,
+                                      conv.v,
+                                      conv.dilation_h,
+                                      conv.dilation_w);
+        return FindFirstSolution(construct_params).Succeeded();
+    }
+    catch(miopen::Exception&)
+    {
+        return false;
+    }
+}
+
+/// Immediate mode: builds the kernels of an algorithm when Find() was not run
+/// for the problem, so there is nothing in the kernel cache.
+///
+/// Only one solution is built. The direct algorithms pick one of several solvers:
+/// the solver recorded in the find-db wins over the heuristic choice, and if
+/// neither is known, no solver fits into the workspace. The other algorithms have
+/// a single solution and pass no solver. measure() runs the solution once into a
+/// scratch buffer and leaves its kernels in the cache, just like Find() does.
+template <class Measure>
+static void BuildImmediate(Handle& handle,
+                           const mlo_construct_direct2D& find_db_params,
+                           miopenConvolutionMode_t mode,
+                           const std::string& algorithm,
+                           const boost::optional<std::string>& heuristic_solver_id,
+                           Measure measure)
+{
+    FindDbSolvers solvers;
+    if(!heuristic_solver_id)
+    {
+        MIOPEN_LOG_I("Immediate mode: building " << algorithm);
+        if(!measure(FindDbSelection{algorithm, std::string{}}, solvers).empty())
+            return;
+        MIOPEN_THROW(miopenStatusBadParm, algorithm + " cannot be executed with these params");
+    }
+
+    std::string solver_id = *heuristic_solver_id;
+    if(!miopen::IsDisabled(MIOPEN_DEBUG_FIND_DB{}))
+    {
+        FindDb db{handle, GetFindDbKey(find_db_params.getContext(), mode)};
+        const auto recorded = db.Load(algorithm);
+        if(recorded && !recorded->solver_id.empty())
+            solver_id = recorded->solver_id;
+    }
+
+    // An empty selection would allow every solver and build them all.
+    if(solver_id.empty())
+        MIOPEN_THROW(miopenStatusBadParm, algorithm + ": no solver fits into the workspace");
+
+    MIOPEN_LOG_I("Immediate mode: building " << algorithm << " " << solver_id);
+    if(!measure(FindDbSelection{algorithm, solver_id}, solvers).empty())
+        return;
+
+    // The recorded solver may need more workspace than the caller provides now.
+    if(solver_id != *heuristic_solver_id && !heuristic_solver_id->empty() &&
+       !measure(FindDbSelection{algorithm, *heuristic_solver_id}, solvers).empty())
+        return;
+
+    MIOPEN_THROW(miopenStatusBadParm, algorithm + " cannot be executed with these params");
+}
+
+#if MIOPEN_USE_MIOPENGEMM
+/// Returns the GEMM built by Find() for the algorithm; in immediate mode builds it first.
+template <class Build>
+static GemmGeometry GetImmediateGemmGeometry(Handle& handle,
+                                             const std::string& algorithm,
+                                             const std::string& geometry_name,
+                                             const std::string& network_config,
+                                             Build build)
+{
+    GemmGeometry gg;
+    if(FindGemmGeometry(handle, std::make_pair(geometry_name, network_config), gg))
+        return gg;
+    build(algorithm, boost::none);
+    return GetGemmGeometry(handle, geometry_name, network_config);
+}
+#endif
+
 void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
                                                  const TensorDescriptor& xDesc,
                                                  ConstData_t x,
@@ -313,6 +550,140 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
     if(requestAlgoCount < 1)
         MIOPEN_THROW(miopenStatusBadParm, "requestAlgoCount cannot be < 1");
 
+    mlo_construct_direct2D find_db_params(1); // forward
+    find_db_params.setOutputDescFromMLDesc(yDesc);
+    find_db_params.setInputDescFromMLDesc(xDesc);
+    find_db_params.setWeightDescFromMLDesc(wDesc);
+    find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+    const auto perf_db = FindWithDb(
+        handle,
+        find_db_params,
+        mode,
+        GetFwdAlgorithmNames(),
+        workSpace,
+        workSpaceSize,
+        exhaustiveSearch,
+        [&](const FindDbSelection& only, FindDbSolvers& solvers) {
+            return MeasureConvFwdAlgorithms(handle,
+                                            xDesc,
+                                            x,
+                                            wDesc,
+                                            w,
+                                            yDesc,
+                                            workSpace,
+                                            workSpaceSize,
+                                            exhaustiveSearch,
+                                            only,
+                                            solvers);
+        });
+
+    if(perf_db.empty())
+        MIOPEN_THROW("Fwd Convolution cannot be executed due to incorrect params");
+
+    for(const auto& entry : perf_db)
+        MIOPEN_LOG_I(entry.name << "\t" << entry.time << "\t" << entry.workspace);
+
+    // update perfResults
+    *returnedAlgoCount = std::min(requestAlgoCount, static_cast<int>(perf_db.size()));
+
+    for(int i = 0; i < *returnedAlgoCount; i++)
+    {
+        perfResults[i].fwd_algo =
+            static_cast<miopenConvFwdAlgorithm_t>(FwdAlgoResolver(perf_db[i].name));
+        perfResults[i].time   = perf_db[i].time;
+        perfResults[i].memory = perf_db[i].workspace;
+    }
+}
+
+miopenConvFwdAlgorithm_t
+ConvolutionDescriptor::GetImmediateConvFwdAlgorithm(Handle& handle,
+                                                    const TensorDescriptor& xDesc,
+                                                    const TensorDescriptor& wDesc,
+                                                    const TensorDescriptor& yDesc,
+                                                    size_t workSpaceSize) const
+{
+    MIOPEN_LOG_I2("workspace = " << workSpaceSize);
+
+    mlo_construct_direct2D find_db_params(1); // forward
+    find_db_params.setOutputDescFromMLDesc(yDesc);
+    find_db_params.setInputDescFromMLDesc(xDesc);
+    find_db_params.setWeightDescFromMLDesc(wDesc);
+    find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+    const auto recorded = GetImmediateRecordedAlgorithm(
+        handle, find_db_params, mode, GetFwdAlgorithmNames(), workSpaceSize);
+    if(!recorded.empty())
+        return static_cast<miopenConvFwdAlgorithm_t>(FwdAlgoResolver(recorded));
+
+    if(mode == miopenConvolution && dilation_h == 1 && dilation_w == 1)
+    {
+        if(IsWinogradApplicable(handle, *this, xDesc, wDesc, yDesc, 1))
+            return miopenConvolutionFwdAlgoWinograd;
+
+        std::string network_config;
+        ExtraKernelArgs eka;
+        const auto all =
+            FindDataDirectSolutions(handle, xDesc, wDesc, yDesc, false, true, network_config, eka);
+        if(!GetImmediateSolverId(all, workSpaceSize).empty())
+            return miopenConvolutionFwdAlgoDirect;
+    }
+
+#if MIOPEN_USE_MIOPENGEMM
+    if(xDesc.GetType() == miopenFloat)
+    {
+        int in_h, in_w;
+        std::tie(std::ignore, std::ignore, in_h, in_w) = tien<4>(xDesc.GetLengths());
+
+        int wei_h, wei_w;
+        std::tie(std::ignore, std::ignore, wei_h, wei_w) = tien<4>(wDesc.GetLengths());
+
+        const bool is_1x1 = wei_h == 1 && wei_w == 1 && pad_h == 0 && pad_w == 0 &&
+                            dilation_h == 1 && dilation_w == 1;
+
+        size_t workspace_gemm = 0;
+        if(mode == miopenTranspose)
+        {
+            if(wei_h != 1 || wei_w != 1 || u != 1 || v != 1)
+                workspace_gemm = BackwardDataGetWorkSpaceSizeGEMM(handle, wDesc, xDesc);
+        }
+        else if(is_1x1 && ((in_h <= 14 && in_w <= 14 && u == 1 && v == 1) || (u == 2 && v == 2)))
+        {
+            workspace_gemm = ForwardGetWorkSpaceSizeGEMMTranspose(xDesc, yDesc);
+        }
+        else if(!is_1x1 || u != 1 || v != 1)
+        {
+            workspace_gemm = ForwardGetWorkSpaceSizeGEMM(handle, wDesc, yDesc);
+        }
+        if(workSpaceSize >= workspace_gemm)
+            return miopenConvolutionFwdAlgoGEMM;
+    }
+#endif
+
+    if(mode == miopenConvolution && dilation_h == 1 && dilation_w == 1 &&
+       xDesc.GetType() == miopenFloat)
+    {
+        const size_t workspace_fft = ForwardGetWorkSpaceSizeFFT(wDesc, xDesc, yDesc);
+        if(workspace_fft != 0 && workSpaceSize >= workspace_fft)
+            return miopenConvolutionFwdAlgoFFT;
+    }
+
+    MIOPEN_THROW("Fwd Convolution cannot be executed due to incorrect params");
+}
+
+std::vector<PerfField>
+ConvolutionDescriptor::MeasureConvFwdAlgorithms(Handle& handle,
+                                                const TensorDescriptor& xDesc,
+                                                ConstData_t x,
+                                                const TensorDescriptor& wDesc,
+                                                ConstData_t w,
+                                                const TensorDescriptor& yDesc,
+                                                Data_t workSpace,
+                                                size_t workSpaceSize,
+                                                bool exhaustiveSearch,
+                                                const FindDbSelection& only,
+                                                FindDbSolvers& solvers) const
+{
     AutoEnableProfiling enableProfiling{handle};
 
     // create a dummy buffer for use as output for the kernel calls
@@ -340,7 +711,8 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
         std::tie(std::ignore, wei_n, wei_h, wei_w) = tien<4>(wDesc.GetLengths());
 
 #if MIOPEN_USE_MIOPENGEMM
-        if(xDesc.GetType() == miopenFloat)
+        if(xDesc.GetType() == miopenFloat &&
+           only.IsAlgorithmAllowed("miopenConvolutionFwdAlgoGEMM"))
         {
             size_t workspace_req = BackwardDataGetWorkSpaceSizeGEMM(handle, wDesc, xDesc);
             float time_gemm      = 0;
@@ -401,7 +773,8 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
         std::tie(wei_n, std::ignore, wei_h, wei_w) = tien<4>(wDesc.GetLengths());
 
 #if MIOPEN_USE_MIOPENGEMM
-        if(xDesc.GetType() == miopenFloat)
+        if(xDesc.GetType() == miopenFloat &&
+           only.IsAlgorithmAllowed("miopenConvolutionFwdAlgoGEMM"))
         {
             float time_gemm = 0;
 
@@ -459,11 +832,15 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
                 perf_db.push_back(PerfField{"miopenConvolutionFwdAlgoGEMM", time_gemm, 0});
             }
             // if not 1x1
+            // gfx803 caps the workspace, so that even a single image may not fit
             else if(workSpace != nullptr &&
-                    workSpaceSize >= ForwardGetWorkSpaceSizeGEMM(handle, wDesc, yDesc))
+                    workSpaceSize >= ForwardGetWorkSpaceSizeGEMM(handle, wDesc, yDesc) &&
+                    ForwardGetGemmChunkSize(handle, wDesc, yDesc, workSpaceSize) > 0)
             {
+                // Batch as many images into one GEMM as the workspace allows
+                const int chunk = ForwardGetGemmChunkSize(handle, wDesc, yDesc, workSpaceSize);
                 GemmGeometry gg =
-                    CreateGemmGeometryConvFwd(xDesc, wDesc, yDesc, false, network_config);
+                    CreateGemmGeometryConvFwd(xDesc, wDesc, yDesc, false, network_config, chunk);
                 float time_im2col = 0;
                 size_t in_offset  = 0;
                 time_im2col       = Im2ColGPU(handle,
@@ -483,14 +860,55 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
                                         v,
                                         dilation_h,
                                         dilation_w,
-                                        workSpace);
+                                        workSpace,
+                                        chunk);
 
-                gg.FindSolution(.003, handle, workSpace, w, tmp_y.get(), false);
-                gg.RunGemm(handle, workSpace, w, tmp_y.get(), 0, 0, 0);
-                time_gemm = in_n * (time_im2col + handle.GetKernelTime());
-                perf_db.push_back(PerfField{"miopenConvolutionFwdAlgoGEMM",
-                                            time_gemm,
-                                            ForwardGetWorkSpaceSizeGEMM(handle, wDesc, yDesc)});
+                if(chunk == 1)
+                {
+                    gg.FindSolution(.003, handle, workSpace, w, tmp_y.get(), false);
+                    gg.RunGemm(handle, workSpace, w, tmp_y.get(), 0, 0, 0);
+                    time_gemm = in_n * (time_im2col + handle.GetKernelTime());
+                }
+                else
+                {
+                    size_t col_size = in_c * wei_h * wei_w * chunk * out_h * out_w;
+                    gg.FindSolution(.003, handle, workSpace, w, workSpace, false);
+                    gg.RunGemm(handle, workSpace, w, workSpace, 0, 0, col_size);
+                    time_gemm = time_im2col + handle.GetKernelTime();
+
+                    const float time_transpose = transpose_CNHW2NCHW(handle,
+                                                                     chunk,
+                                                                     wei_n,
+                                                                     out_h,
+                                                                     out_w,
+                                                                     out_h,
+                                                                     out_w,
+                                                                     workSpace,
+                                                                     tmp_y.get(),
+                                                                     col_size,
+                                                                     0,
+                                                                     1,
+                                                                     1);
+                    time_gemm = (in_n / chunk) * (time_gemm + time_transpose);
+
+                    // A smaller last chunk has a GEMM geometry of its own
+                    const int rest = in_n % chunk;
+                    if(rest != 0)
+                    {
+                        std::string rest_config;
+                        GemmGeometry rest_gg = CreateGemmGeometryConvFwd(
+                            xDesc, wDesc, yDesc, false, rest_config, rest);
+                        col_size = in_c * wei_h * wei_w * rest * out_h * out_w;
+                        rest_gg.FindSolution(.003, handle, workSpace, w, workSpace, false);
+                        rest_gg.RunGemm(handle, workSpace, w, workSpace, 0, 0, col_size);
+                        time_gemm += handle.GetKernelTime() +
+                                     (time_im2col + time_transpose) * rest / chunk;
+                    }
+                }
+                perf_db.push_back(
+                    PerfField{"miopenConvolutionFwdAlgoGEMM",
+                              time_gemm,
+                              ForwardGetWorkSpaceSizeGEMM(handle, wDesc, yDesc, chunk)});
             }
         }
 #else
@@ -502,7 +920,8 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
             // Winograd algo
             WinogradKernelParams k_p;
             KernelInvoke kernel_wino;
-            if(FindWinogradKernel(handle, xDesc, wDesc, yDesc, k_p, kernel_wino, 1) == 0)
+            if(only.IsAlgorithmAllowed("miopenConvolutionFwdAlgoWinograd") &&
+               FindWinogradKernel(handle, xDesc, wDesc, yDesc, k_p, kernel_wino, 1) == 0)
             { // TODO: be more graceful
                 // Execute the winograd kernel
                 float time_wino  = 0;
@@ -546,6 +965,7 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
                 perf_db.push_back(PerfField{"miopenConvolutionFwdAlgoWinograd", time_wino, 0});
             }
 
+            if(only.IsAlgorithmAllowed("miopenConvolutionFwdAlgoDirect"))
             { // Direct algo
                 ExtraKernelArgs eka;
                 const auto all = FindDataDirectSolutions(
@@ -555,6 +975,8 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
                 visit_float(xDesc.GetType(), [&](auto as_float) {
                     for(const auto& sol : all)
                     {
+                        if(!only.IsSolverAllowed(sol.solver_id))
+                            continue;
                         float elapsed = 0.0f;
                         const int rc  = EvaluateDataDirectSolution(handle,
                                                                   sol,
@@ -587,6 +1009,7 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
                 {
                     const std::string algorithm_name = "miopenConvolutionFwdAlgoDirect";
                     AddKernels(handle, algorithm_name, network_config, selected, nullptr);
+                    solvers[algorithm_name] = selected.solver_id;
                     MIOPEN_LOG_I("Selected: " << selected << ": " << best << ", workspce_sz = "
                                               << selected.workspce_sz);
                     perf_db.push_back(PerfField{algorithm_name, best, selected.workspce_sz});
@@ -596,7 +1019,8 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
             // FFT algo
             std::vector<KernelInvoke> kernels_fft;
             size_t workspace_fft = ForwardGetWorkSpaceSizeFFT(wDesc, xDesc, yDesc);
-            if(FindFwdFFTKernel(handle, xDesc, wDesc, yDesc, workspace_fft, kernels_fft) == 0)
+            if(only.IsAlgorithmAllowed("miopenConvolutionFwdAlgoFFT") &&
+               FindFwdFFTKernel(handle, xDesc, wDesc, yDesc, workspace_fft, kernels_fft) == 0)
             {
                 (void)kernels_fft; // not used now, but needed as fft coverage widens
                 if(workSpace != nullptr && workSpaceSize >= workspace_fft)
@@ -618,24 +1042,9 @@ void ConvolutionDescriptor::FindConvFwdAlgorithm(Handle& handle,
         }
     }
 
-    if(perf_db.empty())
-        MIOPEN_THROW("Fwd Convolution cannot be executed due to incorrect params");
-
     // sort the perf_db
     std::sort(begin(perf_db), end(perf_db));
-    for(const auto& entry : perf_db)
-        MIOPEN_LOG_I(entry.name << "\t" << entry.time << "\t" << entry.workspace);
-
-    // update perfResults
-    *returnedAlgoCount = std::min(requestAlgoCount, static_cast<int>(perf_db.size()));
-
-    for(int i = 0; i < *returnedAlgoCount; i++)
-    {
-        perfResults[i].fwd_algo =
-            static_cast<miopenConvFwdAlgorithm_t>(FwdAlgoResolver(perf_db[i].name));
-        perfResults[i].time   = perf_db[i].time;
-        perfResults[i].memory = perf_db[i].workspace;
-    }
+    return perf_db;
 }
 
 void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
@@ -683,6 +1092,35 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
         miopen::checkNumericsInput(handle, wDesc, w);
     }
 
+    // Immediate mode: kernels are built on the first call if Find() was not run.
+    const auto build = [&](const std::string& algorithm,
+                           const boost::optional<std::string>& solver_id) {
+        mlo_construct_direct2D find_db_params(1); // forward
+        find_db_params.setOutputDescFromMLDesc(yDesc);
+        find_db_params.setInputDescFromMLDesc(xDesc);
+        find_db_params.setWeightDescFromMLDesc(wDesc);
+        find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+        BuildImmediate(handle,
+                       find_db_params,
+                       mode,
+                       algorithm,
+                       solver_id,
+                       [&](const FindDbSelection& only, FindDbSolvers& solvers) {
+                           return MeasureConvFwdAlgorithms(handle,
+                                                           xDesc,
+                                                           x,
+                                                           wDesc,
+                                                           w,
+                                                           yDesc,
+                                                           workSpace,
+                                                           workSpaceSize,
+                                                           false,
+                                                           only,
+                                                           solvers);
+                       });
+    };
+
     MIOPEN_LOG_I("workspace = " << workSpaceSize);
     if(mode == miopenConvolution)
     {
@@ -705,6 +1143,15 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
             std::string network_config;
             construct_params.mloBuildConf_Key(network_config);
 
+            if(handle.GetKernels("miopenConvolutionFwdAlgoDirect", network_config).empty())
+            {
+                std::string direct_config;
+                ExtraKernelArgs eka;
+                const auto all = FindDataDirectSolutions(
+                    handle, xDesc, wDesc, yDesc, false, true, direct_config, eka);
+                build("miopenConvolutionFwdAlgoDirect", GetImmediateSolverId(all, workSpaceSize));
+            }
+
             auto&& kernels = handle.GetKernels("miopenConvolutionFwdAlgoDirect", network_config);
 #if(!defined(__GNUC__) || defined(__clang__)) // w/a for segfault in gcc 5.4.0
             const
@@ -799,7 +1246,9 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
             construct_params.mloBuildConf_Key(network_config);
 
             std::string algorithm_name = "miopenConvolutionFwdAlgoWinograd";
-            auto kernel                = handle.GetKernel(algorithm_name, network_config);
+            if(handle.GetKernels(algorithm_name, network_config).empty())
+                build(algorithm_name, boost::none);
+            auto kernel = handle.GetKernel(algorithm_name, network_config);
 
             int flags        = 0;
             int reserved     = 0;
@@ -863,8 +1312,11 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
                        workSpaceSize >= ForwardGetWorkSpaceSizeGEMMTranspose(xDesc, yDesc));
 
                 CreateGemmGeometryConvFwdCNHW(xDesc, wDesc, yDesc, false, network_config);
-                GemmGeometry gg =
-                    GetGemmGeometry(handle, "miopenConvolutionFwdAlgoGEMM", network_config);
+                GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                           "miopenConvolutionFwdAlgoGEMM",
+                                                           "miopenConvolutionFwdAlgoGEMM",
+                                                           network_config,
+                                                           build);
 
                 float t1 = 0;
                 transpose_NCHW2CNHW(
@@ -904,8 +1356,11 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
             {
                 float time_0 = 0;
                 CreateGemmGeometryConvFwd(xDesc, wDesc, yDesc, false, network_config);
-                GemmGeometry gg =
-                    GetGemmGeometry(handle, "miopenConvolutionFwdAlgoGEMM", network_config);
+                GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                           "miopenConvolutionFwdAlgoGEMM",
+                                                           "miopenConvolutionFwdAlgoGEMM",
+                                                           network_config,
+                                                           build);
 
                 for(int i = 0; i < in_n; i++)
                 {
@@ -920,55 +1375,101 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
                     }
                 }
             }
-            else
+            else if(wei_h != 1 || wei_w != 1 || v != 1 || u != 1 || pad_h != 0 || pad_w != 0)
             {
                 assert(workSpace != nullptr &&
                        workSpaceSize >= ForwardGetWorkSpaceSizeGEMM(handle, wDesc, yDesc));
 
-                CreateGemmGeometryConvFwd(xDesc, wDesc, yDesc, false, network_config);
-                GemmGeometry gg =
-                    GetGemmGeometry(handle, "miopenConvolutionFwdAlgoGEMM", network_config);
+                // Batch as many images into one GEMM as the workspace allows
+                const int chunk = ForwardGetGemmChunkSize(handle, wDesc, yDesc, workSpaceSize);
+                if(chunk < 1)
+                    MIOPEN_THROW(miopenStatusBadParm,
+                                 "Workspace is too small for the GEMM convolution of an image");
+                CreateGemmGeometryConvFwd(xDesc, wDesc, yDesc, false, network_config, chunk);
+                GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                           "miopenConvolutionFwdAlgoGEMM",
+                                                           "miopenConvolutionFwdAlgoGEMM",
+                                                           network_config,
+                                                           build);
+
+                // A smaller last chunk has a GEMM geometry of its own
+                GemmGeometry rest_gg = gg;
+                if(in_n % chunk != 0)
+                {
+                    std::string rest_config;
+                    CreateGemmGeometryConvFwd(
+                        xDesc, wDesc, yDesc, false, rest_config, in_n % chunk);
+                    rest_gg = GetImmediateGemmGeometry(handle,
+                                                       "miopenConvolutionFwdAlgoGEMM",
+                                                       "miopenConvolutionFwdAlgoGEMM",
+                                                       rest_config,
+                                                       build);
+                }
 
                 float time_0 = 0;
                 float t1     = 0;
-                for(int i = 0; i < in_n; i++)
+                for(int i = 0; i < in_n; i += chunk)
                 {
-                    int out_offset = i * wei_n * out_h * out_w;
-                    if(wei_h != 1 || wei_w != 1 || v != 1 || u != 1 || pad_h != 0 || pad_w != 0)
+                    const int images = std::min(chunk, in_n - i);
+                    size_t col_size  = in_c * wei_h * wei_w * images * out_h * out_w;
+                    int out_offset   = i * wei_n * out_h * out_w;
+                    size_t in_offset = i * in_c * in_h * in_w;
+                    Im2ColGPU(handle,
+                              xDesc.GetElementSize(),
+                              x,
+                              in_offset,
+                              in_c,
+                              in_h,
+                              in_w,
+                              wei_h,
+                              wei_w,
+                              out_h,
+                              out_w,
+                              pad_h,
+                              pad_w,
+                              u,
+                              v,
+                              dilation_h,
+                              dilation_w,
+                              workSpace,
+                              images);
+                    if(handle.IsProfilingEnabled())
+                        t1 = handle.GetKernelTime();
+
+                    if(chunk == 1)
                     {
-                        size_t in_offset = i * in_c * in_h * in_w;
-                        Im2ColGPU(handle,
-                                  xDesc.GetElementSize(),
-                                  x,
-                                  in_offset,
-                                  in_c,
-                                  in_h,
-                                  in_w,
-                                  wei_h,
-                                  wei_w,
-                                  out_h,
-                                  out_w,
-                                  pad_h,
-                                  pad_w,
-                                  u,
-                                  v,
-                                  dilation_h,
-                                  dilation_w,
-                                  workSpace);
+                        gg.RunGemm(handle, workSpace, w, y, 0, 0, out_offset);
+                    }
+                    else
+                    {
+                        auto& chunk_gg = images == chunk ? gg : rest_gg;
+                        chunk_gg.RunGemm(handle, workSpace, w, workSpace, 0, 0, col_size);
                         if(handle.IsProfilingEnabled())
-                            t1 = handle.GetKernelTime();
+                            t1 += handle.GetKernelTime();
 
-                        gg.RunGemm(handle, workSpace, w, y, 0, 0, out_offset);
+                        transpose_CNHW2NCHW(handle,
+                                            images,
+                                            wei_n,
+                                            out_h,
+                                            out_w,
+                                            out_h,
+                                            out_w,
+                                            workSpace,
+                                            y,
+                                            col_size,
+                                            out_offset,
+                                            1,
+                                            1);
+                    }
 
-                        // Update times for both the kernels
-                        if(handle.IsProfilingEnabled())
-                        {
-                            if(i == in_n - 1)
-                                handle.AccumKernelTime(t1 + time_0);
-                            else
-                                handle.AccumKernelTime(t1);
-                            time_0 += handle.GetKernelTime();
-                        }
+                    // Update times for all the kernels
+                    if(handle.IsProfilingEnabled())
+                    {
+                        if(i + chunk >= in_n)
+                            handle.AccumKernelTime(t1 + time_0);
+                        else
+                            handle.AccumKernelTime(t1);
+                        time_0 += handle.GetKernelTime();
                     }
                 }
             }
@@ -984,6 +1485,8 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
             size_t workspace_fft = ForwardGetWorkSpaceSizeFFT(wDesc, xDesc, yDesc);
             if(workSpace != nullptr && workSpaceSize >= workspace_fft)
             {
+                if(!IsFFTKernelBuilt(handle, xDesc, yDesc))
+                    build("miopenConvolutionFwdAlgoFFT", boost::none);
                 bool timed  = handle.IsProfilingEnabled();
                 float timev = ExecuteFwdFFTKernel(
                     handle, xDesc, x, wDesc, w, yDesc, y, workSpace, workSpaceSize, timed);
@@ -1026,8 +1529,11 @@ void ConvolutionDescriptor::ConvolutionForward(Handle& handle,
 
 #if MIOPEN_USE_MIOPENGEMM
         CreateGemmGeometryConvBwdData(xDesc, wDesc, yDesc, true, network_config);
-        GemmGeometry gg =
-            GetGemmGeometry(handle, "miopenConvolutionBwdDataAlgoGEMM", network_config);
+        GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                   "miopenConvolutionFwdAlgoGEMM",
+                                                   "miopenConvolutionBwdDataAlgoGEMM",
+                                                   network_config,
+                                                   build);
 
         float time_0 = 0;
         float t1     = 0;
@@ -1120,6 +1626,137 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
     if(requestAlgoCount < 1)
         MIOPEN_THROW(miopenStatusBadParm, "requestAlgoCount cannot be < 1");
 
+    mlo_construct_direct2D find_db_params(0); // backward data
+    find_db_params.setOutputDescFromMLDesc(dyDesc);
+    find_db_params.setInputDescFromMLDesc(dxDesc);
+    find_db_params.setWeightDescFromMLDesc(wDesc);
+    find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+    const auto perf_db = FindWithDb(
+        handle,
+        find_db_params,
+        mode,
+        GetBwdDataAlgorithmNames(),
+        workSpace,
+        workSpaceSize,
+        exhaustiveSearch,
+        [&](const FindDbSelection& only, FindDbSolvers& solvers) {
+            return MeasureConvBwdDataAlgorithms(handle,
+                                                dyDesc,
+                                                dy,
+                                                wDesc,
+                                                w,
+                                                dxDesc,
+                                                workSpace,
+                                                workSpaceSize,
+                                                exhaustiveSearch,
+                                                only,
+                                                solvers);
+        });
+
+    if(perf_db.empty())
+        MIOPEN_THROW(miopenStatusUnknownError, "Backward Data Algo cannot be executed");
+
+    for(const auto& entry : perf_db)
+        MIOPEN_LOG_I(entry.name << "\t" << entry.time << "\t" << entry.workspace);
+
+    // update perfResults
+    *returnedAlgoCount = std::min(requestAlgoCount, static_cast<int>(perf_db.size()));
+
+    for(int i = 0; i < *returnedAlgoCount; i++)
+    {
+        perfResults[i].bwd_data_algo =
+            static_cast<miopenConvBwdDataAlgorithm_t>(BwdDataAlgoResolver(perf_db[i].name));
+        perfResults[i].time   = perf_db[i].time;
+        perfResults[i].memory = perf_db[i].workspace;
+    }
+}
+
+miopenConvBwdDataAlgorithm_t
+ConvolutionDescriptor::GetImmediateConvBwdDataAlgorithm(Handle& handle,
+                                                        const TensorDescriptor& dyDesc,
+                                                        const TensorDescriptor& wDesc,
+                                                        const TensorDescriptor& dxDesc,
+                                                        size_t workSpaceSize) const
+{
+    MIOPEN_LOG_I2("workspace = " << workSpaceSize);
+
+    mlo_construct_direct2D find_db_params(0); // backward
+    find_db_params.setOutputDescFromMLDesc(dyDesc);
+    find_db_params.setInputDescFromMLDesc(dxDesc);
+    find_db_params.setWeightDescFromMLDesc(wDesc);
+    find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+    const auto recorded = GetImmediateRecordedAlgorithm(
+        handle, find_db_params, mode, GetBwdDataAlgorithmNames(), workSpaceSize);
+    if(!recorded.empty())
+        return static_cast<miopenConvBwdDataAlgorithm_t>(BwdDataAlgoResolver(recorded));
+
+    if(mode == miopenConvolution && dilation_h == 1 && dilation_w == 1)
+    {
+        if(IsWinogradApplicable(handle, *this, dxDesc, wDesc, dyDesc, 0))
+            return miopenConvolutionBwdDataAlgoWinograd;
+
+        std::string network_config;
+        ExtraKernelArgs eka;
+        const auto all = FindDataDirectSolutions(
+            handle, dxDesc, wDesc, dyDesc, false, false, network_config, eka);
+        if(!GetImmediateSolverId(all, workSpaceSize).empty())
+            return miopenConvolutionBwdDataAlgoDirect;
+    }
+
+#if MIOPEN_USE_MIOPENGEMM
+    if(dyDesc.GetType() == miopenFloat)
+    {
+        int wei_h, wei_w;
+        std::tie(std::ignore, std::ignore, wei_h, wei_w) = tien<4>(wDesc.GetLengths());
+
+        const bool is_1x1 = wei_h == 1 && wei_w == 1 && pad_h == 0 && pad_w == 0 &&
+                            dilation_h == 1 && dilation_w == 1;
+
+        if(mode == miopenTranspose)
+        {
+            if((wei_h == 1 && wei_w == 1 && u == 1 && v == 1) ||
+               workSpaceSize >= ForwardGetWorkSpaceSizeGEMM(handle, wDesc, dxDesc))
+                return miopenTransposeBwdDataAlgoGEMM;
+        }
+        else if(is_1x1 && u == 2 && v == 2)
+        {
+            if(workSpaceSize >= BackwardDataGetWorkSpaceSizeGEMMTranspose(dyDesc, dxDesc))
+                return miopenConvolutionBwdDataAlgoGEMM;
+        }
+        else if((is_1x1 && u == 1 && v == 1) ||
+                workSpaceSize >= BackwardDataGetWorkSpaceSizeGEMM(handle, wDesc, dyDesc))
+        {
+            return miopenConvolutionBwdDataAlgoGEMM;
+        }
+    }
+#endif
+
+    if(mode == miopenConvolution && dilation_h == 1 && dilation_w == 1 &&
+       dyDesc.GetType() == miopenFloat)
+    {
+        const size_t workspace_fft = BackwardGetWorkSpaceSizeFFT(wDesc, dyDesc, dxDesc);
+        if(workspace_fft != 0 && workSpaceSize >= workspace_fft)
+            return miopenConvolutionBwdDataAlgoFFT;
+    }
+
+    MIOPEN_THROW(miopenStatusUnknownError, "Backward Data Algo cannot be executed");
+}
+
+std::vector<PerfField>
+ConvolutionDescriptor::MeasureConvBwdDataAlgorithms(Handle& handle,
+                                                    const TensorDescriptor& dyDesc,
+                                                    ConstData_t dy,
+                                                    const TensorDescriptor& wDesc,
+                                                    ConstData_t w,
+                                                    const TensorDescriptor& dxDesc,
+                                                    Data_t workSpace,
+                                                    size_t workSpaceSize,
+                                                    bool exhaustiveSearch,
+                                                    const FindDbSelection& only,
+                                                    FindDbSolvers& solvers) const
+{
     // create a dummy buffer for use as output for the kernel calls
     // because kernels are called purely for timing purposes
     auto tmp_dx = handle.Create(dxDesc.GetElementSize() * GetTypeSize(dxDesc.GetType()));
@@ -1148,7 +1785,8 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
         std::tie(std::ignore, wei_n, wei_h, wei_w) = tien<4>(wDesc.GetLengths());
 
 #if MIOPEN_USE_MIOPENGEMM
-        if(dyDesc.GetType() == miopenFloat)
+        if(dyDesc.GetType() == miopenFloat &&
+           only.IsAlgorithmAllowed("miopenTransposeBwdDataAlgoGEMM"))
         {
             size_t workspace_req = ForwardGetWorkSpaceSizeGEMM(handle, wDesc, dxDesc);
             float time_gemm      = 0;
@@ -1209,7 +1847,8 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
             // Winograd algo
             WinogradKernelParams k_p;
             KernelInvoke kernel_wino;
-            if(FindWinogradKernel(handle, dxDesc, wDesc, dyDesc, k_p, kernel_wino, 0) == 0)
+            if(only.IsAlgorithmAllowed("miopenConvolutionBwdDataAlgoWinograd") &&
+               FindWinogradKernel(handle, dxDesc, wDesc, dyDesc, k_p, kernel_wino, 0) == 0)
             { // TODO: be more graceful
                 float time_wino = 0;
                 /// \todo Move Flags into Solution.
@@ -1283,6 +1922,7 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
                 perf_db.push_back(PerfField{"miopenConvolutionBwdDataAlgoWinograd", time_wino, 0});
             }
 
+            if(only.IsAlgorithmAllowed("miopenConvolutionBwdDataAlgoDirect"))
             { // Direct algo
                 ExtraKernelArgs eka;
                 const auto all = FindDataDirectSolutions(
@@ -1292,6 +1932,8 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
                 visit_float(dyDesc.GetType(), [&](auto as_float) {
                     for(const auto& sol : all)
                     {
+                        if(!only.IsSolverAllowed(sol.solver_id))
+                            continue;
                         float elapsed = 0.0f;
                         const int rc  = EvaluateDataDirectSolution(handle,
                                                                   sol,
@@ -1324,6 +1966,7 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
                 {
                     const std::string algorithm_name = "miopenConvolutionBwdDataAlgoDirect";
                     AddKernels(handle, algorithm_name, network_config, selected, nullptr);
+                    solvers[algorithm_name] = selected.solver_id;
                     MIOPEN_LOG_I("Selected: " << selected << ": " << best << ", workspce_sz = "
                                               << selected.workspce_sz);
                     perf_db.push_back(PerfField{algorithm_name, best, selected.workspce_sz});
@@ -1333,7 +1976,8 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
             // FFT algo
             std::vector<KernelInvoke> kernels_fft;
             size_t workspace_fft = BackwardGetWorkSpaceSizeFFT(wDesc, dyDesc, dxDesc);
-            if(FindBwdFFTKernel(handle, dyDesc, wDesc, dxDesc, workspace_fft, kernels_fft) == 0)
+            if(only.IsAlgorithmAllowed("miopenConvolutionBwdDataAlgoFFT") &&
+               FindBwdFFTKernel(handle, dyDesc, wDesc, dxDesc, workspace_fft, kernels_fft) == 0)
             {
                 (void)kernels_fft; // not used now, but needed as fft coverage widens
                 if(workSpace != nullptr && workSpaceSize >= workspace_fft)
@@ -1358,7 +2002,8 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
         std::tie(wei_n, std::ignore, wei_h, wei_w) = tien<4>(wDesc.GetLengths());
 
 #if MIOPEN_USE_MIOPENGEMM
-        if(dyDesc.GetType() == miopenFloat)
+        if(dyDesc.GetType() == miopenFloat &&
+           only.IsAlgorithmAllowed("miopenConvolutionBwdDataAlgoGEMM"))
         {
 
             float time_gemm = 0;
@@ -1464,24 +2109,9 @@ void ConvolutionDescriptor::FindConvBwdDataAlgorithm(Handle& handle,
 #endif
     }
 
-    if(perf_db.empty())
-        MIOPEN_THROW(miopenStatusUnknownError, "Backward Data Algo cannot be executed");
-
     // sort the perf_db
     std::sort(begin(perf_db), end(perf_db));
-    for(const auto& entry : perf_db)
-        MIOPEN_LOG_I(entry.name << "\t" << entry.time << "\t" << entry.workspace);
-
-    // update perfResults
-    *returnedAlgoCount = std::min(requestAlgoCount, static_cast<int>(perf_db.size()));
-
-    for(int i = 0; i < *returnedAlgoCount; i++)
-    {
-        perfResults[i].bwd_data_algo =
-            static_cast<miopenConvBwdDataAlgorithm_t>(BwdDataAlgoResolver(perf_db[i].name));
-        perfResults[i].time   = perf_db[i].time;
-        perfResults[i].memory = perf_db[i].workspace;
-    }
+    return perf_db;
 }
 
 // BackwardDataAlgorithm()
@@ -1534,6 +2164,35 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
         }
     }
 
+    // Immediate mode: kernels are built on the first call if Find() was not run.
+    const auto build = [&](const std::string& algorithm,
+                           const boost::optional<std::string>& solver_id) {
+        mlo_construct_direct2D find_db_params(0); // backward
+        find_db_params.setOutputDescFromMLDesc(dyDesc);
+        find_db_params.setInputDescFromMLDesc(dxDesc);
+        find_db_params.setWeightDescFromMLDesc(wDesc);
+        find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+        BuildImmediate(handle,
+                       find_db_params,
+                       mode,
+                       algorithm,
+                       solver_id,
+                       [&](const FindDbSelection& only, FindDbSolvers& solvers) {
+                           return MeasureConvBwdDataAlgorithms(handle,
+                                                               dyDesc,
+                                                               dy,
+                                                               wDesc,
+                                                               w,
+                                                               dxDesc,
+                                                               workSpace,
+                                                               workSpaceSize,
+                                                               false,
+                                                               only,
+                                                               solvers);
+                       });
+    };
+
     if(mode == miopenConvolution)
     {
         if(dyDesc.GetLengths()[1] != wDesc.GetLengths()[0])
@@ -1555,6 +2214,16 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
             std::string network_config;
             construct_params.mloBuildConf_Key(network_config);
 
+            if(handle.GetKernels("miopenConvolutionBwdDataAlgoDirect", network_config).empty())
+            {
+                std::string direct_config;
+                ExtraKernelArgs eka;
+                const auto all = FindDataDirectSolutions(
+                    handle, dxDesc, wDesc, dyDesc, false, false, direct_config, eka);
+                build("miopenConvolutionBwdDataAlgoDirect",
+                      GetImmediateSolverId(all, workSpaceSize));
+            }
+
             auto&& kernels =
                 handle.GetKernels("miopenConvolutionBwdDataAlgoDirect", network_config);
             assert(1 <= kernels.size() && kernels.size() <= 2);
@@ -1630,6 +2299,8 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
             std::string network_config;
             construct_params.mloBuildConf_Key(network_config);
 
+            if(handle.GetKernels("miopenConvolutionBwdDataAlgoWinograd", network_config).empty())
+                build("miopenConvolutionBwdDataAlgoWinograd", boost::none);
             auto kernel = handle.GetKernel("miopenConvolutionBwdDataAlgoWinograd", network_config);
             /// \todo Copied from ConvolutionDescriptor::FindConvBwdDataAlgorithm()
             static const int F_REVERSE_R = 1 << 0;
@@ -1700,8 +2371,11 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
                        workSpaceSize >= BackwardDataGetWorkSpaceSizeGEMMTranspose(dyDesc, dxDesc));
 
                 CreateGemmGeometryConvBwdDataCNHW(dyDesc, wDesc, dxDesc, true, network_config);
-                GemmGeometry gg =
-                    GetGemmGeometry(handle, "miopenConvolutionBwdDataAlgoGEMM", network_config);
+                GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                           "miopenConvolutionBwdDataAlgoGEMM",
+                                                           "miopenConvolutionBwdDataAlgoGEMM",
+                                                           network_config,
+                                                           build);
 
                 transpose_NCHW2CNHW(
                     handle, in_n, wei_n, out_h, out_w, out_h, out_w, dy, workSpace, 0, 0, 1, 1);
@@ -1739,8 +2413,11 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
                     dilation_w == 1 && dilation_h == 1)
             {
                 CreateGemmGeometryConvBwdData(dyDesc, wDesc, dxDesc, true, network_config);
-                GemmGeometry gg =
-                    GetGemmGeometry(handle, "miopenConvolutionBwdDataAlgoGEMM", network_config);
+                GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                           "miopenConvolutionBwdDataAlgoGEMM",
+                                                           "miopenConvolutionBwdDataAlgoGEMM",
+                                                           network_config,
+                                                           build);
 
                 float time_0 = 0;
                 for(int i = 0; i < in_n; i++)
@@ -1766,8 +2443,11 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
                        workSpaceSize >= BackwardDataGetWorkSpaceSizeGEMM(handle, wDesc, dyDesc));
 
                 CreateGemmGeometryConvBwdData(dyDesc, wDesc, dxDesc, true, network_config);
-                GemmGeometry gg =
-                    GetGemmGeometry(handle, "miopenConvolutionBwdDataAlgoGEMM", network_config);
+                GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                           "miopenConvolutionBwdDataAlgoGEMM",
+                                                           "miopenConvolutionBwdDataAlgoGEMM",
+                                                           network_config,
+                                                           build);
 
                 handle.ResetKernelTime();
 
@@ -1829,6 +2509,8 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
             size_t workspace_fft = BackwardGetWorkSpaceSizeFFT(wDesc, dyDesc, dxDesc);
             if(workSpace != nullptr && workSpaceSize >= workspace_fft)
             {
+                if(!IsFFTKernelBuilt(handle, dyDesc, dxDesc))
+                    build("miopenConvolutionBwdDataAlgoFFT", boost::none);
                 bool timed  = handle.IsProfilingEnabled();
                 float timev = ExecuteBwdFFTKernel(
                     handle, dyDesc, dy, wDesc, w, dxDesc, dx, workSpace, workSpaceSize, timed);
@@ -1870,7 +2552,11 @@ void ConvolutionDescriptor::ConvolutionBackwardData(Handle& handle,
         std::string network_config;
 #if MIOPEN_USE_MIOPENGEMM
         CreateGemmGeometryTranBwdData(dyDesc, wDesc, dxDesc, true, network_config);
-        GemmGeometry gg = GetGemmGeometry(handle, "miopenTransposeBwdDataAlgoGEMM", network_config);
+        GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                   "miopenTransposeBwdDataAlgoGEMM",
+                                                   "miopenTransposeBwdDataAlgoGEMM",
+                                                   network_config,
+                                                   build);
 
         float time_0 = 0;
         float t1     = 0;
@@ -2031,6 +2717,109 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
     if(requestAlgoCount < 1)
         MIOPEN_THROW(miopenStatusBadParm, "requestAlgoCount cannot be < 1");
 
+    mlo_construct_BwdWrW2D find_db_params(0); // backward with regards to weights
+    find_db_params.setOutputDescFromMLDesc(dyDesc);
+    find_db_params.setInputDescFromMLDesc(xDesc);
+    find_db_params.setWeightDescFromMLDesc(dwDesc);
+    find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+    const auto perf_db = FindWithDb(
+        handle,
+        find_db_params,
+        mode,
+        GetBwdWeightsAlgorithmNames(),
+        workSpace,
+        workSpaceSize,
+        exhaustiveSearch,
+        [&](const FindDbSelection& only, FindDbSolvers& solvers) {
+            return MeasureConvBwdWeightsAlgorithms(handle,
+                                                   dyDesc,
+                                                   dy,
+                                                   xDesc,
+                                                   x,
+                                                   dwDesc,
+                                                   workSpace,
+                                                   workSpaceSize,
+                                                   exhaustiveSearch,
+                                                   only,
+                                                   solvers);
+        });
+
+    if(perf_db.empty())
+        MIOPEN_THROW("Bwd Weights Convolution cannot be executed due to incorrect params");
+
+    // update perfResults
+    *returnedAlgoCount = std::min(requestAlgoCount, static_cast<int>(perf_db.size()));
+
+    for(int i = 0; i < *returnedAlgoCount; i++)
+    {
+        perfResults[i].bwd_weights_algo =
+            static_cast<miopenConvBwdWeightsAlgorithm_t>(BwdWeightsAlgoResolver(perf_db[i].name));
+        perfResults[i].time   = perf_db[i].time;
+        perfResults[i].memory = perf_db[i].workspace;
+    }
+}
+
+miopenConvBwdWeightsAlgorithm_t
+ConvolutionDescriptor::GetImmediateConvBwdWeightsAlgorithm(Handle& handle,
+                                                           const TensorDescriptor& dyDesc,
+                                                           const TensorDescriptor& xDesc,
+                                                           const TensorDescriptor& dwDesc,
+                                                           size_t workSpaceSize) const
+{
+    MIOPEN_LOG_I2("workspace = " << workSpaceSize);
+
+    mlo_construct_BwdWrW2D find_db_params(0); // backward with regards to weights
+    find_db_params.setOutputDescFromMLDesc(dyDesc);
+    find_db_params.setInputDescFromMLDesc(xDesc);
+    find_db_params.setWeightDescFromMLDesc(dwDesc);
+    find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+    const auto recorded = GetImmediateRecordedAlgorithm(
+        handle, find_db_params, mode, GetBwdWeightsAlgorithmNames(), workSpaceSize);
+    if(!recorded.empty())
+        return static_cast<miopenConvBwdWeightsAlgorithm_t>(BwdWeightsAlgoResolver(recorded));
+
+    int wei_h, wei_w;
+    std::tie(std::ignore, std::ignore, wei_h, wei_w) = tien<4>(dwDesc.GetLengths());
+
+    if(mode == miopenConvolution && dilation_h == 1 && dilation_w == 1 && wei_w >= wei_h &&
+       !miopen::IsDisabled(MIOPEN_DEBUG_CONV_DIRECT{}) && IsBwdWeightsDirectSupported(dwDesc))
+    {
+        find_db_params.setStream(&handle);
+        if(!GetImmediateSolverId(FindAllSolutions(find_db_params), workSpaceSize).empty())
+            return miopenConvolutionBwdWeightsAlgoDirect;
+    }
+
+#if MIOPEN_USE_MIOPENGEMM
+    if(dyDesc.GetType() == miopenFloat)
+    {
+        const bool is_1x1 = wei_h == 1 && wei_w == 1 && u == 1 && v == 1 &&
+                            (mode == miopenTranspose || (pad_h == 0 && pad_w == 0));
+        const auto workspace_gemm =
+            mode == miopenTranspose ? BackwardWeightsGetWorkSpaceSizeGEMM(handle, xDesc, dwDesc)
+                                    : BackwardWeightsGetWorkSpaceSizeGEMM(handle, dyDesc, dwDesc);
+        if(is_1x1 || workSpaceSize >= workspace_gemm)
+            return miopenConvolutionBwdWeightsAlgoGEMM;
+    }
+#endif
+
+    MIOPEN_THROW("Bwd Weights Convolution cannot be executed due to incorrect params");
+}
+
+std::vector<PerfField>
+ConvolutionDescriptor::MeasureConvBwdWeightsAlgorithms(Handle& handle,
+                                                       const TensorDescriptor& dyDesc,
+                                                       ConstData_t dy,
+                                                       const TensorDescriptor& xDesc,
+                                                       ConstData_t x,
+                                                       const TensorDescriptor& dwDesc,
+                                                       Data_t workSpace,
+                                                       size_t workSpaceSize,
+                                                       bool exhaustiveSearch,
+                                                       const FindDbSelection& only,
+                                                       FindDbSolvers& solvers) const
+{
     // create a dummy buffer for use as output for the kernel calls
     // because kernels are called purely for timing purposes
     auto tmp_dw = handle.Create(dwDesc.GetElementSize() * GetTypeSize(dwDesc.GetType()));
@@ -2059,7 +2848,8 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
         std::tie(std::ignore, wei_n, wei_h, wei_w) = tien<4>(dwDesc.GetLengths());
 
 #if MIOPEN_USE_MIOPENGEMM
-        if(dyDesc.GetType() == miopenFloat)
+        if(dyDesc.GetType() == miopenFloat &&
+           only.IsAlgorithmAllowed("miopenConvolutionBwdWeightsAlgoGEMM"))
         {
             GemmGeometry gg =
                 CreateGemmGeometryConvBwdWeights(xDesc, dyDesc, dwDesc, false, network_config);
@@ -2117,7 +2907,8 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
         std::tie(wei_n, std::ignore, wei_h, wei_w) = tien<4>(dwDesc.GetLengths());
 
 #if MIOPEN_USE_MIOPENGEMM
-        if(dyDesc.GetType() == miopenFloat)
+        if(dyDesc.GetType() == miopenFloat &&
+           only.IsAlgorithmAllowed("miopenConvolutionBwdWeightsAlgoGEMM"))
         {
             GemmGeometry gg =
                 CreateGemmGeometryConvBwdWeights(dyDesc, xDesc, dwDesc, false, network_config);
@@ -2134,8 +2925,17 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
                 perf_db.push_back(PerfField{"miopenConvolutionBwdWeightsAlgoGEMM", time_gemm, 0});
             }
             // if not 1x1
-            else if(workSpace != nullptr && workSpaceSize >= workspace_req)
+            // gfx803 caps the workspace, so that even a single image may not fit
+            else if(workSpace != nullptr && workSpaceSize >= workspace_req &&
+                    BackwardWeightsGetGemmChunkSize(handle, dyDesc, dwDesc, workSpaceSize) > 0)
             {
+                // Batch as many images into one GEMM as the workspace allows
+                const int chunk =
+                    BackwardWeightsGetGemmChunkSize(handle, dyDesc, dwDesc, workSpaceSize);
+                gg = CreateGemmGeometryConvBwdWeights(
+                    dyDesc, xDesc, dwDesc, false, network_config, chunk);
+                workspace_req = BackwardWeightsGetWorkSpaceSizeGEMM(handle, dyDesc, dwDesc, chunk);
+
                 float time_im2col = 0;
                 size_t in_offset  = 0;
                 time_im2col       = Im2ColGPU(handle,
@@ -2155,11 +2955,53 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
                                         v,
                                         dilation_h,
                                         dilation_w,
-                                        workSpace);
+                                        workSpace,
+                                        chunk);
 
-                gg.FindSolution(.003, handle, workSpace, dy, tmp_dw.get(), false);
-                gg.RunGemm(handle, workSpace, dy, tmp_dw.get(), 0, 0, 0);
-                time_gemm = in_n * (time_im2col + handle.GetKernelTime());
+                if(chunk == 1)
+                {
+                    gg.FindSolution(.003, handle, workSpace, dy, tmp_dw.get(), false);
+                    gg.RunGemm(handle, workSpace, dy, tmp_dw.get(), 0, 0, 0);
+                    time_gemm = in_n * (time_im2col + handle.GetKernelTime());
+                }
+                else
+                {
+                    size_t col_size            = in_c * wei_h * wei_w * chunk * out_h * out_w;
+                    const float time_transpose = transpose_NCHW2CNHW(handle,
+                                                                     chunk,
+                                                                     wei_n,
+                                                                     out_h,
+                                                                     out_w,
+                                                                     out_h,
+                                                                     out_w,
+                                                                     dy,
+                                                                     workSpace,
+                                                                     0,
+                                                                     col_size,
+                                                                     1,
+                                                                     1);
+                    time_gemm = time_im2col + time_transpose;
+
+                    gg.FindSolution(.003, handle, workSpace, workSpace, tmp_dw.get(), false);
+                    gg.RunGemm(handle, workSpace, workSpace, tmp_dw.get(), 0, col_size, 0);
+                    time_gemm = (in_n / chunk) * (time_gemm + handle.GetKernelTime());
+
+                    // A smaller last chunk has a GEMM geometry of its own
+                    const int rest = in_n % chunk;
+                    if(rest != 0)
+                    {
+                        std::string rest_config;
+                        GemmGeometry rest_gg = CreateGemmGeometryConvBwdWeights(
+                            dyDesc, xDesc, dwDesc, false, rest_config, rest);
+                        col_size = in_c * wei_h * wei_w * rest * out_h * out_w;
+                        rest_gg.FindSolution(
+                            .003, handle, workSpace, workSpace, tmp_dw.get(), false);
+                        rest_gg.RunGemm(
+                            handle, workSpace, workSpace, tmp_dw.get(), 0, col_size, 0);
+                        time_gemm += handle.GetKernelTime() +
+                                     (time_im2col + time_transpose) * rest / chunk;
+                    }
+                }
                 perf_db.push_back(
                     PerfField{"miopenConvolutionBwdWeightsAlgoGEMM", time_gemm, workspace_req});
             }
@@ -2168,7 +3010,8 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
 
         if(dilation_h == 1 && dilation_w == 1)
         {
-            if(wei_w >= wei_h && !miopen::IsDisabled(MIOPEN_DEBUG_CONV_DIRECT{}) &&
+            if(only.IsAlgorithmAllowed("miopenConvolutionBwdWeightsAlgoDirect") &&
+               wei_w >= wei_h && !miopen::IsDisabled(MIOPEN_DEBUG_CONV_DIRECT{}) &&
                IsBwdWeightsDirectSupported(dwDesc))
             {
                 mlo_construct_BwdWrW2D construct_params(0); // backward with regards to weights
@@ -2189,6 +3032,8 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
                 visit_float(dyDesc.GetType(), [&](auto as_float) {
                     for(const auto& sol : all)
                     {
+                        if(!only.IsSolverAllowed(sol.solver_id))
+                            continue;
                         /// \todo If there is only one solution available,
                         /// we can avoid wasting time for building kernels with empty
                         /// algorithm_name and network_config.
@@ -2213,6 +3058,7 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
                 if(selected.Succeeded())
                 {
                     AddKernels(handle, algorithm_name, network_config, selected, nullptr);
+                    solvers[algorithm_name] = selected.solver_id;
                     MIOPEN_LOG_I("Selected: " << selected << ": " << best << ", workspce_sz = "
                                               << selected.workspce_sz);
                     perf_db.push_back(PerfField{algorithm_name, best, selected.workspce_sz});
@@ -2221,22 +3067,9 @@ void ConvolutionDescriptor::FindConvBwdWeightsAlgorithm(Handle& handle,
         }
     }
 
-    if(perf_db.empty())
-        MIOPEN_THROW("Bwd Weights Convolution cannot be executed due to incorrect params");
-
     // sort the perf_db
     std::sort(begin(perf_db), end(perf_db));
-
-    // update perfResults
-    *returnedAlgoCount = std::min(requestAlgoCount, static_cast<int>(perf_db.size()));
-
-    for(int i = 0; i < *returnedAlgoCount; i++)
-    {
-        perfResults[i].bwd_weights_algo =
-            static_cast<miopenConvBwdWeightsAlgorithm_t>(BwdWeightsAlgoResolver(perf_db[i].name));
-        perfResults[i].time   = perf_db[i].time;
-        perfResults[i].memory = perf_db[i].workspace;
-    }
+    return perf_db;
 }
 
 // BackwardWeightsAlgorithm()
@@ -2294,6 +3127,35 @@ void ConvolutionDescriptor::ConvolutionBackwardWeights(Handle& handle,
         }
     }
 
+    // Immediate mode: kernels are built on the first call if Find() was not run.
+    const auto build = [&](const std::string& algorithm,
+                           const boost::optional<std::string>& solver_id) {
+        mlo_construct_BwdWrW2D find_db_params(0); // backward with regards to weights
+        find_db_params.setOutputDescFromMLDesc(dyDesc);
+        find_db_params.setInputDescFromMLDesc(xDesc);
+        find_db_params.setWeightDescFromMLDesc(dwDesc);
+        find_db_params.setConvDescr(pad_h, pad_w, u, v, dilation_h, dilation_w);
+
+        BuildImmediate(handle,
+                       find_db_params,
+                       mode,
+                       algorithm,
+                       solver_id,
+                       [&](const FindDbSelection& only, FindDbSolvers& solvers) {
+                           return MeasureConvBwdWeightsAlgorithms(handle,
+                                                                  dyDesc,
+                                                                  dy,
+                                                                  xDesc,
+                                                                  x,
+                                                                  dwDesc,
+                                                                  workSpace,
+                                                                  workSpaceSize,
+                                                                  false,
+                                                                  only,
+                                                                  solvers);
+                       });
+    };
+
     int in_n, in_c, in_h, in_w;
     std::tie(in_n, in_c, in_h, in_w) = tien<4>(xDesc.GetLengths());
 
@@ -2317,23 +3179,49 @@ void ConvolutionDescriptor::ConvolutionBackwardWeights(Handle& handle,
 
             std::string network_config;
 
+            int chunk = 1;
             if(wei_h != 1 || wei_w != 1 || v != 1 || u != 1 || pad_h != 0 || pad_w != 0)
             {
                 assert(workSpace != nullptr &&
                        workSpaceSize >=
                            BackwardWeightsGetWorkSpaceSizeGEMM(handle, dyDesc, dwDesc));
+
+                // Batch as many images into one GEMM as the workspace allows
+                chunk = BackwardWeightsGetGemmChunkSize(handle, dyDesc, dwDesc, workSpaceSize);
+                if(chunk < 1)
+                    MIOPEN_THROW(miopenStatusBadParm,
+                                 "Workspace is too small for the GEMM convolution of an image");
             }
 
-            CreateGemmGeometryConvBwdWeights(dyDesc, xDesc, dwDesc, false, network_config);
-            GemmGeometry gg =
-                GetGemmGeometry(handle, "miopenConvolutionBwdWeightsAlgoGEMM", network_config);
+            CreateGemmGeometryConvBwdWeights(dyDesc, xDesc, dwDesc, false, network_config, chunk);
+            GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                       "miopenConvolutionBwdWeightsAlgoGEMM",
+                                                       "miopenConvolutionBwdWeightsAlgoGEMM",
+                                                       network_config,
+                                                       build);
+
+            // A smaller last chunk has a GEMM geometry of its own
+            GemmGeometry rest_gg = gg;
+            if(in_n % chunk != 0)
+            {
+                std::string rest_config;
+                CreateGemmGeometryConvBwdWeights(
+                    dyDesc, xDesc, dwDesc, false, rest_config, in_n % chunk);
+                rest_gg = GetImmediateGemmGeometry(handle,
+                                                   "miopenConvolutionBwdWeightsAlgoGEMM",
+                                                   "miopenConvolutionBwdWeightsAlgoGEMM",
+                                                   rest_config,
+                                                   build);
+            }
 
             handle.ResetKernelTime();
             float time_0 = 0;
             float t1     = 0;
-            for(int i = 0; i < in_n; i++)
+            for(int i = 0; i < in_n; i += chunk)
             {
-                int out_offset = i * wei_n * out_h * out_w;
+                const int images = std::min(chunk, in_n - i);
+                size_t col_size  = in_c * wei_h * wei_w * images * out_h * out_w;
+                int out_offset   = i * wei_n * out_h * out_w;
                 if(wei_h != 1 || wei_w != 1 || v != 1 || u != 1 || pad_h != 0 || pad_w != 0)
                 {
                     size_t in_offset = i * in_c * in_h * in_w;
@@ -2354,16 +3242,43 @@ void ConvolutionDescriptor::ConvolutionBackwardWeights(Handle& handle,
                               v,
                               dilation_h,
                               dilation_w,
-                              workSpace);
+                              workSpace,
+                              images);
                     if(handle.IsProfilingEnabled())
                         t1 = handle.GetKernelTime();
 
-                    gg.RunGemm(handle, workSpace, dy, dw, 0, out_offset, 0);
+                    if(chunk == 1)
+                    {
+                        gg.RunGemm(handle, workSpace, dy, dw, 0, out_offset, 0);
+                    }
+                    else
+                    {
+                        // The GEMM needs dy of the whole chunk as one K x (images*out_h*out_w)
+                        // matrix
+                        transpose_NCHW2CNHW(handle,
+                                            images,
+                                            wei_n,
+                                            out_h,
+                                            out_w,
+                                            out_h,
+                                            out_w,
+                                            dy,
+                                            workSpace,
+                                            out_offset,
+                                            col_size,
+                                            1,
+                                            1);
+                        if(handle.IsProfilingEnabled())
+                            t1 += handle.GetKernelTime();
 
-                    // Update times for both the kernels
+                        auto& chunk_gg = images == chunk ? gg : rest_gg;
+                        chunk_gg.RunGemm(handle, workSpace, workSpace, dw, 0, col_size, 0);
+                    }
+
+                    // Update times for all the kernels
                     if(handle.IsProfilingEnabled())
                     {
-                        if(i == in_n - 1)
+                        if(i + chunk >= in_n)
                             handle.AccumKernelTime(t1 + time_0);
                         else
                             handle.AccumKernelTime(t1);
@@ -2407,6 +3322,14 @@ void ConvolutionDescriptor::ConvolutionBackwardWeights(Handle& handle,
                     std::string network_config;
                     construct_params.mloBuildConf_Key(network_config);
 
+                    if(handle.GetKernels("miopenConvolutionBwdWeightsAlgoDirect", network_config)
+                           .empty())
+                    {
+                        build("miopenConvolutionBwdWeightsAlgoDirect",
+                              GetImmediateSolverId(FindAllSolutions(construct_params),
+                                                   workSpaceSize));
+                    }
+
                     auto&& kernels =
                         handle.GetKernels("miopenConvolutionBwdWeightsAlgoDirect", network_config);
                     if(kernels.empty())
@@ -2507,8 +3430,11 @@ void ConvolutionDescriptor::ConvolutionBackwardWeights(Handle& handle,
 
 #if MIOPEN_USE_MIOPENGEMM
         CreateGemmGeometryConvBwdWeights(xDesc, dyDesc, dwDesc, false, network_config);
-        GemmGeometry gg =
-            GetGemmGeometry(handle, "miopenConvolutionBwdWeightsAlgoGEMM", network_config);
+        GemmGeometry gg = GetImmediateGemmGeometry(handle,
+                                                   "miopenConvolutionBwdWeightsAlgoGEMM",
+                                                   "miopenConvolutionBwdWeightsAlgoGEMM",
+                                                   network_config,
+                                                   build);
 
         handle.ResetKernelTime();
         float time_0 = 0;
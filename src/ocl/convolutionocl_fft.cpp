@@ -373,6 +373,21 @@ int ConvolutionDescriptor::FindBwdFFTKernel(Handle& handle,
     return FindFFTKernel(handle, dyDesc, wDesc, dxDesc, workSpaceSize, kernels, false);
 }
 
+bool ConvolutionDescriptor::IsFFTKernelBuilt(Handle& handle,
+                                             const TensorDescriptor& xDesc,
+                                             const TensorDescriptor& yDesc) const
+{
+    int in_n, in_c, in_h, in_w;
+    std::tie(in_n, in_c, in_h, in_w) = miopen::tien<4>(xDesc.GetLengths());
+
+    int out_c;
+    std::tie(std::ignore, out_c, std::ignore, std::ignore) = miopen::tien<4>(yDesc.GetLengths());
+
+    // The first kernel is never skipped.
+    const std::string network_config = make_config_prefix(in_h, in_w, in_n, in_c, out_c) + "0";
+    return !handle.GetKernels("miopenConvolutionFwdAlgoFFT", network_config).empty();
+}
+
 static float ExecuteFFTKernel(Handle& handle,
                               const TensorDescriptor& xDesc,
                               ConstData_t x,
@@ -36,6 +36,7 @@
 #include <miopen/write_file.hpp>
 #include <miopen/kernel.hpp>
 #include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
 #include <sstream>
 
 #ifdef __linux__
@@ -196,6 +197,7 @@ static std::string CleanupPath(const char* p)
  */
 void AmdgcnAssemble(std::string& source, const std::string& params)
 {
+    MIOPEN_TRACE_SCOPE("compile", "AmdgcnAssemble " << params);
 #ifdef __linux__
     miopen::TempFile outfile("amdgcn-asm-out-XXXXXX");
 
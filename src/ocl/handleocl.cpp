@@ -30,6 +30,8 @@
 #include <miopen/kernel_cache.hpp>
 #include <miopen/manage_ptr.hpp>
 #include <miopen/ocldeviceinfo.hpp>
+#include <miopen/per_thread.hpp>
+#include <miopen/trace.hpp>
 #include <miopen/binary_cache.hpp>
 #include <miopen/load_file.hpp>
 #include <boost/filesystem.hpp>
@@ -37,6 +39,7 @@
 #if MIOPEN_USE_MIOPENGEMM
 #include <miopen/gemm_geometry.hpp>
 #endif
+#include <atomic>
 #include <string>
 
 #ifndef _WIN32
@@ -260,12 +263,21 @@ struct HandleImpl
                                           decltype(&clReleaseContext),
                                           &clReleaseContext>;
 
+    // Cached buffers go back to the allocator while the context is alive.
+    ~HandleImpl()
+    {
+        if(pool != nullptr)
+            pool->SetLimit(0);
+    }
+
     ContextPtr context;
     AqPtr queue;
+    PerThread<AqPtr> thread_queues;
     Allocator allocator{};
+    std::shared_ptr<AllocatorPool> pool;
     KernelCache cache;
-    bool enable_profiling  = false;
-    float profiling_result = 0.0;
+    std::atomic<bool> enable_profiling{false};
+    PerThread<float> profiling_result;
 
     ContextPtr create_context()
     {
@@ -332,8 +344,8 @@ struct HandleImpl
         clRetainContext(ctx);
         return ContextPtr{ctx};
     }
-    void ResetProfilingResult() { profiling_result = 0.0; }
-    void AccumProfilingResult(float curr_res) { profiling_result += curr_res; }
+    void ResetProfilingResult() { profiling_result.Get() = 0.0; }
+    void AccumProfilingResult(float curr_res) { profiling_result.Get() += curr_res; }
 
     void SetProfilingResult(cl_event& e)
     {
@@ -342,7 +354,7 @@ struct HandleImpl
             size_t st, end;
             clGetEventProfilingInfo(e, CL_PROFILING_COMMAND_START, sizeof(size_t), &st, nullptr);
             clGetEventProfilingInfo(e, CL_PROFILING_COMMAND_END, sizeof(size_t), &end, nullptr);
-            profiling_result = ((end - st) * 1e-6);
+            profiling_result.Get() = ((end - st) * 1e-6);
         }
     }
 };
@@ -445,7 +457,23 @@ void Handle::SetStream(miopenAcceleratorQueue_t streamID) const
     impl->queue = HandleImpl::AqPtr{streamID};
 }
 
-miopenAcceleratorQueue_t Handle::GetStream() const { return impl->queue.get(); }
+void Handle::SetThreadStream(miopenAcceleratorQueue_t streamID) const
+{
+    if(streamID == nullptr)
+    {
+        impl->thread_queues.Erase();
+        return;
+    }
+
+    clRetainCommandQueue(streamID);
+    impl->thread_queues.Get() = HandleImpl::AqPtr{streamID};
+}
+
+miopenAcceleratorQueue_t Handle::GetStream() const
+{
+    const auto thread_queue = impl->thread_queues.Find();
+    return thread_queue != nullptr ? thread_queue->get() : impl->queue.get();
+}
 
 void Handle::SetAllocator(miopenAllocatorFunction allocator,
                           miopenDeallocatorFunction deallocator,
@@ -460,6 +488,24 @@ void Handle::SetAllocator(miopenAllocatorFunction allocator,
 
     this->impl->allocator.context =
         allocatorContext == nullptr ? this->impl->context.get() : allocatorContext;
+
+    // Buffers still in use keep the previous pool, which frees them on release.
+    auto limit = AllocatorPool::GetDefaultLimit();
+    if(this->impl->pool != nullptr)
+    {
+        limit = this->impl->pool->GetLimit();
+        this->impl->pool->SetLimit(0);
+    }
+    this->impl->pool = std::make_shared<AllocatorPool>(this->impl->allocator, limit);
+}
+
+void Handle::SetAllocatorPoolLimit(std::size_t limit) const { this->impl->pool->SetLimit(limit); }
+
+void Handle::TrimAllocatorPool() const { this->impl->pool->Trim(); }
+
+AllocatorPoolStatistics Handle::GetAllocatorPoolStatistics() const
+{
+    return this->impl->pool->GetStatistics();
 }
 
 void Handle::EnableProfiling(bool enable) { this->impl->enable_profiling = enable; }
@@ -467,7 +513,7 @@ void Handle::EnableProfiling(bool enable) { this->impl->enable_profiling = enabl
 void Handle::ResetKernelTime() { this->impl->ResetProfilingResult(); }
 void Handle::AccumKernelTime(float curr_time) { this->impl->AccumProfilingResult(curr_time); }
 
-float Handle::GetKernelTime() const { return this->impl->profiling_result; }
+float Handle::GetKernelTime() const { return this->impl->profiling_result.Get(); }
 
 KernelInvoke Handle::AddKernel(const std::string& algorithm,
                                const std::string& network_config,
@@ -490,8 +536,8 @@ void Handle::ClearKernels(const std::string& algorithm, const std::string& netwo
     this->impl->cache.ClearKernels(algorithm, network_config);
 }
 
-const std::vector<Kernel>& Handle::GetKernelsImpl(const std::string& algorithm,
-                                                  const std::string& network_config)
+std::vector<Kernel> Handle::GetKernelsImpl(const std::string& algorithm,
+                                           const std::string& network_config)
 {
     return this->impl->cache.GetKernels(algorithm, network_config);
 }
@@ -501,10 +547,20 @@ KernelInvoke Handle::Run(Kernel k)
     auto q = this->GetStream();
     if(this->impl->enable_profiling || MIOPEN_GPU_SYNC)
     {
+#if MIOPEN_ENABLE_TRACE
+        // The kernel name is only needed by the tracer.
+        auto* impl_ptr = this->impl.get();
+        return k.Invoke(q, [impl_ptr, kernel_name = k.GetName()](cl_event& e) {
+            impl_ptr->SetProfilingResult(e);
+            if(impl_ptr->enable_profiling)
+                MIOPEN_TRACE_KERNEL(kernel_name, impl_ptr->profiling_result.Get());
+        });
+#else
         return k.Invoke(q,
                         std::bind(&HandleImpl::SetProfilingResult,
                                   std::ref(*this->impl),
                                   std::placeholders::_1));
+#endif
     }
     else
     {
@@ -514,10 +570,12 @@ KernelInvoke Handle::Run(Kernel k)
 
 Program Handle::LoadProgram(const std::string& program_name, std::string params, bool is_kernel_str)
 {
+    MIOPEN_TRACE_SCOPE("compile", "Handle::LoadProgram " << program_name);
     auto cache_file =
         miopen::LoadBinary(this->GetDeviceName(), program_name, params, is_kernel_str);
     if(cache_file.empty())
     {
+        MIOPEN_TRACE_SCOPE("compile", "Compile " << program_name << ' ' << params);
         auto p = miopen::LoadProgram(miopen::GetContext(this->GetStream()),
                                      miopen::GetDevice(this->GetStream()),
                                      program_name,
@@ -534,6 +592,7 @@ Program Handle::LoadProgram(const std::string& program_name, std::string params,
     }
     else
     {
+        MIOPEN_TRACE_SCOPE("compile", "Load binary " << cache_file);
         return LoadBinaryProgram(miopen::GetContext(this->GetStream()),
                                  miopen::GetDevice(this->GetStream()),
                                  miopen::LoadFile(cache_file));
@@ -566,7 +625,7 @@ Allocator::ManageDataPtr Handle::Create(std::size_t sz)
 {
     MIOPEN_HANDLE_LOCK
     this->Finish();
-    return this->impl->allocator(sz);
+    return this->impl->pool->Allocate(sz);
 }
 
 Allocator::ManageDataPtr&
@@ -33,8 +33,14 @@
 #include <numeric>
 #include <algorithm>
 
+#if MIOPEN_USE_MIOPENGEMM || MIOPEN_BACKEND_CPU
 #if MIOPEN_USE_MIOPENGEMM
 #include <miopen/gemm.hpp>
+#else
+#include <miopen/gemm_host.hpp>
+#include <miopen/host_timer.hpp>
+#include <miopen/rnn_host.hpp>
+#endif
 
 //#define MIO_RNN_OCL_DEBUG 1
 #define MIO_RNN_FINDSOL_TIMEOUT 0.003
@@ -42,6 +48,50 @@
 
 namespace miopen {
 
+#if MIOPEN_BACKEND_CPU
+namespace {
+
+/// The forward pass on the host, all time steps of a layer multiplied with its input weights at
+/// once. reserveSpace is null for inference.
+void RNNForwardHost(const RNNDescriptor& rnn,
+                    const std::vector<int>& in_n,
+                    int in_h,
+                    int hy_h,
+                    int hy_n,
+                    ConstData_t x,
+                    ConstData_t hx,
+                    ConstData_t cx,
+                    const TensorDescriptor& wDesc,
+                    ConstData_t w,
+                    Data_t y,
+                    Data_t hy,
+                    Data_t cy,
+                    Data_t reserveSpace)
+{
+    if(wDesc.GetType() != miopenFloat)
+        MIOPEN_THROW(miopenStatusNotImplemented, "The CPU backend runs float RNNs only");
+    const host::RNNForward forward{rnn.rnnMode,
+                                   static_cast<int>(rnn.nLayers),
+                                   hy_h,
+                                   in_h,
+                                   rnn.dirMode != 0u,
+                                   rnn.biasMode != 0u,
+                                   rnn.inputMode == miopenRNNskip,
+                                   static_cast<const float*>(w)};
+    forward.Run(in_n,
+                hy_n,
+                static_cast<const float*>(x),
+                static_cast<const float*>(hx),
+                rnn.rnnMode == miopenLSTM ? static_cast<const float*>(cx) : nullptr,
+                static_cast<float*>(y),
+                static_cast<float*>(hy),
+                rnn.rnnMode == miopenLSTM ? static_cast<float*>(cy) : nullptr,
+                static_cast<float*>(reserveSpace));
+}
+
+} // namespace
+#endif
+
 // Assuming sequence length is set to > 0 otherwise throw exception.
 void RNNDescriptor::RNNForwardInference(Handle& handle,
                                         const int seqLen,
@@ -128,6 +178,14 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
         MIOPEN_THROW(miopenStatusBadParm, "Output size doesn't match hidden state size!");
     }
 
+#if MIOPEN_BACKEND_CPU
+    {
+        HostKernelTimer timer{handle, "miopenRNNForwardInference"};
+        RNNForwardHost(*this, in_n, in_h, hy_h, hy_n, x, hx, cx, wDesc, w, y, hy, cy, nullptr);
+    }
+    (void)workSpace;
+#else
+
     float ctime    = 0.;
     int in_stride  = in_h;
     int hy_stride  = hy_h * bi * workspaceScale;
@@ -194,7 +252,7 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
     hx_stride[0] = in_n.at(0) * uni_stride;
     hx_stride[1] = uni_stride;
 
-#if MIOPEN_USE_MIOPENGEMM
+#if MIOPEN_USE_MIOPENGEMM || MIOPEN_BACKEND_CPU
 
     int wei_shift, prelayer_shift;
     int wei_len = 0;
@@ -1137,6 +1195,7 @@ void RNNDescriptor::RNNForwardInference(Handle& handle,
     (void)wei_shift_bias;
     MIOPEN_THROW("GEMM is not supported");
 #endif
+#endif // MIOPEN_BACKEND_CPU
 }
 
 void RNNDescriptor::RNNForwardTraining(Handle& handle,
@@ -1231,6 +1290,14 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
         MIOPEN_THROW(miopenStatusBadParm, "Output size doesn't match hidden state size!");
     }
 
+#if MIOPEN_BACKEND_CPU
+    {
+        HostKernelTimer timer{handle, "miopenRNNForwardTraining"};
+        RNNForwardHost(
+            *this, in_n, in_h, hy_h, hy_n, x, hx, cx, wDesc, w, y, hy, cy, reserveSpace);
+    }
+#else
+
     float ctime    = 0.;
     int in_stride  = in_h;
     int hy_stride  = hy_h * bi * workspaceScale;
@@ -1297,7 +1364,7 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
     hx_stride[0] = in_n.at(0) * uni_stride;
     hx_stride[1] = uni_stride;
 
-#if MIOPEN_USE_MIOPENGEMM
+#if MIOPEN_USE_MIOPENGEMM || MIOPEN_BACKEND_CPU
 
     int wei_shift, prelayer_shift;
     int wei_len = 0;
@@ -2257,6 +2324,7 @@ void RNNDescriptor::RNNForwardTraining(Handle& handle,
     (void)wei_shift_bias;
     MIOPEN_THROW("GEMM is not supported");
 #endif
+#endif // MIOPEN_BACKEND_CPU
 };
 
 void RNNDescriptor::RNNBackwardData(Handle& handle,
@@ -2430,7 +2498,7 @@ void RNNDescriptor::RNNBackwardData(Handle& handle,
     hx_stride[0] = in_n.at(0) * uni_stride;
     hx_stride[1] = uni_stride;
 
-#if MIOPEN_USE_MIOPENGEMM
+#if MIOPEN_USE_MIOPENGEMM || MIOPEN_BACKEND_CPU
 
     int prelayer_shift, pretime_shift, cur_time, cur_batch;
     int wei_len    = 0;
@@ -3699,7 +3767,7 @@ void RNNDescriptor::RNNBackwardWeights(Handle& handle,
     w_stride[1] = wei_stride;
     w_size[2]   = 1;
 
-#if MIOPEN_USE_MIOPENGEMM
+#if MIOPEN_USE_MIOPENGEMM || MIOPEN_BACKEND_CPU
 
     int wei_len   = 0;
     int hid_off   = 0;
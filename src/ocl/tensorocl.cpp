@@ -81,8 +81,8 @@ TensorDescriptor GetFlattenedTensorDescriptor(const TensorDescriptor& desc)
 
 // Free Tensor Functions
 static void CreateBitmapAndGrid(unsigned int& bitmap,
-                                std::vector<std::size_t>& a_lens,
-                                std::vector<std::size_t>& c_lens,
+                                const TensorDims& a_lens,
+                                const TensorDims& c_lens,
                                 int& num_wg,
                                 int& work,
                                 int d)
@@ -50,7 +50,8 @@ float Im2ColGPU(Handle& handle,
                 const int stride_w,
                 const int dilation_h,
                 const int dilation_w,
-                Data_t col)
+                Data_t col,
+                const int col_batch)
 {
     std::string program_name = "MIOpenUtilKernels.cl";
     std::string kernel_name  = "Im2Col";
@@ -59,7 +60,8 @@ float Im2ColGPU(Handle& handle,
                                  std::to_string(wei_h) + std::to_string(wei_w) +
                                  std::to_string(pad_h) + std::to_string(pad_w) +
                                  std::to_string(stride_h) + std::to_string(stride_w) +
-                                 std::to_string(dilation_h) + std::to_string(dilation_w);
+                                 std::to_string(dilation_h) + std::to_string(dilation_w) +
+                                 "b" + std::to_string(col_batch);
 
     auto&& kernels = handle.GetKernels("miopenIm2Col", network_config);
 
@@ -120,10 +122,12 @@ float Im2ColGPU(Handle& handle,
         params += " -DTILE_SZ_X=" + std::to_string(tile_sz_x);
         params += " -DTILE_SZ_Y=" + std::to_string(tile_sz_y);
         params += " -DUSE_IM_OFF_GUARD=1 -DMIOPEN_USE_FP16=0 -DMIOPEN_USE_FP32=1";
+        params += " -DCOL_BATCH=" + std::to_string(col_batch);
+        params += " -DIM_BATCH_STRIDE=" + std::to_string(c * h * w);
 
         const std::vector<size_t> vld{256, 1, 1};
         size_t global_threads = 256 * std::max(1, (c / num_ch_per_wg)) * num_blks;
-        const std::vector<size_t> vgd{global_threads, 1, 1};
+        const std::vector<size_t> vgd{global_threads, static_cast<size_t>(col_batch), 1};
 
         handle.AddKernel(
             "miopenIm2Col", network_config, program_name, kernel_name, vld, vgd, params)(
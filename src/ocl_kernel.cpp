@@ -106,7 +106,7 @@ OCLKernelInvoke OCLKernel::Invoke(cl_command_queue q, std::function<void(cl_even
 #ifndef NDEBUG
     MIOPEN_LOG_I(GetName());
 #endif
-    OCLKernelInvoke result{q, kernel, gdims.size(), {}, {}, {}, callback};
+    OCLKernelInvoke result{q, kernel, gdims.size(), {}, {}, {}, callback, args_mutex};
     std::copy(gdims.begin(), gdims.end(), result.global_work_dim.begin());
     std::copy(ldims.begin(), ldims.end(), result.local_work_dim.begin());
     return result;
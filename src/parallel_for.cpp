@@ -0,0 +1,191 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/env.hpp>
+#include <miopen/parallel_for.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_CPU_THREADS)
+
+namespace {
+
+thread_local bool in_parallel_for = false;
+
+class ThreadPool
+{
+    public:
+    static ThreadPool& Get()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    ThreadPool()
+    {
+        std::size_t n = Value(MIOPEN_CPU_THREADS{});
+        if(n == 0)
+            n = std::max(std::thread::hardware_concurrency(), 1u);
+        for(std::size_t i = 1; i < n; i++)
+            workers.emplace_back([this] { Loop(); });
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wake.notify_all();
+        for(auto& worker : workers)
+            worker.join();
+    }
+
+    std::size_t Size() const { return workers.size() + 1; }
+
+    void
+    Run(std::size_t n, std::size_t grain, const std::function<void(std::size_t, std::size_t)>& f)
+    {
+        // A nested call runs on a thread which may hold run_mutex already, so it must not try
+        // to lock it again.
+        if(in_parallel_for || workers.empty() || n <= grain)
+        {
+            Serial(n, grain, f);
+            return;
+        }
+        std::unique_lock<std::mutex> run_lock(run_mutex, std::try_to_lock);
+        if(!run_lock)
+        {
+            Serial(n, grain, f);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job       = &f;
+            job_size  = n;
+            job_grain = grain;
+            next      = 0;
+            pending   = workers.size();
+            error     = nullptr;
+            generation++;
+        }
+        wake.notify_all();
+
+        in_parallel_for = true;
+        Work();
+        in_parallel_for = false;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&] { return pending == 0; });
+        job = nullptr;
+        if(error)
+            std::rethrow_exception(error);
+    }
+
+    private:
+    static void Serial(std::size_t n,
+                       std::size_t grain,
+                       const std::function<void(std::size_t, std::size_t)>& f)
+    {
+        for(std::size_t begin = 0; begin < n; begin += grain)
+            f(begin, std::min(n, begin + grain));
+    }
+
+    void Work()
+    {
+        for(;;)
+        {
+            const auto begin = next.fetch_add(job_grain);
+            if(begin >= job_size)
+                return;
+            try
+            {
+                (*job)(begin, std::min(job_size, begin + job_grain));
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!error)
+                    error = std::current_exception();
+            }
+        }
+    }
+
+    void Loop()
+    {
+        in_parallel_for  = true;
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for(;;)
+        {
+            wake.wait(lock, [&] { return stop || generation != seen; });
+            if(stop)
+                return;
+            seen = generation;
+            lock.unlock();
+            Work();
+            lock.lock();
+            if(--pending == 0)
+                done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex run_mutex;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(std::size_t, std::size_t)>* job = nullptr;
+    std::size_t job_size                                      = 0;
+    std::size_t job_grain                                     = 1;
+    std::atomic<std::size_t> next{0};
+    std::size_t pending    = 0;
+    std::size_t generation = 0;
+    std::exception_ptr error;
+    bool stop = false;
+};
+
+} // namespace
+
+std::size_t ParallelForThreads() { return ThreadPool::Get().Size(); }
+
+void ParallelFor(std::size_t n,
+                 std::size_t grain,
+                 const std::function<void(std::size_t begin, std::size_t end)>& f)
+{
+    ThreadPool::Get().Run(n, std::max<std::size_t>(grain, 1), f);
+}
+
+} // namespace miopen
@@ -0,0 +1,162 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/perf_predictor.hpp>
+#include <miopen/env.hpp>
+#include <miopen/handle.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/mlo_internal.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <utility>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_PERF_PREDICTOR)
+
+bool ParsePerfDbKey(const std::string& key, PerfPredictorKey& result)
+{
+    // 576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F
+    std::vector<std::string> fields;
+    std::istringstream ss(key);
+    std::string field;
+    while(std::getline(ss, field, '-'))
+        fields.push_back(field);
+    if(fields.size() != 15)
+        return false;
+
+    const std::size_t feature_idx[] = {0, 1, 2, 4, 7}; // C, H, W, K, N
+    for(std::size_t i = 0; i < result.features.size(); ++i)
+    {
+        const auto& f = fields[feature_idx[i]];
+        char* end     = nullptr;
+        const auto v  = std::strtol(f.c_str(), &end, 10);
+        if(f.empty() || *end != '\0' || v <= 0)
+            return false;
+        result.features[i] = static_cast<int>(v);
+    }
+
+    const std::size_t signature_idx[] = {3, 8, 9, 10, 11, 12, 13, 14};
+    result.signature.clear();
+    for(const auto i : signature_idx)
+    {
+        if(!result.signature.empty())
+            result.signature += '-';
+        result.signature += fields[i];
+    }
+    return true;
+}
+
+double PerfPredictorDistance(const PerfPredictorFeatures& lhs, const PerfPredictorFeatures& rhs)
+{
+    double distance = 0.0;
+    for(std::size_t i = 0; i < lhs.size(); ++i)
+        distance += std::abs(std::log2(static_cast<double>(lhs[i])) -
+                             std::log2(static_cast<double>(rhs[i])));
+    return distance;
+}
+
+static std::string GetArch(const std::string& device) { return device.substr(0, device.find('_')); }
+
+std::vector<std::string> PredictPerformanceConfigs(const PerfPredictorRecord* records,
+                                                   const std::size_t n_records,
+                                                   const std::string& device,
+                                                   const std::string& solver_id,
+                                                   const PerfPredictorKey& key,
+                                                   const std::size_t max_n)
+{
+    const auto less = [](const PerfPredictorRecord& r, const PerfPredictorRecord& s) {
+        int c = std::strcmp(r.device, s.device);
+        if(c == 0)
+            c = std::strcmp(r.solver, s.solver);
+        if(c == 0)
+            c = std::strcmp(r.signature, s.signature);
+        return c < 0;
+    };
+    PerfPredictorRecord probe{};
+    probe.device    = device.c_str();
+    probe.solver    = solver_id.c_str();
+    probe.signature = key.signature.c_str();
+
+    std::vector<const PerfPredictorRecord*> candidates;
+    const auto end   = records + n_records;
+    const auto range = std::equal_range(records, end, probe, less);
+    for(auto it = range.first; it != range.second; ++it)
+        candidates.push_back(it);
+
+    if(candidates.empty())
+    {
+        const auto arch = GetArch(device);
+        for(auto it = records; it != end; ++it)
+            if(GetArch(it->device) == arch && solver_id == it->solver &&
+               key.signature == it->signature)
+                candidates.push_back(it);
+    }
+
+    std::vector<std::pair<double, const PerfPredictorRecord*>> sorted;
+    sorted.reserve(candidates.size());
+    for(const auto c : candidates)
+        sorted.emplace_back(PerfPredictorDistance(key.features, c->features), c);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const auto& l, const auto& r) {
+        return l.first < r.first;
+    });
+
+    std::vector<std::string> result;
+    for(const auto& s : sorted)
+    {
+        if(result.size() >= max_n)
+            break;
+        if(std::find(result.begin(), result.end(), s.second->values) == result.end())
+            result.emplace_back(s.second->values);
+    }
+    return result;
+}
+
+std::vector<std::string> PredictPerformanceConfigs(const ConvolutionContext& context,
+                                                   const std::string& solver_id)
+{
+    if(miopen::IsDisabled(MIOPEN_DEBUG_PERF_PREDICTOR{}))
+        return {};
+
+    std::ostringstream ss;
+    context.Serialize(ss);
+    PerfPredictorKey key;
+    if(!ParsePerfDbKey(ss.str(), key))
+        return {};
+
+    std::size_t n_records = 0;
+    const auto records    = GetPerfPredictorRecords(n_records);
+    const auto device     = context.GetStream().GetDeviceName() + "_" +
+                        std::to_string(context.GetStream().GetMaxComputeUnits());
+    const std::size_t max_n = 3;
+    return PredictPerformanceConfigs(records, n_records, device, solver_id, key, max_n);
+}
+
+} // namespace miopen
@@ -0,0 +1,8380 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+// Generated by perfdbfit from the installed perf dbs. Do not edit.
+#include <miopen/perf_predictor.hpp>
+
+namespace miopen {
+
+// clang-format off
+static const PerfPredictorRecord perf_predictor_records[] = {
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 64}}, "8,0,8,2,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 64}}, "7,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "7,1,16,4,3,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 16}}, "0,1,16,1,1,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 16}}, "6,0,16,2,2,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 16}}, "4,0,16,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 8}}, "9,0,16,2,2,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 8}}, "8,0,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 8}}, "0,0,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 8}}, "6,0,8,4,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 8}}, "6,1,16,1,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 8}}, "3,1,16,4,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 8}}, "3,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "9,1,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 8}}, "9,1,8,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "8,0,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 16}}, "5,1,16,1,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 16}}, "5,0,16,4,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 16}}, "9,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "8,1,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 16}}, "8,1,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "0,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 8}}, "8,0,16,2,4,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 8}}, "7,0,8,2,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "6,0,8,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "5,0,16,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "6,0,8,2,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "9,0,8,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 16}}, "8,0,16,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 16}}, "3,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 16}}, "0,0,8,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 1}}, "1,1,16,1,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 1}}, "7,0,16,1,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 1}}, "0,0,16,1,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 1}}, "9,0,16,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 1}}, "5,0,16,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 1}}, "9,0,8,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 1}}, "8,0,8,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 1}}, "4,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 1}}, "4,1,16,1,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 1}}, "9,0,16,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 1}}, "4,0,8,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "6,1,8,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 1}}, "8,0,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "6,0,8,2,6,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 2}}, "2,1,16,1,3,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 2}}, "6,0,16,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 2}}, "3,1,8,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "8,1,8,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 2}}, "6,1,8,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "6,0,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 1}}, "5,0,16,1,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 1}}, "8,0,8,1,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 1}}, "9,0,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 2}}, "9,0,16,1,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 2}}, "6,0,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 2}}, "7,1,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 1}}, "4,0,16,2,1,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 1}}, "2,1,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 1}}, "9,1,16,2,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 1}}, "3,1,8,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 2}}, "3,0,16,2,1,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 2}}, "2,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 2}}, "8,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 2}}, "5,1,8,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 32}}, "9,0,16,4,3,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "8,0,8,2,3,3"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 96, 32}}, "0,0,8,2,6,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 96, 32}}, "8,0,8,4,5,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "4,0,8,2,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 160, 32}}, "5,0,8,2,14,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 160, 32}}, "3,0,8,4,3,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 192, 32}}, "5,1,8,4,9,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 192, 32}}, "9,0,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 192, 32}}, "5,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 224, 32}}, "9,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 192, 32}}, "0,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 147, 147, 32, 32}}, "9,1,16,4,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 64, 32}}, "3,0,8,2,3,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 96, 32}}, "2,0,8,2,3,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 448, 32}}, "8,1,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 64, 128, 96, 1}}, "6,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 64, 128, 112, 1}}, "2,1,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 128, 1}}, "3,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 64, 128, 144, 1}}, "5,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 64, 128, 160, 1}}, "7,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 64, 128, 192, 1}}, "0,1,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 32}}, "7,0,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "0,1,16,4,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 32}}, "7,0,8,2,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 32}}, "6,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "9,1,16,4,3,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 128}}, "5,1,16,4,3,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 128}}, "0,0,8,4,4,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 128}}, "8,0,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 128}}, "7,0,8,2,14,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 128}}, "6,0,8,2,13,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 128}}, "9,0,8,2,14,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 128}}, "6,0,8,4,9,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 128}}, "3,0,8,4,6,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 160, 128}}, "5,1,8,2,7,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 192, 128}}, "5,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 32}}, "7,0,8,4,2,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 32}}, "0,0,8,2,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 32}}, "6,0,8,4,6,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 32}}, "7,1,8,2,14,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 32}}, "5,0,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 32}}, "5,1,8,4,4,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 32}}, "6,0,8,4,8,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 128}}, "6,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 128}}, "9,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 128}}, "0,1,16,4,9,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 64}}, "9,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 64}}, "6,1,16,4,9,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 64}}, "0,0,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 50}}, "9,0,16,4,9,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 50}}, "7,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 256}}, "8,0,16,4,9,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 256}}, "5,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 256}}, "7,0,16,4,9,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 64}}, "0,1,16,1,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 64}}, "9,1,16,4,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 64}}, "7,0,16,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 64}}, "8,0,16,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 64}}, "3,0,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 64}}, "9,0,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 32}}, "3,1,16,1,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 32}}, "6,0,16,4,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 32}}, "5,0,16,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 32}}, "4,1,16,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "4,1,8,2,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 32}}, "5,0,8,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 32}}, "7,1,8,4,4,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 16}}, "4,1,16,2,2,8"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "4,0,8,4,2,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 64}}, "4,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 64}}, "0,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 50}}, "9,1,16,4,10,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 35, 35, 192, 32}}, "2,1,8,4,3,4"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 16}}, "9,0,16,4,2,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 160, 32}}, "5,1,8,2,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 16}}, "8,0,16,4,3,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 16}}, "6,0,8,4,5,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 16}}, "4,0,8,8,8,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 16}}, "0,0,8,4,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{96, 14, 14, 96, 32}}, "6,0,16,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{192, 7, 7, 128, 32}}, "4,0,8,4,5,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 32}}, "3,0,8,8,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "1,0,8,4,4,2"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "7,0,8,4,5,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 32}}, "4,0,8,4,7,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 64}}, "7,0,8,4,3,1"},
+    {"gfx803_36", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 64}}, "6,0,8,8,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "11x11-0x0-4x4-1x1-0-NCHW-FP32-B", {{96, 55, 55, 3, 64}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 147, 147, 32, 32}}, "8,16,16,32,2,1,8,1,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 71, 71, 80, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 71, 71, 64, 32}}, "16,16,16,16,4,4,2,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{32, 149, 149, 32, 32}}, "8,16,16,32,1,2,8,2,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{80, 73, 73, 192, 32}}, "16,16,16,16,4,2,4,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 149, 149, 3, 32}}, "8,16,32,32,1,4,2,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 16}}, "8,16,16,32,2,1,1,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 8}}, "16,16,16,32,4,1,2,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 16}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 1}}, "8,16,16,32,1,2,1,1,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 1}}, "8,16,32,32,4,1,2,2,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 2}}, "16,16,16,16,2,1,2,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 16}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 1}}, "8,16,16,32,1,2,8,1,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 2}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 16}}, "8,16,16,32,2,1,8,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "3x3-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 54, 54, 3, 8}}, "8,16,16,16,1,1,2,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 4}}, "8,16,32,32,4,1,1,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 8}}, "8,16,32,32,1,4,1,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 16}}, "8,16,32,32,4,1,1,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 80, 349, 1, 16}}, "16,16,16,32,1,4,1,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 48, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 16}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 50}}, "8,16,32,32,4,1,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 128}}, "16,16,16,16,2,2,2,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 24, 128}}, "16,16,16,16,4,4,1,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 128}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 128}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 128}}, "16,16,8,8,2,2,1,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 32}}, "16,16,16,16,4,1,2,1,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 32}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 32}}, "8,8,8,8,2,1,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 32}}, "8,8,8,8,2,1,1,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{48, 35, 35, 64, 32}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 16}}, "16,16,16,16,4,4,1,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 48, 16}}, "16,16,16,16,4,1,1,4,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 16}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 50}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 128}}, "8,8,16,16,1,1,8,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{24, 14, 14, 64, 128}}, "8,8,16,16,1,1,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 128}}, "8,16,32,32,1,4,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 128}}, "16,16,8,8,2,4,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 32}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 128, 32}}, "8,8,16,16,1,1,4,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 64, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 32}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 32}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 64}}, "8,16,32,32,2,2,2,1,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,16,16,1,4,1,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx803_36", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "8,16,32,32,1,4,2,2,1"},
+    {"gfx803_36", "ConvOclDirectFwd", "7x7-3x3-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "16,16,16,32,1,4,1,2,2"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,128,1,1,0,4,16,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 16}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 64}}, "1,64,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 256, 512, 64, 1}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 192, 1}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 128, 256, 192, 1}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 128, 256, 256, 1}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 256, 1}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 64, 128, 480, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 64, 128, 480, 1}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 64, 128, 512, 1}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 64, 128, 528, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 528, 1}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 832, 1}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{19, 64, 128, 1024, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 128}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 832, 128}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 128}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1280, 64}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 8}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 256, 1}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 64, 128, 480, 1}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 512, 1}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "1,8,1,1,1,1,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "1,128,1,1,0,1,16,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 32}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 32}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "1,8,1,1,1,0,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "1,8,1,1,1,1,32,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "1,8,1,1,1,0,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "1,8,1,1,1,1,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "1,8,1,1,1,1,32,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 2}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 2}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "1,8,1,1,1,1,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 2}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 32}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 64}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 64}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 256, 512, 64, 1}}, "1,8,1,1,1,0,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 64, 1}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 128, 1}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 32, 1}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 64, 1}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 192, 1}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 96, 1}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 16, 1}}, "1,8,1,1,1,4,32,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 64, 1}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 160, 1}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 112, 1}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 128, 128, 24, 1}}, "1,64,1,1,0,4,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 64, 1}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 128, 1}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 24, 1}}, "1,64,1,1,0,2,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 144, 1}}, "1,8,1,1,1,1,64,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 32, 1}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 256, 1}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 32, 1}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 256, 1}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 32, 1}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 48, 1}}, "1,8,1,1,1,1,32,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 64, 128, 19, 1}}, "1,64,1,1,0,4,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,8,1,1,1,1,32,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,8,1,1,1,1,32,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,8,1,1,1,0,32,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 128}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 128}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 160, 128}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 128}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "1,8,1,1,1,1,32,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 192, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 64}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 32, 1}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 8}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 8}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 8}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 8}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 1}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "1,8,1,1,1,4,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 32}}, "1,8,1,1,1,0,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,8,1,1,1,4,32,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,8,1,1,1,1,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "1,8,1,1,1,1,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "1,8,1,1,1,0,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 2}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 1}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "1,8,1,1,1,4,16,128,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,8,1,1,1,0,32,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 2}}, "1,8,1,1,1,4,16,64,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "1,8,1,1,1,0,32,2048,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_36", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 16}}, "1,8,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 16}}, "8,2,8,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 16}}, "8,4,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "4,4,2,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "8,2,8,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "16,2,4,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 8}}, "1,4,1,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 8}}, "2,4,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 8}}, "2,4,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 8}}, "4,4,2,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 8}}, "4,4,4,2,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 8}}, "16,2,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 8}}, "8,4,2,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 8}}, "16,8,4,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 8}}, "16,4,2,16,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 16}}, "1,8,1,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 16}}, "2,8,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 16}}, "8,8,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 16}}, "8,8,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 16}}, "16,4,4,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 16}}, "16,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 1}}, "4,2,2,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 1}}, "16,1,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 1}}, "16,1,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 2}}, "8,2,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 2}}, "16,2,4,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 1}}, "8,2,4,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "16,4,4,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 1}}, "1,4,1,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 1}}, "2,4,2,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 1}}, "2,4,2,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 1}}, "4,8,2,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 1}}, "4,8,2,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 1}}, "16,4,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 1}}, "16,1,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 1}}, "16,4,2,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 1}}, "16,2,2,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 2}}, "1,8,1,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 2}}, "2,4,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 2}}, "2,4,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 2}}, "4,4,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 2}}, "4,4,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 2}}, "16,2,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 2}}, "16,2,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 2}}, "16,4,2,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 2}}, "16,2,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "1,4,1,2,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 32}}, "1,8,1,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 32}}, "2,4,2,2,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 32}}, "2,8,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 32}}, "1,8,1,16,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 576, 32}}, "4,8,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 32}}, "2,8,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 576, 32}}, "2,8,2,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 576, 32}}, "8,2,4,2,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 608, 32}}, "4,8,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 608, 32}}, "8,1,8,2,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 32}}, "8,4,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 32}}, "4,2,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1024, 32}}, "16,2,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 32}}, "8,4,8,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 32}}, "8,4,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "1,4,1,2,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 64}}, "1,8,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 64}}, "1,8,1,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 64}}, "2,4,2,2,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 64}}, "2,8,2,8,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 64}}, "1,8,1,16,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 64}}, "2,8,2,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 576, 64}}, "2,8,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 576, 64}}, "8,2,2,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 576, 64}}, "4,8,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 64}}, "4,8,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 608, 64}}, "4,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 608, 64}}, "8,1,4,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 64}}, "8,4,4,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 64}}, "8,4,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 64}}, "4,2,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1024, 64}}, "16,2,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 64}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 64}}, "8,4,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 256, 512, 64, 1}}, "1,8,1,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 192, 1}}, "1,8,1,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 128, 256, 192, 1}}, "1,8,1,16,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 192, 1}}, "1,8,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 128, 256, 256, 1}}, "2,8,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 256, 1}}, "1,8,1,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 256, 1}}, "2,4,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 480, 1}}, "4,4,4,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 64, 128, 480, 1}}, "4,4,4,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 64, 128, 480, 1}}, "2,1,1,16,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 480, 1}}, "1,8,1,8,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 512, 1}}, "8,2,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 64, 128, 512, 1}}, "8,2,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 128, 128, 512, 1}}, "4,1,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 512, 1}}, "4,4,4,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 512, 1}}, "4,8,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 64, 128, 512, 1}}, "4,1,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 512, 1}}, "4,4,2,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 528, 1}}, "8,2,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 528, 1}}, "4,4,2,16,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 528, 1}}, "4,1,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 528, 1}}, "4,4,2,16,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 832, 1}}, "8,2,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 832, 1}}, "8,2,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 832, 1}}, "4,4,2,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 64, 128, 832, 1}}, "4,2,2,16,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 832, 1}}, "8,2,4,16,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 64, 128, 832, 1}}, "4,1,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{19, 64, 128, 1024, 1}}, "4,1,4,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 16}}, "2,8,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 16}}, "16,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 16}}, "8,4,4,2,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 64}}, "8,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 64}}, "8,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 64}}, "2,8,2,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 64}}, "16,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 64}}, "2,4,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 64}}, "16,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 64}}, "2,8,2,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 64}}, "1,8,1,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 64}}, "16,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 64}}, "8,4,8,1,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 32}}, "8,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 32}}, "8,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 32}}, "2,8,2,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 32}}, "16,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 32}}, "2,8,2,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 32}}, "2,4,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 32}}, "8,4,8,1,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 128}}, "1,4,1,4,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 128}}, "1,16,1,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 128}}, "1,2,1,8,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 128}}, "2,8,2,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 256, 128}}, "1,8,1,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 128}}, "1,8,1,8,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 128}}, "4,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 480, 128}}, "2,8,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 128}}, "1,4,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 128}}, "1,16,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 128}}, "8,2,8,1,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 128}}, "1,16,1,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 512, 128}}, "2,8,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 128}}, "2,8,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 128}}, "8,2,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 128}}, "4,4,4,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 128}}, "1,16,1,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 128}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 128}}, "8,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 128}}, "8,2,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 7, 7, 832, 128}}, "2,4,2,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 128}}, "4,4,2,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 128}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 832, 128}}, "8,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 128}}, "2,4,2,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 32}}, "1,16,1,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 32}}, "1,2,1,4,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 32}}, "2,8,2,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 32}}, "4,4,4,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 32}}, "1,8,1,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 512, 32}}, "2,8,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 32}}, "8,2,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 32}}, "2,4,2,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 32}}, "8,2,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 32}}, "4,4,4,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 32}}, "2,2,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 32}}, "4,2,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 7, 7, 832, 32}}, "4,2,4,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 832, 32}}, "8,4,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 64}}, "1,8,1,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "1,8,1,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 256, 32}}, "1,8,1,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "1,8,1,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "16,1,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 32}}, "1,8,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 64}}, "4,8,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 64}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 64}}, "2,8,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 128}}, "1,8,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 128}}, "1,8,1,8,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 128}}, "1,16,1,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 32}}, "4,8,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 32}}, "1,4,1,8,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 32}}, "2,8,2,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 32}}, "4,4,4,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 64}}, "8,0,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 64}}, "7,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "7,1,16,4,3,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 16}}, "0,1,16,1,1,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 16}}, "6,0,16,2,2,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 16}}, "4,0,16,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 8}}, "9,0,16,2,2,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 8}}, "8,0,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 8}}, "0,0,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 8}}, "6,0,8,4,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 8}}, "6,1,16,1,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 8}}, "3,1,16,4,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 8}}, "3,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "9,1,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 8}}, "9,1,8,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "8,0,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 16}}, "5,1,16,1,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 16}}, "5,0,16,4,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 16}}, "9,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "8,1,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 16}}, "8,1,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "0,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 8}}, "8,0,16,2,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 8}}, "7,0,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "6,0,8,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "5,0,16,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "6,0,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "9,0,8,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 16}}, "8,0,16,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 16}}, "3,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 16}}, "0,0,8,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 1}}, "1,1,16,1,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 1}}, "7,0,16,1,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 1}}, "0,0,16,1,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 1}}, "9,0,16,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 1}}, "5,0,16,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 1}}, "9,0,8,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 1}}, "8,0,8,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 1}}, "4,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 1}}, "4,1,16,1,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 1}}, "9,0,16,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 1}}, "4,0,8,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "6,1,8,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 1}}, "8,0,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "6,0,8,2,6,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 2}}, "2,1,16,1,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 2}}, "6,0,16,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 2}}, "3,1,8,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "8,1,8,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 2}}, "6,1,8,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "6,0,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 1}}, "5,0,16,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 1}}, "8,0,8,1,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 1}}, "9,0,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 2}}, "9,0,16,1,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 2}}, "6,0,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 2}}, "7,1,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 1}}, "4,0,16,2,1,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 1}}, "2,1,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 1}}, "9,1,16,2,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 1}}, "3,1,8,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 2}}, "3,0,16,2,1,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 2}}, "2,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 2}}, "8,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 2}}, "5,1,8,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 32}}, "9,0,16,4,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "8,0,8,2,3,3"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 96, 32}}, "0,0,8,2,6,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 96, 32}}, "8,0,8,4,5,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "4,0,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 160, 32}}, "5,0,8,2,14,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 160, 32}}, "3,0,8,4,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 192, 32}}, "5,1,8,4,9,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 192, 32}}, "9,0,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 192, 32}}, "5,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 224, 32}}, "9,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 192, 32}}, "0,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 147, 147, 32, 32}}, "9,1,16,4,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 64, 32}}, "3,0,8,2,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 96, 32}}, "2,0,8,2,3,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 448, 32}}, "8,1,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 64, 128, 96, 1}}, "6,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 64, 128, 112, 1}}, "2,1,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 128, 1}}, "3,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 64, 128, 144, 1}}, "5,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 64, 128, 160, 1}}, "7,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 64, 128, 192, 1}}, "0,1,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 32}}, "0,1,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "0,1,16,4,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 32}}, "0,0,8,2,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 32}}, "0,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "9,1,16,4,3,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 128}}, "5,1,16,4,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 128}}, "0,0,8,4,4,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 128}}, "8,0,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 128}}, "7,0,8,2,14,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 128}}, "6,0,8,2,13,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 128}}, "9,0,8,2,14,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 128}}, "6,0,8,4,9,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 128}}, "3,0,8,4,6,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 160, 128}}, "5,1,8,2,7,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 192, 128}}, "5,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 32}}, "7,0,8,4,2,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 32}}, "6,0,8,4,6,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 32}}, "7,1,8,2,14,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 32}}, "5,0,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 32}}, "5,1,8,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 32}}, "6,0,8,4,8,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 128}}, "6,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 128}}, "9,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 128}}, "0,1,16,4,9,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 64}}, "9,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 64}}, "6,1,16,4,9,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 64}}, "0,0,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 50}}, "9,0,16,4,9,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 50}}, "7,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 256}}, "8,0,16,4,9,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 256}}, "5,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 256}}, "7,0,16,4,9,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 64}}, "0,1,16,1,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 64}}, "9,1,16,4,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 64}}, "7,0,16,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 64}}, "8,0,16,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 64}}, "3,0,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 64}}, "9,0,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 32}}, "3,1,16,1,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 32}}, "6,0,16,4,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 32}}, "5,0,16,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 32}}, "4,1,16,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "4,1,8,2,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 32}}, "5,0,8,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 32}}, "7,1,8,4,4,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 16}}, "4,1,16,2,2,8"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "0,1,8,4,2,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 64}}, "4,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 64}}, "0,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 50}}, "9,1,16,4,10,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 35, 35, 192, 32}}, "2,1,8,4,3,4"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 16}}, "9,0,16,4,2,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 160, 32}}, "5,1,8,2,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 16}}, "8,0,16,4,3,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 16}}, "6,0,8,4,5,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 16}}, "4,0,8,8,8,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 16}}, "0,0,8,4,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{96, 14, 14, 96, 32}}, "6,0,16,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{192, 7, 7, 128, 32}}, "4,0,8,4,5,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 32}}, "3,0,8,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "1,0,8,4,4,2"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "7,0,8,4,5,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 32}}, "4,0,8,4,7,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 64}}, "7,0,8,4,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 64}}, "6,0,8,8,3,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "0,0,8,8,14,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "0,0,8,8,5,1"},
+    {"gfx803_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "0,0,8,4,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "11x11-0x0-4x4-1x1-0-NCHW-FP32-B", {{96, 55, 55, 3, 64}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 147, 147, 32, 32}}, "8,16,16,32,2,1,8,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 71, 71, 80, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 71, 71, 64, 32}}, "16,16,16,16,4,4,2,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{32, 149, 149, 32, 32}}, "8,16,16,32,1,2,8,2,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{80, 73, 73, 192, 32}}, "16,16,16,16,4,2,4,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 149, 149, 3, 32}}, "8,16,32,32,1,4,2,2,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 16}}, "8,16,16,32,2,1,1,2,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 8}}, "16,16,16,32,4,1,2,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 16}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 1}}, "8,16,16,32,1,2,1,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 1}}, "8,16,32,32,4,1,2,2,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 2}}, "16,16,16,16,2,1,2,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 16}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 1}}, "8,16,16,32,1,2,8,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 2}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 16}}, "8,16,16,32,2,1,8,2,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "3x3-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 54, 54, 3, 8}}, "32,8,32,32,1,4,2,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 4}}, "8,16,16,32,2,2,1,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 8}}, "16,32,16,32,1,1,1,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 16}}, "8,32,16,32,2,1,1,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 32}}, "8,8,32,32,4,4,1,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 80, 349, 1, 16}}, "8,16,16,32,2,2,1,2,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 48, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 16}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 50}}, "8,16,32,32,4,1,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 128}}, "16,16,16,16,2,2,2,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 24, 128}}, "16,16,16,16,4,4,1,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 128}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 128}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 128}}, "16,16,8,8,2,2,1,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 32}}, "16,16,16,16,4,1,2,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 32}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 32}}, "8,8,8,8,2,1,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 32}}, "8,8,8,8,2,1,1,2,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{48, 35, 35, 64, 32}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 16}}, "16,16,16,16,4,4,1,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 48, 16}}, "16,16,16,16,4,1,1,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 16}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 50}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 128}}, "8,8,16,16,1,1,8,2,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{24, 14, 14, 64, 128}}, "8,8,16,16,1,1,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 128}}, "8,16,32,32,1,4,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 128}}, "16,16,8,8,2,4,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 32}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 128, 32}}, "8,8,16,16,1,1,4,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 64, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 32}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 32}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 64}}, "8,16,32,32,2,2,2,1,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,16,16,2,1,1,1,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx803_64", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "8,16,32,32,1,4,2,2,1"},
+    {"gfx803_64", "ConvOclDirectFwd", "7x7-3x3-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "8,8,32,32,4,4,1,4,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,128,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "1,64,1,1,0,2,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,128,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 16}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "1,256,1,1,0,2,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 16}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,256,1,1,0,2,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,256,1,1,0,2,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 8}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,64,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,64,1,1,0,4,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,64,1,1,0,2,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,128,1,1,0,4,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,64,1,1,0,2,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 256, 512, 64, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 192, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 256, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 64, 128, 480, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 64, 128, 480, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 64, 128, 480, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 64, 128, 480, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 512, 1}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 64, 128, 512, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 128, 128, 512, 1}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 64, 128, 512, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 64, 128, 832, 1}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 832, 1}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 832, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 832, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{19, 64, 128, 1024, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 32}}, "1,64,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 32}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 256, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "1,256,1,1,0,2,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 128}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 128}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 832, 128}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 128}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1280, 64}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 128, 256, 256, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 256, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 64, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,64,1,1,1,1,64,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "1,64,1,1,1,1,64,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "1,64,1,1,1,0,32,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "1,8,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "1,8,1,1,1,0,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "1,8,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 96, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 96, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 256, 512, 64, 1}}, "1,64,1,1,1,0,32,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 96, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 32, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 128, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 32, 1}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 64, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 192, 1}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 96, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 16, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 64, 1}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 160, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 112, 1}}, "1,64,1,1,1,1,64,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 128, 128, 24, 1}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 64, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 128, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 24, 1}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 144, 1}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 256, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 32, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 256, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 160, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 128, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 192, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 48, 1}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 64, 128, 19, 1}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 128}}, "1,64,1,1,1,1,64,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 160, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 32}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "1,8,1,1,1,1,32,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1, 1760, 1760, 1, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 192, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,128,1,1,0,1,16,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 8}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 8}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 8}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 16}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 16}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 1}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 2}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,0,32,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,64,1,1,1,4,32,64,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx803_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,16,1,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,32,1,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,32,1,32,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,16,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "2,16,2,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,16,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,32,1,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,32,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,32,1,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "2,32,2,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,32,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "2,32,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,32,1,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,32,1,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "2,32,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "3,32,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,32,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,32,1,32,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "2,32,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,32,1,32,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,16,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,32,1,16,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "2,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,16,1,16,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,32,1,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,32,1,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,32,1,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "2,4,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,4,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,16,1,32,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 1}}, "1,4,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,4,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,16,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,16,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,16,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,16,1,16,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,16,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,16,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,32,1,16,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 64}}, "1,16,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,32,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,32,1,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,32,1,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,16,1,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "2,32,2,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "3,32,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 64}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 64}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{448, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,32,2,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 128}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,32,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 55, 55, 256, 16}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 256, 64}}, "2,32,2,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,32,1,16,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,16,1,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,16,1,32,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "2,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,32,1,16,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,32,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,32,1,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,32,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 2}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,32,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,32,1,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "2,16,2,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "2,16,2,32,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,16,1,16,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "2,16,2,32,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 32}}, "1,16,1,64,3,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "3,16,3,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "3,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,16,1,16,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "4,16,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "3,16,4,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,16,1,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 32}}, "4,16,5,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "2,16,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "4,16,4,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,16,2,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "2,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "2,16,2,32,4,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "2,16,4,16,3,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 32}}, "3,16,3,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "4,16,4,16,3,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "2,32,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "4,16,5,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "4,32,7,16,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "2,16,2,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "4,16,5,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "4,16,5,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "2,16,2,32,4,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "3,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "3,16,3,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "4,16,4,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "4,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "2,16,2,64,3,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "2,16,5,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "3,32,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,32,1,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "2,16,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "3,16,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,16,1,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "3,16,4,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "2,16,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,32,7,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "2,16,2,32,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "4,16,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "4,16,4,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,16,2,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "2,4,4,16,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "2,16,2,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "2,16,2,32,4,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "2,32,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "2,16,2,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "2,16,2,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "2,16,2,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "2,16,4,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "2,4,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "4,1,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "1,1,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 2}}, "1,4,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,4,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "1,4,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 2}}, "2,4,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "2,16,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "2,16,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "2,16,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,16,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "2,16,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "2,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "2,16,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,16,3,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "2,16,2,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "2,16,2,32,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 32}}, "4,16,4,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "2,16,2,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "4,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "3,16,3,16,4,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,4,1,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "3,16,3,16,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 32}}, "4,16,4,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 32}}, "4,16,4,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "4,16,4,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "2,16,2,32,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "3,16,3,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "3,16,3,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "3,16,3,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "3,16,4,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "3,16,3,16,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,16,1,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 64}}, "3,16,4,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 64}}, "4,16,5,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "4,32,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "4,16,5,16,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 64}}, "1,16,1,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 64}}, "3,16,3,16,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "2,16,2,32,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "4,16,4,16,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "4,16,4,16,3,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "4,16,4,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,32,1,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "3,16,3,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 32}}, "4,16,4,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 32}}, "4,32,7,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "4,16,5,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "4,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "4,16,5,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "3,16,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "2,16,2,32,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "2,16,3,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "3,16,3,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "2,16,2,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "4,16,5,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 128}}, "4,16,4,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "2,16,2,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,16,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "4,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 128}}, "4,16,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "4,32,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "3,16,4,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "3,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "4,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "2,16,2,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 128}}, "4,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 160, 128}}, "4,16,5,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 128}}, "3,16,4,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,16,1,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "2,16,2,32,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,16,2,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "2,16,2,32,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "2,16,2,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "2,16,2,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 32}}, "2,16,2,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "3,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "3,16,4,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "2,16,2,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 64}}, "3,16,5,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "4,16,5,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "4,32,7,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 448, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "2,16,2,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "2,16,2,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 64}}, "1,16,2,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 128}}, "2,16,2,32,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "2,32,2,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "3,16,3,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 8}}, "2,16,3,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "2,16,2,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "2,16,2,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "2,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "4,16,4,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "2,16,3,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "4,16,7,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,16,2,32,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "2,16,2,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 4}}, "1,16,1,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 2}}, "3,16,3,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "2,16,3,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 2}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 1}}, "2,16,2,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,32,1,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "2,16,2,64,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "4,32,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "4,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "3,16,3,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,32,1,64,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,32,1,64,3,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,32,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "2,32,2,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "4,32,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "2,32,2,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,32,1,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 8}}, "1,32,1,16,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "2,32,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "2,32,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "2,32,2,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,32,1,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,16,1,64,4,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "2,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "2,32,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 128}}, "1,32,1,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,32,1,32,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,32,1,32,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,16,1,64,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "2,16,2,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "3,16,3,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "4,16,4,64,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "2,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "2,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,16,1,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "4,16,4,16,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "4,32,4,16,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "4,16,7,32,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "2,16,2,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "3,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "4,16,7,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "3,16,3,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "2,32,2,32,3,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 128}}, "3,32,7,32,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 16}}, "4,16,5,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,16,1,32,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{16, 7, 7, 512, 2}}, "1,16,1,16,1,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,16,1,32,4,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "3,16,3,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "2,16,2,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "2,16,2,32,2,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "2,16,2,64,4,1"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "4,16,4,64,2,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "2,16,2,32,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "4,16,7,64,1,2"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "2,16,7,64,1,4"},
+    {"gfx900_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 16}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 8}}, "8,2,4,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 8}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 8}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 8}}, "2,8,4,4,2,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 8}}, "2,8,2,4,4,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 16}}, "2,8,2,2,8,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 16}}, "2,8,8,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 16}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 1}}, "4,4,2,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 2}}, "4,4,2,4,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "1,16,4,2,4,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 1}}, "4,4,8,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 2}}, "8,2,4,2,2,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 2}}, "2,8,2,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 2}}, "4,4,4,2,4,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "4,4,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 32}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 32}}, "4,4,4,4,4,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 576, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 576, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 576, 32}}, "2,8,2,4,4,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 32}}, "2,8,4,4,8,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 608, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 32}}, "4,4,4,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1024, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 32}}, "2,8,4,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 608, 64}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 64}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 64}}, "1,16,2,8,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 64}}, "4,4,4,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 192, 1}}, "8,2,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 128, 256, 192, 1}}, "8,2,8,2,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 192, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 256, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 256, 1}}, "8,2,4,2,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 480, 1}}, "4,4,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 64, 128, 480, 1}}, "4,4,4,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 64, 128, 480, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 480, 1}}, "8,2,8,2,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 128, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 512, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 528, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 528, 1}}, "2,8,2,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 528, 1}}, "8,2,2,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 528, 1}}, "8,2,4,2,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 832, 1}}, "2,8,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 832, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 832, 1}}, "8,2,2,2,8,1,1,2"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 832, 1}}, "4,4,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 832, 1}}, "2,8,4,8,4,1,1,2"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 64, 128, 832, 1}}, "4,4,2,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{19, 64, 128, 1024, 1}}, "4,4,1,4,1,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 16}}, "8,2,8,2,8,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 16}}, "2,8,4,4,2,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 64}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 64}}, "2,8,4,4,8,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 64}}, "1,16,2,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 64}}, "1,16,2,8,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 64}}, "1,16,2,8,2,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 64}}, "2,8,2,4,4,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 32}}, "1,16,2,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 32}}, "2,8,4,2,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 128}}, "1,16,2,8,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 128}}, "4,4,2,4,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 128}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 128}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 128}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 128}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 128}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 128}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 128}}, "4,4,8,4,2,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 128}}, "8,2,8,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 128}}, "4,4,4,4,2,1,1,2"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 128}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 128}}, "4,4,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 128}}, "8,2,8,2,8,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 128}}, "1,16,4,8,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 128}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 7, 7, 832, 128}}, "4,4,2,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 128}}, "4,4,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 128}}, "8,2,4,2,8,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 32}}, "4,4,2,2,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 32}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 480, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 32}}, "4,4,4,4,2,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 32}}, "2,8,4,8,2,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 32}}, "8,2,4,2,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 512, 32}}, "2,8,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 32}}, "2,8,2,2,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 32}}, "2,8,2,8,2,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 32}}, "4,4,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 32}}, "4,4,2,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 192, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 32}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 32}}, "1,16,4,8,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 32}}, "1,16,4,8,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 64}}, "8,2,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 288, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 64}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 64}}, "1,16,4,8,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 64}}, "1,16,4,8,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 64}}, "4,4,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 64}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 64}}, "2,8,4,8,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 128}}, "2,8,4,4,8,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 128}}, "4,4,4,4,8,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 128}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 16}}, "8,2,8,2,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 64}}, "8,2,8,2,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 8, 8, 1536, 32}}, "4,4,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1536, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 17, 17, 1024, 32}}, "2,8,4,8,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 1024, 32}}, "4,4,8,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 17, 17, 1024, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 35, 35, 384, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 384, 32}}, "4,4,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 73, 73, 160, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 4}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 4}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "8,2,4,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "8,2,2,2,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 2}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "4,4,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 64}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 64}}, "2,8,2,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "4,4,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 32}}, "2,8,2,2,8,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 128}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 64}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 64}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 64}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 64}}, "4,4,8,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,2,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 32}}, "1,16,4,4,8,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 8}}, "2,8,2,4,2,1,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 8}}, "1,16,2,8,2,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 8}}, "1,16,2,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 8}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 16}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 16}}, "4,4,8,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 2}}, "8,2,4,2,2,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 1}}, "1,16,8,2,4,1,1,2"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,2,8,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 16, 2}}, "4,4,2,2,2,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "2,8,4,4,2,2,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 4}}, "4,4,4,2,4,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 4}}, "2,8,4,4,4,2,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 4}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "2,8,2,4,2,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "2,8,2,4,4,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "4,4,4,2,2,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 64}}, "8,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 64}}, "7,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "7,1,16,4,3,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 16}}, "0,1,16,1,1,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 16}}, "0,0,16,2,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 16}}, "0,0,16,4,6,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 8}}, "0,1,8,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 8}}, "0,1,8,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 8}}, "0,0,8,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 8}}, "0,1,8,4,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 8}}, "0,1,16,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 8}}, "0,1,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 8}}, "0,0,16,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "0,1,8,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 8}}, "0,1,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "8,1,8,4,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 16}}, "0,0,16,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "0,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 8}}, "0,0,16,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 8}}, "6,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "6,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "0,0,8,2,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "5,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "4,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 16}}, "0,1,16,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 16}}, "0,0,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 16}}, "0,1,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 16}}, "0,1,8,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 1}}, "1,1,16,1,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 1}}, "7,0,16,1,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 1}}, "0,0,16,1,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 1}}, "9,0,16,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 1}}, "5,0,16,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 1}}, "9,0,8,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 1}}, "8,0,8,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 1}}, "4,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 1}}, "4,1,16,1,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 1}}, "9,0,16,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 1}}, "4,0,8,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "6,1,8,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 1}}, "8,0,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "5,0,8,2,6,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 2}}, "2,1,16,1,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 2}}, "6,0,16,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 2}}, "3,1,8,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "8,1,8,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 2}}, "6,1,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "5,0,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 1}}, "5,0,16,1,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 1}}, "0,0,8,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 1}}, "7,0,8,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 2}}, "9,0,16,1,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 2}}, "5,0,8,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 2}}, "9,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 1}}, "4,0,16,2,1,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 1}}, "2,1,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 1}}, "9,1,16,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 1}}, "3,1,8,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 2}}, "3,0,16,2,1,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 2}}, "2,0,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 2}}, "8,0,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 2}}, "5,1,8,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 32}}, "9,0,16,4,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "8,0,8,2,3,3"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 96, 32}}, "0,0,8,2,6,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 96, 32}}, "8,0,8,4,5,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "4,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 160, 32}}, "5,0,8,2,14,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 160, 32}}, "3,0,8,4,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 192, 32}}, "5,1,8,4,9,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 192, 32}}, "9,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 192, 32}}, "5,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 224, 32}}, "9,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 192, 32}}, "0,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 147, 147, 32, 32}}, "9,1,16,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 64, 32}}, "3,0,8,2,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 96, 32}}, "2,0,8,2,3,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 448, 32}}, "8,1,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 64, 128, 96, 1}}, "6,0,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 64, 128, 112, 1}}, "2,1,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 128, 1}}, "3,0,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 64, 128, 144, 1}}, "5,0,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 64, 128, 160, 1}}, "7,0,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 64, 128, 192, 1}}, "0,1,16,4,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 32}}, "8,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "0,1,16,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 32}}, "9,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 32}}, "8,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "9,1,16,4,3,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 128}}, "5,1,16,4,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 128}}, "0,0,8,4,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 128}}, "8,0,8,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 128}}, "7,0,8,2,14,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 128}}, "6,0,8,2,13,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 128}}, "9,0,8,2,14,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 128}}, "6,0,8,4,9,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 128}}, "3,0,8,4,6,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 160, 128}}, "5,1,8,2,7,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 192, 128}}, "5,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 32}}, "7,0,8,4,2,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 32}}, "0,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 32}}, "6,0,8,4,6,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 32}}, "7,1,8,2,14,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 32}}, "5,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 32}}, "5,1,8,4,4,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 32}}, "6,0,8,4,8,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 128}}, "0,0,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 64}}, "9,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 64}}, "6,1,16,4,9,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 64}}, "0,0,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 50}}, "9,0,16,4,9,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 50}}, "7,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 256}}, "8,0,16,4,9,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 256}}, "5,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 256}}, "7,0,16,4,9,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 64}}, "9,1,16,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 64}}, "7,0,16,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 64}}, "8,0,16,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 64}}, "3,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 64}}, "9,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 32}}, "3,1,16,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 32}}, "6,0,16,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 32}}, "5,0,16,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 32}}, "4,1,16,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "4,1,8,2,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 32}}, "5,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 32}}, "7,1,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 16}}, "0,0,16,2,1,8"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "0,0,8,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 64}}, "4,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 64}}, "0,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 50}}, "9,1,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 35, 35, 192, 32}}, "2,1,8,4,3,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 128}}, "7,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 128}}, "6,0,8,4,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 128}}, "7,1,8,4,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 128}}, "3,1,16,4,4,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "2,0,8,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "7,1,8,4,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 4}}, "7,0,8,2,4,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 4}}, "9,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 4}}, "7,1,8,4,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "0,0,16,4,2,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "5,0,16,4,2,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "0,0,8,2,2,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 512}}, "2,0,8,8,11,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 512}}, "0,0,16,4,5,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 512}}, "0,0,16,4,6,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 160, 32}}, "5,1,8,2,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 128}}, "0,0,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 128}}, "0,0,16,4,10,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 64}}, "0,1,16,1,2,4"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 16}}, "8,0,16,4,3,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 16}}, "6,0,8,4,5,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 16}}, "4,0,8,8,8,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 16}}, "0,0,8,4,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{96, 14, 14, 96, 32}}, "6,0,16,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{192, 7, 7, 128, 32}}, "4,0,8,4,5,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 32}}, "3,0,8,8,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "1,0,8,4,4,2"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "7,0,8,4,5,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 32}}, "4,0,8,4,7,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 64}}, "7,0,8,4,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 64}}, "6,0,8,8,3,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "0,0,8,8,14,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "0,0,8,8,5,1"},
+    {"gfx900_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "0,0,8,4,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "11x11-0x0-4x4-1x1-0-NCHW-FP32-B", {{96, 55, 55, 3, 64}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 147, 147, 32, 32}}, "8,16,16,32,2,1,8,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 71, 71, 80, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 71, 71, 64, 32}}, "16,16,16,16,4,4,2,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{32, 149, 149, 32, 32}}, "8,16,16,32,1,2,8,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{80, 73, 73, 192, 32}}, "16,16,16,16,4,2,4,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 149, 149, 3, 32}}, "8,16,32,32,1,4,2,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 192, 32}}, "32,8,32,32,1,4,4,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 8, 8, 192, 32}}, "16,32,32,32,2,1,4,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 288, 32}}, "16,16,16,16,1,1,8,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{96, 17, 17, 96, 32}}, "8,16,16,16,2,1,8,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 320, 32}}, "32,16,32,32,1,2,8,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 384, 32}}, "16,8,16,16,1,2,8,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 35, 35, 192, 32}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 16}}, "8,32,16,32,2,1,1,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 8}}, "8,32,16,32,2,1,2,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 16}}, "16,16,32,32,2,2,2,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 1}}, "8,16,16,32,1,2,1,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 1}}, "8,16,32,32,4,1,2,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 2}}, "16,16,16,16,2,1,2,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 64}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 32}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 16}}, "8,32,16,32,2,1,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 8}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 1}}, "8,16,16,32,1,2,8,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 2}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 64}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 16}}, "16,16,16,32,1,2,8,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "3x3-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 54, 54, 3, 8}}, "16,8,16,32,1,4,2,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 4}}, "16,8,16,32,1,4,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 8}}, "8,16,16,32,2,2,1,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 16}}, "8,32,16,32,2,1,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 32}}, "8,16,16,32,2,2,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 80, 349, 1, 16}}, "16,8,16,32,1,4,1,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{128, 39, 174, 64, 16}}, "16,32,16,32,1,1,4,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 48, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 16}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 50}}, "8,16,32,32,4,1,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 128}}, "16,16,16,16,2,2,2,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 24, 128}}, "16,16,16,16,4,4,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 128}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 128}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 128}}, "16,16,8,8,2,2,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 32}}, "16,16,16,16,4,1,2,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 32}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 32}}, "8,8,8,8,2,1,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 32}}, "8,8,8,8,2,1,1,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 512, 16}}, "8,8,16,16,2,2,4,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 16}}, "8,8,8,8,1,1,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{192, 27, 27, 64, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{48, 35, 35, 64, 32}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 16}}, "16,16,32,32,2,2,2,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 48, 16}}, "16,16,16,16,1,1,4,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 16}}, "8,8,8,8,1,1,2,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 50}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 128}}, "8,8,16,16,1,1,8,2,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{24, 14, 14, 64, 128}}, "8,8,16,16,1,1,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 128}}, "8,16,32,32,1,4,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 128}}, "16,16,8,8,2,4,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 32}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 128, 32}}, "8,8,16,16,1,1,4,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 64, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 32}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 32}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{64, 27, 27, 192, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 64}}, "8,16,16,16,2,1,1,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,8,16,16,2,2,1,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "16,8,16,16,1,2,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 8}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 4}}, "8,16,16,16,2,1,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 2}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 1}}, "16,32,32,32,2,1,1,4,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "8,16,32,32,1,4,2,2,1"},
+    {"gfx900_56", "ConvOclDirectFwd", "7x7-3x3-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "8,8,32,32,4,4,1,1,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-B", {{256, 7, 7, 832, 16}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-F", {{832, 7, 7, 256, 16}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 32}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,128,1,1,0,4,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,256,1,1,0,4,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,128,1,1,0,2,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,128,1,1,0,4,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,64,1,1,0,4,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,128,1,1,0,4,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 64}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 64}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 256, 512, 64, 1}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 192, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 128, 256, 192, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 192, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 128, 256, 256, 1}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 256, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 64, 128, 480, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 64, 128, 480, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 64, 128, 480, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 528, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 64, 128, 832, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 832, 1}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{19, 64, 128, 1024, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 128}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 1}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 128, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 64, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "1,64,1,1,1,1,64,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "1,64,1,1,1,0,32,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 192, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 64}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "1,64,1,1,1,0,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 96, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 256, 512, 64, 1}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 96, 1}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 32, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 64, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 192, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 96, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 16, 1}}, "1,64,1,1,1,4,64,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 64, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 160, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 112, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 128, 128, 24, 1}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 64, 1}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 128, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 24, 1}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 32, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 256, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 256, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 160, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 128, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 192, 1}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 48, 1}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 64, 128, 19, 1}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,64,1,1,1,1,32,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "1,64,1,1,1,4,64,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1, 1760, 1760, 1, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 8}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 16}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,64,1,1,1,4,32,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 128}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,16,1,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,32,1,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,32,1,32,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,16,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "2,16,2,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,16,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,32,1,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,32,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,32,1,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "2,32,2,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,32,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "2,32,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,32,1,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,32,1,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "2,32,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "3,32,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,32,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,32,1,32,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "2,32,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,32,1,32,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,16,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,32,1,16,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "2,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,16,1,16,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,32,1,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,32,1,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,32,1,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "2,4,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,4,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,16,1,32,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 1}}, "1,4,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,4,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,16,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,16,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,16,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,16,1,16,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,16,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,16,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,32,1,16,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 64}}, "1,16,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,32,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,32,1,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,32,1,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,16,1,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "2,32,2,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "3,32,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 64}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 64}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{448, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,32,2,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 128}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,32,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 55, 55, 256, 16}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 256, 64}}, "2,32,2,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,32,1,16,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,16,1,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,16,1,32,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "2,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,32,1,16,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,32,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,32,1,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,32,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 2}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,32,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,32,1,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "2,16,2,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "2,16,2,32,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,16,1,16,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "2,16,2,32,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 32}}, "1,16,1,64,3,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "3,16,3,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "3,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,16,1,16,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "4,16,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "3,16,4,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,16,1,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 32}}, "4,16,5,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "2,16,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "4,16,4,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,16,2,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "2,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "2,16,2,32,4,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "2,16,4,16,3,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 32}}, "3,16,3,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "4,16,4,16,3,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "2,32,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "4,16,5,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "4,32,7,16,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "2,16,2,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "4,16,5,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "4,16,5,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "2,16,2,32,4,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "3,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "3,16,3,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "4,16,4,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "4,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "2,16,2,64,3,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "2,16,5,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "3,32,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,32,1,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "2,16,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "3,16,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,16,1,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "3,16,4,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "2,16,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,32,7,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "2,16,2,32,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "4,16,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "4,16,4,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,16,2,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "2,4,4,16,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "2,16,2,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "2,16,2,32,4,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "2,32,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "2,16,2,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "2,16,2,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "2,16,2,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "2,16,4,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "2,4,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "4,1,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "1,1,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 2}}, "1,4,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,4,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "1,4,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 2}}, "2,4,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "2,16,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "2,16,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "2,16,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,16,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "2,16,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "2,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "2,16,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,16,3,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "2,16,2,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "2,16,2,32,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 32}}, "4,16,4,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "2,16,2,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "4,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "3,16,3,16,4,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,4,1,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "3,16,3,16,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 32}}, "4,16,4,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 32}}, "4,16,4,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "4,16,4,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "2,16,2,32,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "3,16,3,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "3,16,3,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "3,16,3,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "3,16,4,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "3,16,3,16,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,16,1,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 64}}, "3,16,4,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 64}}, "4,16,5,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "4,32,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "4,16,5,16,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 64}}, "1,16,1,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 64}}, "3,16,3,16,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "2,16,2,32,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "4,16,4,16,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "4,16,4,16,3,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "4,16,4,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,32,1,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "3,16,3,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 32}}, "4,16,4,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 32}}, "4,32,7,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "4,16,5,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "4,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "4,16,5,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "3,16,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "2,16,2,32,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "2,16,3,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "3,16,3,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "2,16,2,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "4,16,5,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 128}}, "4,16,4,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "2,16,2,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,16,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "4,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 128}}, "4,16,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "4,32,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "3,16,4,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "3,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "4,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "2,16,2,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 128}}, "4,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 160, 128}}, "4,16,5,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 128}}, "3,16,4,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,16,1,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "2,16,2,32,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,16,2,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "2,16,2,32,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "2,16,2,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "2,16,2,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 32}}, "2,16,2,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "3,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "3,16,4,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "2,16,2,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 64}}, "3,16,5,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "4,16,5,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "4,32,7,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 448, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "2,16,2,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "2,16,2,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 64}}, "1,16,2,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 128}}, "2,16,2,32,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "2,32,2,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "3,16,3,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 8}}, "2,16,3,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "2,16,2,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "2,16,2,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "2,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "4,16,4,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "2,16,3,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "4,16,7,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,16,2,32,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "2,16,2,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 4}}, "1,16,1,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 2}}, "3,16,3,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "2,16,3,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 2}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 1}}, "2,16,2,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,32,1,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "2,16,2,64,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "4,32,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "4,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "3,16,3,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,32,1,64,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,32,1,64,3,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,32,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "2,32,2,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "4,32,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "2,32,2,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,32,1,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 8}}, "1,32,1,16,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "2,32,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "2,32,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "2,32,2,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,32,1,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,16,1,64,4,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "2,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "2,32,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 128}}, "1,32,1,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,32,1,32,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,32,1,32,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,16,1,64,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "2,16,2,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "3,16,3,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "4,16,4,64,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "2,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "2,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,16,1,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "4,16,4,16,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "4,32,4,16,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "4,16,7,32,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,16,1,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "2,16,2,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "3,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "4,16,7,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "3,16,3,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "2,32,2,32,3,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 128}}, "3,32,7,32,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 16}}, "4,16,5,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,16,1,32,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{16, 7, 7, 512, 2}}, "1,16,1,16,1,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,16,1,32,4,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "3,16,3,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "2,16,2,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "2,16,2,32,2,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "2,16,2,64,4,1"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "4,16,4,64,2,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "2,16,2,32,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "4,16,7,64,1,2"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "2,16,7,64,1,4"},
+    {"gfx900_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 16}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 8}}, "8,2,4,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 8}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 8}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 8}}, "2,8,4,4,2,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 8}}, "2,8,2,4,4,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 16}}, "2,8,2,2,8,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 16}}, "2,8,8,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 16}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 1}}, "4,4,2,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 2}}, "4,4,2,4,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "1,16,4,2,4,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 1}}, "4,4,8,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 2}}, "8,2,4,2,2,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 2}}, "2,8,2,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 2}}, "4,4,4,2,4,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "4,4,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 32}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 32}}, "4,4,4,4,4,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 576, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 576, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 576, 32}}, "2,8,2,4,4,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 32}}, "2,8,4,4,8,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 608, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 32}}, "4,4,4,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1024, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 32}}, "2,8,4,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 608, 64}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 64}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 64}}, "1,16,2,8,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 64}}, "4,4,4,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 192, 1}}, "8,2,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 128, 256, 192, 1}}, "8,2,8,2,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 192, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 256, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 256, 1}}, "8,2,4,2,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 480, 1}}, "4,4,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 64, 128, 480, 1}}, "4,4,4,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 64, 128, 480, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 480, 1}}, "8,2,8,2,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 128, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 512, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 528, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 528, 1}}, "2,8,2,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 528, 1}}, "8,2,2,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 528, 1}}, "8,2,4,2,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 832, 1}}, "2,8,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 832, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 832, 1}}, "8,2,2,2,8,1,1,2"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 832, 1}}, "4,4,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 832, 1}}, "2,8,4,8,4,1,1,2"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 64, 128, 832, 1}}, "4,4,2,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{19, 64, 128, 1024, 1}}, "4,4,1,4,1,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 16}}, "8,2,8,2,8,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 16}}, "2,8,4,4,2,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 64}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 64}}, "2,8,4,4,8,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 64}}, "1,16,2,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 64}}, "1,16,2,8,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 64}}, "1,16,2,8,2,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 64}}, "2,8,2,4,4,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 32}}, "1,16,2,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 32}}, "2,8,4,2,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 128}}, "1,16,2,8,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 128}}, "4,4,2,4,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 128}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 128}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 128}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 128}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 128}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 128}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 128}}, "4,4,8,4,2,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 128}}, "8,2,8,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 128}}, "4,4,4,4,2,1,1,2"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 128}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 128}}, "4,4,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 128}}, "8,2,8,2,8,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 128}}, "1,16,4,8,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 128}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 7, 7, 832, 128}}, "4,4,2,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 128}}, "4,4,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 128}}, "8,2,4,2,8,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 32}}, "4,4,2,2,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 32}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 480, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 32}}, "4,4,4,4,2,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 32}}, "2,8,4,8,2,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 32}}, "8,2,4,2,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 512, 32}}, "2,8,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 32}}, "2,8,2,2,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 32}}, "2,8,2,8,2,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 32}}, "4,4,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 32}}, "4,4,2,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 192, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 32}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 32}}, "1,16,4,8,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 32}}, "1,16,4,8,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 64}}, "8,2,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 288, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 64}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 64}}, "1,16,4,8,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 64}}, "1,16,4,8,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 64}}, "4,4,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 64}}, "2,8,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 64}}, "2,8,4,8,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 128}}, "2,8,4,4,8,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 128}}, "4,4,4,4,8,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 128}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 16}}, "8,2,8,2,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 64}}, "8,2,8,2,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 8, 8, 1536, 32}}, "4,4,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1536, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 17, 17, 1024, 32}}, "2,8,4,8,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 1024, 32}}, "4,4,8,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 17, 17, 1024, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 35, 35, 384, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 384, 32}}, "4,4,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 73, 73, 160, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 4}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 4}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "8,2,4,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "8,2,2,2,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 2}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "4,4,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 64}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 64}}, "2,8,2,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "4,4,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 32}}, "2,8,2,2,8,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 128}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 64}}, "1,16,2,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 64}}, "4,4,4,4,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 64}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 64}}, "4,4,8,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,2,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 32}}, "1,16,4,4,8,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 8}}, "2,8,2,4,2,1,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 8}}, "1,16,2,8,2,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 8}}, "1,16,2,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 8}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 16}}, "1,16,2,4,4,1,8,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 16}}, "4,4,8,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 2}}, "8,2,4,2,2,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 1}}, "1,16,8,2,4,1,1,2"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,2,8,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 16, 2}}, "4,4,2,2,2,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "2,8,4,4,2,2,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 4}}, "4,4,4,2,4,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 4}}, "2,8,4,4,4,2,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 4}}, "1,16,2,4,8,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "2,8,2,4,2,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "2,8,4,4,4,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "2,8,2,4,4,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "4,4,4,2,2,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 64}}, "8,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 64}}, "7,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "7,1,16,4,3,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 16}}, "0,1,16,1,1,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 16}}, "0,0,16,2,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 16}}, "0,0,16,4,6,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 8}}, "0,1,8,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 8}}, "0,1,8,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 8}}, "0,0,8,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 8}}, "0,1,8,4,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 8}}, "0,1,16,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 8}}, "0,1,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 8}}, "0,0,16,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "0,1,8,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 8}}, "0,1,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "8,1,8,4,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 16}}, "0,0,16,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "0,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 8}}, "0,0,16,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 8}}, "6,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "6,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "0,0,8,2,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "5,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "4,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 16}}, "0,1,16,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 16}}, "0,0,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 16}}, "0,1,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 16}}, "0,1,8,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 1}}, "1,1,16,1,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 1}}, "7,0,16,1,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 1}}, "0,0,16,1,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 1}}, "9,0,16,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 1}}, "5,0,16,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 1}}, "9,0,8,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 1}}, "8,0,8,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 1}}, "4,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 1}}, "4,1,16,1,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 1}}, "9,0,16,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 1}}, "4,0,8,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "6,1,8,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 1}}, "8,0,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "5,0,8,2,6,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 2}}, "2,1,16,1,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 2}}, "6,0,16,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 2}}, "3,1,8,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "8,1,8,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 2}}, "6,1,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "5,0,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 1}}, "5,0,16,1,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 1}}, "0,0,8,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 1}}, "7,0,8,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 2}}, "9,0,16,1,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 2}}, "5,0,8,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 2}}, "9,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 1}}, "4,0,16,2,1,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 1}}, "2,1,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 1}}, "9,1,16,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 1}}, "3,1,8,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 2}}, "3,0,16,2,1,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 2}}, "2,0,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 2}}, "8,0,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 2}}, "5,1,8,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 32}}, "9,0,16,4,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "8,0,8,2,3,3"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 96, 32}}, "0,0,8,2,6,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 96, 32}}, "8,0,8,4,5,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "4,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 160, 32}}, "5,0,8,2,14,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 160, 32}}, "3,0,8,4,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 192, 32}}, "5,1,8,4,9,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 192, 32}}, "9,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 192, 32}}, "5,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 224, 32}}, "9,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 192, 32}}, "0,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 147, 147, 32, 32}}, "9,1,16,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 64, 32}}, "3,0,8,2,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 96, 32}}, "2,0,8,2,3,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 448, 32}}, "8,1,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 64, 128, 96, 1}}, "6,0,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 64, 128, 112, 1}}, "2,1,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 128, 1}}, "3,0,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 64, 128, 144, 1}}, "5,0,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 64, 128, 160, 1}}, "7,0,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 64, 128, 192, 1}}, "0,1,16,4,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 32}}, "8,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "0,1,16,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 32}}, "9,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 32}}, "8,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "9,1,16,4,3,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 128}}, "5,1,16,4,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 128}}, "0,0,8,4,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 128}}, "8,0,8,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 128}}, "7,0,8,2,14,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 128}}, "6,0,8,2,13,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 128}}, "9,0,8,2,14,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 128}}, "6,0,8,4,9,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 128}}, "3,0,8,4,6,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 160, 128}}, "5,1,8,2,7,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 192, 128}}, "5,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 32}}, "7,0,8,4,2,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 32}}, "0,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 32}}, "6,0,8,4,6,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 32}}, "7,1,8,2,14,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 32}}, "5,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 32}}, "5,1,8,4,4,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 32}}, "6,0,8,4,8,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 128}}, "0,0,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 64}}, "9,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 64}}, "6,1,16,4,9,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 64}}, "0,0,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 50}}, "9,0,16,4,9,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 50}}, "7,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 256}}, "8,0,16,4,9,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 256}}, "5,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 256}}, "7,0,16,4,9,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 64}}, "9,1,16,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 64}}, "7,0,16,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 64}}, "8,0,16,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 64}}, "3,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 64}}, "9,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 32}}, "3,1,16,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 32}}, "6,0,16,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 32}}, "5,0,16,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 32}}, "4,1,16,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "4,1,8,2,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 32}}, "5,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 32}}, "7,1,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 16}}, "0,0,16,2,1,8"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "0,0,8,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 64}}, "4,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 64}}, "0,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 50}}, "9,1,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 35, 35, 192, 32}}, "2,1,8,4,3,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 128}}, "7,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 128}}, "6,0,8,4,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 128}}, "7,1,8,4,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 128}}, "3,1,16,4,4,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "2,0,8,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "7,1,8,4,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 4}}, "7,0,8,2,4,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 4}}, "9,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 4}}, "7,1,8,4,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "0,0,16,4,2,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "5,0,16,4,2,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "0,0,8,2,2,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 512}}, "2,0,8,8,11,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 512}}, "0,0,16,4,5,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 512}}, "0,0,16,4,6,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 160, 32}}, "5,1,8,2,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 128}}, "0,0,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 128}}, "0,0,16,4,10,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 64}}, "0,1,16,1,2,4"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 16}}, "8,0,16,4,3,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 16}}, "6,0,8,4,5,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 16}}, "4,0,8,8,8,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 16}}, "0,0,8,4,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{96, 14, 14, 96, 32}}, "6,0,16,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{192, 7, 7, 128, 32}}, "4,0,8,4,5,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 32}}, "3,0,8,8,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "1,0,8,4,4,2"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "7,0,8,4,5,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 32}}, "4,0,8,4,7,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 64}}, "7,0,8,4,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 64}}, "6,0,8,8,3,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "0,0,8,8,14,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "0,0,8,8,5,1"},
+    {"gfx900_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "0,0,8,4,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "11x11-0x0-4x4-1x1-0-NCHW-FP32-B", {{96, 55, 55, 3, 64}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 147, 147, 32, 32}}, "8,16,16,32,2,1,8,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 71, 71, 80, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 71, 71, 64, 32}}, "16,16,16,16,4,4,2,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{32, 149, 149, 32, 32}}, "8,16,16,32,1,2,8,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{80, 73, 73, 192, 32}}, "16,16,16,16,4,2,4,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 149, 149, 3, 32}}, "8,16,32,32,1,4,2,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 192, 32}}, "32,8,32,32,1,4,4,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 8, 8, 192, 32}}, "16,32,32,32,2,1,4,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 288, 32}}, "16,16,16,16,1,1,8,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{96, 17, 17, 96, 32}}, "8,16,16,16,2,1,8,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 320, 32}}, "32,16,32,32,1,2,8,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 384, 32}}, "16,8,16,16,1,2,8,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 35, 35, 192, 32}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 16}}, "8,32,16,32,2,1,1,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 8}}, "8,32,16,32,2,1,2,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 16}}, "16,16,32,32,2,2,2,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 1}}, "8,16,16,32,1,2,1,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 1}}, "8,16,32,32,4,1,2,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 2}}, "16,16,16,16,2,1,2,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 64}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 32}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 16}}, "8,32,16,32,2,1,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 8}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 1}}, "8,16,16,32,1,2,8,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 2}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 64}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 16}}, "16,16,16,32,1,2,8,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "3x3-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 54, 54, 3, 8}}, "16,8,16,32,1,4,2,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 4}}, "16,8,16,32,1,4,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 8}}, "8,16,16,32,2,2,1,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 16}}, "8,32,16,32,2,1,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 32}}, "8,16,16,32,2,2,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 80, 349, 1, 16}}, "16,8,16,32,1,4,1,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{128, 39, 174, 64, 16}}, "16,32,16,32,1,1,4,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 48, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 16}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 50}}, "8,16,32,32,4,1,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 128}}, "16,16,16,16,2,2,2,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 24, 128}}, "16,16,16,16,4,4,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 128}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 128}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 128}}, "16,16,8,8,2,2,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 32}}, "16,16,16,16,4,1,2,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 32}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 32}}, "8,8,8,8,2,1,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 32}}, "8,8,8,8,2,1,1,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 512, 16}}, "8,8,16,16,2,2,4,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 16}}, "8,8,8,8,1,1,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{192, 27, 27, 64, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{48, 35, 35, 64, 32}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 16}}, "16,16,32,32,2,2,2,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 48, 16}}, "16,16,16,16,1,1,4,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 16}}, "8,8,8,8,1,1,2,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 50}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 128}}, "8,8,16,16,1,1,8,2,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{24, 14, 14, 64, 128}}, "8,8,16,16,1,1,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 128}}, "8,16,32,32,1,4,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 128}}, "16,16,8,8,2,4,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 32}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 128, 32}}, "8,8,16,16,1,1,4,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 64, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 32}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 32}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{64, 27, 27, 192, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 64}}, "8,16,16,16,2,1,1,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,8,16,16,2,2,1,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "16,8,16,16,1,2,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 8}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 4}}, "8,16,16,16,2,1,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 2}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 1}}, "16,32,32,32,2,1,1,4,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "8,16,32,32,1,4,2,2,1"},
+    {"gfx900_64", "ConvOclDirectFwd", "7x7-3x3-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "8,8,32,32,4,4,1,1,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-B", {{256, 7, 7, 832, 16}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-F", {{832, 7, 7, 256, 16}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 32}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,128,1,1,0,4,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,256,1,1,0,4,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,128,1,1,0,2,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,128,1,1,0,4,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,64,1,1,0,4,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,128,1,1,0,4,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 64}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 64}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 256, 512, 64, 1}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 192, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 128, 256, 192, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 192, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 128, 256, 256, 1}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 256, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 64, 128, 480, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 64, 128, 480, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 64, 128, 480, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 528, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 64, 128, 832, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 832, 1}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{19, 64, 128, 1024, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 128}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 1}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 128, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 64, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "1,64,1,1,1,1,64,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "1,64,1,1,1,0,32,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 192, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 64}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "1,64,1,1,1,0,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 96, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 256, 512, 64, 1}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 96, 1}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 32, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 64, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 192, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 96, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 16, 1}}, "1,64,1,1,1,4,64,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 64, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 160, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 112, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 128, 128, 24, 1}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 64, 1}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 128, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 24, 1}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 32, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 256, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 256, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 160, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 128, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 192, 1}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 48, 1}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 64, 128, 19, 1}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,64,1,1,1,1,32,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "1,64,1,1,1,4,64,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1, 1760, 1760, 1, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 8}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 16}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,64,1,1,1,4,32,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 128}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx900_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,16,1,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,32,1,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,32,1,32,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,16,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "2,16,2,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,16,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,32,1,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,32,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,32,1,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "2,32,2,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,32,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "2,32,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,32,1,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,32,1,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "2,32,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "3,32,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,32,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,32,1,32,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "2,32,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,32,1,32,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,16,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,32,1,16,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "2,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,16,1,16,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,32,1,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,32,1,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,32,1,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "2,4,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,4,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,16,1,32,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 1}}, "1,4,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,4,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,16,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,16,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,16,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,16,1,16,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,16,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,16,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,32,1,16,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 64}}, "1,16,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,32,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,32,1,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,32,1,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,16,1,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "2,32,2,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "3,32,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 64}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 64}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{448, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,32,2,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 128}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,32,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 55, 55, 256, 16}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 256, 64}}, "2,32,2,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,32,1,16,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,16,1,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,16,1,32,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "2,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,32,1,16,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,32,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,32,1,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,32,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 2}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,32,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,32,1,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "2,16,2,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "2,16,2,32,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,16,1,16,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "2,16,2,32,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 32}}, "1,16,1,64,3,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "3,16,3,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "3,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,16,1,16,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "4,16,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "3,16,4,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,16,1,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 32}}, "4,16,5,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "2,16,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "4,16,4,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,16,2,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "2,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "2,16,2,32,4,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "2,16,4,16,3,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 32}}, "3,16,3,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "4,16,4,16,3,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "2,32,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "4,16,5,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "4,32,7,16,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "2,16,2,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "4,16,5,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "4,16,5,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "2,16,2,32,4,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "3,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "3,16,3,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "4,16,4,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "4,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "2,16,2,64,3,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "2,16,5,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "3,32,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,32,1,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "2,16,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "3,16,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,16,1,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "3,16,4,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "2,16,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,32,7,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "2,16,2,32,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "4,16,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "4,16,4,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,16,2,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "2,4,4,16,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "2,16,2,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "2,16,2,32,4,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "2,32,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "2,16,2,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "2,16,2,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "2,16,2,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "2,16,4,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "2,4,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "4,1,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "1,1,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 2}}, "1,4,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,4,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "1,4,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 2}}, "2,4,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "2,16,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "2,16,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "2,16,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,16,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "2,16,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "2,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "2,16,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,16,3,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "2,16,2,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "2,16,2,32,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 32}}, "4,16,4,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "2,16,2,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "4,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "3,16,3,16,4,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,4,1,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "3,16,3,16,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 32}}, "4,16,4,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 32}}, "4,16,4,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "4,16,4,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "2,16,2,32,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "3,16,3,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "3,16,3,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "3,16,3,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "3,16,4,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "3,16,3,16,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,16,1,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 64}}, "3,16,4,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 64}}, "4,16,5,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "4,32,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "4,16,5,16,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 64}}, "1,16,1,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 64}}, "3,16,3,16,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "2,16,2,32,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "4,16,4,16,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "4,16,4,16,3,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "4,16,4,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,32,1,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "3,16,3,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 32}}, "4,16,4,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 32}}, "4,32,7,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "4,16,5,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "4,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "4,16,5,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "3,16,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "2,16,2,32,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "2,16,3,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "3,16,3,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "2,16,2,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "4,16,5,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 128}}, "4,16,4,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "2,16,2,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,16,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "4,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 128}}, "4,16,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "4,32,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "3,16,4,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "3,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "4,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "2,16,2,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 128}}, "4,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 160, 128}}, "4,16,5,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 128}}, "3,16,4,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,16,1,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "2,16,2,32,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,16,2,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "2,16,2,32,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "2,16,2,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "2,16,2,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 32}}, "2,16,2,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "3,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "3,16,4,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "2,16,2,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 64}}, "3,16,5,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "4,16,5,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "4,32,7,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 448, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "2,16,2,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "2,16,2,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 64}}, "1,16,2,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 128}}, "2,16,2,32,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "2,32,2,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "3,16,3,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 8}}, "2,16,3,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "2,16,2,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "2,16,2,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "2,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "4,16,4,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "2,16,3,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "4,16,7,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,16,2,32,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "2,16,2,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 4}}, "1,16,1,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 2}}, "3,16,3,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "2,16,3,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 2}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 1}}, "2,16,2,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,32,1,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "2,16,2,64,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "4,32,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "4,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "3,16,3,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,32,1,64,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,32,1,64,3,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,32,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "2,32,2,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "4,32,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "2,32,2,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,32,1,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 8}}, "1,32,1,16,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "2,32,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "2,32,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "2,32,2,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,32,1,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,16,1,64,4,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "2,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "2,32,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 128}}, "1,32,1,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,32,1,32,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,32,1,32,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,16,1,64,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "2,16,2,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "3,16,3,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "4,16,4,64,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "2,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "2,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,16,1,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "4,16,4,16,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "4,32,4,16,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "4,16,7,32,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "2,16,2,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "3,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "4,16,7,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "3,16,3,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "2,32,2,32,3,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 128}}, "3,32,7,32,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 16}}, "4,16,5,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,16,1,32,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{16, 7, 7, 512, 2}}, "1,16,1,16,1,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,16,1,32,4,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "3,16,3,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "2,16,2,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "2,16,2,32,2,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "2,16,2,64,4,1"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "4,16,4,64,2,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "2,16,2,32,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "4,16,7,64,1,2"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "2,16,7,64,1,4"},
+    {"gfx906_56", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 16}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 8}}, "8,2,4,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 8}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 8}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 8}}, "2,8,4,4,2,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 8}}, "2,8,2,4,4,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 16}}, "2,8,2,2,8,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 16}}, "2,8,8,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 16}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 1}}, "4,4,2,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 2}}, "4,4,2,4,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "1,16,4,2,4,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 1}}, "4,4,8,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 2}}, "8,2,4,2,2,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 2}}, "2,8,2,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 2}}, "4,4,4,2,4,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "4,4,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 32}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 32}}, "4,4,4,4,4,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 576, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 576, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 576, 32}}, "2,8,2,4,4,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 32}}, "2,8,4,4,8,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 608, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 32}}, "4,4,4,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1024, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 32}}, "2,8,4,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 608, 64}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 64}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 64}}, "1,16,2,8,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 64}}, "4,4,4,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 192, 1}}, "8,2,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 128, 256, 192, 1}}, "8,2,8,2,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 192, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 256, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 256, 1}}, "8,2,4,2,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 480, 1}}, "4,4,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 64, 128, 480, 1}}, "4,4,4,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 64, 128, 480, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 480, 1}}, "8,2,8,2,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 128, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 512, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 528, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 528, 1}}, "2,8,2,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 528, 1}}, "8,2,2,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 528, 1}}, "8,2,4,2,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 832, 1}}, "2,8,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 832, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 832, 1}}, "8,2,2,2,8,1,1,2"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 832, 1}}, "4,4,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 832, 1}}, "2,8,4,8,4,1,1,2"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 64, 128, 832, 1}}, "4,4,2,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{19, 64, 128, 1024, 1}}, "4,4,1,4,1,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 16}}, "8,2,8,2,8,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 16}}, "2,8,4,4,2,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 64}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 64}}, "2,8,4,4,8,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 64}}, "1,16,2,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 64}}, "1,16,2,8,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 64}}, "1,16,2,8,2,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 64}}, "2,8,2,4,4,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 32}}, "1,16,2,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 32}}, "2,8,4,2,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 128}}, "1,16,2,8,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 128}}, "4,4,2,4,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 128}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 128}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 128}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 128}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 128}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 128}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 128}}, "4,4,8,4,2,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 128}}, "8,2,8,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 128}}, "4,4,4,4,2,1,1,2"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 128}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 128}}, "4,4,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 128}}, "8,2,8,2,8,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 128}}, "1,16,4,8,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 128}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 7, 7, 832, 128}}, "4,4,2,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 128}}, "4,4,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 128}}, "8,2,4,2,8,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 32}}, "4,4,2,2,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 32}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 480, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 32}}, "4,4,4,4,2,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 32}}, "2,8,4,8,2,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 32}}, "8,2,4,2,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 512, 32}}, "2,8,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 32}}, "2,8,2,2,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 32}}, "2,8,2,8,2,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 32}}, "4,4,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 32}}, "4,4,2,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 192, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 32}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 32}}, "1,16,4,8,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 32}}, "1,16,4,8,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 64}}, "8,2,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 288, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 64}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 64}}, "1,16,4,8,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 64}}, "1,16,4,8,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 64}}, "4,4,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 64}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 64}}, "2,8,4,8,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 128}}, "2,8,4,4,8,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 128}}, "4,4,4,4,8,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 128}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 16}}, "8,2,8,2,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 64}}, "8,2,8,2,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 8, 8, 1536, 32}}, "4,4,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1536, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 17, 17, 1024, 32}}, "2,8,4,8,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 1024, 32}}, "4,4,8,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 17, 17, 1024, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 35, 35, 384, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 384, 32}}, "4,4,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 73, 73, 160, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 4}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 4}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "8,2,4,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "8,2,2,2,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 2}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "4,4,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 64}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 64}}, "2,8,2,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "4,4,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 32}}, "2,8,2,2,8,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 128}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 64}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 64}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 64}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 64}}, "4,4,8,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,2,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 32}}, "1,16,4,4,8,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 8}}, "2,8,2,4,2,1,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 8}}, "1,16,2,8,2,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 8}}, "1,16,2,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 8}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 16}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 16}}, "4,4,8,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 2}}, "8,2,4,2,2,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 1}}, "1,16,8,2,4,1,1,2"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,2,8,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 16, 2}}, "4,4,2,2,2,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "2,8,4,4,2,2,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 4}}, "4,4,4,2,4,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 4}}, "2,8,4,4,4,2,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 4}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "2,8,2,4,2,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "2,8,2,4,4,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "4,4,4,2,2,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 64}}, "8,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 64}}, "7,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "7,1,16,4,3,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 16}}, "0,1,16,1,1,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 16}}, "0,0,16,2,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 16}}, "0,0,16,4,6,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 8}}, "0,1,8,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 8}}, "0,1,8,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 8}}, "0,0,8,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 8}}, "0,1,8,4,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 8}}, "0,1,16,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 8}}, "0,1,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 8}}, "0,0,16,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "0,1,8,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 8}}, "0,1,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "8,1,8,4,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 16}}, "0,0,16,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "0,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 8}}, "0,0,16,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 8}}, "6,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "6,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "0,0,8,2,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "5,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "4,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 16}}, "0,1,16,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 16}}, "0,0,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 16}}, "0,1,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 16}}, "0,1,8,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 1}}, "1,1,16,1,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 1}}, "7,0,16,1,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 1}}, "0,0,16,1,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 1}}, "9,0,16,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 1}}, "5,0,16,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 1}}, "9,0,8,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 1}}, "8,0,8,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 1}}, "4,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 1}}, "4,1,16,1,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 1}}, "9,0,16,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 1}}, "4,0,8,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "6,1,8,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 1}}, "8,0,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "5,0,8,2,6,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 2}}, "2,1,16,1,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 2}}, "6,0,16,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 2}}, "3,1,8,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "8,1,8,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 2}}, "6,1,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "5,0,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 1}}, "5,0,16,1,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 1}}, "0,0,8,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 1}}, "7,0,8,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 2}}, "9,0,16,1,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 2}}, "5,0,8,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 2}}, "9,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 1}}, "4,0,16,2,1,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 1}}, "2,1,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 1}}, "9,1,16,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 1}}, "3,1,8,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 2}}, "3,0,16,2,1,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 2}}, "2,0,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 2}}, "8,0,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 2}}, "5,1,8,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 32}}, "9,0,16,4,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "8,0,8,2,3,3"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 96, 32}}, "0,0,8,2,6,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 96, 32}}, "8,0,8,4,5,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "4,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 160, 32}}, "5,0,8,2,14,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 160, 32}}, "3,0,8,4,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 192, 32}}, "5,1,8,4,9,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 192, 32}}, "9,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 192, 32}}, "5,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 224, 32}}, "9,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 192, 32}}, "0,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 147, 147, 32, 32}}, "9,1,16,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 64, 32}}, "3,0,8,2,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 96, 32}}, "2,0,8,2,3,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 448, 32}}, "8,1,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 64, 128, 96, 1}}, "6,0,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 64, 128, 112, 1}}, "2,1,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 128, 1}}, "3,0,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 64, 128, 144, 1}}, "5,0,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 64, 128, 160, 1}}, "7,0,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 64, 128, 192, 1}}, "0,1,16,4,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 32}}, "8,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "0,1,16,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 32}}, "9,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 32}}, "8,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "9,1,16,4,3,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 128}}, "5,1,16,4,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 128}}, "0,0,8,4,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 128}}, "8,0,8,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 128}}, "7,0,8,2,14,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 128}}, "6,0,8,2,13,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 128}}, "9,0,8,2,14,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 128}}, "6,0,8,4,9,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 128}}, "3,0,8,4,6,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 160, 128}}, "5,1,8,2,7,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 192, 128}}, "5,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 32}}, "7,0,8,4,2,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 32}}, "0,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 32}}, "6,0,8,4,6,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 32}}, "7,1,8,2,14,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 32}}, "5,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 32}}, "5,1,8,4,4,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 32}}, "6,0,8,4,8,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 128}}, "0,0,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 64}}, "9,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 64}}, "6,1,16,4,9,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 64}}, "0,0,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 50}}, "9,0,16,4,9,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 50}}, "7,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 256}}, "8,0,16,4,9,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 256}}, "5,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 256}}, "7,0,16,4,9,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 64}}, "9,1,16,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 64}}, "7,0,16,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 64}}, "8,0,16,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 64}}, "3,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 64}}, "9,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 32}}, "3,1,16,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 32}}, "6,0,16,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 32}}, "5,0,16,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 32}}, "4,1,16,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "4,1,8,2,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 32}}, "5,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 32}}, "7,1,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 16}}, "0,0,16,2,1,8"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "0,0,8,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 64}}, "4,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 64}}, "0,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 50}}, "9,1,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 35, 35, 192, 32}}, "2,1,8,4,3,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 128}}, "7,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 128}}, "6,0,8,4,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 128}}, "7,1,8,4,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 128}}, "3,1,16,4,4,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "2,0,8,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "7,1,8,4,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 4}}, "7,0,8,2,4,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 4}}, "9,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 4}}, "7,1,8,4,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "0,0,16,4,2,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "5,0,16,4,2,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "0,0,8,2,2,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 512}}, "2,0,8,8,11,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 512}}, "0,0,16,4,5,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 512}}, "0,0,16,4,6,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 160, 32}}, "5,1,8,2,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 128}}, "0,0,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 128}}, "0,0,16,4,10,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 64}}, "0,1,16,1,2,4"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 16}}, "8,0,16,4,3,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 16}}, "6,0,8,4,5,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 16}}, "4,0,8,8,8,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 16}}, "0,0,8,4,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{96, 14, 14, 96, 32}}, "6,0,16,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{192, 7, 7, 128, 32}}, "4,0,8,4,5,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 32}}, "3,0,8,8,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "1,0,8,4,4,2"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "7,0,8,4,5,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 32}}, "4,0,8,4,7,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 64}}, "7,0,8,4,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 64}}, "6,0,8,8,3,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "0,0,8,8,14,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "0,0,8,8,5,1"},
+    {"gfx906_56", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "0,0,8,4,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "11x11-0x0-4x4-1x1-0-NCHW-FP32-B", {{96, 55, 55, 3, 64}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 147, 147, 32, 32}}, "8,16,16,32,2,1,8,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 71, 71, 80, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 71, 71, 64, 32}}, "16,16,16,16,4,4,2,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{32, 149, 149, 32, 32}}, "8,16,16,32,1,2,8,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{80, 73, 73, 192, 32}}, "16,16,16,16,4,2,4,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 149, 149, 3, 32}}, "8,16,32,32,1,4,2,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 192, 32}}, "32,8,32,32,1,4,4,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 8, 8, 192, 32}}, "16,32,32,32,2,1,4,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 288, 32}}, "16,16,16,16,1,1,8,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{96, 17, 17, 96, 32}}, "8,16,16,16,2,1,8,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 320, 32}}, "32,16,32,32,1,2,8,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 384, 32}}, "16,8,16,16,1,2,8,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 35, 35, 192, 32}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 16}}, "8,32,16,32,2,1,1,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 8}}, "8,32,16,32,2,1,2,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 16}}, "16,16,32,32,2,2,2,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 1}}, "8,16,16,32,1,2,1,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 1}}, "8,16,32,32,4,1,2,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 2}}, "16,16,16,16,2,1,2,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 64}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 32}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 16}}, "8,32,16,32,2,1,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 8}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 1}}, "8,16,16,32,1,2,8,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 2}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 64}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 16}}, "16,16,16,32,1,2,8,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "3x3-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 54, 54, 3, 8}}, "16,8,16,32,1,4,2,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 4}}, "16,8,16,32,1,4,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 8}}, "8,16,16,32,2,2,1,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 16}}, "8,32,16,32,2,1,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 32}}, "8,16,16,32,2,2,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 80, 349, 1, 16}}, "16,8,16,32,1,4,1,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{128, 39, 174, 64, 16}}, "16,32,16,32,1,1,4,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 48, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 16}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 50}}, "8,16,32,32,4,1,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 128}}, "16,16,16,16,2,2,2,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 24, 128}}, "16,16,16,16,4,4,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 128}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 128}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 128}}, "16,16,8,8,2,2,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 32}}, "16,16,16,16,4,1,2,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 32}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 32}}, "8,8,8,8,2,1,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 32}}, "8,8,8,8,2,1,1,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 512, 16}}, "8,8,16,16,2,2,4,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 16}}, "8,8,8,8,1,1,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{192, 27, 27, 64, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{48, 35, 35, 64, 32}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 16}}, "16,16,32,32,2,2,2,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 48, 16}}, "16,16,16,16,1,1,4,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 16}}, "8,8,8,8,1,1,2,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 50}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 128}}, "8,8,16,16,1,1,8,2,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{24, 14, 14, 64, 128}}, "8,8,16,16,1,1,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 128}}, "8,16,32,32,1,4,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 128}}, "16,16,8,8,2,4,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 32}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 128, 32}}, "8,8,16,16,1,1,4,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 64, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 32}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 32}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{64, 27, 27, 192, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 64}}, "8,16,16,16,2,1,1,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,8,16,16,2,2,1,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "16,8,16,16,1,2,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 8}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 4}}, "8,16,16,16,2,1,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 2}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 1}}, "16,32,32,32,2,1,1,4,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "8,16,32,32,1,4,2,2,1"},
+    {"gfx906_56", "ConvOclDirectFwd", "7x7-3x3-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "8,8,32,32,4,4,1,1,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-B", {{256, 7, 7, 832, 16}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-F", {{832, 7, 7, 256, 16}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 32}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,128,1,1,0,4,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,256,1,1,0,4,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,128,1,1,0,2,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,128,1,1,0,4,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,64,1,1,0,4,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,128,1,1,0,4,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 64}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 64}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 256, 512, 64, 1}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 192, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 128, 256, 192, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 192, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 128, 256, 256, 1}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 256, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 64, 128, 480, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 64, 128, 480, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 64, 128, 480, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 528, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 64, 128, 832, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 832, 1}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{19, 64, 128, 1024, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 128}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 1}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 128, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 64, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "1,64,1,1,1,1,64,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "1,64,1,1,1,0,32,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 192, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 64}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "1,64,1,1,1,0,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 96, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 256, 512, 64, 1}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 96, 1}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 32, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 64, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 192, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 96, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 16, 1}}, "1,64,1,1,1,4,64,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 64, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 160, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 112, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 128, 128, 24, 1}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 64, 1}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 128, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 24, 1}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 32, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 256, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 256, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 160, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 128, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 192, 1}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 48, 1}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 64, 128, 19, 1}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,64,1,1,1,1,32,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "1,64,1,1,1,4,64,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1, 1760, 1760, 1, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 8}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 16}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,64,1,1,1,4,32,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 128}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_56", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,16,1,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,32,1,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,32,1,32,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,32,1,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,16,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "2,16,2,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,16,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,32,1,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,32,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,32,1,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "2,32,2,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,32,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "2,32,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,32,1,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,32,1,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "2,32,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "3,32,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,32,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,32,1,32,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "2,32,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,32,1,32,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,16,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,32,1,16,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "2,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,16,1,16,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,32,1,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,32,1,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,32,1,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "2,4,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,4,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,16,1,32,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 1}}, "1,4,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,4,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,16,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,16,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,16,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,16,1,16,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 32}}, "1,32,1,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,16,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,16,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,32,1,16,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 7, 7, 1056, 64}}, "1,16,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,32,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,32,1,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,32,1,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,16,1,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "2,32,2,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 128}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "3,32,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 64}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 256, 64}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 64}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 64}}, "1,32,1,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{448, 8, 8, 2048, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,32,2,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 128}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,32,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 55, 55, 256, 16}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "3,32,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 256, 64}}, "2,32,2,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,32,1,16,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,16,1,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,16,1,32,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "2,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,32,1,16,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,32,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,32,1,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,32,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 2}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 32}}, "1,16,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,16,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 192, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 17, 17, 1024, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,32,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 32}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,16,1,64,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,32,1,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,32,1,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "2,16,2,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "2,16,2,32,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,16,1,16,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "2,16,2,32,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 32}}, "1,16,1,64,3,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "3,16,3,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "3,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,16,1,16,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "4,16,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "3,16,4,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,16,1,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 32}}, "4,16,5,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "2,16,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "4,16,4,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,16,2,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "2,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "2,16,2,32,4,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "2,16,4,16,3,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 32}}, "3,16,3,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "4,16,4,16,3,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "2,16,2,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "2,32,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "4,16,5,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "4,32,7,16,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "2,16,2,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "4,16,5,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "4,16,5,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "2,16,2,32,4,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "3,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "3,16,3,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "4,16,4,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "4,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "2,16,2,64,3,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "2,16,5,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "3,32,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,32,1,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "2,16,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "3,16,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,16,1,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "3,16,4,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "2,16,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,32,7,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "2,16,2,32,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "4,16,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "4,16,4,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,16,2,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "2,4,4,16,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "2,16,2,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "2,16,2,32,4,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "2,32,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "2,16,2,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "2,16,2,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "2,16,2,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "2,16,4,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "2,4,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "4,1,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "1,1,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 2}}, "1,4,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,4,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,4,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "1,4,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 2}}, "2,4,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "2,16,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "2,16,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "2,16,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,16,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "2,16,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "2,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "1,16,1,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "2,16,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,16,3,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "2,16,2,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "2,16,2,32,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,16,2,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 32}}, "4,16,4,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "2,16,2,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "4,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "3,16,3,16,4,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,4,1,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "3,16,3,16,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 32}}, "4,16,4,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 32}}, "4,16,4,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "4,16,4,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "2,16,2,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "2,16,2,32,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "3,16,3,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "3,16,3,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "3,16,3,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "3,16,4,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "3,16,3,16,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,16,1,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 64}}, "3,16,4,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 64}}, "4,16,5,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "4,32,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "4,16,5,16,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 64}}, "1,16,1,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 64}}, "3,16,3,16,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "2,16,2,32,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "4,16,4,16,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "4,16,4,16,3,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "4,16,4,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,32,1,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "3,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "3,16,3,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "4,32,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 32}}, "4,16,4,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 32}}, "4,32,7,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "4,16,5,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "4,16,5,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "4,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "4,16,5,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "3,16,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "2,16,2,32,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "2,16,3,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "3,16,3,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "2,16,2,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "4,16,5,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 128}}, "4,16,4,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "2,16,2,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,16,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "4,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 160, 128}}, "4,16,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "4,32,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "3,16,4,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "3,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "4,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "2,16,2,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 128}}, "4,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 160, 128}}, "4,16,5,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 128}}, "3,16,4,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,16,1,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "2,16,2,32,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,16,2,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "2,16,2,32,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "2,16,2,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "2,16,2,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 32}}, "2,16,2,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "2,32,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "3,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "3,16,4,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "4,16,5,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "2,16,2,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 64}}, "3,16,5,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "4,16,5,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "4,32,7,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 448, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "2,16,2,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "2,16,2,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 64}}, "1,16,2,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 128}}, "2,16,2,32,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "2,32,2,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "3,32,3,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "3,16,3,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 8}}, "2,16,3,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "2,16,2,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "2,16,2,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "2,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "4,16,4,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "2,16,3,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "4,16,7,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,16,2,32,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "2,16,2,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 4}}, "1,16,1,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 2}}, "3,16,3,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "2,16,3,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 2}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 1}}, "2,16,2,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "2,16,2,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,32,1,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "2,16,2,64,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "4,32,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "2,16,2,32,3,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "4,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "3,16,3,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,32,1,64,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "4,16,4,16,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "2,16,2,32,4,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,32,1,64,3,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,32,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "2,32,2,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "4,32,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "2,32,2,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,32,1,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 8}}, "1,32,1,16,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "2,32,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "2,32,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,32,1,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "2,32,2,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,32,1,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,16,1,64,4,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "2,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "2,32,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,32,1,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 128}}, "1,32,1,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,32,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,32,1,32,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,32,1,32,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,16,1,64,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,16,1,16,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,16,1,64,2,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,32,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "2,16,2,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,32,1,32,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "4,16,4,16,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "2,16,2,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "3,16,3,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "3,16,3,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "4,16,4,64,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "2,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "2,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "4,16,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "2,32,2,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "4,16,4,16,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,16,1,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "4,16,7,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "4,16,4,64,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "4,16,4,16,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "4,32,4,16,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "4,16,7,32,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,16,1,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "2,16,2,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "1,16,1,64,1,3"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "3,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 2}}, "2,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "4,16,7,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,16,1,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "3,16,3,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "3,16,3,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 128}}, "4,16,4,16,3,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "4,16,5,32,2,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "2,32,2,32,3,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 128}}, "3,32,7,32,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 16}}, "4,16,5,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,16,1,32,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{16, 7, 7, 512, 2}}, "1,16,1,16,1,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,16,1,32,4,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "3,16,3,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "2,16,2,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "2,16,2,32,2,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "2,16,2,64,4,1"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "4,16,4,64,2,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "3,16,4,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "2,16,2,32,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "4,16,7,64,1,2"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "2,16,7,64,1,4"},
+    {"gfx906_64", "ConvAsm1x1U", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,16,1,64,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 16}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 8}}, "8,2,4,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 8}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 8}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 8}}, "2,8,4,4,2,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 8}}, "2,8,2,4,4,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 16}}, "2,8,2,2,8,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 16}}, "2,8,4,4,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 16}}, "2,8,8,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 16}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 1}}, "4,4,2,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 2}}, "4,4,2,4,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "1,16,4,2,4,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 1}}, "4,4,8,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 112, 112, 64, 2}}, "8,2,4,2,2,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 2}}, "2,8,2,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 2}}, "4,4,4,2,4,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "4,4,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 32}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 32}}, "4,4,4,4,4,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 576, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 576, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 4, 4, 576, 32}}, "2,8,2,4,4,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 32}}, "2,8,4,4,8,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 608, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 32}}, "4,4,4,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1024, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 32}}, "2,8,4,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 320, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 576, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 608, 64}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 608, 64}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{352, 7, 7, 1056, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1056, 64}}, "1,16,2,8,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 7, 7, 1024, 64}}, "4,4,4,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1024, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 192, 1}}, "8,2,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 128, 256, 192, 1}}, "8,2,8,2,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 192, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 128, 256, 256, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 128, 256, 256, 1}}, "8,2,4,2,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 480, 1}}, "4,4,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 64, 128, 480, 1}}, "4,4,4,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 64, 128, 480, 1}}, "8,2,2,2,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 480, 1}}, "8,2,8,2,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 64, 128, 512, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 128, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 64, 128, 512, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 512, 1}}, "4,4,4,2,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 528, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 528, 1}}, "2,8,2,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 528, 1}}, "8,2,2,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 528, 1}}, "8,2,4,2,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 832, 1}}, "2,8,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 64, 128, 832, 1}}, "2,8,2,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 832, 1}}, "8,2,2,2,8,1,1,2"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 64, 128, 832, 1}}, "4,4,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 64, 128, 832, 1}}, "2,8,4,8,4,1,1,2"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 64, 128, 832, 1}}, "4,4,2,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{19, 64, 128, 1024, 1}}, "4,4,1,4,1,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 16}}, "8,2,8,2,8,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 16}}, "2,8,4,4,2,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 64}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 64}}, "2,8,4,4,8,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 64}}, "1,16,2,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 64}}, "1,16,2,8,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 64}}, "1,16,2,8,2,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 56, 56, 256, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 256, 64}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 28, 28, 512, 64}}, "2,8,2,4,4,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 32}}, "1,16,2,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 32}}, "2,8,4,2,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 128}}, "1,16,2,8,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 128}}, "4,4,2,4,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 128}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 128}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 128}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 128}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 128}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 128}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 128}}, "4,4,8,4,2,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 128}}, "8,2,8,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 128}}, "4,4,4,4,2,1,1,2"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 128}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 128}}, "4,4,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 128}}, "8,2,8,2,8,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 128}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 128}}, "1,16,4,8,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 128}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 7, 7, 832, 128}}, "4,4,2,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 128}}, "4,4,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 128}}, "8,2,4,2,8,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 192, 32}}, "2,8,2,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 28, 28, 192, 32}}, "4,4,2,2,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 32}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 480, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{16, 14, 14, 480, 32}}, "4,4,4,4,2,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 480, 32}}, "2,8,4,8,2,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 512, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{112, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{24, 14, 14, 512, 32}}, "8,2,4,2,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 512, 32}}, "2,8,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{144, 14, 14, 512, 32}}, "2,8,2,2,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 512, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 528, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 14, 14, 528, 32}}, "2,8,2,8,2,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 7, 7, 832, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 7, 7, 832, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 832, 32}}, "4,4,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 832, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 7, 7, 832, 32}}, "4,4,2,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 192, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 32}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 32}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 32}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 32}}, "1,16,4,8,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 32}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 32}}, "1,16,4,8,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 32}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 32}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 32}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{80, 73, 73, 64, 64}}, "8,2,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 288, 64}}, "8,2,8,2,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 288, 64}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 1280, 64}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1280, 64}}, "1,16,4,8,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 1280, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 1280, 64}}, "1,16,4,8,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{320, 8, 8, 2048, 64}}, "4,4,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 2048, 64}}, "2,8,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{448, 8, 8, 2048, 64}}, "2,8,4,8,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 8, 8, 2048, 64}}, "2,8,4,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 128}}, "2,8,4,4,8,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 128, 128}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 512, 128}}, "4,4,4,4,8,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 128}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 16}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 16}}, "8,2,8,2,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 55, 55, 256, 64}}, "8,2,8,2,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 64}}, "2,8,4,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 8, 8, 1536, 32}}, "4,4,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 1536, 32}}, "2,8,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 17, 17, 1024, 32}}, "2,8,4,8,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 17, 17, 1024, 32}}, "4,4,8,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{384, 17, 17, 1024, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 35, 35, 384, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 384, 32}}, "4,4,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 73, 73, 160, 32}}, "4,4,4,2,8,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 4}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 512, 4}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 4}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "8,2,4,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 55, 55, 64, 2}}, "4,4,4,2,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "8,2,2,2,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "8,2,2,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 1}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 2048, 1}}, "1,16,2,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 2}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 32}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "4,4,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 256, 64}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 320, 64}}, "2,8,2,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 14, 14, 576, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 7, 7, 1056, 64}}, "4,4,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 64, 128, 512, 1}}, "8,2,8,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "4,4,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 1024, 32}}, "1,16,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 64, 32}}, "2,8,2,2,8,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 1024, 32}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 128}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 480, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 512, 32}}, "4,4,8,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 528, 32}}, "2,8,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 35, 35, 256, 32}}, "4,4,4,4,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{48, 35, 35, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 35, 35, 192, 64}}, "8,2,8,2,4,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{192, 17, 17, 768, 64}}, "1,16,2,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{160, 17, 17, 768, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 192, 64}}, "2,8,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-W", {{32, 28, 28, 192, 64}}, "4,4,4,4,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 64}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 64}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 64}}, "4,4,8,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,2,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 32}}, "1,16,4,4,8,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 32}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 8}}, "2,8,2,4,2,1,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 8}}, "1,16,2,4,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 8}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 16}}, "2,8,2,8,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 16}}, "2,8,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 8}}, "1,16,2,8,2,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 8}}, "1,16,2,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 8}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 8}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 16}}, "1,16,2,4,4,1,8,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 16}}, "4,4,8,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 16}}, "1,16,4,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 1}}, "8,2,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 14, 14, 128, 1}}, "2,8,2,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 28, 28, 64, 2}}, "8,2,4,2,2,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 7, 7, 256, 2}}, "1,16,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 1}}, "4,4,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 1}}, "1,16,2,4,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 1}}, "1,16,8,2,4,1,1,2"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{2048, 7, 7, 1024, 1}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 1024, 2}}, "1,16,4,2,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 512, 128}}, "2,8,4,4,8,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,2,8,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 16, 2}}, "4,4,2,2,2,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "2,8,4,4,2,2,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 4}}, "4,4,4,2,4,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 4}}, "2,8,4,4,4,2,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{1024, 14, 14, 512, 4}}, "1,16,2,4,8,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "2,8,2,4,2,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "2,8,4,4,4,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "2,8,2,4,4,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 256, 2}}, "4,4,4,2,2,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 64}}, "8,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 64}}, "7,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 64}}, "7,1,16,4,3,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 16}}, "0,1,16,1,1,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 16}}, "0,0,16,2,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 16}}, "0,0,16,4,6,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 8}}, "0,1,8,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 8}}, "0,1,8,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 8}}, "0,0,8,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 8}}, "0,1,8,4,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 8}}, "0,1,16,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 8}}, "0,1,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 8}}, "0,0,16,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 8}}, "0,1,8,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 8}}, "0,1,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 8}}, "8,1,8,4,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 16}}, "0,0,16,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 16}}, "0,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 8}}, "0,0,16,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 8}}, "6,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 8}}, "6,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 16}}, "0,0,8,2,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "5,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "4,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 16}}, "0,1,16,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 16}}, "0,0,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 16}}, "0,1,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 16}}, "0,1,8,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{16, 48, 480, 1, 1}}, "1,1,16,1,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 1}}, "7,0,16,1,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 12, 120, 32, 1}}, "0,0,16,1,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 6, 60, 64, 1}}, "9,0,16,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 54, 54, 64, 1}}, "5,0,16,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 27, 27, 128, 1}}, "9,0,8,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 1}}, "8,0,8,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 256, 1}}, "4,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 1}}, "4,1,16,1,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 1}}, "9,0,16,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 1}}, "4,0,8,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 1}}, "6,1,8,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 1}}, "8,0,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 1}}, "5,0,8,2,6,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 2}}, "2,1,16,1,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 2}}, "6,0,16,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 2}}, "3,1,8,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 2}}, "8,1,8,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 2}}, "6,1,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 2}}, "5,0,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 1}}, "5,0,16,1,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 1}}, "0,0,8,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 1}}, "7,0,8,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 2}}, "9,0,16,1,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 2}}, "5,0,8,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 2}}, "9,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 1}}, "4,0,16,2,1,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 1}}, "2,1,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 1}}, "9,1,16,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 1}}, "3,1,8,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 80, 350, 64, 2}}, "3,0,16,2,1,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 40, 175, 128, 2}}, "2,0,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 20, 84, 256, 2}}, "8,0,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 10, 42, 512, 2}}, "5,1,8,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 32}}, "9,0,16,4,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "8,0,8,2,3,3"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 28, 28, 96, 32}}, "0,0,8,2,6,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 96, 32}}, "8,0,8,4,5,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "4,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{160, 14, 14, 160, 32}}, "5,0,8,2,14,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 160, 32}}, "3,0,8,4,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 14, 14, 192, 32}}, "5,1,8,4,9,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 192, 32}}, "9,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 192, 32}}, "5,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 224, 32}}, "9,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 192, 32}}, "0,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 147, 147, 32, 32}}, "9,1,16,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 64, 32}}, "3,0,8,2,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 35, 35, 96, 32}}, "2,0,8,2,3,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 8, 8, 448, 32}}, "8,1,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 64, 128, 96, 1}}, "6,0,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 64, 128, 112, 1}}, "2,1,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 64, 128, 128, 1}}, "3,0,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 64, 128, 144, 1}}, "5,0,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 64, 128, 160, 1}}, "7,0,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 64, 128, 192, 1}}, "0,1,16,4,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 32}}, "8,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 32}}, "0,1,16,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 32}}, "9,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 32}}, "8,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 56, 56, 64, 64}}, "9,1,16,4,3,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 56, 56, 64, 128}}, "5,1,16,4,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 128}}, "0,0,8,4,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 128}}, "8,0,8,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 128}}, "7,0,8,2,14,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 128}}, "6,0,8,2,13,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 128}}, "9,0,8,2,14,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 128}}, "6,0,8,4,9,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 128}}, "3,0,8,4,6,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 7, 7, 160, 128}}, "5,1,8,2,7,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 7, 7, 192, 128}}, "5,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 96, 32}}, "7,0,8,4,2,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{192, 28, 28, 128, 32}}, "0,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{208, 14, 14, 96, 32}}, "6,0,8,4,6,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 14, 14, 112, 32}}, "7,1,8,2,14,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 128, 32}}, "5,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{288, 14, 14, 144, 32}}, "5,1,8,4,4,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{320, 14, 14, 160, 32}}, "6,0,8,4,8,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 128}}, "0,0,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 64}}, "9,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 64}}, "6,1,16,4,9,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 64}}, "0,0,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 50}}, "9,0,16,4,9,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 50}}, "7,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 192, 256}}, "8,0,16,4,9,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 256}}, "5,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 256}}, "7,0,16,4,9,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 64}}, "9,1,16,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 64}}, "7,0,16,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 64}}, "8,0,16,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 64}}, "8,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 64}}, "3,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 64}}, "9,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 32}}, "3,1,16,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 112, 112, 64, 32}}, "6,0,16,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 128, 32}}, "5,0,16,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 56, 56, 256, 32}}, "4,1,16,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 256, 32}}, "4,1,8,2,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 28, 28, 512, 32}}, "5,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 14, 14, 512, 32}}, "7,1,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{32, 24, 240, 16, 16}}, "0,0,16,2,1,8"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 32}}, "0,0,8,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 64}}, "4,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 64}}, "0,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 50}}, "9,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 50}}, "9,1,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 35, 35, 192, 32}}, "2,1,8,4,3,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 128}}, "7,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 128}}, "6,0,8,4,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 128}}, "7,1,8,4,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 128}}, "3,1,16,4,4,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 16}}, "2,0,8,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 8}}, "7,1,8,4,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 4}}, "7,0,8,2,4,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 4}}, "9,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 4}}, "7,1,8,4,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 4}}, "0,0,16,4,2,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 2}}, "5,0,16,4,2,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 55, 55, 64, 1}}, "0,0,8,2,2,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 384, 512}}, "2,0,8,8,11,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 512}}, "0,0,16,4,5,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{384, 13, 13, 256, 512}}, "0,0,16,4,6,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{96, 14, 14, 64, 32}}, "3,0,8,2,4,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{224, 7, 7, 160, 32}}, "5,1,8,2,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 384, 128}}, "0,0,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{256, 13, 13, 256, 128}}, "0,0,16,4,10,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-1x1-1x1-0-NCHW-FP32-W", {{64, 224, 224, 3, 64}}, "0,1,16,1,2,4"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 16}}, "8,0,16,4,3,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 16}}, "6,0,8,4,5,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 16}}, "4,0,8,8,8,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 16}}, "0,0,8,4,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{160, 14, 14, 128, 32}}, "6,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{96, 14, 14, 96, 32}}, "6,0,16,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{192, 7, 7, 128, 32}}, "4,0,8,4,5,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 32}}, "3,0,8,8,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{64, 28, 28, 64, 32}}, "1,0,8,4,4,2"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 32}}, "7,0,8,4,5,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 4, 4, 512, 32}}, "4,0,8,4,7,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 14, 14, 128, 64}}, "7,0,8,4,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 7, 7, 256, 64}}, "6,0,8,8,3,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{512, 7, 7, 512, 16}}, "0,0,8,8,14,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{256, 14, 14, 256, 16}}, "0,0,8,8,5,1"},
+    {"gfx906_64", "ConvAsmBwdWrW3x3", "3x3-1x1-2x2-1x1-0-NCHW-FP32-W", {{128, 28, 28, 128, 16}}, "0,0,8,4,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "11x11-0x0-4x4-1x1-0-NCHW-FP32-B", {{96, 55, 55, 3, 64}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 147, 147, 32, 32}}, "8,16,16,32,2,1,8,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 71, 71, 80, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 71, 71, 64, 32}}, "16,16,16,16,4,4,2,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{32, 149, 149, 32, 32}}, "8,16,16,32,1,2,8,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-1x1-1x1-0-NCHW-FP32-F", {{80, 73, 73, 192, 32}}, "16,16,16,16,4,2,4,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 149, 149, 3, 32}}, "8,16,32,32,1,4,2,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 192, 32}}, "32,8,32,32,1,4,4,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 8, 8, 192, 32}}, "16,32,32,32,2,1,4,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 288, 32}}, "16,16,16,16,1,1,8,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{96, 17, 17, 96, 32}}, "8,16,16,16,2,1,8,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{320, 8, 8, 320, 32}}, "32,16,32,32,1,2,8,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{384, 17, 17, 384, 32}}, "16,8,16,16,1,2,8,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-0x0-2x2-1x1-0-NCHW-FP32-B", {{192, 35, 35, 192, 32}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 16}}, "8,32,16,32,2,1,1,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 8}}, "8,32,16,32,2,1,2,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 16}}, "16,16,32,32,2,2,2,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{16, 48, 480, 1, 1}}, "8,16,16,32,1,2,1,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 1}}, "8,16,32,32,4,1,2,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 2}}, "16,16,16,16,2,1,2,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 64}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-B", {{64, 224, 224, 3, 32}}, "16,16,16,32,1,4,2,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 16}}, "8,32,16,32,2,1,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 8}}, "8,32,16,32,2,1,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{1, 48, 480, 16, 1}}, "8,16,16,32,1,2,8,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 1}}, "8,16,32,32,1,4,4,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 2}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{3, 224, 224, 64, 64}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-1x1-1x1-0-NCHW-FP32-F", {{16, 24, 240, 32, 16}}, "16,16,16,32,1,2,8,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "3x3-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 54, 54, 3, 8}}, "16,8,16,32,1,4,2,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 4}}, "16,8,16,32,1,4,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 8}}, "8,16,16,32,2,2,1,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 16}}, "8,32,16,32,2,1,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x20-0x0-2x2-1x1-0-NCHW-FP32-B", {{32, 79, 341, 1, 32}}, "8,16,16,32,2,2,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{64, 80, 349, 1, 16}}, "16,8,16,32,1,4,1,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-1x1-2x2-1x1-0-NCHW-FP32-B", {{128, 39, 174, 64, 16}}, "16,32,16,32,1,1,4,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 48, 32}}, "16,16,16,16,4,2,2,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 16}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{256, 27, 27, 96, 50}}, "8,16,32,32,4,1,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 128}}, "16,16,16,16,2,2,2,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 24, 128}}, "16,16,16,16,4,4,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 32, 128}}, "8,8,16,16,1,1,4,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 128}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 128}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 128}}, "16,16,8,8,2,2,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 16, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 16, 32}}, "16,16,16,16,4,1,2,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 32, 32}}, "16,16,16,16,4,1,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 32, 32}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 32, 32}}, "8,8,8,8,2,1,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 48, 32}}, "8,8,8,8,2,1,1,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{48, 14, 14, 512, 16}}, "8,8,16,16,2,2,4,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 16}}, "8,8,8,8,1,1,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-B", {{192, 27, 27, 64, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{48, 35, 35, 64, 32}}, "8,16,16,32,2,1,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 16}}, "16,16,32,32,2,2,2,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 48, 16}}, "16,16,16,16,1,1,4,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 16}}, "8,8,8,8,1,1,2,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 64}}, "8,16,32,32,2,2,8,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{96, 27, 27, 256, 50}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 128}}, "8,8,16,16,1,1,8,2,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 128}}, "8,16,32,32,2,2,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{24, 14, 14, 64, 128}}, "8,8,16,16,1,1,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 128}}, "8,16,32,32,1,4,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 128}}, "16,16,8,8,2,4,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 14, 14, 48, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{16, 28, 28, 32, 32}}, "8,16,32,32,4,1,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 128, 32}}, "8,8,16,16,1,1,4,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 14, 14, 64, 32}}, "16,16,8,16,4,2,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 28, 28, 96, 32}}, "8,16,32,32,2,2,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{32, 7, 7, 128, 32}}, "16,16,8,8,2,2,1,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "5x5-2x2-1x1-1x1-0-NCHW-FP32-F", {{64, 27, 27, 192, 128}}, "16,16,32,32,2,2,8,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 64}}, "8,16,16,16,2,1,1,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,8,16,16,2,2,1,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "16,8,16,16,1,2,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 8}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 4}}, "8,16,16,16,2,1,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 2}}, "16,16,16,16,1,1,1,1,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-0x0-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 1}}, "16,32,32,32,2,1,1,4,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 32}}, "8,16,32,32,1,4,2,4,2"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-2x2-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 128}}, "8,16,32,32,1,4,2,2,1"},
+    {"gfx906_64", "ConvOclDirectFwd", "7x7-3x3-2x2-1x1-0-NCHW-FP32-B", {{64, 112, 112, 3, 16}}, "8,8,32,32,4,4,1,1,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-B", {{256, 7, 7, 832, 16}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP16-F", {{832, 7, 7, 256, 16}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 32}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{80, 73, 73, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 768, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 17, 17, 768, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 17, 17, 1024, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 8, 8, 1536, 32}}, "1,128,1,1,0,4,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1536, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 73, 73, 160, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 384, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 16}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 16}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 16}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 16}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 16}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 8}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 16}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 16}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 8}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 8}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 8}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 8}}, "1,256,1,1,0,4,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 8}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 16}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 1}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 7, 7, 832, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 512, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 1}}, "1,64,1,1,0,2,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 1}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 1}}, "1,128,1,1,0,2,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 1}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 1}}, "1,128,1,1,0,4,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 112, 112, 64, 2}}, "1,64,1,1,0,4,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 2}}, "1,256,1,1,0,2,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 2}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 2}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 2}}, "1,64,1,1,0,4,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 2}}, "1,128,1,1,0,4,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 320, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 32}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 32}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 320, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{224, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 576, 64}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 576, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 576, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 608, 64}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 608, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 608, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 4, 4, 608, 64}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 608, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1024, 64}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 256, 512, 64, 1}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 128, 256, 192, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 128, 256, 192, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 192, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 128, 256, 256, 1}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 128, 256, 256, 1}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 64, 128, 480, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 64, 128, 480, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 64, 128, 480, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 528, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 64, 128, 528, 1}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 64, 128, 832, 1}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 64, 128, 832, 1}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 64, 128, 832, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{19, 64, 128, 1024, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 64}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 32}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 32}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 32}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 32}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 32}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 14, 14, 1024, 32}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 28, 28, 512, 32}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 56, 56, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 28, 28, 192, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 256, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 14, 14, 480, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 480, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{16, 14, 14, 480, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 480, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 14, 14, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 128}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 528, 128}}, "1,256,1,1,0,4,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 14, 14, 528, 128}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 832, 128}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 128}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 35, 35, 192, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 17, 17, 768, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 1280, 64}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 2048, 64}}, "1,64,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 128}}, "1,64,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 128}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 8}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 8}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 8}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 14, 14, 1024, 4}}, "1,128,1,1,0,2,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 28, 28, 128, 4}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{512, 7, 7, 2048, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 256, 4}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 28, 28, 512, 4}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 4}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 2}}, "1,128,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 2}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 256, 1}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 55, 55, 64, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{32, 14, 14, 512, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 7, 7, 832, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 8, 8, 1280, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{48, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 35, 35, 288, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{384, 17, 17, 1024, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 55, 55, 64, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{256, 56, 56, 64, 8}}, "1,128,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 512, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 32}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{352, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{128, 7, 7, 1056, 32}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{96, 14, 14, 576, 64}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{192, 7, 7, 1056, 64}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 64, 128, 512, 1}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{112, 64, 128, 512, 1}}, "1,256,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 128, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 64, 128, 512, 1}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{64, 28, 28, 192, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{160, 14, 14, 512, 128}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{24, 14, 14, 512, 128}}, "1,256,1,1,0,4,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{144, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-B", {{320, 8, 8, 2048, 64}}, "1,128,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 32}}, "1,64,1,1,1,1,64,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 32}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 256, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 32, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 32}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 32}}, "1,64,1,1,1,0,32,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 128, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 192, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 256, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 17, 17, 384, 32}}, "1,8,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 256, 32}}, "1,8,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1536, 8, 8, 384, 32}}, "1,8,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{160, 73, 73, 64, 32}}, "1,8,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 192, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 64, 32}}, "1,8,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{384, 35, 35, 96, 32}}, "1,8,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 64}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 16}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 16}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 8}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 8}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 8}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 8}}, "1,64,1,1,1,0,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 16}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 192, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 256, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 112, 112, 64, 2}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 2}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 32}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 192, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 160, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 96, 32}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 4, 4, 128, 32}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 32}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{320, 28, 28, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 224, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 64, 64}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 14, 14, 96, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{576, 4, 4, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 128, 64}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{608, 14, 14, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 192, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 160, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 352, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 7, 7, 128, 64}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 256, 512, 64, 1}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 96, 1}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 32, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 128, 256, 64, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 192, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 96, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 16, 1}}, "1,64,1,1,1,4,64,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 64, 128, 64, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 160, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 112, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 128, 128, 24, 1}}, "1,64,1,1,0,2,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 64, 1}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 128, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 24, 1}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 64, 128, 32, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 256, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 256, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 160, 1}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 32, 1}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 128, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 192, 1}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 64, 128, 48, 1}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 64, 128, 19, 1}}, "1,64,1,1,0,4,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 64}}, "1,64,1,1,1,1,32,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 32}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 32}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 96, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 16, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 32, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 16, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 24, 128}}, "1,64,1,1,0,2,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 64, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 128, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 144, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{528, 14, 14, 128, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 160, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 32, 128}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 128, 128}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 384, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 192, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 48, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 32}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 73, 73, 80, 64}}, "1,64,1,1,1,4,64,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 48, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 32, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 48, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{288, 35, 35, 48, 64}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 128, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{768, 17, 17, 160, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 320, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1280, 8, 8, 192, 64}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 320, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 448, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1, 1760, 1760, 1, 1}}, "1,256,1,1,0,4,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 128}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 128}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 16}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 16}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 7, 7, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 4}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 256, 2}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 55, 55, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 55, 55, 64, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 192, 32}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 64, 32}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 28, 28, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 64, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 7, 7, 2048, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 2}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{1056, 7, 7, 128, 32}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 128, 256, 64, 1}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 64, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 28, 28, 32, 128}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 28, 28, 64, 128}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 96, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{480, 14, 14, 64, 128}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{512, 14, 14, 112, 128}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{832, 7, 7, 256, 128}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{192, 35, 35, 64, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{256, 35, 35, 64, 64}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-1x1-1x1-0-NCHW-FP32-F", {{2048, 8, 8, 384, 64}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 64}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 16}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 16}}, "1,256,1,1,0,1,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 16}}, "1,64,1,1,0,1,16,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 8}}, "1,64,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 8}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 16}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 16}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 16}}, "1,256,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 8}}, "1,128,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 64}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,128,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 32}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 32}}, "1,256,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 1}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 7, 7, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 28, 28, 64, 2}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 14, 14, 128, 2}}, "1,128,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,2,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 2}}, "1,256,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 2}}, "1,128,1,1,0,1,4,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 2}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 32}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 128}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 128}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 16}}, "1,128,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 16}}, "1,256,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 4}}, "1,128,1,1,0,1,8,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 7, 7, 1024, 4}}, "1,64,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 4}}, "1,64,1,1,0,1,16,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 4}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 2}}, "1,256,1,1,0,1,8,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{512, 28, 28, 256, 1}}, "1,256,1,1,0,1,4,8,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{256, 14, 14, 512, 64}}, "1,256,1,1,0,2,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{128, 28, 28, 256, 8}}, "1,64,1,1,0,1,32,4,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-B", {{2048, 7, 7, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 64}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 16}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 16}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 16}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 16}}, "1,64,1,1,1,4,32,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 16}}, "1,64,1,1,1,1,32,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 8}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 8}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 8}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 8}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 64}}, "1,64,1,1,1,4,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 32}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 32}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{64, 56, 56, 256, 1}}, "1,64,1,1,1,0,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 1}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 14, 14, 1024, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{128, 28, 28, 512, 2}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 1}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 1}}, "16,16,16,16,1,1,2,3,1"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 1}}, "1,64,1,1,1,4,32,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 2}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 2}}, "1,64,1,1,1,0,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 32}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 128}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 128}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 128}}, "1,64,1,1,1,1,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 128}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 16}}, "1,64,1,1,1,4,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 8}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 8}}, "1,64,1,1,1,1,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 4}}, "1,64,1,1,1,4,32,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 512, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 4}}, "1,64,1,1,1,4,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 4}}, "1,64,1,1,1,1,16,256,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 4}}, "1,64,1,1,1,4,16,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 256, 4}}, "1,64,1,1,1,0,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 128, 2}}, "1,64,1,1,1,1,16,64,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 2}}, "1,64,1,1,1,4,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 55, 55, 512, 1}}, "1,64,1,1,1,1,16,128,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{512, 28, 28, 1024, 64}}, "1,64,1,1,1,1,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{1024, 14, 14, 2048, 16}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 512, 32}}, "1,64,1,1,1,0,32,2048,0"},
+    {"gfx906_64", "ConvOclDirectFwd1x1", "1x1-0x0-2x2-1x1-0-NCHW-FP32-F", {{256, 56, 56, 128, 2}}, "16,16,16,16,1,1,2,3,1"},
+};
+// clang-format on
+
+const PerfPredictorRecord* GetPerfPredictorRecords(std::size_t& n_records)
+{
+    n_records = sizeof(perf_predictor_records) / sizeof(perf_predictor_records[0]);
+    return perf_predictor_records;
+}
+
+} // namespace miopen
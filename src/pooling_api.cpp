@@ -87,7 +87,7 @@ extern "C" miopenStatus_t miopenSetNdPoolingDescriptor(miopenPoolingDescriptor_t
                                                        int* padA,
                                                        int* stridesA)
 {
-
+    MIOPEN_LOG_FUNCTION(poolDesc, mode, pmode, nbDims, windowDimA, padA, stridesA);
     return miopen::try_([&] {
         miopen::deref(poolDesc) =
             miopen::PoolingDescriptor(mode, pmode, windowDimA, padA, stridesA, nbDims);
@@ -102,7 +102,7 @@ extern "C" miopenStatus_t miopenGetNdPoolingDescriptor(miopenPoolingDescriptor_t
                                                        int* padA,
                                                        int* stridesA)
 {
-
+    MIOPEN_LOG_FUNCTION(poolDesc, mode, pmode, nbDims, windowDimA, padA, stridesA);
     return miopen::try_([&] {
         if(mode != nullptr)
         {
@@ -0,0 +1,412 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/errors.hpp>
+#include <miopen/host_math.hpp>
+#include <miopen/parallel_for.hpp>
+#include <miopen/rnn_host.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace miopen {
+namespace host {
+
+namespace {
+
+// Multiply-adds of the hidden product of a time step below which the two directions of a layer
+// run side by side instead of one after the other, each product spread over the threads.
+constexpr std::size_t rnn_step_grain = 1 << 18;
+// Values of a time step whose gates are updated as one piece of work.
+constexpr std::size_t rnn_gate_grain = 1 << 14;
+
+template <class V>
+V Sigmoid(V x)
+{
+    return 1 / (1 + Exp(-x));
+}
+
+} // namespace
+
+RNNForward::RNNForward(miopenRNNMode_t pmode,
+                       int players,
+                       int phidden,
+                       int pin_h,
+                       bool pbidirectional,
+                       bool pbiased,
+                       bool pskip_input,
+                       const float* w)
+    : mode(pmode),
+      layers(players),
+      hidden(phidden),
+      in_h(pin_h),
+      bidirectional(pbidirectional),
+      biased(pbiased),
+      skip_input(pskip_input)
+{
+    if(layers <= 0 || hidden <= 0 || in_h <= 0)
+        MIOPEN_THROW(miopenStatusBadParm, "RNN lengths must be positive");
+    if(skip_input && in_h != hidden)
+        MIOPEN_THROW(miopenStatusBadParm,
+                     "The input tensor size must equal to the hidden state size of the network "
+                     "in SKIP_INPUT mode!");
+
+    // The layout of RNNDescriptor: the input and hidden weights of every layer, each matrix
+    // with the rows of all gates of one direction after the other, then the input and hidden
+    // biases of every layer.
+    const std::size_t d      = Directions();
+    const std::size_t h      = hidden;
+    const std::size_t rows   = d * Gates() * h;
+    const std::size_t inputs = skip_input ? 0 : in_h;
+    const float* bias        = w + (inputs + h + (d * h + h) * (layers - 1)) * rows;
+
+    weights.resize(layers);
+    for(int li = 0; li < layers; li++)
+    {
+        Layer& layer          = weights[li];
+        const std::size_t len = li == 0 ? inputs : d * h;
+        if(len != 0)
+            layer.input.emplace_back(true, len, rows, w, len);
+        w += len * rows;
+        for(std::size_t dir = 0; dir < d; dir++)
+            layer.hidden.emplace_back(true, h, Gates() * h, w + dir * Gates() * h * h, h);
+        w += h * rows;
+
+        layer.bias.assign(2 * rows, 0.0f);
+        if(biased)
+            std::copy(bias + li * 2 * rows, bias + (li + 1) * 2 * rows, layer.bias.begin());
+    }
+}
+
+int RNNForward::Gates() const
+{
+    switch(mode)
+    {
+    case miopenRNNRELU:
+    case miopenRNNTANH: return 1;
+    case miopenLSTM: return 4;
+    case miopenGRU: return 3;
+    }
+    return 1;
+}
+
+std::size_t RNNForward::ReserveStride() const
+{
+    // The gates, then the cell and hidden states of LSTM or the hidden state of GRU.
+    const std::size_t states = mode == miopenLSTM ? 2 : mode == miopenGRU ? 1 : 0;
+    return (Gates() + states) * Directions() * std::size_t(hidden);
+}
+
+std::size_t RNNForward::HiddenColumn(std::size_t rows) const
+{
+    // The hidden states of LSTM and GRU follow their gates and cells in the first half of the
+    // reserve; the vanilla RNN keeps its activations in the second half instead.
+    const std::size_t width = Directions() * std::size_t(hidden);
+    if(mode == miopenLSTM)
+        return 5 * width;
+    if(mode == miopenGRU)
+        return 3 * width;
+    return layers * rows * ReserveStride();
+}
+
+std::size_t RNNForward::ReserveSize(const std::vector<int>& batches) const
+{
+    std::size_t rows = 0;
+    for(int b : batches)
+        rows += b;
+    return 2 * layers * rows * ReserveStride();
+}
+
+std::size_t RNNForward::WeightSize() const
+{
+    const std::size_t d      = Directions();
+    const std::size_t h      = hidden;
+    const std::size_t rows   = d * Gates() * h;
+    const std::size_t inputs = skip_input ? 0 : in_h;
+    return (inputs + h + (d * h + h) * (layers - 1) + (biased ? 2 * layers : 0)) * rows;
+}
+
+void RNNForward::Run(const std::vector<int>& batches,
+                     int hy_n,
+                     const float* x,
+                     const float* hx,
+                     const float* cx,
+                     float* y,
+                     float* hy,
+                     float* cy,
+                     float* reserve) const
+{
+    if(batches.empty() || batches[0] <= 0 || hy_n < batches[0])
+        MIOPEN_THROW(miopenStatusBadParm, "Incorrect RNN batch sizes");
+    std::vector<std::size_t> offsets{0};
+    for(std::size_t t = 0; t < batches.size(); t++)
+    {
+        if(t > 0 && (batches[t] > batches[t - 1] || batches[t] < 0))
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "Incorrect input batch size at time " + std::to_string(t) +
+                             "! Batch size must not ascend!");
+        offsets.push_back(offsets.back() + batches[t]);
+    }
+
+    std::vector<float> inference;
+    if(reserve == nullptr)
+    {
+        inference.resize(ReserveSize(batches));
+        reserve = inference.data();
+    }
+    const std::size_t states = std::size_t(layers) * Directions() * hy_n * hidden;
+    if(hy != nullptr)
+        std::fill(hy, hy + states, 0.0f);
+    if(mode == miopenLSTM && cy != nullptr)
+        std::fill(cy, cy + states, 0.0f);
+
+    for(int li = 0; li < layers; li++)
+        RunLayer(li, batches, offsets, hy_n, x, hx, cx, hy, cy, reserve);
+
+    // The hidden states of the last layer, or their activations for the vanilla RNN
+    const std::size_t rows   = offsets.back();
+    const std::size_t stride = ReserveStride();
+    const std::size_t width  = Directions() * std::size_t(hidden);
+    const float* out         = reserve + (layers - 1) * rows * stride + HiddenColumn(rows);
+    ParallelFor(
+        rows, std::max<std::size_t>(rnn_gate_grain / width, 1), [&](std::size_t b, std::size_t e) {
+            for(std::size_t r = b; r < e; r++)
+                std::copy(out + r * stride, out + r * stride + width, y + r * width);
+        });
+}
+
+void RNNForward::RunLayer(int li,
+                          const std::vector<int>& batches,
+                          const std::vector<std::size_t>& offsets,
+                          int hy_n,
+                          const float* x,
+                          const float* hx,
+                          const float* cx,
+                          float* hy,
+                          float* cy,
+                          float* reserve) const
+{
+    const std::size_t rows   = offsets.back();
+    const std::size_t stride = ReserveStride();
+    const std::size_t gates  = Directions() * Gates() * std::size_t(hidden);
+    const Layer& layer       = weights[li];
+    float* pre               = reserve + li * rows * stride;
+
+    // The input of all time steps at once: the biases, then the product with the input weights,
+    // or the input itself added to every gate when it is skipped.
+    ParallelFor(
+        rows, std::max<std::size_t>(rnn_gate_grain / gates, 1), [&](std::size_t b, std::size_t e) {
+            for(std::size_t r = b; r < e; r++)
+            {
+                float* g = pre + r * stride;
+                std::copy(layer.bias.begin(), layer.bias.begin() + gates, g);
+                if(li == 0 && skip_input)
+                    for(std::size_t k = 0; k < gates; k += hidden)
+                        Transform(hidden,
+                                  [](auto v, auto a) { return v + a; },
+                                  g + k,
+                                  g + k,
+                                  x + r * hidden);
+            }
+        });
+    if(li == 0 && !skip_input)
+    {
+        Gemm(false, rows, 1, x, in_h, layer.input[0], 1, pre, stride);
+    }
+    else if(li > 0)
+    {
+        const float* in = reserve + (li - 1) * rows * stride + HiddenColumn(rows);
+        Gemm(false, rows, 1, in, stride, layer.input[0], 1, pre, stride);
+    }
+
+    const auto direction = [&](std::size_t dir) {
+        RunDirection(li, dir, batches, offsets, hy_n, hx, cx, hy, cy, reserve);
+    };
+    if(bidirectional && std::size_t(batches[0]) * Gates() * hidden * hidden < rnn_step_grain)
+    {
+        ParallelFor(2, 1, [&](std::size_t b, std::size_t e) {
+            for(std::size_t dir = b; dir < e; dir++)
+                direction(dir);
+        });
+    }
+    else
+    {
+        for(int dir = 0; dir < Directions(); dir++)
+            direction(dir);
+    }
+}
+
+void RNNForward::RunDirection(int li,
+                              int dir,
+                              const std::vector<int>& batches,
+                              const std::vector<std::size_t>& offsets,
+                              int hy_n,
+                              const float* hx,
+                              const float* cx,
+                              float* hy,
+                              float* cy,
+                              float* reserve) const
+{
+    const std::size_t h      = hidden;
+    const std::size_t n      = Gates() * h;
+    const std::size_t rows   = offsets.back();
+    const std::size_t stride = ReserveStride();
+    const std::size_t width  = Directions() * h;
+    const std::size_t half   = layers * rows * stride;
+    const int steps          = batches.size();
+    const Layer& layer       = weights[li];
+    const float* bias        = layer.bias.data() + Directions() * n + dir * n;
+    // The cell and hidden states of the direction in a row of the reserve
+    const std::size_t c_col = 4 * width + dir * h;
+    const std::size_t h_col = HiddenColumn(rows) + dir * h;
+
+    const std::size_t state = (std::size_t(li) * Directions() + dir) * hy_n * h;
+    hx                      = hx == nullptr ? nullptr : hx + state;
+    cx                      = cx == nullptr ? nullptr : cx + state;
+    hy                      = hy == nullptr ? nullptr : hy + state;
+    cy                      = cy == nullptr ? nullptr : cy + state;
+
+    // The products with the previous hidden states, and zeros for the rows without one
+    std::vector<float> product(batches[0] * n);
+    const std::vector<float> zeros(n);
+
+    for(int s = 0; s < steps; s++)
+    {
+        const int t      = dir == 0 ? s : steps - 1 - s;
+        const int prev   = dir == 0 ? t - 1 : t + 1;
+        const int rows_t = batches[t];
+        // Rows which go on from the previous time step; the backward direction starts the rest
+        const int cont = s == 0 ? 0 : std::min(batches[prev], rows_t);
+        float* first   = reserve + (li * rows + offsets[t]) * stride;
+        const float* last =
+            s == 0 ? nullptr : reserve + (li * rows + offsets[prev]) * stride;
+
+        if(cont > 0)
+            Gemm(false, cont, 1, last + h_col, stride, layer.hidden[dir], 0, product.data(), n);
+        if(hx != nullptr && rows_t > cont)
+            Gemm(false,
+                 rows_t - cont,
+                 1,
+                 hx + cont * h,
+                 h,
+                 layer.hidden[dir],
+                 0,
+                 product.data() + cont * n,
+                 n);
+
+        const auto update = [&](std::size_t b) {
+            const bool recurrent = int(b) < cont || hx != nullptr;
+            const float* p       = recurrent ? product.data() + b * n : zeros.data();
+            const float* bh      = recurrent ? bias : zeros.data();
+            const float* h_prev =
+                int(b) < cont ? last + b * stride + h_col
+                              : hx != nullptr ? hx + b * h : zeros.data();
+            float* g  = first + b * stride + dir * n;
+            float* a  = g + half;
+            float* ho = first + b * stride + h_col;
+
+            switch(mode)
+            {
+            case miopenRNNRELU:
+            case miopenRNNTANH:
+                ForEachPack<float>(h, [&](std::size_t i, auto v) {
+                    using V     = decltype(v);
+                    const V pre = Load<V>(g + i) + (Load<V>(p + i) + Load<V>(bh + i));
+                    Store(g + i, pre);
+                    Store(a + i, mode == miopenRNNRELU ? (pre > 0 ? pre : V{}) : Tanh(pre));
+                });
+                break;
+            case miopenLSTM:
+            {
+                const float* c_prev =
+                    int(b) < cont ? last + b * stride + c_col
+                                  : cx != nullptr ? cx + b * h : zeros.data();
+                float* c = first + b * stride + c_col;
+                ForEachPack<float>(h, [&](std::size_t i, auto v) {
+                    using V = decltype(v);
+                    V pre[4];
+                    for(std::size_t k = 0; k < 4; k++)
+                    {
+                        const std::size_t j = k * h + i;
+                        pre[k] = Load<V>(g + j) + (Load<V>(p + j) + Load<V>(bh + j));
+                        Store(g + j, pre[k]);
+                    }
+                    const V in_gate     = Sigmoid(pre[0]);
+                    const V forget_gate = Sigmoid(pre[1]);
+                    const V out_gate    = Sigmoid(pre[2]);
+                    const V candidate   = Tanh(pre[3]);
+                    const V cell        = in_gate * candidate + forget_gate * Load<V>(c_prev + i);
+                    const V cell_tanh   = Tanh(cell);
+                    Store(a + i, in_gate);
+                    Store(a + h + i, forget_gate);
+                    Store(a + 2 * h + i, out_gate);
+                    Store(a + 3 * h + i, candidate);
+                    Store(c + i, cell);
+                    Store(c + half + i, cell_tanh);
+                    Store(ho + i, out_gate * cell_tanh);
+                    Store(ho + half + i, V{});
+                });
+                if(cy != nullptr)
+                    std::copy(c, c + h, cy + b * h);
+                break;
+            }
+            case miopenGRU:
+                ForEachPack<float>(h, [&](std::size_t i, auto v) {
+                    using V       = decltype(v);
+                    const V pre_z = Load<V>(g + i) + (Load<V>(p + i) + Load<V>(bh + i));
+                    const V pre_r =
+                        Load<V>(g + h + i) + (Load<V>(p + h + i) + Load<V>(bh + h + i));
+                    const V hidden_product = Load<V>(p + 2 * h + i) + Load<V>(bh + 2 * h + i);
+                    const V update_gate    = Sigmoid(pre_z);
+                    const V reset_gate     = Sigmoid(pre_r);
+                    const V pre_c          = Load<V>(g + 2 * h + i) + reset_gate * hidden_product;
+                    const V candidate      = Tanh(pre_c);
+                    Store(g + i, pre_z);
+                    Store(g + h + i, pre_r);
+                    Store(g + 2 * h + i, pre_c);
+                    Store(a + i, update_gate);
+                    Store(a + h + i, reset_gate);
+                    Store(a + 2 * h + i, candidate);
+                    Store(ho + half + i, hidden_product);
+                    Store(ho + i,
+                          (1 - update_gate) * candidate + update_gate * Load<V>(h_prev + i));
+                });
+                break;
+            }
+            if(hy != nullptr)
+                std::copy(ho, ho + h, hy + b * h);
+        };
+        ParallelFor(rows_t,
+                    std::max<std::size_t>(rnn_gate_grain / n, 1),
+                    [&](std::size_t b, std::size_t e) {
+                        for(std::size_t r = b; r < e; r++)
+                            update(r);
+                    });
+    }
+}
+
+} // namespace host
+} // namespace miopen
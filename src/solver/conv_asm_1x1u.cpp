@@ -34,6 +34,7 @@
 #include <miopen/handle.hpp>
 #include <miopen/solver.hpp>
 #include <miopen/generic_search.hpp>
+#include <miopen/search_model.hpp>
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_GCN_ASM_DIRECT_1X1U_PERF_VALS)
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_GCN_ASM_DIRECT_1X1U_SEARCH_OPTIMIZED)
@@ -191,6 +192,15 @@ bool PerformanceConfigConvAsm1x1U::IsValidValue() const
         && IsLinear<1,8>(waves_in_group); // clang-format on
 }
 
+int PerformanceConfigConvAsm1x1U::GetVgprCount() const
+{
+    const int in_gprs  = chunks_per_wave * n_blocks_per_wave;
+    const int acc_gprs = in_gprs * k_mult;
+    return 4 + 2 * in_gprs + acc_gprs;
+}
+
+int PerformanceConfigConvAsm1x1U::GetSgprCount() const { return 24 + 2 * k_mult; }
+
 bool PerformanceConfigConvAsm1x1U::IsValidForProblem(const ConvolutionContext& config) const
 {
     if(!IsValidValue())
@@ -201,15 +211,13 @@ bool PerformanceConfigConvAsm1x1U::IsValidForProblem(const ConvolutionContext& c
         return false;
     if(!(k_mult <= config.n_outputs))
         return false;
-    const int in_gprs  = chunks_per_wave * n_blocks_per_wave;
-    const int acc_gprs = in_gprs * k_mult;
-    const int vgprs    = 4 + 2 * in_gprs + acc_gprs;
+    const int vgprs = GetVgprCount();
     if(!(vgprs < 256))
         return false;
     const int max_waves_per_CU = (256 / vgprs) * 4;
     if(!(max_waves_per_CU >= waves_in_group))
         return false;
-    const int sgprs = 24 + 2 * k_mult;
+    const int sgprs = GetSgprCount();
     if(!(sgprs < 102)) /// \todo This is valid for Gfx8 and Gfx9. Check for newer parts.
         return false;
     const int total_n_blocks = (config.batch_sz + GetNPerGpr() - 1) / GetNPerGpr();
@@ -361,6 +369,21 @@ bool ConvAsm1x1U::IsApplicable(const ConvolutionContext& params) const
 
 bool ConvAsm1x1U::IsFast(const ConvolutionContext&) const { return true; }
 
+std::size_t ConvAsm1x1U::GetWorkspaceSize(const ConvolutionContext& params) const
+{
+    if(!UseSubsample(params) && !UseUpsample(params))
+        return 0;
+
+    // Sub/upsampled input for the asm kernel.
+    const std::size_t in_batch_stride = AsmImgWidth(params) * AsmImgHeight(params) *
+                                        (UseSubsample(params) ? params.n_inputs : params.n_outputs);
+    assert(params.out_data_type == "FP16" || params.out_data_type == "FP32" ||
+           params.out_data_type == "FP64");
+    const std::size_t data_len =
+        (params.out_data_type == "FP16" ? 2 : (params.out_data_type == "FP32" ? 4 : 8));
+    return in_batch_stride * params.batch_sz * data_len;
+}
+
 static int divide_round_plus_inf(const int x, const int y)
 {
     assert(x >= 0 && y > 0);
@@ -429,11 +452,7 @@ ConvSolution ConvAsm1x1U::GetSolution(const ConvolutionContext& params,
 
         kernel.comp_options = subsample_kernel_compilation_options;
 
-        assert(params.out_data_type == "FP16" || params.out_data_type == "FP32" ||
-               params.out_data_type == "FP64");
-        int data_len =
-            (params.out_data_type == "FP16" ? 2 : (params.out_data_type == "FP32" ? 4 : 8));
-        result.workspce_sz = in_batch_stride * params.batch_sz * data_len;
+        result.workspce_sz = GetWorkspaceSize(params);
     }
 
     GenerateClangDefsym(options, "stride_h", 1);
@@ -582,6 +601,35 @@ int ConvAsm1x1U::RunAndMeasureSolution(miopen::Handle& profile_h,
     return 0;
 }
 
+double ConvAsm1x1U::EstimatePerformanceConfigCost(const ConvolutionContext& params,
+                                                  const PerformanceConfigConvAsm1x1U& config) const
+{
+    const double n          = params.batch_sz;
+    const double c          = params.n_inputs;
+    const double k          = params.n_outputs;
+    const int img_hw        = AsmImgHeight(params) * AsmImgWidth(params);
+    const int hw_per_wave   = config.GetChunksPerWave() * config.GetChunkSize();
+    const int n_per_wave    = config.GetNBlocksPerWave() * config.GetNPerGpr();
+    const int k_per_wave    = std::min(config.GetKMult(), params.n_outputs);
+    const size_t hw_groups  = divide_round_plus_inf(img_hw, hw_per_wave);
+    const size_t k_groups   = divide_round_plus_inf(params.n_outputs, config.GetKMult());
+    const size_t n_groups_n = divide_round_plus_inf(params.batch_sz, n_per_wave);
+
+    KernelCostEstimate estimate;
+    estimate.vgprs           = config.GetVgprCount();
+    estimate.sgprs           = config.GetSgprCount();
+    estimate.waves_per_group = config.GetWavesInGroup();
+    estimate.n_groups        = hw_groups * k_groups * n_groups_n;
+    estimate.flops           = 2.0 * n * c * k * img_hw;
+    // Each group reads a (hw_per_wave x n_per_wave) slice of all input channels
+    // and k_mult filters, and writes k_mult output slices.
+    const double in_per_group  = c * hw_per_wave * n_per_wave;
+    const double wei_per_group = c * k_per_wave;
+    const double out_per_group = static_cast<double>(k_per_wave) * hw_per_wave * n_per_wave;
+    estimate.bytes = 4.0 * estimate.n_groups * (in_per_group + wei_per_group + out_per_group);
+    return EstimateKernelCost(estimate);
+}
+
 PerformanceConfigConvAsm1x1U ConvAsm1x1U::Search(const ConvolutionContext& context) const
 {
     if(UseSubsample(context) || UseUpsample(context))
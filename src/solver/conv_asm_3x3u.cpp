@@ -34,6 +34,7 @@
 #include <miopen/handle.hpp>
 #include <miopen/solver.hpp>
 #include <miopen/generic_search.hpp>
+#include <miopen/search_model.hpp>
 
 MIOPEN_DECLARE_ENV_VAR(MIOPEN_DEBUG_GCN_ASM_DIRECT_3X3U_PERF_VALS)
 
@@ -64,7 +65,7 @@ PerformanceConfigConvAsm3x3U::PerformanceConfigConvAsm3x3U(int lwc, int fpw, int
 {
 }
 
-inline bool PerformanceConfigConvAsm3x3U::
+bool PerformanceConfigConvAsm3x3U::
 operator==(const PerformanceConfigConvAsm3x3U& other) const
 {
     // clang-format off
@@ -81,11 +82,8 @@ bool PerformanceConfigConvAsm3x3U::IsValidValue() const
         && (1 <= output_lines_per_wave && output_lines_per_wave <= 8); // clang-format on
 }
 
-bool PerformanceConfigConvAsm3x3U::IsValid(const ConvolutionContext& config) const
+int PerformanceConfigConvAsm3x3U::GetVgprCount(const ConvolutionContext& config) const
 {
-    if(!IsValidValue())
-        return false;
-
     // Count the number of VGPRs required.
     const auto& img_width  = config.in_width;
     const auto& img_height = config.in_height;
@@ -99,11 +97,11 @@ bool PerformanceConfigConvAsm3x3U::IsValid(const ConvolutionContext& config) con
     const int w64_chunks   = (img_x_blocks + 63) / 64;
     assert(w64_chunks != 0);
     if(w64_chunks == 0)
-        return false;
+        return -1;
     const int active_lanes = (img_x_blocks + w64_chunks - 1) / w64_chunks;
     assert(active_lanes != 0);
     if(active_lanes == 0)
-        return false;
+        return -1;
     const bool uneven_line_read_mode  = (img_x_blocks % active_lanes != 0);
     const bool uneven_line_write_mode = (img_width % active_lanes != 0);
     if(uneven_line_read_mode || uneven_line_write_mode)
@@ -122,7 +120,16 @@ bool PerformanceConfigConvAsm3x3U::IsValid(const ConvolutionContext& config) con
 
     const int acc_lines_per_wave = output_lines_per_wave;
     n += (gprs_per_input_line * filters_per_wave * acc_lines_per_wave);
+    return n;
+}
 
+bool PerformanceConfigConvAsm3x3U::IsValid(const ConvolutionContext& config) const
+{
+    if(!IsValidValue())
+        return false;
+    const int n = GetVgprCount(config);
+    if(n < 0)
+        return false;
     const int available_vgprs = 256;
     return n < available_vgprs;
 }
@@ -309,6 +316,37 @@ int ConvAsm3x3U::RunAndMeasureSolution(miopen::Handle& profile_h,
     return 0;
 }
 
+double ConvAsm3x3U::EstimatePerformanceConfigCost(const ConvolutionContext& params,
+                                                  const PerformanceConfigConvAsm3x3U& config) const
+{
+    const double n = params.batch_sz;
+    const double c = params.n_inputs;
+    const double k = params.n_outputs;
+    const double w = params.in_width;
+    const double h = params.in_height;
+    const int k_groups =
+        (params.n_outputs + config.filters_per_wave - 1) / config.filters_per_wave;
+    const int h_groups =
+        (params.in_height + config.output_lines_per_wave - 1) / config.output_lines_per_wave;
+    const int k_per_wave = std::min(config.filters_per_wave, params.n_outputs);
+    const int h_per_wave = std::min(config.output_lines_per_wave, params.in_height);
+
+    KernelCostEstimate estimate;
+    estimate.vgprs              = config.GetVgprCount(params);
+    estimate.waves_per_group    = 1;
+    estimate.n_groups           = static_cast<size_t>(k_groups) * h_groups * params.batch_sz;
+    estimate.max_waves_per_simd = config.limit_wave_cnt;
+    estimate.flops              = 2.0 * n * c * k * h * w * 9;
+    // Each wave reads (output_lines_per_wave + 2) input lines of every input channel
+    // and filters_per_wave 3x3 filters, and writes output_lines_per_wave lines
+    // of filters_per_wave output channels.
+    const double in_per_wave  = c * (h_per_wave + 2) * w;
+    const double wei_per_wave = c * k_per_wave * 9;
+    const double out_per_wave = static_cast<double>(k_per_wave) * h_per_wave * w;
+    estimate.bytes = 4.0 * estimate.n_groups * (in_per_wave + wei_per_wave + out_per_wave);
+    return EstimateKernelCost(estimate);
+}
+
 PerformanceConfigConvAsm3x3U ConvAsm3x3U::Search(const ConvolutionContext& context) const
 {
     return GenericSearch(*this, context);
@@ -488,6 +488,20 @@ bool ConvAsmBwdWrW1x1::IsApplicable(const ConvolutionContext& params) const
 
 bool ConvAsmBwdWrW1x1::IsFast(const ConvolutionContext&) const { return true; }
 
+std::size_t ConvAsmBwdWrW1x1::GetWorkspaceSize(const ConvolutionContext& params) const
+{
+    if(!UseSubsample(params))
+        return 0;
+
+    // Subsampled input, in_height equals to image size after downsampling.
+    const std::size_t in_batch_stride = params.in_stride * params.in_height * params.n_outputs;
+    assert(params.out_data_type == "FP16" || params.out_data_type == "FP32" ||
+           params.out_data_type == "FP64");
+    const std::size_t data_len =
+        (params.out_data_type == "FP16" ? 2 : (params.out_data_type == "FP32" ? 4 : 8));
+    return in_batch_stride * params.batch_sz * data_len;
+}
+
 static int divide_round_plus_inf(const int x, const int y)
 {
     assert(x >= 0 && y > 0);
@@ -552,11 +566,7 @@ ConvSolution ConvAsmBwdWrW1x1::GetSolution(const ConvolutionContext& params,
 
         result.construction_params.push_back(kernel);
 
-        assert(params.out_data_type == "FP16" || params.out_data_type == "FP32" ||
-               params.out_data_type == "FP64");
-        int data_len =
-            (params.out_data_type == "FP16" ? 2 : (params.out_data_type == "FP32" ? 4 : 8));
-        result.workspce_sz = in_batch_stride * params.batch_sz * data_len;
+        result.workspce_sz = GetWorkspaceSize(params);
     }
     GenerateClangDefsym(options, "stride_h", 1);
     GenerateClangDefsym(options, "stride_w", 1);
@@ -42,9 +42,8 @@ bool ConvOclBwdWrW1x1::IsApplicable(const ConvolutionContext& params) const
     return result;
 }
 
-ConvSolution ConvOclBwdWrW1x1::GetSolution(const ConvolutionContext& params) const
+static int GetNPasses(const ConvolutionContext& params)
 {
-    ConvSolution result;
     const int n_passes =
 #if TWO_PASSES
         ((params.batch_sz >= 16 || 2 * params.n_outputs > params.n_inputs) && params.pad1 == 0 &&
@@ -53,6 +52,25 @@ ConvSolution ConvOclBwdWrW1x1::GetSolution(const ConvolutionContext& params) con
             :
 #endif
             1;
+    return n_passes;
+}
+
+std::size_t ConvOclBwdWrW1x1::GetWorkspaceSize(const ConvolutionContext& params) const
+{
+    if((params.n_inputs & 0xF) != 0 || (params.n_outputs & 0xF) != 0)
+        return 0;
+    if(GetNPasses(params) == 1)
+        return 0;
+
+    // Subsampled input for the second pass.
+    const std::size_t in_batch_stride = params.in_stride * params.in_height * params.n_outputs;
+    return in_batch_stride * params.batch_sz * sizeof(float);
+}
+
+ConvSolution ConvOclBwdWrW1x1::GetSolution(const ConvolutionContext& params) const
+{
+    ConvSolution result;
+    const int n_passes = GetNPasses(params);
 
     // FIX ME! FIX ME! FIX ME! Does not support C, K != 16X yet
     // NON-Stride/PAD mode NON-16X will be supported by MIOpenConvBwdWrW1x1.CL
@@ -331,7 +349,7 @@ ConvSolution ConvOclBwdWrW1x1::GetSolution(const ConvolutionContext& params) con
 
             result.construction_params.push_back(kernel);
 
-            result.workspce_sz = in_batch_stride * params.batch_sz * sizeof(float);
+            result.workspce_sz = GetWorkspaceSize(params);
         }
 
         {
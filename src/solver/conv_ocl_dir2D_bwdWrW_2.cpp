@@ -47,7 +47,8 @@ bool ConvOclBwdWrW2::IsApplicable(const ConvolutionContext& params) const
             (params.kernel_size0 != 1 || params.kernel_size1 != 1));
 }
 
-ConvSolution ConvOclBwdWrW2::GetSolution(const ConvolutionContext& params) const
+/// Returns tuned values for the problem config, if any.
+static std::vector<std::string> GetStrideTableValues(const ConvolutionContext& params)
 {
     static const char* s_stride_table[32][2] = {
         //
@@ -78,16 +79,56 @@ ConvSolution ConvOclBwdWrW2::GetSolution(const ConvolutionContext& params) const
           std::to_string(params.out_height) + "x" + std::to_string(params.out_width) + "x" +
           std::to_string(params.batch_sz);
     //	std::map<std::string, std::string> lcl_db;
-    bool found = false;
-    int i      = 0;
-    for(; s_stride_table[i][0] != nullptr; ++i)
+    std::vector<std::string> val_vec;
+    for(int i = 0; s_stride_table[i][0] != nullptr; ++i)
     {
         if(std::string(s_stride_table[i][0]) == key)
         {
-            found = true;
+            tokenize(std::string(s_stride_table[i][1]), val_vec, std::string("."));
             break;
         }
     }
+    return val_vec;
+}
+
+/// Number of batch blocks, each accumulating its own copy of weights.
+/// May increase N_BATCH_LOOPS.
+static int GetNBatchBlks(const ConvolutionContext& params, const int n_stacks, int& N_BATCH_LOOPS)
+{
+    const int wei_bstride = params.n_outputs * params.kernel_size0 * params.kernel_size1;
+
+    assert((N_BATCH_LOOPS * n_stacks) != 0);
+    int n_batch_blks =
+        (params.batch_sz + N_BATCH_LOOPS * n_stacks - 1) / (N_BATCH_LOOPS * n_stacks);
+
+    // guard not to grab too much system memory
+    while(n_batch_blks > 1 && wei_bstride * params.n_inputs * n_batch_blks > 4 * 1024 * 1024)
+    {
+        N_BATCH_LOOPS <<= 1;
+        assert((N_BATCH_LOOPS * n_stacks) != 0);
+        n_batch_blks =
+            (params.batch_sz + N_BATCH_LOOPS * n_stacks - 1) / (N_BATCH_LOOPS * n_stacks);
+    }
+    return n_batch_blks;
+}
+
+std::size_t ConvOclBwdWrW2::GetWorkspaceSize(const ConvolutionContext& params) const
+{
+    const auto val_vec     = GetStrideTableValues(params);
+    int N_BATCH_LOOPS      = val_vec.empty() ? 1 : std::stoi(val_vec[0]);
+    const int n_batch_blks = GetNBatchBlks(params, std::min(params.batch_sz, 1), N_BATCH_LOOPS);
+    if(n_batch_blks <= 1)
+        return 0;
+
+    // Partial sums of weights per batch block, reduced by the second kernel.
+    const std::size_t wei_bstride = params.n_outputs * params.kernel_size0 * params.kernel_size1;
+    const std::size_t data_len    = (params.out_data_type == "FP32" ? 4 : 8);
+    return wei_bstride * params.n_inputs * n_batch_blks * data_len;
+}
+
+ConvSolution ConvOclBwdWrW2::GetSolution(const ConvolutionContext& params) const
+{
+    const auto val_vec = GetStrideTableValues(params);
 
     ConvSolution result;
 
@@ -101,12 +142,8 @@ ConvSolution ConvOclBwdWrW2::GetSolution(const ConvolutionContext& params) const
 
     int N_ALIGNED_OUT_SCAN_BLK = 2;
 
-    if(found)
+    if(!val_vec.empty())
     {
-        std::vector<std::string> val_vec;
-
-        tokenize(std::string(s_stride_table[i][1]), val_vec, std::string("."));
-
         N_BATCH_LOOPS          = std::stoi(val_vec[0]);
         result.out_pix_tile1   = std::stoi(val_vec[1]);
         n_waves                = std::stoi(val_vec[2]);
@@ -124,20 +161,9 @@ ConvSolution ConvOclBwdWrW2::GetSolution(const ConvolutionContext& params) const
     int wei_bstride = params.n_outputs * wei_cstride;
 
     // number  of batch iterations
-    result.n_stacks = 1;
-    result.n_stacks = std::min(params.batch_sz, result.n_stacks);
-    assert((N_BATCH_LOOPS * result.n_stacks) != 0);
-    int n_batch_blks =
-        (params.batch_sz + N_BATCH_LOOPS * result.n_stacks - 1) / (N_BATCH_LOOPS * result.n_stacks);
-
-    // guard not to grab too much system memory
-    while(n_batch_blks > 1 && wei_bstride * params.n_inputs * n_batch_blks > 4 * 1024 * 1024)
-    {
-        N_BATCH_LOOPS <<= 1;
-        assert((N_BATCH_LOOPS * result.n_stacks) != 0);
-        n_batch_blks = (params.batch_sz + N_BATCH_LOOPS * result.n_stacks - 1) /
-                       (N_BATCH_LOOPS * result.n_stacks);
-    }
+    result.n_stacks  = 1;
+    result.n_stacks  = std::min(params.batch_sz, result.n_stacks);
+    int n_batch_blks = GetNBatchBlks(params, result.n_stacks, N_BATCH_LOOPS);
 
     // number of filter taps in the processing wk_item
     int WEI_WKITEM =
@@ -307,8 +333,7 @@ ConvSolution ConvOclBwdWrW2::GetSolution(const ConvolutionContext& params) const
         kernel.g_wk.push_back(1);
         result.construction_params.push_back(kernel);
 
-        int data_len       = (params.out_data_type == "FP32" ? 4 : 8);
-        result.workspce_sz = wei_bstride * params.n_inputs * n_batch_blks * data_len;
+        result.workspce_sz = GetWorkspaceSize(params);
     }
     return result;
 }
@@ -55,6 +55,35 @@ bool ConvOclBwdWrW53::IsApplicable(const ConvolutionContext& params) const
             (params.kernel_stride1 == 1 && params.kernel_stride0 == 1));
 }
 
+static int GetNBatchLoops(const ConvolutionContext& params, const int n_stacks)
+{
+    // defines how to proceed : 1 grouop per batch or with a loop over all batches
+    // loop over al batches make sense in 2 cases: a lot of small inputs/outputs or few batches
+    // param
+    return (params.n_inputs * params.n_outputs <= 8 * 1024)
+               ? 1
+               : (params.batch_sz <= 16 || params.in_width <= 32) ? (params.batch_sz / n_stacks)
+                                                                  : 4;
+}
+
+static int GetNBatchBlks(const ConvolutionContext& params, const int n_stacks)
+{
+    const int N_BATCH_LOOPS = GetNBatchLoops(params, n_stacks);
+    return (params.batch_sz + N_BATCH_LOOPS * n_stacks - 1) / (N_BATCH_LOOPS * n_stacks);
+}
+
+std::size_t ConvOclBwdWrW53::GetWorkspaceSize(const ConvolutionContext& params) const
+{
+    const int n_batch_blks = GetNBatchBlks(params, std::min(params.batch_sz, 1));
+    if(n_batch_blks <= 1)
+        return 0;
+
+    // Partial sums of weights per batch block, reduced by the second kernel.
+    const std::size_t wei_bstride = params.n_outputs * params.kernel_size0 * params.kernel_size1;
+    const std::size_t data_len    = (params.out_data_type == "FP32" ? 4 : 8);
+    return wei_bstride * params.n_inputs * n_batch_blks * data_len;
+}
+
 ConvSolution ConvOclBwdWrW53::GetSolution(const ConvolutionContext& params) const
 {
     ConvSolution result;
@@ -70,18 +99,10 @@ ConvSolution ConvOclBwdWrW53::GetSolution(const ConvolutionContext& params) cons
     int wei_bstride = params.n_outputs * wei_cstride;
 
     // number  of batch iterations
-    result.n_stacks = 1;
-    result.n_stacks = std::min(params.batch_sz, result.n_stacks);
-    // defines how to proceed : 1 grouop per batch or with a loop over all batches
-    // loop over al batches make sense in 2 cases: a lot of small inputs/outputs or few batches
-    // param
-    int N_BATCH_LOOPS = (params.n_inputs * params.n_outputs <= 8 * 1024)
-                            ? 1
-                            : (params.batch_sz <= 16 || params.in_width <= 32)
-                                  ? (params.batch_sz / result.n_stacks)
-                                  : 4;
-    int n_batch_blks =
-        (params.batch_sz + N_BATCH_LOOPS * result.n_stacks - 1) / (N_BATCH_LOOPS * result.n_stacks);
+    result.n_stacks   = 1;
+    result.n_stacks   = std::min(params.batch_sz, result.n_stacks);
+    int N_BATCH_LOOPS = GetNBatchLoops(params, result.n_stacks);
+    int n_batch_blks  = GetNBatchBlks(params, result.n_stacks);
 
     result.out_pix_tile0 = params.kernel_size0;
     result.out_pix_tile1 = params.kernel_size1;
@@ -277,10 +298,8 @@ ConvSolution ConvOclBwdWrW53::GetSolution(const ConvolutionContext& params) cons
         kernel.g_wk.push_back(1);
         kernel.g_wk.push_back(1);
 
-        int data_len = (params.out_data_type == "FP32" ? 4 : 8);
-
         result.construction_params.push_back(kernel);
-        result.workspce_sz = wei_bstride * params.n_inputs * n_batch_blks * data_len;
+        result.workspce_sz = GetWorkspaceSize(params);
     }
     return result;
 }
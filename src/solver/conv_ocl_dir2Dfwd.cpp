@@ -216,7 +216,8 @@ bool ConvOclDirectFwd::IsValidPerformanceConfig(
 }
 
 ConvSolution ConvOclDirectFwd::GetSolution(const ConvolutionContext& params,
-                                           const LegacyPerformanceConfig& searched_params) const
+                                           const LegacyPerformanceConfig& searched_params,
+                                           bool) const
 {
     ConvSolution result;
 
@@ -26,12 +26,15 @@
 
 #define MIOPEN
 
-#include <miopen/allocator.hpp>
-#include <miopen/db_path.hpp>
+#include <miopen/generic_search.hpp>
 #include <miopen/handle.hpp>
 #include <miopen/legacy_exhaustive_search.hpp>
-#include <miopen/mlo_utils.hpp>
 #include <miopen/solver.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <limits>
 #ifdef max
 #undef max
 #endif
@@ -120,601 +123,273 @@ ConvOclDirectFwdLegacyExhaustiveSearch::GetPerformanceConfig(const ConvolutionCo
     return result;
 }
 
-/*
-* Measure the current configuration performance.
-*/
-template <class... Solvers>
-static int MeasureLoop(Handle* profile_h,
-                       Data_t bot_ocl_buf,
-                       Data_t top_ocl_buf,
-                       Data_t wei_ocl_buf,
-                       Data_t bias_ocl_buf,
-                       double& processing_time,
-                       const ConvolutionContext& params,
-                       const LegacyPerformanceConfig& result)
+/// Values of the fields in the order of the former hand-written search loops.
+/// 1x1 filters:
+static const int versions_1x1[]        = {0, 1}; // out_pix_tile1
+static const int grp_tiles0_1x1[]      = {64, 128, 256};
+static const int n_out_pix_tiles_1x1[] = {4, 8, 16, 32, 64};
+static const int out_pix_tiles0_1x1[]  = {0, 1, 2, 4};
+static const int n_in_data_tiles_1x1[] = {4, 8, 64, 128, 256, 2048};
+/// Other filters:
+static const int in_tile_range[]         = {8, 16, 32, 64};
+static const int out_pix_tile_range[]    = {1, 2, 4};
+static const int n_out_pix_tiles_range[] = {1, 2, 4, 8};
+static const int n_in_data_tiles_range[] = {1, 2, 4};
+static const int n_stacks_range[]        = {1, 2};
+
+template <std::size_t N>
+static bool IsOneOf(const int v, const int (&values)[N])
 {
-    ConvSolution kernel_search_result{miopenStatusNotInitialized};
-
-    miopen::each_args(
-        [&](auto s) {
-            if(!kernel_search_result.Succeeded()) // once
-            {
-                if(s.IsApplicable(params))
-                {
-                    if(s.IsValidPerformanceConfig(params, result))
-                    {
-                        kernel_search_result = s.GetSolution(params, result);
-                    }
-                }
-            }
-        },
-        Solvers{}...);
+    return std::find(std::begin(values), std::end(values), v) != std::end(values);
+}
 
-    if(!kernel_search_result.Succeeded())
+/// Returns true on wrap-around, like NextLinear() etc.
+template <std::size_t N>
+static bool NextOf(int& v, const int (&values)[N])
+{
+    const auto it = std::find(std::begin(values), std::end(values), v);
+    assert(it != std::end(values));
+    if(it == std::end(values) || std::next(it) == std::end(values))
     {
-        return 1;
+        v = values[0];
+        return true;
     }
+    v = *std::next(it);
+    return false;
+}
 
-    MIOPEN_LOG_I2("Trying " << result);
-    const auto kernel_params     = kernel_search_result.construction_params[0];
-    std::string compiler_options = params.general_compile_options + kernel_params.comp_options;
-
-    // Creating OCLKernel obj
-    try
-    {
-
-        float padding_value = 0;
-
-        if(profile_h)
-        {
-            processing_time = std::numeric_limits<float>::max();
-
-            auto k = profile_h->AddKernel("",
-                                          "",
-                                          kernel_params.kernel_file,
-                                          kernel_params.kernel_name,
-                                          kernel_params.l_wk,
-                                          kernel_params.g_wk,
-                                          compiler_options);
-
-            if(params.bias)
-            {
-                k(bot_ocl_buf, wei_ocl_buf, bias_ocl_buf, top_ocl_buf, padding_value);
-            }
-            else
-            {
-                k(bot_ocl_buf, wei_ocl_buf, top_ocl_buf, padding_value);
-            }
-            processing_time = profile_h->GetKernelTime();
-        }
-        else
-        {
-            double s = 0, e = 0;
-
-            auto k = params.GetStream().AddKernel("",
-                                                  "",
-                                                  kernel_params.kernel_file,
-                                                  kernel_params.kernel_name,
-                                                  kernel_params.l_wk,
-                                                  kernel_params.g_wk,
-                                                  compiler_options);
-
-            if(params.bias)
-            {
-                k(bot_ocl_buf, wei_ocl_buf, bias_ocl_buf, top_ocl_buf, padding_value);
-            }
-            else
-            {
-                k(bot_ocl_buf, wei_ocl_buf, top_ocl_buf, padding_value);
-            }
-
-            params.GetStream().Finish();
-
-            s = miopen_mach_absolute_time();
-
-            if(params.bias)
-            {
-                k(bot_ocl_buf, wei_ocl_buf, bias_ocl_buf, top_ocl_buf, padding_value);
-            }
-            else
-            {
-                k(bot_ocl_buf, wei_ocl_buf, top_ocl_buf, padding_value);
-            }
-
-            params.GetStream().Finish();
-            e = miopen_mach_absolute_time();
+static bool IsFor1x1(const LegacyPerformanceConfig& c) { return c.in_tile0 == 1; }
 
-            processing_time = subtractTimes(e, s);
-        }
-    }
-    catch(miopen::Exception&)
-    {
-        return -1;
-    }
+static bool IsProblem1x1(const ConvolutionContext& params)
+{
+    return params.kernel_size0 == 1 && params.kernel_size1 == 1;
+}
 
-    MIOPEN_LOG_I2("\t\t\t\t" << processing_time);
-    return 0;
+LegacyPerformanceConfig::LegacyPerformanceConfig(bool)
+{
+    grp_tile1       = 1;
+    grp_tile0       = grp_tiles0_1x1[0];
+    in_tile1        = 1;
+    in_tile0        = 1;
+    out_pix_tile1   = versions_1x1[0];
+    out_pix_tile0   = out_pix_tiles0_1x1[0];
+    n_out_pix_tiles = n_out_pix_tiles_1x1[0];
+    n_in_data_tiles = n_in_data_tiles_1x1[0];
+    n_stacks        = 0;
 }
 
-LegacyPerformanceConfig
-ConvOclDirectFwdLegacyExhaustiveSearch::Search(const ConvolutionContext& params) const
+bool LegacyPerformanceConfig::SetNextValue()
 {
-    LegacyPerformanceConfig result;
-    bool is_passed = false;
-
-    miopen::Handle profile_h;
-    double processing_time = std::numeric_limits<double>::max();
-
-    int min_grp_tile0 = 16;
-    int min_grp_tile1 = 16;
-    // tile 0
-    int min_in_tile0 = 16;
-    // tile 1
-    int min_in_tile1 = 16;
-    // out pix 0
-    int min_out_pix_tile0 = 1;
-    // out pix 1
-    int min_out_pix_tile1   = 1;
-    int min_n_out_pix_tiles = 2;
-    int min_n_in_data_tiles = 3;
-    int min_n_stacks        = 1;
-
-    // enable profiling for the handle for benchmarking
-    profile_h.EnableProfiling();
-
-    // allocate tem input/output buffers
-    size_t bot_sz = params.bot_sz / sizeof(float);
-    std::vector<float> bot_sys_buf(bot_sz);
-
-    for(int i = 0; i < bot_sz; i++)
+    if(IsFor1x1(*this))
     {
-        bot_sys_buf[i] = static_cast<float>(rand() * (1.0 / RAND_MAX));
+        // Increment with wrap-around:
+        do
+        {
+            if(!NextOf(n_in_data_tiles, n_in_data_tiles_1x1))
+                break;
+            if(!NextOf(out_pix_tile0, out_pix_tiles0_1x1))
+                break;
+            if(!NextOf(n_out_pix_tiles, n_out_pix_tiles_1x1))
+                break;
+            if(!NextOf(grp_tile0, grp_tiles0_1x1))
+                break;
+            if(!NextOf(out_pix_tile1, versions_1x1))
+                break;
+            // Continue with the part of the search space for other filters.
+            in_tile1        = in_tile_range[0];
+            in_tile0        = in_tile_range[0];
+            out_pix_tile1   = out_pix_tile_range[0];
+            out_pix_tile0   = out_pix_tile_range[0];
+            n_out_pix_tiles = n_out_pix_tiles_range[0];
+            n_in_data_tiles = n_in_data_tiles_range[0];
+            n_stacks        = n_stacks_range[0];
+            grp_tile1       = in_tile1 / out_pix_tile1;
+            grp_tile0       = in_tile0 / out_pix_tile0;
+        } while(false);
+        return true;
     }
 
-    auto bot_ocl_buf = profile_h.Write(bot_sys_buf);
-
-    size_t top_sz = params.top_sz / sizeof(float);
-    std::vector<float> top_sys_buf(top_sz);
-
-    auto top_ocl_buf = profile_h.Write(top_sys_buf);
-
-    std::vector<float> random_top_sys_buf(top_sz);
-    for(int i = 0; i < top_sz; i++)
+    do
     {
-        random_top_sys_buf[i] = static_cast<float>(rand() * (1.0 / RAND_MAX));
-    }
+        if(!NextOf(n_stacks, n_stacks_range))
+            break;
+        if(!NextOf(n_in_data_tiles, n_in_data_tiles_range))
+            break;
+        if(!NextOf(n_out_pix_tiles, n_out_pix_tiles_range))
+            break;
+        if(!NextOf(out_pix_tile0, out_pix_tile_range))
+            break;
+        if(!NextOf(out_pix_tile1, out_pix_tile_range))
+            break;
+        if(!NextOf(in_tile0, in_tile_range))
+            break;
+        if(!NextOf(in_tile1, in_tile_range))
+            break;
+        // All the fields of performance config have wrapped around.
+        *this = LegacyPerformanceConfig(true);
+        return false;
+    } while(false);
+    grp_tile1 = in_tile1 / out_pix_tile1;
+    grp_tile0 = in_tile0 / out_pix_tile0;
+    return true;
+}
 
-    size_t weights_sz = params.weights_sz / sizeof(float);
-    std::vector<float> wei_sys_buf(weights_sz);
-    for(int i = 0; i < weights_sz; i++)
+static bool IsValidFor1x1(const LegacyPerformanceConfig& c, const ConvolutionContext& params)
+{
+    // clang-format off
+    if(!(c.grp_tile1 == 1
+        && c.in_tile1 == 1
+        && c.n_stacks == 0
+        && IsOneOf(c.out_pix_tile1, versions_1x1)
+        && IsOneOf(c.grp_tile0, grp_tiles0_1x1)
+        && IsOneOf(c.n_out_pix_tiles, n_out_pix_tiles_1x1)
+        && IsOneOf(c.out_pix_tile0, out_pix_tiles0_1x1)
+        && IsOneOf(c.n_in_data_tiles, n_in_data_tiles_1x1)))
+        return false; // clang-format on
+
+    const int version = (params.in_data_type == "FP32" && params.direction.IsForward() &&
+                         params.n_inputs % 16 == 0 && params.n_outputs % 16 == 0)
+                            ? 1
+                            : 0;
+    if(c.out_pix_tile1 != version)
+        return false;
+
+    if(version == 1)
     {
-        wei_sys_buf[i] = static_cast<float>((rand() * (1.0 / RAND_MAX) - 0.5) * 0.001);
+        return c.grp_tile0 == 64 && c.n_out_pix_tiles >= 16 && c.out_pix_tile0 != 2 &&
+               c.n_in_data_tiles >= 64;
     }
 
-    auto wei_ocl_buf = profile_h.Write(wei_sys_buf);
-
-    std::vector<float> bias_sys_buf;
-    miopen::Allocator::ManageDataPtr bias_ocl_buf = nullptr;
-
-    if(params.bias != 0)
+    int max_out_pix_tile0 = 4;
+    if(params.kernel_stride0 == 1)
     {
-        size_t bias_sz = params.bias_sz / sizeof(float);
-        bias_sys_buf   = std::vector<float>(bias_sz);
-        for(int i = 0; i < bias_sz; i++)
-        {
-            bias_sys_buf[i] = static_cast<float>(rand() * (1.0 / RAND_MAX));
-        }
-
-        bias_ocl_buf = profile_h.Write(bias_sys_buf);
+        const int i_sz    = params.in_width * params.in_height;
+        max_out_pix_tile0 = (i_sz & 1) != 0 ? 1 : (i_sz & 0x3) != 0 ? 2 : 4;
     }
-
-    // search loop here
-    int grp_tl_ln[4]       = {8, 16, 32};
-    int tile_sz1[4]        = {8, 16, 32, 64};
-    int tile_sz0[4]        = {8, 16, 32, 64};
-    int out_pix_tile_sz[3] = {1, 2, 4};
-    int n_out_tiles_rg[5]  = {1, 2, 4, 8};
-    int n_in_tiles_rg[3]   = {1, 2, 4};
-    int n_in_stacks_sz[2]  = {1, 2};
-    int in_tiles[4]        = {64, 128, 256, 2048};
-
-    double min_proc_time = std::numeric_limits<double>::max();
-
-    size_t run_counter = 0;
-
-    int out_pix_tl_cnt = 3; // out_pix_tile_sz[1];
-    int n_out_tls      = 4;
-    int n_in_tls       = 3;
-    int stack_cnt      = std::min(params.batch_sz, 2);
-    int n_tile0_sz     = 4;
-    int n_tile1_sz     = 4;
-
-    if(params.out_width >= 16)
+    else if(params.direction.IsForward())
     {
-        tile_sz0[0] = 16;
-        tile_sz0[1] = 32;
-        n_tile0_sz  = 2;
+        max_out_pix_tile0 = (params.out_width & 1) != 0 ? 1 : 2;
     }
-
-    if(params.out_height >= 16)
+    else
     {
-        tile_sz1[0] = 16;
-        tile_sz1[1] = 32;
-        n_tile1_sz  = 2;
+        max_out_pix_tile0 = (((params.out_width & 1) != 0) || ((params.in_width & 1) != 0)) ? 1 : 2;
     }
+    const int max_n_out_pix_tiles =
+        (params.n_outputs % 64 == 0) ? 64 : (params.n_outputs % 32 == 0) ? 32 : 16;
+    const int max_n_in_data_tiles = (params.n_inputs % 8 == 0) ? 8 : 4;
+
+    // clang-format off
+    return c.out_pix_tile0 != 0
+        && c.out_pix_tile0 <= max_out_pix_tile0
+        && c.n_out_pix_tiles <= max_n_out_pix_tiles
+        && c.n_in_data_tiles <= max_n_in_data_tiles
+        && !(c.n_out_pix_tiles == 32 && c.out_pix_tile0 >= 4)
+        && !(c.n_out_pix_tiles == 64 && c.out_pix_tile0 >= 2); // clang-format on
+}
 
-    int n_tiles_cnt = n_tile0_sz * n_tile1_sz;
+static bool IsValidForGeneric(const LegacyPerformanceConfig& c, const ConvolutionContext& params)
+{
+    // clang-format off
+    if(!(IsOneOf(c.in_tile1, in_tile_range)
+        && IsOneOf(c.in_tile0, in_tile_range)
+        && IsOneOf(c.out_pix_tile1, out_pix_tile_range)
+        && IsOneOf(c.out_pix_tile0, out_pix_tile_range)
+        && IsOneOf(c.n_out_pix_tiles, n_out_pix_tiles_range)
+        && IsOneOf(c.n_in_data_tiles, n_in_data_tiles_range)
+        && IsOneOf(c.n_stacks, n_stacks_range)
+        && c.grp_tile1 == c.in_tile1 / c.out_pix_tile1
+        && c.grp_tile0 == c.in_tile0 / c.out_pix_tile0))
+        return false; // clang-format on
+
+    // Large images do not use the smallest and the largest tiles.
+    if(params.out_height >= 16 && !(c.in_tile1 == 16 || c.in_tile1 == 32))
+        return false;
+    if(params.out_width >= 16 && !(c.in_tile0 == 16 || c.in_tile0 == 32))
+        return false;
+
+    // The former search loops also checked grp_tile0/1 here, but the values
+    // were left from the previous iterations and never both equal to 8.
+    // clang-format off
+    return !(params.out_height * 2 <= c.in_tile1 && c.in_tile1 > 8)
+        && !(params.out_width * 2 <= c.in_tile0 && c.in_tile0 > 8)
+        && !(params.out_height > 16 && params.out_width > 16
+             && c.in_tile1 == 8 && c.in_tile0 == 8)
+        && !(params.out_width > 32 && c.in_tile1 > c.in_tile0)
+        && c.out_pix_tile1 <= c.in_tile1 && c.grp_tile1 >= 8
+        && c.out_pix_tile0 <= c.in_tile0 && c.grp_tile0 >= 8
+        && c.n_out_pix_tiles <= params.n_outputs
+        && c.n_in_data_tiles <= params.n_inputs
+        && c.n_stacks <= params.batch_sz
+        && c.out_pix_tile1 * c.out_pix_tile0 * c.n_out_pix_tiles * c.n_stacks < 128
+        && ConvOclDirectFwd{}.IsValidPerformanceConfig(params, c); // clang-format on
+}
 
-    size_t report_inteval = 25;
+bool LegacyPerformanceConfig::IsValid(const ConvolutionContext& config) const
+{
+    if(IsProblem1x1(config) != IsFor1x1(*this))
+        return false;
+    if(IsFor1x1(*this))
+        return IsValidFor1x1(*this, config) &&
+               ConvOclDirectFwd1x1{}.IsValidPerformanceConfig(config, *this);
+    return IsValidForGeneric(*this, config);
+}
 
-    long long runs_left = 0;
+bool LegacyPerformanceConfig::operator==(const LegacyPerformanceConfig& other) const
+{
+    // clang-format off
+    return grp_tile1 == other.grp_tile1
+        && grp_tile0 == other.grp_tile0
+        && in_tile1 == other.in_tile1
+        && in_tile0 == other.in_tile0
+        && out_pix_tile1 == other.out_pix_tile1
+        && out_pix_tile0 == other.out_pix_tile0
+        && n_out_pix_tiles == other.n_out_pix_tiles
+        && n_in_data_tiles == other.n_in_data_tiles
+        && n_stacks == other.n_stacks; // clang-format on
+}
 
-    if(params.kernel_size0 == 1 && params.kernel_size1 == 1)
+int ConvOclDirectFwdLegacyExhaustiveSearch::RunAndMeasureSolution(miopen::Handle& profile_h,
+                                                                  Data_t bot_ocl_buf,
+                                                                  Data_t top_ocl_buf,
+                                                                  Data_t wei_ocl_buf,
+                                                                  Data_t bias_ocl_buf,
+                                                                  const ConvolutionContext& params,
+                                                                  const ConvSolution& solution,
+                                                                  float& elapsed_time) const
+{
+    const KernelInfo k_info = solution.construction_params[0];
+    // Not all the configs can be compiled, thus exceptions are caught in release builds, too.
+    try
     {
-        int n_grp_tiles0 = 3;
-        std::cout << "Searching the best solution in the 4 dim space. Please, be patient it may "
-                     "take few minutes."
-                  << std::endl;
-        result.grp_tile1 = 1;
-        result.in_tile1  = 1;
-        result.in_tile0  = 1;
-        report_inteval   = 5;
-
-        // Add 1x1_stride : no padding support yet
-        if(params.in_data_type == "FP32" && params.direction.IsForward() &&
-           params.n_inputs % 16 == 0 && params.n_outputs % 16 == 0)
-        {
-
-            // uint N_LCL_IN_MAPS = result.n_in_data_tiles;
-            n_in_tiles_rg[0] = 0;
-            n_in_tiles_rg[1] = 3;
-            n_in_tls         = 4;
-
-            //					int N_LCL_OUT_MAPS = result.n_out_pix_tiles;
-            n_out_tiles_rg[0] = 4;
-            n_out_tiles_rg[1] = 6;
-            // 0 or 1
-            out_pix_tl_cnt = 3;
-            //					uint CHEAT_SHADER_COMPILER =
-            // result.out_pix_tile0;
-            out_pix_tile_sz[0] = 0;
-            out_pix_tile_sz[1] = 1;
-            n_out_tls          = (n_out_tiles_rg[1] - n_out_tiles_rg[0] + 1);
-            n_grp_tiles0       = 1;
-            grp_tl_ln[0]       = 64;
-
-            runs_left = out_pix_tl_cnt * n_out_tls * n_in_tls * (n_grp_tiles0 + 1);
-
-            result.out_pix_tile1 = 1;
-        }
+        elapsed_time = std::numeric_limits<float>::max();
+        auto kernel  = profile_h.AddKernel("",
+                                          "",
+                                          k_info.kernel_file,
+                                          k_info.kernel_name,
+                                          k_info.l_wk,
+                                          k_info.g_wk,
+                                          params.general_compile_options + k_info.comp_options);
+        float padding_value = 0;
+        if(params.bias)
+            kernel(bot_ocl_buf, wei_ocl_buf, bias_ocl_buf, top_ocl_buf, padding_value);
         else
-        {
-            int i_sz = params.in_width * params.in_height;
-            if(params.kernel_stride0 == 1)
-            {
-                out_pix_tl_cnt = (i_sz & 1) != 0 ? 1 : (i_sz & 0x3) != 0 ? 2 : 3;
-            }
-            else
-            {
-                if(params.direction.IsForward())
-                {
-                    out_pix_tl_cnt = (params.out_width & 1) != 0 ? 1 : 2;
-                }
-                else
-                {
-                    out_pix_tl_cnt =
-                        (((params.out_width & 1) != 0) || ((params.in_width & 1) != 0)) ? 1 : 2;
-                }
-            }
-            out_pix_tile_sz[0] = 1;
-            out_pix_tile_sz[1] = 2;
-            out_pix_tile_sz[2] = 4;
-
-            n_out_tiles_rg[0] = 2;
-            n_out_tiles_rg[1] =
-                (params.n_outputs % 64 == 0) ? 6 : (params.n_outputs % 32 == 0) ? 5 : 4;
-
-            n_in_tiles_rg[0] = 2;
-            n_in_tiles_rg[1] = (params.n_inputs % 8 == 0) ? 3 : 2;
-
-            grp_tl_ln[0]     = 64;
-            grp_tl_ln[1]     = 128;
-            grp_tl_ln[2]     = 256;
-            n_grp_tiles0     = 3;
-            int n_grp_tiles1 = 1;
-
-            int n_grp_tiles = n_grp_tiles1 * n_grp_tiles0;
-            n_out_tls       = (n_out_tiles_rg[1] - n_out_tiles_rg[0] + 1);
-            n_in_tls        = 2;
-            runs_left       = n_grp_tiles * out_pix_tl_cnt * n_out_tls * n_in_tls;
-
-            result.out_pix_tile1 = 0;
-        }
-
-        int version = result.out_pix_tile1;
-
-        for(int g0 = 0; g0 < n_grp_tiles0; ++g0)
-        {
-            result.grp_tile0 = grp_tl_ln[g0];
-
-            // out pix 0
-            for(int o_t = n_out_tiles_rg[0]; o_t <= n_out_tiles_rg[1]; ++o_t)
-            {
-                result.n_out_pix_tiles = (1 << o_t);
-                for(int l = 0; l < out_pix_tl_cnt; ++l)
-                {
-                    result.out_pix_tile0 = out_pix_tile_sz[l];
-                    if(version == 0 &&
-                       ((result.n_out_pix_tiles == 32 && result.out_pix_tile0 >= 4) ||
-                        (result.n_out_pix_tiles == 64 && result.out_pix_tile0 >= 2)))
-                    {
-                        continue;
-                    }
-
-                    for(int i_t = n_in_tiles_rg[0]; i_t <= n_in_tiles_rg[1]; ++i_t)
-                    {
-                        if(version == 1)
-                        {
-                            result.n_in_data_tiles = in_tiles[i_t];
-                        }
-                        else
-                        {
-                            result.n_in_data_tiles = (1 << i_t);
-                        }
-                        // randomize output
-                        profile_h.WriteTo(reinterpret_cast<const void*>(random_top_sys_buf.data()),
-                                          top_ocl_buf,
-                                          random_top_sys_buf.size() * sizeof(float));
-
-                        const auto ret = MeasureLoop<ConvOclDirectFwd1x1>(&profile_h,
-                                                                          bot_ocl_buf.get(),
-                                                                          top_ocl_buf.get(),
-                                                                          wei_ocl_buf.get(),
-                                                                          bias_ocl_buf.get(),
-                                                                          processing_time,
-                                                                          params,
-                                                                          result);
-
-                        runs_left--;
-                        runs_left = (runs_left < 0) ? 0 : runs_left;
-
-                        if(ret != 0)
-                        {
-                            continue;
-                        }
-
-                        if(run_counter % report_inteval == 0)
-                        {
-                            min_proc_time = (run_counter == 0) ? processing_time : min_proc_time;
-                            std::cout
-                                << "Runs left : " << runs_left << ", "
-                                << "min time so far : " << min_proc_time << ", "
-                                << "curr time : " << processing_time << ", " << result.grp_tile1
-                                << ", " << result.grp_tile0 << ", " << result.in_tile1 << ", "
-                                << result.in_tile0 << ", " << result.out_pix_tile1 << ", "
-                                << result.out_pix_tile0 << ", " << result.n_out_pix_tiles << ", "
-                                << result.n_in_data_tiles << ", " << result.n_stacks << std::endl;
-                        }
-
-                        is_passed = true;
-
-                        run_counter++;
-
-                        if(min_proc_time > processing_time)
-                        {
-                            min_proc_time       = processing_time;
-                            min_grp_tile0       = result.grp_tile0;
-                            min_grp_tile1       = result.grp_tile1;
-                            min_in_tile0        = result.in_tile0;
-                            min_in_tile1        = result.in_tile1;
-                            min_out_pix_tile0   = result.out_pix_tile0;
-                            min_out_pix_tile1   = result.out_pix_tile1;
-                            min_n_out_pix_tiles = result.n_out_pix_tiles;
-                            min_n_in_data_tiles = result.n_in_data_tiles;
-                            min_n_stacks        = result.n_stacks;
-                            MIOPEN_LOG_I2(
-                                "processing_time = " << processing_time << ", result = " << result);
-                        }
-
-                    } // for (int i_t = n_in_tiles_rg[0]; i_t <= n_in_tiles_rg[1]; ++i_t)
-                }     // if (result.out_pix_tile0 > result.in_tile0)
-            }         // for (int l = 0; l < l_l; ++l)
-        }             // for (int g0 = 0; g0 < 2; ++g0)
+            kernel(bot_ocl_buf, wei_ocl_buf, top_ocl_buf, padding_value);
+        elapsed_time = profile_h.GetKernelTime();
     }
-    else
+    catch(miopen::Exception&)
     {
-
-        std::cout << "Searching the best solution in the 9 dim space. Please, be patient it may "
-                     "take few minutes."
-                  << std::endl;
-
-        runs_left = /*n_grp_tiles * */ n_tiles_cnt * out_pix_tl_cnt * out_pix_tl_cnt * n_out_tls *
-                    n_in_tls * stack_cnt;
-
-        // tile1
-        for(int j = 0; j < n_tile1_sz; ++j)
-        {
-            int tile_sz[3]  = {8, 16, 32};
-            result.in_tile1 = tile_sz1[j];
-            if(params.out_height * 2 <= result.in_tile1 && result.in_tile1 > tile_sz[0])
-            {
-                runs_left--;
-                runs_left = (runs_left < 0) ? 0 : runs_left;
-                continue;
-            }
-
-            // tile 0
-            for(int i = 0; i < n_tile0_sz; ++i)
-            {
-                result.in_tile0 = tile_sz0[i];
-                if((params.out_width * 2 <= result.in_tile0 && result.in_tile0 > tile_sz[0]))
-                {
-                    runs_left--;
-                    runs_left = (runs_left < 0) ? 0 : runs_left;
-                    continue;
-                }
-                if(params.out_height > 16 && params.out_width > 16 &&
-                   ((result.in_tile1 == 8 && result.in_tile0 == 8) ||
-                    (result.grp_tile0 == 8 && result.grp_tile1 == 8)))
-                {
-                    runs_left--;
-                    runs_left = (runs_left < 0) ? 0 : runs_left;
-                    continue;
-                }
-                if(params.out_width > 32 && result.in_tile1 > result.in_tile0)
-                {
-                    runs_left--;
-                    runs_left = (runs_left < 0) ? 0 : runs_left;
-                    continue;
-                }
-                // out pix 1
-
-                for(int k = 0; k < out_pix_tl_cnt; ++k)
-                {
-                    result.out_pix_tile1 = out_pix_tile_sz[k];
-                    result.grp_tile1     = result.in_tile1 / result.out_pix_tile1;
-                    if(result.out_pix_tile1 > result.in_tile1 || result.grp_tile1 < 8)
-                    {
-                        runs_left--;
-                        runs_left = (runs_left < 0) ? 0 : runs_left;
-                        continue;
-                    }
-                    // out pix 0
-
-                    for(int l = 0; l < out_pix_tl_cnt; ++l)
-                    {
-                        result.out_pix_tile0 = out_pix_tile_sz[l];
-                        result.grp_tile0     = result.in_tile0 / result.out_pix_tile0;
-
-                        if(result.out_pix_tile0 > result.in_tile0 || result.grp_tile0 < 8)
-                        {
-                            runs_left--;
-                            runs_left = (runs_left < 0) ? 0 : runs_left;
-                            continue;
-                        }
-
-                        for(int o_t = 0; o_t < n_out_tls; ++o_t)
-                        {
-                            result.n_out_pix_tiles = n_out_tiles_rg[o_t];
-                            if(params.n_outputs < result.n_out_pix_tiles)
-                            {
-                                runs_left--;
-                                runs_left = (runs_left < 0) ? 0 : runs_left;
-                                continue;
-                            }
-
-                            for(int i_t = 0; i_t < n_in_tls; ++i_t)
-                            {
-                                result.n_in_data_tiles = n_in_tiles_rg[i_t];
-                                if(params.n_inputs < result.n_in_data_tiles)
-                                {
-                                    runs_left--;
-                                    runs_left = (runs_left < 0) ? 0 : runs_left;
-                                    continue;
-                                }
-
-                                for(int s = 0; s < stack_cnt; ++s)
-                                {
-
-                                    result.n_stacks = n_in_stacks_sz[s];
-                                    if(result.n_stacks > params.batch_sz)
-                                    {
-                                        runs_left--;
-                                        runs_left = (runs_left < 0) ? 0 : runs_left;
-                                        continue;
-                                    }
-
-                                    if(result.out_pix_tile1 * result.out_pix_tile0 *
-                                           result.n_out_pix_tiles * result.n_stacks >=
-                                       128)
-                                    {
-                                        runs_left--;
-                                        runs_left = (runs_left < 0) ? 0 : runs_left;
-                                        continue;
-                                    }
-
-                                    const auto ret =
-                                        MeasureLoop<ConvOclDirectFwd>(&profile_h,
-                                                                      bot_ocl_buf.get(),
-                                                                      top_ocl_buf.get(),
-                                                                      wei_ocl_buf.get(),
-                                                                      bias_ocl_buf.get(),
-                                                                      processing_time,
-                                                                      params,
-                                                                      result);
-
-                                    runs_left--;
-                                    runs_left = (runs_left < 0) ? 0 : runs_left;
-
-                                    if(ret != 0)
-                                    {
-                                        continue;
-                                    }
-
-                                    if(run_counter % report_inteval == 0)
-                                    {
-                                        min_proc_time =
-                                            (run_counter == 0) ? processing_time : min_proc_time;
-
-                                        std::cout
-                                            << "Runs left : " << runs_left << ", "
-                                            << "min time so far : " << min_proc_time << ", "
-                                            << "curr time : " << processing_time << ", "
-                                            << result.grp_tile1 << ", " << result.grp_tile0 << ", "
-                                            << result.in_tile1 << ", " << result.in_tile0 << ", "
-                                            << result.out_pix_tile1 << ", " << result.out_pix_tile0
-                                            << ", " << result.n_out_pix_tiles << ", "
-                                            << result.n_in_data_tiles << ", " << result.n_stacks
-                                            << std::endl;
-                                    }
-
-                                    is_passed = true;
-
-                                    run_counter++;
-
-                                    if(min_proc_time > processing_time)
-                                    {
-                                        min_proc_time       = processing_time;
-                                        min_grp_tile0       = result.grp_tile0;
-                                        min_grp_tile1       = result.grp_tile1;
-                                        min_in_tile0        = result.in_tile0;
-                                        min_in_tile1        = result.in_tile1;
-                                        min_out_pix_tile0   = result.out_pix_tile0;
-                                        min_out_pix_tile1   = result.out_pix_tile1;
-                                        min_n_out_pix_tiles = result.n_out_pix_tiles;
-                                        min_n_in_data_tiles = result.n_in_data_tiles;
-                                        min_n_stacks        = result.n_stacks;
-                                        MIOPEN_LOG_I2("processing_time = " << processing_time
-                                                                           << ", result = "
-                                                                           << result);
-                                    }
-
-                                } // for (int s = 0; s < 3; ++s)
-                            }     // for (int i_t = n_in_tiles_rg[0]; i_t <= n_in_tiles_rg[1];
-                            // ++i_t)
-                        } // if (result.out_pix_tile0 > result.in_tile0)
-                    }     // for (int l = 0; l < l_l; ++l)
-                }         // for (int k = 0; k < k_l; ++k)
-            }             // for (int i = 0; i < 3; ++i)
-        }                 // for (int j = 0; j < 3; ++j)
+        return -1;
     }
+    return 0;
+}
 
-    std::cout << std::endl << "Score: " << min_proc_time << std::endl;
-
-    result.grp_tile0       = min_grp_tile0;
-    result.grp_tile1       = min_grp_tile1;
-    result.in_tile0        = min_in_tile0;
-    result.in_tile1        = min_in_tile1;
-    result.out_pix_tile0   = min_out_pix_tile0;
-    result.out_pix_tile1   = min_out_pix_tile1;
-    result.n_out_pix_tiles = min_n_out_pix_tiles;
-    result.n_in_data_tiles = min_n_in_data_tiles;
-    result.n_stacks        = min_n_stacks;
-
-    profile_h.EnableProfiling(false);
-    if(!is_passed)
-        MIOPEN_THROW("Search failed for ConvOclDirectFwdLegacyExhaustiveSearch");
-    return result;
+LegacyPerformanceConfig
+ConvOclDirectFwdLegacyExhaustiveSearch::Search(const ConvolutionContext& params) const
+{
+    if(IsProblem1x1(params))
+        return GenericSearch(ConvOclDirectFwd1x1{}, params);
+    else
+        return GenericSearch(ConvOclDirectFwd{}, params);
 }
 
 } // namespace solver
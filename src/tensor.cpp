@@ -33,10 +33,10 @@
 
 namespace miopen {
 
-TensorDescriptor::TensorDescriptor() : packed(true) {}
+TensorDescriptor::TensorDescriptor() { this->CalculateDerivedValues(); }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t, std::initializer_list<std::size_t> plens)
-    : lens(plens), packed(true), type(t)
+    : lens(plens), type(t)
 {
     this->CalculateStrides();
 }
@@ -46,11 +46,11 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    std::initializer_list<std::size_t> pstrides)
     : lens(plens), strides(pstrides), type(t)
 {
-    packed = (this->GetElementSize() == this->GetElementSpace());
+    this->CalculateDerivedValues();
 }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t, const int* plens, int size)
-    : lens(plens, plens + size), packed(true), type(t)
+    : lens(plens, plens + size), type(t)
 {
     if(!std::all_of(plens, plens + size, [](int x) { return x >= 0; }))
         MIOPEN_THROW("Invalid length. Length must be greater than 0.");
@@ -66,41 +66,51 @@ TensorDescriptor::TensorDescriptor(miopenDataType_t t,
         MIOPEN_THROW("Invalid length. Length must be greater than 0.");
     if(!std::all_of(pstrides, pstrides + size, [](int x) { return x >= 0; }))
         MIOPEN_THROW("Invalid strides. Strides must be greater than 0.");
-    packed = (this->GetElementSize() == this->GetElementSpace());
+    this->CalculateDerivedValues();
 }
 
 TensorDescriptor::TensorDescriptor(miopenDataType_t t,
                                    std::vector<std::size_t> lens_in,
                                    std::vector<std::size_t> strides_in)
-    : lens(std::move(lens_in)), strides(std::move(strides_in)), type(t)
+    : lens(lens_in), strides(strides_in), type(t)
 {
-    packed = (this->GetElementSize() == this->GetElementSpace());
+    this->CalculateDerivedValues();
 }
 
 void TensorDescriptor::CalculateStrides()
 {
     strides.clear();
     strides.resize(lens.size(), 0);
-    if(strides.empty())
-        return;
-    strides.back() = 1;
-    std::partial_sum(
-        lens.rbegin(), lens.rend() - 1, strides.rbegin() + 1, std::multiplies<std::size_t>());
+    if(!strides.empty())
+    {
+        strides.back() = 1;
+        std::partial_sum(
+            lens.rbegin(), lens.rend() - 1, strides.rbegin() + 1, std::multiplies<std::size_t>());
+    }
+    this->CalculateDerivedValues();
 }
 
-const std::vector<std::size_t>& TensorDescriptor::GetLengths() const { return lens; }
-const std::vector<std::size_t>& TensorDescriptor::GetStrides() const { return strides; }
-int TensorDescriptor::GetSize() const
+void TensorDescriptor::CalculateDerivedValues()
 {
     assert(lens.size() == strides.size());
-    return lens.size();
+    element_size  = 1;
+    element_space = 1;
+    for(std::size_t i = 0; i < lens.size(); i++)
+    {
+        element_size *= lens[i];
+        element_space += (lens[i] - 1) * strides[i];
+    }
+    packed = element_size == element_space;
 }
-std::size_t TensorDescriptor::GetElementSize() const
+
+const TensorDims& TensorDescriptor::GetLengths() const { return lens; }
+const TensorDims& TensorDescriptor::GetStrides() const { return strides; }
+int TensorDescriptor::GetSize() const
 {
     assert(lens.size() == strides.size());
-    return std::accumulate(
-        lens.begin(), lens.end(), std::size_t{1}, std::multiplies<std::size_t>());
+    return lens.size();
 }
+std::size_t TensorDescriptor::GetElementSize() const { return element_size; }
 miopenDataType_t TensorDescriptor::GetType() const { return this->type; }
 
 std::size_t TensorDescriptor::GetIndex(std::initializer_list<int> l) const
@@ -109,18 +119,7 @@ std::size_t TensorDescriptor::GetIndex(std::initializer_list<int> l) const
     return std::inner_product(l.begin(), l.end(), strides.begin(), std::size_t{0});
 }
 
-std::size_t TensorDescriptor::GetElementSpace() const
-{
-    std::vector<std::size_t> maxIndices(lens.size());
-    std::transform(lens.begin(),
-                   lens.end(),
-                   std::vector<std::size_t>(lens.size(), 1).begin(),
-                   maxIndices.begin(),
-                   std::minus<std::size_t>());
-    return std::inner_product(
-               maxIndices.begin(), maxIndices.end(), strides.begin(), std::size_t{0}) +
-           1;
-}
+std::size_t TensorDescriptor::GetElementSpace() const { return element_space; }
 
 std::size_t TensorDescriptor::GetNumBytes() const
 {
@@ -135,6 +134,17 @@ std::size_t TensorDescriptor::GetNumBytes() const
 
 bool TensorDescriptor::IsPacked() const { return this->packed; }
 
+std::size_t TensorDescriptor::GetHash() const
+{
+    std::size_t result = type;
+    const auto combine = [&](std::size_t x) { result = result * 1000003 ^ x; };
+    for(auto x : lens)
+        combine(x);
+    for(auto x : strides)
+        combine(x);
+    return result;
+}
+
 bool TensorDescriptor::operator==(const TensorDescriptor& rhs) const
 {
     assert(this->lens.size() == rhs.strides.size());
@@ -0,0 +1,245 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/errors.hpp>
+#include <miopen/host_loops.hpp>
+#include <miopen/tensor_ops_host.hpp>
+#include <miopen/visit_float.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace miopen {
+namespace host {
+
+namespace {
+
+struct OpAdd
+{
+    float operator()(float a, float b) const { return a + b; }
+};
+
+struct OpMul
+{
+    float operator()(float a, float b) const { return a * b; }
+};
+
+struct OpMin
+{
+    float operator()(float a, float b) const { return a < b ? a : b; }
+};
+
+struct OpMax
+{
+    float operator()(float a, float b) const { return a > b ? a : b; }
+};
+
+template <class F>
+void VisitTensorOp(miopenTensorOp_t op, F f)
+{
+    switch(op)
+    {
+    case miopenTensorOpAdd: f(OpAdd{}); break;
+    case miopenTensorOpMul: f(OpMul{}); break;
+    case miopenTensorOpMin: f(OpMin{}); break;
+    case miopenTensorOpMax: f(OpMax{}); break;
+    }
+}
+
+/// One run of OpTensor. The common cases of unit strides, with or without a broadcast B, get
+/// their own loops which the compiler can vectorize.
+template <bool Accumulate, class T, class Op>
+void OpTensorRun(Op op,
+                 float alpha0,
+                 const T* a,
+                 std::ptrdiff_t sa,
+                 float alpha1,
+                 const T* b,
+                 std::ptrdiff_t sb,
+                 float beta,
+                 T* c,
+                 std::ptrdiff_t sc,
+                 std::size_t n)
+{
+    const auto out = [&](T& y, float x) {
+        y = static_cast<T>(Accumulate ? x + beta * static_cast<float>(y) : x);
+    };
+
+    if(sa == 1 && sc == 1 && sb == 1)
+    {
+        for(std::size_t i = 0; i < n; i++)
+            out(c[i], op(alpha0 * static_cast<float>(a[i]), alpha1 * static_cast<float>(b[i])));
+    }
+    else if(sa == 1 && sc == 1 && sb == 0)
+    {
+        const float bv = alpha1 * static_cast<float>(*b);
+        for(std::size_t i = 0; i < n; i++)
+            out(c[i], op(alpha0 * static_cast<float>(a[i]), bv));
+    }
+    else
+    {
+        for(std::size_t i = 0; i < n; i++)
+            out(c[i * sc],
+                op(alpha0 * static_cast<float>(a[i * sa]), alpha1 * static_cast<float>(b[i * sb])));
+    }
+}
+
+} // namespace
+
+void ScaleTensor(const TensorDescriptor& yDesc, void* y, const void* alpha, std::size_t offset)
+{
+    if(y == nullptr || alpha == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm);
+
+    const auto loops            = MakeLoops<1>(yDesc.GetLengths(), {{Strides(yDesc)}});
+    const std::ptrdiff_t stride = loops.strides[0].back();
+    const float s               = *static_cast<const float*>(alpha);
+    visit_float(yDesc.GetType(), [&](auto as_float) {
+        using T       = typename decltype(as_float)::type;
+        const auto py = as_float(y) + offset;
+        ForEachRun(loops, [&](const std::array<std::ptrdiff_t, 1>& o, std::size_t n) {
+            const auto p = py + o[0];
+            for(std::size_t i = 0; i < n; i++)
+                p[i * stride] = static_cast<T>(s * static_cast<float>(p[i * stride]));
+        });
+    });
+}
+
+void SetTensor(const TensorDescriptor& yDesc, void* y, const void* alpha, std::size_t offset)
+{
+    if(y == nullptr || alpha == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm);
+
+    const auto loops            = MakeLoops<1>(yDesc.GetLengths(), {{Strides(yDesc)}});
+    const std::ptrdiff_t stride = loops.strides[0].back();
+    visit_float(yDesc.GetType(), [&](auto as_float) {
+        const auto value = as_float(*static_cast<const float*>(alpha));
+        const auto py    = as_float(y) + offset;
+        ForEachRun(loops, [&](const std::array<std::ptrdiff_t, 1>& o, std::size_t n) {
+            if(stride == 1)
+                std::fill_n(py + o[0], n, value);
+            else
+                for(std::size_t i = 0; i < n; i++)
+                    py[o[0] + i * stride] = value;
+        });
+    });
+}
+
+void OpTensor(miopenTensorOp_t tensorOp,
+              const void* alpha0,
+              const TensorDescriptor& aTensorDesc,
+              const void* ATensor,
+              const void* alpha1,
+              const TensorDescriptor& bTensorDesc,
+              const void* BTensor,
+              const void* beta,
+              const TensorDescriptor& cTensorDesc,
+              void* CTensor,
+              std::size_t Aoffset,
+              std::size_t Boffset,
+              std::size_t Coffset)
+{
+    if(ATensor == nullptr || BTensor == nullptr || CTensor == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm);
+
+    const auto& clens = cTensorDesc.GetLengths();
+    const auto& blens = bTensorDesc.GetLengths();
+    if(aTensorDesc.GetLengths() != clens)
+        MIOPEN_THROW(miopenStatusBadParm, "A and C Tensors do not match");
+    if(aTensorDesc.GetType() != cTensorDesc.GetType() ||
+       bTensorDesc.GetType() != cTensorDesc.GetType())
+        MIOPEN_THROW(miopenStatusBadParm, "Datatypes for A, B and C tensors do not match");
+    if(blens.size() != clens.size())
+        MIOPEN_THROW(miopenStatusBadParm, "Number of dims in B and C Tensors do not match");
+
+    auto bstrides = Strides(bTensorDesc);
+    for(std::size_t i = 0; i < clens.size(); i++)
+    {
+        if(blens[i] != 1 && blens[i] != clens[i])
+            MIOPEN_THROW(miopenStatusBadParm,
+                         "BTensor dim != 1 && BTensor dim != CTensor dim: " + std::to_string(i));
+        if(blens[i] == 1)
+            bstrides[i] = 0;
+    }
+
+    const auto loops =
+        MakeLoops<3>(clens, {{Strides(aTensorDesc), std::move(bstrides), Strides(cTensorDesc)}});
+    const float a0 = *static_cast<const float*>(alpha0);
+    const float a1 = *static_cast<const float*>(alpha1);
+    const float b0 = *static_cast<const float*>(beta);
+
+    visit_float(cTensorDesc.GetType(), [&](auto as_float) {
+        const auto pa = as_float(ATensor) + Aoffset;
+        const auto pb = as_float(BTensor) + Boffset;
+        const auto pc = as_float(CTensor) + Coffset;
+        const auto sa = loops.strides[0].back();
+        const auto sb = loops.strides[1].back();
+        const auto sc = loops.strides[2].back();
+        VisitTensorOp(tensorOp, [&](auto op) {
+            ForEachRun(loops, [&](const std::array<std::ptrdiff_t, 3>& o, std::size_t n) {
+                if(b0 == 0)
+                    OpTensorRun<false>(
+                        op, a0, pa + o[0], sa, a1, pb + o[1], sb, b0, pc + o[2], sc, n);
+                else
+                    OpTensorRun<true>(
+                        op, a0, pa + o[0], sa, a1, pb + o[1], sb, b0, pc + o[2], sc, n);
+            });
+        });
+    });
+}
+
+void CopyTensor(const TensorDescriptor& srcDesc,
+                const void* src,
+                const TensorDescriptor& dstDesc,
+                void* dst,
+                std::size_t srcOffset,
+                std::size_t dstOffset)
+{
+    if(src == nullptr || dst == nullptr)
+        MIOPEN_THROW(miopenStatusBadParm, "Null pointer for tensor.");
+    if(srcDesc.GetType() != dstDesc.GetType())
+        MIOPEN_THROW(miopenStatusBadParm, "Tensor types do not match.");
+    if(srcDesc.GetLengths() != dstDesc.GetLengths())
+        MIOPEN_THROW(miopenStatusBadParm, "Tensor dimension lengths do not match.");
+
+    const auto loops = MakeLoops<2>(srcDesc.GetLengths(), {{Strides(srcDesc), Strides(dstDesc)}});
+    visit_float(srcDesc.GetType(), [&](auto as_float) {
+        const auto ps = as_float(src) + srcOffset;
+        const auto pd = as_float(dst) + dstOffset;
+        const auto ss = loops.strides[0].back();
+        const auto sd = loops.strides[1].back();
+        ForEachRun(loops, [&](const std::array<std::ptrdiff_t, 2>& o, std::size_t n) {
+            if(ss == 1 && sd == 1)
+                std::copy_n(ps + o[0], n, pd + o[1]);
+            else
+                for(std::size_t i = 0; i < n; i++)
+                    pd[o[1] + i * sd] = ps[o[0] + i * ss];
+        });
+    });
+}
+
+} // namespace host
+} // namespace miopen
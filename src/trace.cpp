@@ -0,0 +1,215 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/env.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/trace.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace miopen {
+
+MIOPEN_DECLARE_ENV_VAR(MIOPEN_TRACE_FILE)
+
+namespace {
+
+struct TraceEvent
+{
+    const char* category;
+    std::string name;
+    double start;
+    double duration;
+    bool kernel;
+};
+
+/// Events of one thread. Only the owning thread appends, so the lock is uncontended
+/// except while the trace is being written.
+struct TraceBuffer
+{
+    std::mutex mutex;
+    std::vector<TraceEvent> events;
+    int tid = 0;
+};
+
+std::string JsonEscape(const std::string& s)
+{
+    std::string result;
+    result.reserve(s.size());
+    for(const auto c : s)
+    {
+        switch(c)
+        {
+        case '"': result += "\\\""; break;
+        case '\\': result += "\\\\"; break;
+        case '\n': result += "\\n"; break;
+        case '\t': result += "\\t"; break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+            {
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                result += buf;
+            }
+            else
+            {
+                result += c;
+            }
+        }
+    }
+    return result;
+}
+
+class Tracer
+{
+    public:
+    Tracer() : start_time(std::chrono::steady_clock::now()) {}
+
+    ~Tracer()
+    {
+        if(IsTracing())
+            Write(GetStringEnv(MIOPEN_TRACE_FILE{}));
+    }
+
+    static Tracer& Get()
+    {
+        static Tracer tracer;
+        return tracer;
+    }
+
+    double Now() const
+    {
+        return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() -
+                                                         start_time)
+            .count();
+    }
+
+    void Add(TraceEvent event)
+    {
+        auto& buffer = ThreadBuffer();
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.events.push_back(std::move(event));
+    }
+
+    void Write(const std::string& path)
+    {
+        std::ofstream file(path);
+        if(!file)
+        {
+            // Also called at exit, when the log sink may be gone already.
+            std::cerr << PlatformName() << ": Error [TraceWrite] Cannot write trace to " << path
+                      << std::endl;
+            return;
+        }
+        file << std::fixed << std::setprecision(3);
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+        file << R"({"name":"process_name","ph":"M","pid":1,"args":{"name":"MIOpen"}},)"
+             << "\n";
+        file << R"({"name":"process_name","ph":"M","pid":2,"args":{"name":"Kernels"}})";
+
+        std::lock_guard<std::mutex> lock(buffers_mutex);
+        for(auto&& buffer : buffers)
+        {
+            std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+            for(auto&& event : buffer->events)
+            {
+                file << ",\n{\"name\":\"" << JsonEscape(event.name) << "\",\"cat\":\""
+                     << event.category << "\",\"ph\":\"X\",\"pid\":" << (event.kernel ? 2 : 1)
+                     << ",\"tid\":" << buffer->tid << ",\"ts\":" << event.start
+                     << ",\"dur\":" << event.duration << "}";
+            }
+        }
+        file << "\n]}\n";
+    }
+
+    private:
+    TraceBuffer& ThreadBuffer()
+    {
+        thread_local std::shared_ptr<TraceBuffer> buffer;
+        if(buffer == nullptr)
+        {
+            buffer = std::make_shared<TraceBuffer>();
+            std::lock_guard<std::mutex> lock(buffers_mutex);
+            buffer->tid = static_cast<int>(buffers.size()) + 1;
+            buffers.push_back(buffer);
+        }
+        return *buffer;
+    }
+
+    std::chrono::steady_clock::time_point start_time;
+    std::mutex buffers_mutex;
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+};
+
+} // namespace
+
+bool IsTracing()
+{
+    static const bool enabled = [] {
+        const auto path = GetStringEnv(MIOPEN_TRACE_FILE{});
+        if(path == nullptr || *path == '\0')
+            return false;
+        // Started before the first event, so it is destroyed (and writes the trace) last.
+        Tracer::Get();
+        return true;
+    }();
+    return enabled;
+}
+
+double TraceNow() { return Tracer::Get().Now(); }
+
+void TraceComplete(const char* category, std::string name, double start, double duration)
+{
+    if(IsTracing())
+        Tracer::Get().Add({category, std::move(name), start, duration, false});
+}
+
+void TraceKernel(const std::string& name, float ms)
+{
+    if(!IsTracing())
+        return;
+    const auto duration = ms * 1000.0;
+    const auto end      = TraceNow();
+    Tracer::Get().Add({"kernel", name, end - duration, duration, true});
+}
+
+void TraceWrite()
+{
+    if(IsTracing())
+        TraceWrite(GetStringEnv(MIOPEN_TRACE_FILE{}));
+}
+
+void TraceWrite(const std::string& path) { Tracer::Get().Write(path); }
+
+} // namespace miopen
@@ -0,0 +1,315 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <miopen/convolution.hpp>
+#include <miopen/errors.hpp>
+#include <miopen/gemm_host.hpp>
+#include <miopen/parallel_for.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/winograd_host.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace miopen {
+namespace host {
+
+namespace {
+
+constexpr int max_alpha = 6;
+
+/// The matrices of Y = A^T [(G g G^T) . (B^T d B)] A for an m x m output tile, from
+/// "Fast Algorithms for Convolutional Neural Networks" (Lavin and Gray).
+struct Transforms
+{
+    int m;
+    int alpha;
+    const float* bt; // alpha x alpha
+    const double* g; // alpha x 3
+    const float* at; // m x alpha
+};
+
+// clang-format off
+constexpr float bt_f2[] = {
+    1,  0, -1,  0,
+    0,  1,  1,  0,
+    0, -1,  1,  0,
+    0,  1,  0, -1};
+constexpr double g_f2[] = {
+    1,    0,   0,
+    0.5,  0.5, 0.5,
+    0.5, -0.5, 0.5,
+    0,    0,   1};
+constexpr float at_f2[] = {
+    1, 1,  1,  0,
+    0, 1, -1, -1};
+
+constexpr float bt_f4[] = {
+    4,  0, -5,  0, 1, 0,
+    0, -4, -4,  1, 1, 0,
+    0,  4, -4, -1, 1, 0,
+    0, -2, -1,  2, 1, 0,
+    0,  2, -1, -2, 1, 0,
+    0,  4,  0, -5, 0, 1};
+constexpr double g_f4[] = {
+     1.0 / 4,         0,        0,
+    -1.0 / 6,  -1.0 / 6, -1.0 / 6,
+    -1.0 / 6,   1.0 / 6, -1.0 / 6,
+     1.0 / 24,  1.0 / 12, 1.0 / 6,
+     1.0 / 24, -1.0 / 12, 1.0 / 6,
+     0,         0,        1};
+constexpr float at_f4[] = {
+    1, 1,  1, 1,  1, 0,
+    0, 1, -1, 2, -2, 0,
+    0, 1,  1, 4,  4, 0,
+    0, 1, -1, 8, -8, 1};
+// clang-format on
+
+const Transforms& GetTransforms(WinogradTile tile)
+{
+    static const Transforms f2{2, 4, bt_f2, g_f2, at_f2};
+    static const Transforms f4{4, 6, bt_f4, g_f4, at_f4};
+    return tile == WinogradTile::F2x3 ? f2 : f4;
+}
+
+/// y = t x t^T for the rows x alpha matrix t and alpha x alpha tiles x, of which there are nb
+/// side by side: element (i, j) of the tiles is the row x + (i * alpha + j) * x_stride, and
+/// element (a, b) of the results the row y + (a * rows + b) * y_stride. The loops run along the
+/// tiles, and the zeros of t are skipped. tx is scratch for rows * alpha * nb values.
+void Transform(int rows,
+               int alpha,
+               const float* t,
+               const float* x,
+               std::size_t x_stride,
+               float* y,
+               std::size_t y_stride,
+               float* tx,
+               std::size_t nb)
+{
+    std::fill(tx, tx + std::size_t(rows) * alpha * nb, 0.0f);
+    for(int a = 0; a < rows; a++)
+        for(int i = 0; i < alpha; i++)
+        {
+            const float f = t[a * alpha + i];
+            if(f == 0)
+                continue;
+            for(int j = 0; j < alpha; j++)
+            {
+                const float* xr = x + (i * alpha + j) * x_stride;
+                float* txr      = tx + (a * alpha + j) * nb;
+                for(std::size_t tb = 0; tb < nb; tb++)
+                    txr[tb] += f * xr[tb];
+            }
+        }
+    for(int a = 0; a < rows; a++)
+        for(int b = 0; b < rows; b++)
+        {
+            float* yr = y + (a * rows + b) * y_stride;
+            std::fill(yr, yr + nb, 0.0f);
+            for(int j = 0; j < alpha; j++)
+            {
+                const float f = t[b * alpha + j];
+                if(f == 0)
+                    continue;
+                const float* txr = tx + (a * alpha + j) * nb;
+                for(std::size_t tb = 0; tb < nb; tb++)
+                    yr[tb] += f * txr[tb];
+            }
+        }
+}
+
+// Bytes of transformed input and output that a block of tiles should stay within, so that they
+// are still in cache for the GEMMs and the output transform.
+constexpr std::size_t block_bytes = std::size_t{1} << 20;
+
+} // namespace
+
+WinogradConv3x3::WinogradConv3x3(
+    WinogradTile ptile, int pk, int pc, const float* w, bool pbackward)
+    : tile(ptile), backward(pbackward), k(pbackward ? pc : pk), c(pbackward ? pk : pc)
+{
+    const auto& t     = GetTransforms(tile);
+    const int alpha   = t.alpha;
+    const auto stride = std::size_t(k) * c;
+    u.resize(std::size_t(alpha) * alpha * stride);
+
+    for(int ko = 0; ko < k; ko++)
+        for(int ci = 0; ci < c; ci++)
+        {
+            // Backward data convolves with the flipped filter of the swapped channels
+            double g[3][3];
+            const float* f =
+                backward ? w + (std::size_t(ci) * pc + ko) * 9 : w + (std::size_t(ko) * pc + ci) * 9;
+            for(int i = 0; i < 3; i++)
+                for(int j = 0; j < 3; j++)
+                    g[i][j] = backward ? f[(2 - i) * 3 + 2 - j] : f[i * 3 + j];
+
+            // U = G g G^T, in double since it is done once
+            double gg[max_alpha][3];
+            for(int a = 0; a < alpha; a++)
+                for(int j = 0; j < 3; j++)
+                    gg[a][j] = t.g[a * 3] * g[0][j] + t.g[a * 3 + 1] * g[1][j] +
+                               t.g[a * 3 + 2] * g[2][j];
+            for(int a = 0; a < alpha; a++)
+                for(int b = 0; b < alpha; b++)
+                    u[(a * alpha + b) * stride + std::size_t(ko) * c + ci] =
+                        static_cast<float>(gg[a][0] * t.g[b * 3] + gg[a][1] * t.g[b * 3 + 1] +
+                                           gg[a][2] * t.g[b * 3 + 2]);
+        }
+}
+
+void WinogradConv3x3::Run(int n,
+                          int in_h,
+                          int in_w,
+                          int pad_h,
+                          int pad_w,
+                          int out_h,
+                          int out_w,
+                          const float* in,
+                          float* out) const
+{
+    // The transposed convolution pads by the filter overhang the forward one did not use
+    if(backward)
+    {
+        pad_h = 2 - pad_h;
+        pad_w = 2 - pad_w;
+    }
+    if(pad_h < 0 || pad_w < 0)
+        MIOPEN_THROW(miopenStatusBadParm, "Winograd convolution needs non-negative pads");
+
+    const auto& t          = GetTransforms(tile);
+    const int m            = t.m;
+    const int alpha        = t.alpha;
+    const std::size_t xi_n = std::size_t(alpha) * alpha;
+    const int tiles_h      = (out_h + m - 1) / m;
+    const int tiles_w      = (out_w + m - 1) / m;
+    const std::size_t image_tiles = std::size_t(tiles_h) * tiles_w;
+    const std::size_t total_tiles = image_tiles * n;
+    if(total_tiles == 0)
+        return;
+
+    const std::size_t in_size  = std::size_t(c) * in_h * in_w;
+    const std::size_t out_size = std::size_t(k) * out_h * out_w;
+    const std::size_t block = std::max<std::size_t>(
+        16,
+        std::min<std::size_t>(256, block_bytes / (xi_n * (c + k) * sizeof(float)) / 16 * 16));
+    const std::size_t blocks = (total_tiles + block - 1) / block;
+
+    ParallelFor(blocks, 1, [&](std::size_t begin, std::size_t end) {
+        // d holds alpha^2 rows of nb input tiles of one channel, and later the m^2 rows of the
+        // output tiles. v holds alpha^2 matrices of c x nb transformed inputs, mv alpha^2
+        // matrices of k x nb products.
+        std::vector<float> d(xi_n * block);
+        std::vector<float> tx(xi_n * block);
+        std::vector<float> v(xi_n * c * block);
+        std::vector<float> mv(xi_n * k * block);
+        std::vector<int> tile_y(block);
+        std::vector<int> tile_x(block);
+        std::vector<std::size_t> tile_img(block);
+
+        for(std::size_t bi = begin; bi < end; bi++)
+        {
+            const std::size_t first = bi * block;
+            const std::size_t nb    = std::min(block, total_tiles - first);
+            for(std::size_t tb = 0; tb < nb; tb++)
+            {
+                const std::size_t tile_idx = first + tb;
+                tile_img[tb]               = tile_idx / image_tiles;
+                tile_y[tb]                 = int(tile_idx % image_tiles / tiles_w) * m;
+                tile_x[tb]                 = int(tile_idx % tiles_w) * m;
+            }
+
+            // V = B^T d B
+            for(int ci = 0; ci < c; ci++)
+            {
+                for(std::size_t tb = 0; tb < nb; tb++)
+                {
+                    const float* plane =
+                        in + tile_img[tb] * in_size + std::size_t(ci) * in_h * in_w;
+                    for(int i = 0; i < alpha; i++)
+                    {
+                        const int yy = tile_y[tb] - pad_h + i;
+                        for(int j = 0; j < alpha; j++)
+                        {
+                            const int xx = tile_x[tb] - pad_w + j;
+                            d[(i * alpha + j) * nb + tb] =
+                                (yy >= 0 && yy < in_h && xx >= 0 && xx < in_w)
+                                    ? plane[std::size_t(yy) * in_w + xx]
+                                    : 0.0f;
+                        }
+                    }
+                }
+                Transform(alpha, alpha, t.bt, d.data(), nb, &v[ci * nb], c * nb, tx.data(), nb);
+            }
+
+            // M = U V for every transform coefficient
+            for(std::size_t xi = 0; xi < xi_n; xi++)
+                Gemm(false,
+                     false,
+                     k,
+                     nb,
+                     c,
+                     1.0f,
+                     u.data() + xi * k * c,
+                     c,
+                     v.data() + xi * c * nb,
+                     nb,
+                     0.0f,
+                     mv.data() + xi * k * nb,
+                     nb);
+
+            // Y = A^T M A, clipped to the output
+            for(int ko = 0; ko < k; ko++)
+            {
+                Transform(m, alpha, t.at, &mv[ko * nb], k * nb, d.data(), nb, tx.data(), nb);
+                for(std::size_t tb = 0; tb < nb; tb++)
+                {
+                    float* plane = out + tile_img[tb] * out_size + std::size_t(ko) * out_h * out_w;
+                    for(int a = 0; a < m && tile_y[tb] + a < out_h; a++)
+                        for(int b = 0; b < m && tile_x[tb] + b < out_w; b++)
+                            plane[std::size_t(tile_y[tb] + a) * out_w + tile_x[tb] + b] =
+                                d[(a * m + b) * nb + tb];
+                }
+            }
+        }
+    });
+}
+
+bool IsWinogradApplicable(const ConvolutionDescriptor& conv,
+                          const TensorDescriptor& wDesc,
+                          bool backward)
+{
+    const auto& lens = wDesc.GetLengths();
+    if(lens.size() != 4 || lens[2] != 3 || lens[3] != 3)
+        return false;
+    if(conv.u != 1 || conv.v != 1 || conv.dilation_h != 1 || conv.dilation_w != 1)
+        return false;
+    if(conv.pad_h < 0 || conv.pad_w < 0)
+        return false;
+    return !backward || (conv.pad_h <= 2 && conv.pad_w <= 2);
+}
+
+} // namespace host
+} // namespace miopen
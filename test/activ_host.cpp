@@ -0,0 +1,210 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "activ_reference.hpp"
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/activ_host.hpp>
+#include <miopen/host_math.hpp>
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+using miopen::host::Transform;
+
+/// Distance of a from the exact b in units in the last place of T at b.
+template <class T>
+double Ulps(T a, long double b)
+{
+    if(std::isnan(b))
+        return std::isnan(a) ? 0 : std::numeric_limits<double>::infinity();
+    if(std::isinf(b))
+        return a == b ? 0 : std::numeric_limits<double>::infinity();
+    const T r     = static_cast<T>(std::abs(b));
+    const T ulp   = r < std::numeric_limits<T>::min()
+                      ? std::numeric_limits<T>::denorm_min()
+                      : std::nextafter(r, std::numeric_limits<T>::infinity()) - r;
+    return static_cast<double>(std::abs(a - b) / ulp);
+}
+
+struct test_host_math
+{
+    /// Largest error of f over count points of [lo, hi], evaluated on packs and on scalars.
+    template <class T, class F, class R>
+    static double MaxUlps(F f, R exact, double lo, double hi)
+    {
+        const std::size_t count = 100001;
+        std::vector<T> x(count), y(count);
+        for(std::size_t i = 0; i < count; i++)
+            x[i] = static_cast<T>(lo + (hi - lo) * i / (count - 1));
+        Transform(count, f, y.data(), x.data());
+        double worst = 0;
+        for(std::size_t i = 0; i < count; i++)
+        {
+            worst = std::max(worst, Ulps(y[i], exact(static_cast<long double>(x[i]))));
+            worst = std::max(worst, Ulps(f(x[i]), exact(static_cast<long double>(x[i]))));
+        }
+        return worst;
+    }
+
+    template <class T>
+    static void Check()
+    {
+        using miopen::host::Exp;
+        using miopen::host::Expm1;
+        using miopen::host::Log;
+        using miopen::host::Log1p;
+        using miopen::host::Tanh;
+        const auto exp   = [](auto x) { return Exp(x); };
+        const auto log   = [](auto x) { return Log(x); };
+        const auto expm1 = [](auto x) { return Expm1(x); };
+        const auto log1p = [](auto x) { return Log1p(x); };
+        const auto tanh  = [](auto x) { return Tanh(x); };
+        const double max_exp = std::log(std::numeric_limits<T>::max());
+        const double min_exp = std::log(std::numeric_limits<T>::denorm_min()) - 1;
+        const double tiny    = std::numeric_limits<T>::min();
+
+        // Over the whole range, including denormal and infinite results
+        CHECK(MaxUlps<T>(exp, [](long double x) { return std::exp(x); }, min_exp, max_exp + 1) <=
+              1);
+        CHECK(MaxUlps<T>(exp, [](long double x) { return std::exp(x); }, -10, 10) <= 1);
+        CHECK(MaxUlps<T>(log, [](long double x) { return std::log(x); }, 0, 100) <= 1);
+        CHECK(MaxUlps<T>(log, [](long double x) { return std::log(x); }, 0.5, 2) <= 1);
+        CHECK(MaxUlps<T>(log, [](long double x) { return std::log(x); }, 0, 100 * tiny) <= 1);
+        CHECK(MaxUlps<T>(expm1, [](long double x) { return std::expm1(x); }, -30, 10) <= 3);
+        CHECK(MaxUlps<T>(expm1, [](long double x) { return std::expm1(x); }, -1e-3, 1e-3) <= 3);
+        CHECK(MaxUlps<T>(log1p, [](long double x) { return std::log1p(x); }, -1, 30) <= 3);
+        CHECK(MaxUlps<T>(log1p, [](long double x) { return std::log1p(x); }, 0, 1e-3) <= 3);
+        CHECK(MaxUlps<T>(tanh, [](long double x) { return std::tanh(x); }, -20, 20) <= 3);
+        CHECK(MaxUlps<T>(tanh, [](long double x) { return std::tanh(x); }, -1, 1) <= 3);
+
+        const T inf = std::numeric_limits<T>::infinity();
+        const T nan = std::numeric_limits<T>::quiet_NaN();
+        const std::vector<T> special{inf, -inf, nan, 0};
+        const auto same = [&](auto f, auto exact) {
+            std::vector<T> y(special.size());
+            Transform(special.size(), f, y.data(), special.data());
+            for(std::size_t i = 0; i < special.size(); i++)
+            {
+                CHECK(Ulps(y[i], exact(static_cast<long double>(special[i]))) == 0);
+                CHECK(Ulps(f(special[i]), exact(static_cast<long double>(special[i]))) == 0);
+            }
+        };
+        same(exp, [](long double x) { return std::exp(x); });
+        same(log, [](long double x) { return std::log(x); });
+        same(expm1, [](long double x) { return std::expm1(x); });
+        same(log1p, [](long double x) { return std::log1p(x); });
+        same(tanh, [](long double x) { return std::tanh(x); });
+        CHECK(std::isnan(Log(T(-1))));
+        CHECK(Log1p(T(-1)) == -inf);
+        CHECK(std::isnan(Log1p(T(-2))));
+    }
+
+    void run() const
+    {
+        Check<float>();
+        Check<double>();
+    }
+};
+
+static const std::vector<miopenActivationMode_t>& Modes()
+{
+    static const std::vector<miopenActivationMode_t> modes = {miopenActivationPASTHRU,
+                                                              miopenActivationLOGISTIC,
+                                                              miopenActivationTANH,
+                                                              miopenActivationRELU,
+                                                              miopenActivationSOFTRELU,
+                                                              miopenActivationABS,
+                                                              miopenActivationPOWER,
+                                                              miopenActivationCLIPPEDRELU,
+                                                              miopenActivationLEAKYRELU,
+                                                              miopenActivationELU};
+    return modes;
+}
+
+struct test_activ_host
+{
+    void run() const
+    {
+        for(auto mode : Modes())
+            for(float scale : {3.0f, 60.0f})
+                Check(mode, scale);
+    }
+
+    static void Check(miopenActivationMode_t mode, float scale)
+    {
+        // Lengths that leave values past the last pack and past the last block
+        const std::size_t n = 3 * miopen::host::activ_block_size + 7;
+        auto x              = Generate(n, 1, scale);
+        const auto dy       = Generate(n, 2, 1);
+        // Zeros next to values beyond the thresholds of the modes
+        for(std::size_t i = 0; i < n; i += 97)
+            x[i] = 0;
+        const ActivReference ref{mode};
+
+        std::vector<float> y(n), dx(n);
+        std::vector<double> yd(n), dxd(n);
+        std::vector<double> xd(x.begin(), x.end()), dyd(dy.begin(), dy.end());
+        std::vector<float> y_strided(2 * n), dx_strided(3 * n);
+        miopen::host::VisitActivation<float>(
+            mode, ref.alpha, ref.beta, ref.gamma, [&](auto fwd, auto bwd) {
+                miopen::host::ActivationForwardRun(fwd, x.data(), 1, y.data(), 1, n);
+                miopen::host::ActivationForwardRun(fwd, x.data(), 1, y_strided.data(), 2, n);
+                miopen::host::ActivationBackwardRun(
+                    bwd, y.data(), 1, dy.data(), 1, x.data(), 1, dx.data(), 1, n);
+                miopen::host::ActivationBackwardRun(
+                    bwd, y_strided.data(), 2, dy.data(), 1, x.data(), 1, dx_strided.data(), 3, n);
+            });
+        miopen::host::VisitActivation<double>(
+            mode, ref.alpha, ref.beta, ref.gamma, [&](auto fwd, auto bwd) {
+                miopen::host::ActivationForwardRun(fwd, xd.data(), 1, yd.data(), 1, n);
+                miopen::host::ActivationBackwardRun(
+                    bwd, yd.data(), 1, dyd.data(), 1, xd.data(), 1, dxd.data(), 1, n);
+            });
+
+        for(std::size_t i = 0; i < n; i++)
+        {
+            const double expected_y = ref.fwd(x[i]);
+            CHECK(Near(y[i], expected_y, 1e-5));
+            CHECK(Near(yd[i], expected_y, 1e-13));
+            CHECK(y_strided[2 * i] == y[i]);
+
+            const double expected_dx = ref.bwd(dy[i], x[i], y[i]);
+            CHECK(Near(dx[i], expected_dx, 1e-5));
+            CHECK(Near(dxd[i], ref.bwd(dy[i], x[i], yd[i]), 1e-13));
+            CHECK(dx_strided[3 * i] == dx[i]);
+        }
+    }
+};
+
+int main()
+{
+    run_test<test_host_math>();
+    run_test<test_activ_host>();
+}
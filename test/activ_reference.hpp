@@ -0,0 +1,102 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_ACTIV_REFERENCE_HPP
+#define GUARD_ACTIV_REFERENCE_HPP
+
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+/// The double references of test/activation.cpp for the modes, and parameters for them.
+struct ActivReference
+{
+    double alpha = 0.95, beta = 2.3, gamma = 3.4;
+    std::function<double(double)> fwd;
+    std::function<double(double, double, double)> bwd;
+
+    explicit ActivReference(miopenActivationMode_t mode)
+    {
+        const double a = alpha, b = beta, g = gamma;
+        const double eps = std::numeric_limits<float>::epsilon();
+        switch(mode)
+        {
+        case miopenActivationPASTHRU:
+            fwd = [](double x) { return x; };
+            bwd = [](double dy, double, double) { return dy; };
+            break;
+        case miopenActivationLOGISTIC:
+            fwd = [](double x) { return 1 / (1 + std::exp(-x)); };
+            bwd = [](double dy, double, double y) { return dy * y * (1 - y); };
+            break;
+        case miopenActivationTANH:
+            fwd = [=](double x) { return b * std::tanh(a * x); };
+            bwd = [=](double dy, double, double y) { return dy * a * (b - y * y / b); };
+            break;
+        case miopenActivationRELU:
+            fwd = [](double x) { return x > 0 ? x : 0; };
+            bwd = [](double dy, double x, double) { return x > 0 ? dy : 0; };
+            break;
+        case miopenActivationSOFTRELU:
+            fwd = [](double x) { return std::log1p(std::exp(x)); };
+            bwd = [](double dy, double x, double) {
+                const double e = std::exp(std::min(x, 50.0));
+                return dy * e / (e + 1);
+            };
+            break;
+        case miopenActivationABS:
+            fwd = [](double x) { return std::abs(x); };
+            bwd = [](double dy, double x, double) { return dy * (x > 0 ? 1 : -1); };
+            break;
+        case miopenActivationPOWER:
+            fwd = [=](double x) {
+                const double v = a + b * x;
+                return v <= eps ? 0 : std::pow(v, g);
+            };
+            bwd = [=](double, double x, double y) {
+                const double v = a + b * x;
+                return v <= eps ? 0 : g * b * y / v;
+            };
+            break;
+        case miopenActivationCLIPPEDRELU:
+            fwd = [=](double x) { return std::min(a, std::max(0.0, x)); };
+            bwd = [=](double dy, double x, double) { return x > 0 && x <= a ? dy : 0; };
+            break;
+        case miopenActivationLEAKYRELU:
+            fwd = [=](double x) { return x > 0 ? x : x * a; };
+            bwd = [=](double dy, double x, double) { return dy * (x > 0 ? 1 : a); };
+            break;
+        case miopenActivationELU:
+            fwd = [=](double x) { return x > 0 ? x : a * std::expm1(x); };
+            bwd = [=](double dy, double x, double y) { return dy * (x > 0 ? 1 : y + a); };
+            break;
+        }
+    }
+};
+
+#endif
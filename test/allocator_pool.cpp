@@ -0,0 +1,239 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/allocator_pool.hpp>
+
+#include <cstdlib>
+#include <set>
+
+struct counting_allocator
+{
+    std::size_t allocations   = 0;
+    std::size_t deallocations = 0;
+    std::size_t fail_above    = 0;
+    std::set<void*> live;
+
+    static void* allocate(void* ctx, std::size_t n)
+    {
+        auto self = static_cast<counting_allocator*>(ctx);
+        if(self->fail_above != 0 && n > self->fail_above)
+            return nullptr;
+        auto p = std::malloc(n);
+        self->allocations++;
+        self->live.insert(p);
+        return p;
+    }
+
+    static void deallocate(void* ctx, void* p)
+    {
+        auto self = static_cast<counting_allocator*>(ctx);
+        CHECK(self->live.erase(p) == 1);
+        self->deallocations++;
+        std::free(p);
+    }
+
+    miopen::Allocator get() { return {&allocate, &deallocate, this}; }
+};
+
+struct pool_fixture
+{
+    counting_allocator mock;
+    std::shared_ptr<miopen::AllocatorPool> pool;
+    pool_fixture(std::size_t limit = 1 << 20)
+        : pool(std::make_shared<miopen::AllocatorPool>(mock.get(), limit))
+    {
+    }
+};
+
+struct test_size_class
+{
+    void run()
+    {
+        using miopen::AllocatorPool;
+        CHECK(AllocatorPool::GetSizeClass(1) == 512);
+        CHECK(AllocatorPool::GetSizeClass(512) == 512);
+        CHECK(AllocatorPool::GetSizeClass(513) == 1024);
+        CHECK(AllocatorPool::GetSizeClass(4096) == 4096);
+        CHECK(AllocatorPool::GetSizeClass(4097) == 5120);
+        CHECK(AllocatorPool::GetSizeClass(6000) == 6144);
+        CHECK(AllocatorPool::GetSizeClass(7169) == 8192);
+        for(std::size_t n = 1; n < (1 << 16); n += 37)
+        {
+            const auto c = AllocatorPool::GetSizeClass(n);
+            CHECK(c >= n);
+            CHECK(c < n + n / 4 + 512);
+        }
+    }
+};
+
+struct test_reuse : pool_fixture
+{
+    void run()
+    {
+        void* first = nullptr;
+        {
+            auto p = pool->Allocate(1000);
+            first  = p.get();
+            CHECK(mock.allocations == 1);
+        }
+        CHECK(mock.deallocations == 0);
+        // Same size class: served from the cache.
+        auto p = pool->Allocate(900);
+        CHECK(p.get() == first);
+        CHECK(mock.allocations == 1);
+        auto stats = pool->GetStatistics();
+        CHECK(stats.requests == 2);
+        CHECK(stats.hits == 1);
+        CHECK(stats.bytes_in_use == 1024);
+        CHECK(stats.bytes_cached == 0);
+    }
+};
+
+struct test_best_fit : pool_fixture
+{
+    void run()
+    {
+        void* small = nullptr;
+        void* large = nullptr;
+        {
+            auto a = pool->Allocate(4096);
+            auto b = pool->Allocate(16384);
+            small  = a.get();
+            large  = b.get();
+        }
+        CHECK(pool->GetStatistics().bytes_cached == 4096 + 16384);
+        // The smallest block which fits.
+        auto c = pool->Allocate(3000);
+        CHECK(c.get() == small);
+        // Too large a block is not used for a small request.
+        auto d = pool->Allocate(3000);
+        CHECK(d.get() != large);
+        CHECK(mock.allocations == 3);
+        // But it is for a request of a similar size.
+        auto e = pool->Allocate(10000);
+        CHECK(e.get() == large);
+        CHECK(mock.allocations == 3);
+    }
+};
+
+struct test_limit : pool_fixture
+{
+    test_limit() : pool_fixture(8192) {}
+    void run()
+    {
+        {
+            auto a = pool->Allocate(4096);
+            auto b = pool->Allocate(4096);
+            auto c = pool->Allocate(4096);
+            CHECK(pool->GetStatistics().peak_bytes == 3 * 4096);
+        }
+        // Only as much as the limit is kept.
+        auto stats = pool->GetStatistics();
+        CHECK(stats.bytes_cached <= 8192);
+        CHECK(mock.deallocations == 1);
+        // Cached blocks are freed to make room for new allocations.
+        auto d = pool->Allocate(8192);
+        stats = pool->GetStatistics();
+        CHECK(stats.bytes_in_use + stats.bytes_cached <= 8192);
+        CHECK(mock.live.size() == 1);
+        CHECK(stats.peak_bytes == 3 * 4096);
+    }
+};
+
+struct test_trim : pool_fixture
+{
+    void run()
+    {
+        {
+            auto a = pool->Allocate(100);
+            auto b = pool->Allocate(100000);
+        }
+        auto c = pool->Allocate(100);
+        CHECK(mock.live.size() == 2);
+        pool->Trim();
+        CHECK(mock.live.size() == 1);
+        CHECK(pool->GetStatistics().bytes_cached == 0);
+        c = nullptr;
+        CHECK(mock.live.size() == 1);
+        pool->SetLimit(0);
+        CHECK(mock.live.empty());
+        // Disabled: no caching at all.
+        {
+            auto d = pool->Allocate(100);
+        }
+        CHECK(mock.live.empty());
+        CHECK(mock.allocations == mock.deallocations);
+    }
+};
+
+struct test_retry_after_trim : pool_fixture
+{
+    void run()
+    {
+        {
+            auto a = pool->Allocate(4096);
+        }
+        mock.fail_above = 4096;
+        // The first attempt fails, the cache is freed and the second one fails too.
+        CHECK(throws([&] { pool->Allocate(8192); }));
+        CHECK(mock.live.empty());
+        mock.fail_above = 0;
+        auto b          = pool->Allocate(8192);
+        CHECK(b != nullptr);
+    }
+};
+
+struct test_outlive_pool
+{
+    void run()
+    {
+        counting_allocator mock;
+        miopen::Allocator::ManageDataPtr p = nullptr;
+        {
+            auto pool = std::make_shared<miopen::AllocatorPool>(mock.get(), 1 << 20);
+            {
+                auto cached = pool->Allocate(100);
+            }
+            p = pool->Allocate(5000);
+        }
+        // The buffer keeps the pool alive.
+        CHECK(mock.live.size() == 2);
+        p = nullptr;
+        CHECK(mock.live.empty());
+    }
+};
+
+int main()
+{
+    run_test<test_size_class>();
+    run_test<test_reuse>();
+    run_test<test_best_fit>();
+    run_test<test_limit>();
+    run_test<test_trim>();
+    run_test<test_retry_after_trim>();
+    run_test<test_outlive_pool>();
+}
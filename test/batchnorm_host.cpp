@@ -0,0 +1,215 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/batchnorm_host.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using miopen::host::BatchNormGroups;
+
+/// Two-pass statistics and the textbook gradients in double, one group at a time.
+struct Reference
+{
+    BatchNormGroups bn;
+    std::vector<double> mean, variance;
+
+    Reference(const BatchNormGroups& pbn, const std::vector<float>& x)
+        : bn(pbn), mean(bn.groups), variance(bn.groups)
+    {
+        for(std::size_t g = 0; g < bn.groups; g++)
+        {
+            double sum = 0;
+            for(std::size_t m = 0; m < bn.members; m++)
+                sum += x[Offset(g, m)];
+            mean[g]   = sum / bn.members;
+            double m2 = 0;
+            for(std::size_t m = 0; m < bn.members; m++)
+                m2 += (x[Offset(g, m)] - mean[g]) * (x[Offset(g, m)] - mean[g]);
+            variance[g] = m2 / bn.members;
+        }
+    }
+
+    std::size_t Offset(std::size_t g, std::size_t m) const
+    {
+        return (m / bn.inner) * bn.image + g * bn.inner + m % bn.inner;
+    }
+};
+
+struct test_batchnorm_host
+{
+    void run() const
+    {
+        // n, c, h, w: single positions, rows over a statistics block and single images
+        const std::vector<std::vector<std::size_t>> shapes = {{2, 3, 1, 1},
+                                                              {5, 4, 3, 7},
+                                                              {3, 2, 70, 65},
+                                                              {1, 3, 9, 9},
+                                                              {64, 2, 2, 2},
+                                                              {4, 5000, 1, 1}};
+        for(auto&& shape : shapes)
+            for(bool spatial : {true, false})
+                Check(BatchNormGroups{spatial, shape[0], shape[1], shape[2], shape[3]});
+    }
+
+    static void Check(const BatchNormGroups& bn)
+    {
+        const double epsilon = 1e-5;
+        const double factor  = 0.1;
+        const auto x         = Generate(bn.n * bn.image, 1, 1, 0.5f);
+        const auto dy        = Generate(x.size(), 2);
+        const auto scale     = Generate(bn.groups, 3);
+        const auto bias      = Generate(bn.groups, 4);
+        const Reference ref{bn, x};
+
+        std::vector<float> y(x.size()), run_mean(bn.groups, 0.25f), run_var(bn.groups, 2.0f);
+        std::vector<float> saved_mean(bn.groups), saved_invvar(bn.groups);
+        miopen::host::BatchNormForwardTraining(bn,
+                                               x.data(),
+                                               y.data(),
+                                               scale.data(),
+                                               bias.data(),
+                                               factor,
+                                               run_mean.data(),
+                                               run_var.data(),
+                                               epsilon,
+                                               saved_mean.data(),
+                                               saved_invvar.data());
+
+        std::vector<float> dx(x.size()), dscale(bn.groups), dbias(bn.groups);
+        miopen::host::BatchNormBackward<float, float>(bn,
+                                                      x.data(),
+                                                      dy.data(),
+                                                      dx.data(),
+                                                      scale.data(),
+                                                      dscale.data(),
+                                                      dbias.data(),
+                                                      epsilon,
+                                                      nullptr,
+                                                      nullptr);
+
+        std::vector<float> dx_saved(x.size()), y_infer(x.size()), variance(bn.groups);
+        std::copy(ref.variance.begin(), ref.variance.end(), variance.begin());
+        miopen::host::BatchNormBackward<float, float>(bn,
+                                                      x.data(),
+                                                      dy.data(),
+                                                      dx_saved.data(),
+                                                      scale.data(),
+                                                      nullptr,
+                                                      nullptr,
+                                                      epsilon,
+                                                      saved_mean.data(),
+                                                      saved_invvar.data());
+        miopen::host::BatchNormForwardInference(bn,
+                                                x.data(),
+                                                y_infer.data(),
+                                                scale.data(),
+                                                bias.data(),
+                                                saved_mean.data(),
+                                                variance.data(),
+                                                epsilon);
+
+        const double count = bn.members;
+        for(std::size_t g = 0; g < bn.groups; g++)
+        {
+            const double invvar = 1.0 / std::sqrt(ref.variance[g] + epsilon);
+            const double unbiased =
+                bn.members == 1 ? ref.variance[g] : ref.variance[g] * count / (count - 1);
+            CHECK(Near(saved_mean[g], ref.mean[g], 1e-6));
+            CHECK(Near(saved_invvar[g], invvar, 1e-6));
+            CHECK(Near(run_mean[g], 0.9 * 0.25 + 0.1 * ref.mean[g], 1e-6));
+            CHECK(Near(run_var[g], 0.9 * 2.0 + 0.1 * unbiased, 1e-6));
+
+            double sum_dy = 0, sum_dy_xhat = 0;
+            for(std::size_t m = 0; m < bn.members; m++)
+            {
+                const auto i = ref.Offset(g, m);
+                sum_dy += dy[i];
+                sum_dy_xhat += dy[i] * (x[i] - ref.mean[g]) * invvar;
+            }
+            CHECK(Near(dbias[g], sum_dy, 1e-5));
+            CHECK(Near(dscale[g], sum_dy_xhat, 1e-5));
+
+            for(std::size_t m = 0; m < bn.members; m++)
+            {
+                const auto i      = ref.Offset(g, m);
+                const double xhat = (x[i] - ref.mean[g]) * invvar;
+                CHECK(Near(y[i], scale[g] * xhat + bias[g], 1e-5));
+                CHECK(Near(y_infer[i], y[i], 1e-5));
+
+                double expected;
+                if(bn.spatial)
+                    expected = scale[g] * invvar / count *
+                               (count * dy[i] - sum_dy - xhat * sum_dy_xhat);
+                else
+                    expected = invvar / count * scale[g] *
+                               (count * sum_dy - xhat * sum_dy_xhat - sum_dy);
+                CHECK(Near(dx[i], expected, 1e-4));
+                CHECK(Near(dx_saved[i], dx[i], 1e-5));
+            }
+        }
+    }
+};
+
+/// A large mean next to a small spread, where sums of squares lose the variance to cancellation.
+struct test_batchnorm_host_offset
+{
+    void run() const
+    {
+        const BatchNormGroups bn{true, 8, 2, 64, 64};
+        const float offset = 3000;
+        const auto x       = Generate(bn.n * bn.image, 1, 1, offset);
+        const Reference ref{bn, x};
+
+        std::vector<float> scale(bn.groups, 1), bias(bn.groups, 0);
+        std::vector<double> y(x.size()), saved_mean(bn.groups), saved_invvar(bn.groups);
+        miopen::host::BatchNormForwardTraining<float, double>(bn,
+                                                              x.data(),
+                                                              y.data(),
+                                                              scale.data(),
+                                                              bias.data(),
+                                                              0,
+                                                              nullptr,
+                                                              nullptr,
+                                                              0,
+                                                              saved_mean.data(),
+                                                              saved_invvar.data());
+        for(std::size_t g = 0; g < bn.groups; g++)
+        {
+            CHECK(Near(saved_mean[g], ref.mean[g], 1e-12));
+            CHECK(Near(1 / (saved_invvar[g] * saved_invvar[g]), ref.variance[g], 1e-9));
+        }
+    }
+};
+
+int main()
+{
+    run_test<test_batchnorm_host>();
+    run_test<test_batchnorm_host_offset>();
+}
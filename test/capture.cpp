@@ -0,0 +1,214 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/capture.hpp>
+#include <miopen/miopen.h>
+#include <miopen/temp_file.hpp>
+
+#include <half.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static std::string CapturePath()
+{
+    static const miopen::TempFile file{"miopen-capture"};
+    return file.Path();
+}
+
+static miopen::capture::Arg MakeArg(const std::string& name,
+                                    miopen::capture::Kind kind,
+                                    std::vector<std::int64_t> ints,
+                                    std::vector<double> floats = {})
+{
+    miopen::capture::Arg arg;
+    arg.name   = name;
+    arg.kind   = kind;
+    arg.ints   = std::move(ints);
+    arg.floats = std::move(floats);
+    return arg;
+}
+
+static void ExpectEqual(const miopen::capture::Call& x, const miopen::capture::Call& y)
+{
+    EXPECT(x.name == y.name);
+    EXPECT_EQUAL(x.args.size(), y.args.size());
+    for(std::size_t i = 0; i < x.args.size(); i++)
+    {
+        EXPECT(x.args[i].name == y.args[i].name);
+        EXPECT(x.args[i].kind == y.args[i].kind);
+        EXPECT(x.args[i].ints == y.args[i].ints);
+        EXPECT(x.args[i].floats == y.args[i].floats);
+    }
+}
+
+struct test_round_trip
+{
+    void run() const
+    {
+        using miopen::capture::Kind;
+        miopen::capture::Call forward;
+        forward.name = "miopenActivationForward";
+        forward.args = {MakeArg("activDesc", Kind::Activation, {3}, {0.5, -1.25, 1e-30}),
+                        MakeArg("alpha", Kind::Float, {}, {1}),
+                        MakeArg("xDesc", Kind::Tensor, {1, 4, 2, 3, 4, 5, 60, 20, 5, 1}),
+                        MakeArg("x", Kind::Buffer, {0, 480}),
+                        MakeArg("y", Kind::Null, {})};
+        miopen::capture::Call workspace;
+        workspace.name = "miopenPoolingForward";
+        workspace.args = {MakeArg("xDesc", Kind::Tensor, {1, 4, 1, 1, 1, 1, 1, 1, 1, 1}),
+                          MakeArg("do_backward", Kind::Int, {-1}),
+                          MakeArg("workSpaceSize",
+                                  Kind::Int,
+                                  {std::numeric_limits<std::int64_t>::min(),
+                                   std::numeric_limits<std::int64_t>::max(),
+                                   0x80})};
+
+        std::stringstream stream;
+        {
+            miopen::capture::Writer writer{stream};
+            writer.Write(forward);
+            writer.Write(workspace);
+            writer.Write(forward);
+        }
+        // Repeated names are stored once.
+        EXPECT_EQUAL(stream.str().find("xDesc"), stream.str().rfind("xDesc"));
+
+        miopen::capture::Reader reader{stream};
+        EXPECT(reader.IsValid());
+        miopen::capture::Call call;
+        for(auto&& expected : {forward, workspace, forward})
+        {
+            EXPECT(reader.Read(call));
+            ExpectEqual(call, expected);
+        }
+        EXPECT(not reader.Read(call));
+
+        std::stringstream garbage{"not a capture"};
+        EXPECT(not miopen::capture::Reader{garbage}.IsValid());
+    }
+};
+
+struct test_recorder
+{
+    void run() const
+    {
+        setenv("MIOPEN_CAPTURE_FILE", CapturePath().c_str(), 1);
+        EXPECT(miopen::capture::IsCapturing());
+
+        miopenTensorDescriptor_t desc;
+        EXPECT(miopenCreateTensorDescriptor(&desc) == miopenStatusSuccess);
+        EXPECT(miopenSet4dTensorDescriptor(desc, miopenFloat, 2, 3, 4, 5) == miopenStatusSuccess);
+        size_t size = 0;
+        EXPECT(miopenLRNGetWorkSpaceSize(desc, &size) == miopenStatusSuccess);
+        EXPECT(miopenDestroyTensorDescriptor(desc) == miopenStatusSuccess);
+
+        std::ifstream file(CapturePath(), std::ios::binary);
+        miopen::capture::Reader reader{file};
+        EXPECT(reader.IsValid());
+        std::vector<std::string> names;
+        miopen::capture::Call call;
+        while(reader.Read(call))
+        {
+            names.push_back(call.name);
+            if(call.name != "miopenLRNGetWorkSpaceSize")
+                continue;
+            const auto y = call.Find("yDesc");
+            EXPECT(y != nullptr);
+            EXPECT(y->kind == miopen::capture::Kind::Tensor);
+            EXPECT(y->ints == std::vector<std::int64_t>({miopenFloat, 4, 2, 3, 4, 5, 60, 20, 5, 1}));
+            const auto workspace_size = call.Find("workSpaceSize");
+            EXPECT(workspace_size != nullptr);
+            EXPECT(workspace_size->kind == miopen::capture::Kind::Pointer);
+        }
+        EXPECT(names == std::vector<std::string>({"miopenCreateTensorDescriptor",
+                                                  "miopenSet4dTensorDescriptor",
+                                                  "miopenLRNGetWorkSpaceSize",
+                                                  "miopenDestroyTensorDescriptor"}));
+    }
+};
+
+struct test_scales
+{
+    // Records alpha before the tensor which decides its type, as the API functions do.
+    static void Record(const char* name, miopenDataType_t type, const void* alpha, const void* beta)
+    {
+        miopenTensorDescriptor_t desc;
+        EXPECT(miopenCreateTensorDescriptor(&desc) == miopenStatusSuccess);
+        EXPECT(miopenSet4dTensorDescriptor(desc, type, 1, 2, 3, 4) == miopenStatusSuccess);
+        {
+            miopen::capture::Recorder recorder{name};
+            recorder.Add("alpha", alpha);
+            recorder.Add("xDesc", desc);
+            recorder.Add("beta", beta);
+        }
+        EXPECT(miopenDestroyTensorDescriptor(desc) == miopenStatusSuccess);
+    }
+
+    void run() const
+    {
+        setenv("MIOPEN_CAPTURE_FILE", CapturePath().c_str(), 1);
+        EXPECT(miopen::capture::IsCapturing());
+
+        const half_float::half half_alpha{0.5f};
+        const half_float::half half_beta{-2.0f};
+        Record("scales_half", miopenHalf, &half_alpha, &half_beta);
+        const float float_alpha = 0.25f;
+        const float float_beta  = 3.0f;
+        Record("scales_float", miopenFloat, &float_alpha, &float_beta);
+
+        std::ifstream file(CapturePath(), std::ios::binary);
+        miopen::capture::Reader reader{file};
+        EXPECT(reader.IsValid());
+        std::vector<std::vector<double>> scales;
+        miopen::capture::Call call;
+        while(reader.Read(call))
+        {
+            if(call.name != "scales_half" && call.name != "scales_float")
+                continue;
+            for(auto&& name : {"alpha", "beta"})
+            {
+                const auto scale = call.Find(name);
+                EXPECT(scale != nullptr);
+                EXPECT(scale->kind == miopen::capture::Kind::Float);
+                scales.push_back(scale->floats);
+            }
+        }
+        EXPECT(scales == std::vector<std::vector<double>>({{0.5}, {-2.0}, {0.25}, {3.0}}));
+    }
+};
+
+int main()
+{
+    run_test<test_round_trip>();
+    run_test<test_recorder>();
+    run_test<test_scales>();
+}
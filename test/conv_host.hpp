@@ -0,0 +1,408 @@
+/*******************************************************************************
+ *
+ * MIT License
+ *
+ * Copyright (c) 2018 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GUARD_CONV_HOST_HPP
+#define GUARD_CONV_HOST_HPP
+
+#include "ford.hpp"
+#include "tensor_holder.hpp"
+#include <algorithm>
+#include <miopen/convolution.hpp>
+#include <vector>
+
+// Reference convolutions for the tests. Each image is unrolled into columns
+// (im2col) one block of output pixels at a time, and multiplied with the
+// weights by a cache-blocked GEMM that accumulates in double, so the results
+// match the direct loops within the tolerance of verify.hpp.
+namespace conv_host_detail {
+
+// Output channels (or weights rows) computed together against one column block
+static constexpr std::size_t k_block = 16;
+
+// Number of output pixels packed at once, so that a block of `rows` columns
+// stays in cache
+inline std::size_t pixel_block(std::size_t rows)
+{
+    const std::size_t pixels = (std::size_t{1} << 15) / std::max<std::size_t>(rows, 1);
+    return std::max<std::size_t>(16, std::min<std::size_t>(256, pixels));
+}
+
+// A 4-D NCHW tensor seen as planes of (n, c)
+template <class T>
+struct planes
+{
+    T* data;
+    std::size_t n_stride, c_stride, h_stride, w_stride;
+
+    template <class U>
+    planes(T* pdata, const tensor<U>& t) : data(pdata)
+    {
+        std::tie(n_stride, c_stride, h_stride, w_stride) = miopen::tien<4>(t.desc.GetStrides());
+    }
+
+    T* operator()(std::size_t n, std::size_t c) const { return data + n * n_stride + c * c_stride; }
+};
+
+struct geometry
+{
+    // "in" has the weights' input channels, "out" has the weights' output channels
+    int in_h, in_w, wei_h, wei_w, out_h, out_w;
+    int pad_h, pad_w, u, v, dilation_h, dilation_w;
+
+    template <class T>
+    geometry(const tensor<T>& in,
+             const tensor<T>& weights,
+             const tensor<T>& out,
+             const miopen::ConvolutionDescriptor& filter)
+        : pad_h(filter.pad_h),
+          pad_w(filter.pad_w),
+          u(filter.u),
+          v(filter.v),
+          dilation_h(filter.dilation_h),
+          dilation_w(filter.dilation_w)
+    {
+        std::tie(std::ignore, std::ignore, in_h, in_w)   = miopen::tien<4>(in.desc.GetLengths());
+        std::tie(std::ignore, std::ignore, wei_h, wei_w) = miopen::tien<4>(weights.desc.GetLengths());
+        std::tie(std::ignore, std::ignore, out_h, out_w) = miopen::tien<4>(out.desc.GetLengths());
+    }
+
+    std::size_t taps() const { return std::size_t(wei_h) * wei_w; }
+    std::size_t pixels() const { return std::size_t(out_h) * out_w; }
+
+    // Calls f(p, ih, iw) for the output pixels [p0, p0 + pn) under filter tap (x, y)
+    template <class F>
+    void for_each_tap_pixel(int x, int y, std::size_t p0, std::size_t pn, F f) const
+    {
+        int oh = p0 / out_w;
+        int ow = p0 % out_w;
+        for(std::size_t p = 0; p < pn; p++)
+        {
+            f(p, oh * u - pad_h + x * dilation_h, ow * v - pad_w + y * dilation_w);
+            if(++ow == out_w)
+            {
+                ow = 0;
+                oh++;
+            }
+        }
+    }
+
+    bool inside(int ih, int iw) const { return ih >= 0 && ih < in_h && iw >= 0 && iw < in_w; }
+
+    // Unrolls one input plane into col[tap * pn + p], with zeros over the padding
+    template <class T>
+    void im2col(const T* plane,
+                std::size_t h_stride,
+                std::size_t w_stride,
+                std::size_t p0,
+                std::size_t pn,
+                double* col) const
+    {
+        for(int x = 0; x < wei_h; x++)
+            for(int y = 0; y < wei_w; y++, col += pn)
+                for_each_tap_pixel(x, y, p0, pn, [&](std::size_t p, int ih, int iw) {
+                    col[p] = inside(ih, iw) ? double(plane[ih * h_stride + iw * w_stride]) : 0.0;
+                });
+    }
+
+    // Accumulates col[tap * pn + p] back into a packed in_h x in_w plane
+    void col2im(const double* col, std::size_t p0, std::size_t pn, double* plane) const
+    {
+        for(int x = 0; x < wei_h; x++)
+            for(int y = 0; y < wei_w; y++, col += pn)
+                for_each_tap_pixel(x, y, p0, pn, [&](std::size_t p, int ih, int iw) {
+                    if(inside(ih, iw))
+                        plane[ih * in_w + iw] += col[p];
+                });
+    }
+
+    // Calls f(p, offset) for the output pixels [p0, p0 + pn) of a plane
+    template <class F>
+    void for_each_pixel(
+        std::size_t p0, std::size_t pn, std::size_t h_stride, std::size_t w_stride, F f) const
+    {
+        std::size_t oh = p0 / out_w;
+        std::size_t ow = p0 % out_w;
+        for(std::size_t p = 0; p < pn; p++)
+        {
+            f(p, oh * h_stride + ow * w_stride);
+            if(++ow == std::size_t(out_w))
+            {
+                ow = 0;
+                oh++;
+            }
+        }
+    }
+};
+
+inline double dot(const double* x, const double* y, std::size_t n)
+{
+    // Independent partial sums, so the additions do not serialize
+    double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    std::size_t i = 0;
+    for(; i + 4 <= n; i += 4)
+    {
+        s0 += x[i] * y[i];
+        s1 += x[i + 1] * y[i + 1];
+        s2 += x[i + 2] * y[i + 2];
+        s3 += x[i + 3] * y[i + 3];
+    }
+    for(; i < n; i++)
+        s0 += x[i] * y[i];
+    return (s0 + s1) + (s2 + s3);
+}
+
+// out = in * weights + bias
+template <class T>
+void forward(const tensor<T>& in,
+             const tensor<T>& weights,
+             tensor<T>& out,
+             const geometry& g,
+             double bias)
+{
+    int n, c, k;
+    std::tie(n, c, std::ignore, std::ignore) = miopen::tien<4>(in.desc.GetLengths());
+    std::tie(k, std::ignore, std::ignore, std::ignore) =
+        miopen::tien<4>(weights.desc.GetLengths());
+
+    const std::size_t taps   = g.taps();
+    const std::size_t rows   = c * taps;
+    const std::size_t pixels = g.pixels();
+    const std::size_t pb     = pixel_block(rows);
+    const std::size_t blocks = (pixels + pb - 1) / pb;
+
+    std::vector<double> wei(k * rows);
+    ford(k, c, g.wei_h, g.wei_w)([&](int w, int ch, int x, int y) {
+        wei[w * rows + (ch * g.wei_h + x) * g.wei_w + y] = weights(w, ch, x, y);
+    });
+
+    const planes<const T> src(in.data.data(), in);
+    const planes<T> dst(out.data.data(), out);
+
+    par_for(n * blocks, 1, [&](std::size_t i) {
+        const std::size_t img = i / blocks;
+        const std::size_t p0  = (i % blocks) * pb;
+        const std::size_t pn  = std::min(pb, pixels - p0);
+
+        std::vector<double> col(rows * pn);
+        for(int ch = 0; ch < c; ch++)
+            g.im2col(src(img, ch), src.h_stride, src.w_stride, p0, pn, &col[ch * taps * pn]);
+
+        std::vector<double> acc(k_block * pn);
+        for(std::size_t k0 = 0; k0 < std::size_t(k); k0 += k_block)
+        {
+            const std::size_t kn = std::min<std::size_t>(k_block, k - k0);
+            std::fill(acc.begin(), acc.end(), bias);
+            for(std::size_t r = 0; r < rows; r++)
+            {
+                const double* col_row = &col[r * pn];
+                for(std::size_t kk = 0; kk < kn; kk++)
+                {
+                    const double a = wei[(k0 + kk) * rows + r];
+                    double* acc_row = &acc[kk * pn];
+                    for(std::size_t p = 0; p < pn; p++)
+                        acc_row[p] += a * col_row[p];
+                }
+            }
+            for(std::size_t kk = 0; kk < kn; kk++)
+            {
+                T* plane = dst(img, k0 + kk);
+                g.for_each_pixel(p0, pn, dst.h_stride, dst.w_stride, [&](std::size_t p, std::size_t o) {
+                    plane[o] = static_cast<T>(acc[kk * pn + p]);
+                });
+            }
+        }
+    });
+}
+
+// in = out * weights^T, scattered back through col2im; in starts at `init`
+template <class T>
+void backward_data(tensor<T>& in,
+                   const tensor<T>& weights,
+                   const tensor<T>& out,
+                   const geometry& g,
+                   double init)
+{
+    int n, c, k;
+    std::tie(n, c, std::ignore, std::ignore) = miopen::tien<4>(in.desc.GetLengths());
+    std::tie(k, std::ignore, std::ignore, std::ignore) =
+        miopen::tien<4>(weights.desc.GetLengths());
+
+    const std::size_t taps   = g.taps();
+    const std::size_t pixels = g.pixels();
+    const std::size_t pb     = pixel_block(k + taps);
+
+    // Transposed weights: wei[(ch * taps + tap) * k + w]
+    std::vector<double> wei(c * taps * k);
+    ford(k, c, g.wei_h, g.wei_w)([&](int w, int ch, int x, int y) {
+        wei[((ch * g.wei_h + x) * g.wei_w + y) * k + w] = weights(w, ch, x, y);
+    });
+
+    const planes<const T> src(out.data.data(), out);
+    const planes<T> dst(in.data.data(), in);
+
+    // Each (image, channel) owns its input plane, so the scatter needs no locking
+    par_for(std::size_t(n) * c, 1, [&](std::size_t i) {
+        const std::size_t img = i / c;
+        const std::size_t ch  = i % c;
+
+        std::vector<double> plane(std::size_t(g.in_h) * g.in_w, init);
+        std::vector<double> dout(k * pb);
+        std::vector<double> acc(taps * pb);
+        for(std::size_t p0 = 0; p0 < pixels; p0 += pb)
+        {
+            const std::size_t pn = std::min(pb, pixels - p0);
+            for(int w = 0; w < k; w++)
+            {
+                const T* row = src(img, w);
+                g.for_each_pixel(p0, pn, src.h_stride, src.w_stride, [&](std::size_t p, std::size_t o) {
+                    dout[w * pn + p] = row[o];
+                });
+            }
+
+            std::fill(acc.begin(), acc.begin() + taps * pn, 0.0);
+            for(int w = 0; w < k; w++)
+            {
+                const double* dout_row = &dout[w * pn];
+                for(std::size_t t = 0; t < taps; t++)
+                {
+                    const double a  = wei[(ch * taps + t) * k + w];
+                    double* acc_row = &acc[t * pn];
+                    for(std::size_t p = 0; p < pn; p++)
+                        acc_row[p] += a * dout_row[p];
+                }
+            }
+            g.col2im(acc.data(), p0, pn, plane.data());
+        }
+
+        T* result = dst(img, ch);
+        for(int h = 0; h < g.in_h; h++)
+            for(int w = 0; w < g.in_w; w++)
+                result[h * dst.h_stride + w * dst.w_stride] =
+                    static_cast<T>(plane[h * g.in_w + w]);
+    });
+}
+
+// weights = sum over the images of out * im2col(in)^T
+template <class T>
+void backward_weights(const tensor<T>& in,
+                      tensor<T>& weights,
+                      const tensor<T>& out,
+                      const geometry& g)
+{
+    int n, c, k;
+    std::tie(n, c, std::ignore, std::ignore) = miopen::tien<4>(in.desc.GetLengths());
+    std::tie(k, std::ignore, std::ignore, std::ignore) =
+        miopen::tien<4>(weights.desc.GetLengths());
+
+    const std::size_t taps    = g.taps();
+    const std::size_t pixels  = g.pixels();
+    const std::size_t pb      = pixel_block(k_block + taps);
+    const std::size_t kblocks = (k + k_block - 1) / k_block;
+
+    const planes<const T> src(in.data.data(), in);
+    const planes<const T> diff(out.data.data(), out);
+
+    // Each (block of output channels, input channel) owns its weights
+    par_for(kblocks * c, 1, [&](std::size_t i) {
+        const std::size_t k0 = (i / c) * k_block;
+        const std::size_t ch = i % c;
+        const std::size_t kn = std::min<std::size_t>(k_block, k - k0);
+
+        std::vector<double> acc(kn * taps);
+        std::vector<double> col(taps * pb);
+        std::vector<double> dout(kn * pb);
+        for(int img = 0; img < n; img++)
+        {
+            for(std::size_t p0 = 0; p0 < pixels; p0 += pb)
+            {
+                const std::size_t pn = std::min(pb, pixels - p0);
+                g.im2col(src(img, ch), src.h_stride, src.w_stride, p0, pn, col.data());
+                for(std::size_t kk = 0; kk < kn; kk++)
+                {
+                    const T* row = diff(img, k0 + kk);
+                    g.for_each_pixel(
+                        p0, pn, diff.h_stride, diff.w_stride, [&](std::size_t p, std::size_t o) {
+                            dout[kk * pn + p] = row[o];
+                        });
+                }
+                for(std::size_t kk = 0; kk < kn; kk++)
+                    for(std::size_t t = 0; t < taps; t++)
+                        acc[kk * taps + t] += dot(&dout[kk * pn], &col[t * pn], pn);
+            }
+        }
+
+        for(std::size_t kk = 0; kk < kn; kk++)
+            for(int x = 0; x < g.wei_h; x++)
+                for(int y = 0; y < g.wei_w; y++)
+                    weights(k0 + kk, ch, x, y) = static_cast<T>(acc[kk * taps + x * g.wei_w + y]);
+    });
+}
+
+} // namespace conv_host_detail
+
+// Transposed convolutions swap the roles of the input and the output, so their
+// forward pass is the backward data pass of the normal convolution and back.
+
+template <class T>
+void conv_host_forward(const tensor<T>& input,
+                       const tensor<T>& weights,
+                       tensor<T>& out,
+                       const miopen::ConvolutionDescriptor& filter,
+                       double bias = 0)
+{
+    using namespace conv_host_detail;
+    if(filter.mode == miopenTranspose)
+        backward_data(out, weights, input, geometry{out, weights, input, filter}, bias);
+    else
+        forward(input, weights, out, geometry{input, weights, out, filter}, bias);
+}
+
+template <class T>
+void conv_host_backward_data(tensor<T>& input,
+                             const tensor<T>& weights,
+                             const tensor<T>& out,
+                             const miopen::ConvolutionDescriptor& filter)
+{
+    using namespace conv_host_detail;
+    if(filter.mode == miopenTranspose)
+        forward(out, weights, input, geometry{out, weights, input, filter}, 0);
+    else
+        backward_data(input, weights, out, geometry{input, weights, out, filter}, 0);
+}
+
+template <class T>
+void conv_host_backward_weights(const tensor<T>& input,
+                                tensor<T>& weights,
+                                const tensor<T>& out,
+                                const miopen::ConvolutionDescriptor& filter)
+{
+    using namespace conv_host_detail;
+    if(filter.mode == miopenTranspose)
+        backward_weights(out, weights, input, geometry{out, weights, input, filter});
+    else
+        backward_weights(input, weights, out, geometry{input, weights, out, filter});
+}
+
+#endif
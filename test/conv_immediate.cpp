@@ -0,0 +1,313 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "test.hpp"
+#include <iostream>
+#include <miopen/convolution.hpp>
+#include <miopen/miopen.h>
+#include <miopen/tensor.hpp>
+#include <utility>
+
+#include "conv_host.hpp"
+#include "driver.hpp"
+#include "get_handle.hpp"
+#include "tensor_holder.hpp"
+#include "verify.hpp"
+
+// Immediate mode: the convolutions below never call Find(). The algorithm comes from
+// GetImmediate*Algorithm() and its kernels are built by the first execution.
+
+template <class T>
+struct immediate_conv_base
+{
+    tensor<T> input;
+    tensor<T> weights;
+    tensor<T> out;
+    miopen::ConvolutionDescriptor filter;
+
+    void fail(float = 0) const
+    {
+        std::cout << "Input tensor: " << input.desc.ToString() << std::endl;
+        std::cout << "Weights tensor: " << weights.desc.ToString() << std::endl;
+        std::cout << "Output tensor: " << out.desc.ToString() << std::endl;
+        std::cout << "Filter: " << filter << std::endl;
+    }
+};
+
+template <class T>
+struct verify_immediate_forward : immediate_conv_base<T>
+{
+    using immediate_conv_base<T>::input;
+    using immediate_conv_base<T>::weights;
+    using immediate_conv_base<T>::out;
+    using immediate_conv_base<T>::filter;
+
+    verify_immediate_forward(const tensor<T>& pinput,
+                             const tensor<T>& pweights,
+                             const tensor<T>& pout,
+                             const miopen::ConvolutionDescriptor& pfilter)
+    {
+        input   = pinput;
+        weights = pweights;
+        out     = pout;
+        filter  = pfilter;
+    }
+
+    tensor<T> cpu() const
+    {
+        auto rout = out;
+        conv_host_forward(input, weights, rout, filter);
+        return rout;
+    }
+
+    tensor<T> gpu() const
+    {
+        auto&& handle = get_handle();
+        auto rout     = out;
+
+        auto in_dev  = handle.Write(input.data);
+        auto wei_dev = handle.Write(weights.data);
+        auto out_dev = handle.Write(rout.data);
+
+        const auto workspace_size =
+            filter.ForwardGetWorkSpaceSize(handle, weights.desc, input.desc, rout.desc);
+        std::vector<char> workspace(workspace_size);
+        auto workspace_dev = workspace_size != 0 ? handle.Write(workspace) : nullptr;
+
+        const auto algo = filter.GetImmediateConvFwdAlgorithm(
+            handle, input.desc, weights.desc, rout.desc, workspace_size);
+
+        float alpha = 1, beta = 0;
+        filter.ConvolutionForward(handle,
+                                  &alpha,
+                                  input.desc,
+                                  in_dev.get(),
+                                  weights.desc,
+                                  wei_dev.get(),
+                                  algo,
+                                  &beta,
+                                  rout.desc,
+                                  out_dev.get(),
+                                  workspace_dev.get(),
+                                  workspace_size);
+
+        rout.data = handle.Read<T>(out_dev, rout.data.size());
+        return rout;
+    }
+
+    void fail(float) const
+    {
+        std::cout << "Immediate forward convolution: " << std::endl;
+        this->immediate_conv_base<T>::fail();
+    }
+};
+
+template <class T>
+struct verify_immediate_backward_data : immediate_conv_base<T>
+{
+    using immediate_conv_base<T>::input;
+    using immediate_conv_base<T>::weights;
+    using immediate_conv_base<T>::out;
+    using immediate_conv_base<T>::filter;
+
+    verify_immediate_backward_data(const tensor<T>& pinput,
+                                   const tensor<T>& pweights,
+                                   const tensor<T>& pout,
+                                   const miopen::ConvolutionDescriptor& pfilter)
+    {
+        input   = pinput;
+        weights = pweights;
+        out     = pout;
+        filter  = pfilter;
+    }
+
+    tensor<T> cpu() const
+    {
+        auto rinput = input;
+        conv_host_backward_data(rinput, weights, out, filter);
+        return rinput;
+    }
+
+    tensor<T> gpu() const
+    {
+        auto&& handle = get_handle();
+        auto rinput   = input;
+        std::fill(rinput.begin(), rinput.end(), 0);
+
+        auto out_dev = handle.Write(out.data);
+        auto wei_dev = handle.Write(weights.data);
+        auto in_dev  = handle.Write(rinput.data);
+
+        const auto workspace_size =
+            filter.BackwardDataGetWorkSpaceSize(handle, weights.desc, out.desc, rinput.desc);
+        std::vector<char> workspace(workspace_size);
+        auto workspace_dev = workspace_size != 0 ? handle.Write(workspace) : nullptr;
+
+        const auto algo = filter.GetImmediateConvBwdDataAlgorithm(
+            handle, out.desc, weights.desc, rinput.desc, workspace_size);
+
+        float alpha = 1, beta = 0;
+        filter.ConvolutionBackwardData(handle,
+                                       &alpha,
+                                       out.desc,
+                                       out_dev.get(),
+                                       weights.desc,
+                                       wei_dev.get(),
+                                       algo,
+                                       &beta,
+                                       rinput.desc,
+                                       in_dev.get(),
+                                       workspace_dev.get(),
+                                       workspace_size);
+
+        rinput.data = handle.Read<T>(in_dev, rinput.data.size());
+        return rinput;
+    }
+
+    void fail(float) const
+    {
+        std::cout << "Immediate backward data convolution: " << std::endl;
+        this->immediate_conv_base<T>::fail();
+    }
+};
+
+template <class T>
+struct verify_immediate_backward_weights : immediate_conv_base<T>
+{
+    using immediate_conv_base<T>::input;
+    using immediate_conv_base<T>::weights;
+    using immediate_conv_base<T>::out;
+    using immediate_conv_base<T>::filter;
+
+    verify_immediate_backward_weights(const tensor<T>& pinput,
+                                      const tensor<T>& pweights,
+                                      const tensor<T>& pout,
+                                      const miopen::ConvolutionDescriptor& pfilter)
+    {
+        input   = pinput;
+        weights = pweights;
+        out     = pout;
+        filter  = pfilter;
+    }
+
+    tensor<T> cpu() const
+    {
+        auto rweights = weights;
+        conv_host_backward_weights(input, rweights, out, filter);
+        return rweights;
+    }
+
+    tensor<T> gpu() const
+    {
+        auto&& handle = get_handle();
+        auto rweights = weights;
+        std::fill(rweights.begin(), rweights.end(), 0);
+
+        auto out_dev = handle.Write(out.data);
+        auto wei_dev = handle.Write(rweights.data);
+        auto in_dev  = handle.Write(input.data);
+
+        const auto workspace_size = filter.ConvolutionBackwardWeightsGetWorkSpaceSize(
+            handle, out.desc, input.desc, rweights.desc);
+        std::vector<char> workspace(workspace_size);
+        auto workspace_dev = workspace_size != 0 ? handle.Write(workspace) : nullptr;
+
+        const auto algo = filter.GetImmediateConvBwdWeightsAlgorithm(
+            handle, out.desc, input.desc, rweights.desc, workspace_size);
+
+        float alpha = 1, beta = 0;
+        filter.ConvolutionBackwardWeights(handle,
+                                          &alpha,
+                                          out.desc,
+                                          out_dev.get(),
+                                          input.desc,
+                                          in_dev.get(),
+                                          algo,
+                                          &beta,
+                                          rweights.desc,
+                                          wei_dev.get(),
+                                          workspace_dev.get(),
+                                          workspace_size);
+
+        rweights.data = handle.Read<T>(wei_dev, rweights.data.size());
+        return rweights;
+    }
+
+    void fail(float) const
+    {
+        std::cout << "Immediate backward weights convolution: " << std::endl;
+        this->immediate_conv_base<T>::fail();
+    }
+};
+
+template <class T>
+struct conv_immediate_driver : test_driver
+{
+    tensor<T> input;
+    tensor<T> weights;
+    miopen::ConvolutionDescriptor filter;
+    bool enable_backward_weights = false;
+    unsigned long max_value      = miopen_type<T>{} == miopenHalf ? 5 : 17;
+
+    conv_immediate_driver()
+    {
+        add(input, "input", get_input_tensor());
+        add(weights, "weights", get_weights_tensor());
+        add(filter, "filter", generate_data(get_filters()));
+        add(enable_backward_weights, "enable-backward-weights", flag());
+    }
+
+    std::vector<miopen::ConvolutionDescriptor> get_filters()
+    {
+        return {miopen::ConvolutionDescriptor{0, 0, 1, 1},
+                miopen::ConvolutionDescriptor{1, 1, 1, 1},
+                miopen::ConvolutionDescriptor{1, 1, 2, 2},
+                miopen::ConvolutionDescriptor{2, 2, 1, 1}};
+    }
+
+    void run()
+    {
+        int input_c, input_h, input_w, wei_c, wei_h, wei_w;
+        std::tie(std::ignore, wei_c, wei_h, wei_w) = miopen::tien<4>(weights.desc.GetLengths());
+        std::tie(std::ignore, input_c, input_h, input_w) = miopen::tien<4>(input.desc.GetLengths());
+
+        if(input_c != wei_c || wei_h <= 2 * filter.pad_h || wei_w <= 2 * filter.pad_w ||
+           input_h < 2 * filter.pad_h + wei_h || input_w < 2 * filter.pad_w + wei_w)
+            return;
+        if(input_c == 1 && input.desc.GetType() == miopenHalf)
+            return;
+
+        tensor<T> out{filter.GetForwardOutputTensor(input.desc, weights.desc)};
+        auto out_p = verify(verify_immediate_forward<T>{input, weights, out, filter});
+        for(auto& x : out_p.first)
+            x = (long(x + 19) * 2) % max_value; // Clamp big numbers
+        verify(verify_immediate_backward_data<T>{input, weights, out_p.first, filter});
+        if(enable_backward_weights or (MIOPEN_USE_MIOPENGEMM and sizeof(T) > 2))
+            verify(verify_immediate_backward_weights<T>{input, weights, out_p.first, filter});
+    }
+};
+
+int main(int argc, const char* argv[]) { test_drive<conv_immediate_driver>(argc, argv); }
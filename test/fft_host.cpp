@@ -0,0 +1,146 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/convolution.hpp>
+#include <miopen/convolution_fft.hpp>
+#include <miopen/fft_host.hpp>
+#include <miopen/gemm_host.hpp>
+#include <miopen/tensor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+struct test_fft
+{
+    void run() const
+    {
+        // n, k, c, r, s, h, w, pad_h, pad_w: odd and even tiles of powers of 2 and 3, filters
+        // as large as the padded input, rows of padding only and channel counts above a GEMM block
+        const std::vector<std::vector<int>> shapes = {{1, 1, 1, 5, 5, 5, 5, 0, 0},
+                                                      {2, 3, 2, 5, 5, 7, 7, 2, 2},
+                                                      {1, 2, 3, 5, 7, 9, 11, 1, 3},
+                                                      {3, 4, 5, 7, 5, 14, 14, 3, 0},
+                                                      {1, 5, 1, 5, 20, 8, 25, 4, 2},
+                                                      {2, 17, 33, 5, 5, 13, 10, 2, 1},
+                                                      {1, 8, 4, 11, 11, 12, 12, 5, 5}};
+        for(auto&& shape : shapes)
+            for(bool backward : {false, true})
+                Check(backward,
+                      shape[0],
+                      shape[1],
+                      shape[2],
+                      shape[3],
+                      shape[4],
+                      shape[5],
+                      shape[6],
+                      shape[7],
+                      shape[8]);
+    }
+
+    static void
+    Check(bool backward, int n, int k, int c, int r, int s, int h, int w, int pad_h, int pad_w)
+    {
+        const int out_h = OutSize(h, r, pad_h, backward);
+        const int out_w = OutSize(w, s, pad_w, backward);
+        if(out_h < 1 || out_w < 1)
+            return;
+        const auto in  = Generate(std::size_t(n) * (backward ? k : c) * h * w, 1);
+        const auto wei = Generate(std::size_t(k) * c * r * s, 2);
+        std::vector<double> expected, mag;
+        DirectConv(backward, n, k, c, r, s, h, w, pad_h, pad_w, in, wei, expected, mag);
+
+        const miopen::host::FFTConv fft{k, c, r, s, h, w, pad_h, pad_w, wei.data(), backward};
+        CHECK(fft.InputChannels() == (backward ? k : c));
+        CHECK(fft.OutputChannels() == (backward ? c : k));
+        CHECK(fft.OutHeight() == out_h);
+        CHECK(fft.OutWidth() == out_w);
+        std::vector<float> out(expected.size(), std::nanf(""));
+        fft.Run(n, in.data(), out.data());
+
+        // The rounding error of a transform grows with the log of its size, not with the taps
+        for(std::size_t i = 0; i < out.size(); i++)
+            CHECK(std::abs(out[i] - expected[i]) <= 1e-5 * (mag[i] + 1));
+    }
+};
+
+/// The tiles match those of the GPU kernels, and the spectra fit in the workspace they ask for.
+struct test_fft_gpu_configs
+{
+    void run() const
+    {
+        const miopen::ConvolutionDescriptor conv{2, 2, 1, 1};
+        for(int size : {7, 14, 27, 28})
+        {
+            const int n = 16, c = 8, k = 32;
+            const std::size_t len = size;
+            const miopen::TensorDescriptor xDesc{miopenFloat, {n, c, len, len}};
+            const miopen::TensorDescriptor wDesc{miopenFloat, {k, c, 5, 5}};
+            const miopen::TensorDescriptor yDesc{miopenFloat, {n, k, len, len}};
+            const auto wei = Generate(std::size_t(k) * c * 25, 2);
+            CHECK(miopen::host::IsFFTApplicable(conv, wDesc, false));
+            CHECK(miopen::host::IsFFTApplicable(conv, wDesc, true));
+
+            const miopen::host::FFTConv forward{k, c, 5, 5, size, size, 2, 2, wei.data()};
+            CHECK(forward.TileSize() == std::size_t(miopen::FFTConvParams::TileSize(size, size)));
+            CHECK(forward.SpectraSize(n) <=
+                  conv.ForwardGetWorkSpaceSizeFFT(wDesc, xDesc, yDesc));
+
+            const miopen::host::FFTConv backward{k, c, 5, 5, size, size, 2, 2, wei.data(), true};
+            CHECK(backward.TileSize() == std::size_t(miopen::FFTConvParams::TileSize(size, size)));
+            CHECK(backward.SpectraSize(n) <=
+                  conv.BackwardGetWorkSpaceSizeFFT(wDesc, yDesc, xDesc));
+        }
+    }
+};
+
+struct test_fft_applicable
+{
+    void run() const
+    {
+        const miopen::TensorDescriptor w3{miopenFloat, {8, 4, 3, 3}};
+        const miopen::TensorDescriptor w5{miopenFloat, {8, 4, 5, 5}};
+        const miopen::TensorDescriptor w57{miopenFloat, {8, 4, 5, 7}};
+        using miopen::host::IsFFTApplicable;
+
+        CHECK(IsFFTApplicable(miopen::ConvolutionDescriptor{0, 0, 1, 1}, w5, false));
+        CHECK(IsFFTApplicable(miopen::ConvolutionDescriptor{4, 6, 1, 1}, w57, true));
+        CHECK(IsFFTApplicable(miopen::ConvolutionDescriptor{7, 7, 1, 1}, w5, false));
+        CHECK(!IsFFTApplicable(miopen::ConvolutionDescriptor{5, 5, 1, 1}, w5, true));
+        CHECK(!IsFFTApplicable(miopen::ConvolutionDescriptor{2, 2, 2, 2}, w5, false));
+        CHECK(!IsFFTApplicable(miopen::ConvolutionDescriptor{2, 2, 1, 1, 2, 2}, w5, false));
+        CHECK(!IsFFTApplicable(miopen::ConvolutionDescriptor{1, 1, 1, 1}, w3, false));
+    }
+};
+
+int main()
+{
+    run_test<test_fft>();
+    run_test<test_fft_gpu_configs>();
+    run_test<test_fft_applicable>();
+}
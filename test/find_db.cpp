@@ -0,0 +1,223 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/find_db.hpp>
+#include <miopen/lock_file.hpp>
+#include <miopen/temp_file.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "test.hpp"
+
+namespace miopen {
+namespace tests {
+
+static const std::vector<std::string>& fwd_algorithms()
+{
+    static const std::vector<std::string> data{"miopenConvolutionFwdAlgoGEMM",
+                                               "miopenConvolutionFwdAlgoDirect",
+                                               "miopenConvolutionFwdAlgoFFT",
+                                               "miopenConvolutionFwdAlgoWinograd"};
+    return data;
+}
+
+static const char* const key = "64-28-28-3x3-64-28-28-16-1x1-1x1-1x1-0-NCHW-FP32-F-1-C";
+
+struct FindDbTest
+{
+    FindDbTest() : installed("miopen.tests.fdb"), user("miopen.tests.ufdb")
+    {
+        (void)std::ofstream(installed);
+        (void)std::ofstream(user);
+    }
+
+    ~FindDbTest()
+    {
+        std::remove(LockFilePath(installed.Path()).c_str());
+        std::remove(LockFilePath(user.Path()).c_str());
+    }
+
+    FindDb GetDb(const std::string& k = key) const { return {installed, user, k}; }
+
+    TempFile installed;
+    TempFile user;
+};
+
+struct test_serialization
+{
+    void run() const
+    {
+        const FindDbData direct{0.5f, 1024, 4096, "ConvOclDirectFwd1x1", true};
+        std::ostringstream ss;
+        direct.Serialize(ss);
+        EXPECT_EQUAL(ss.str(), "0.5,1024,4096,ConvOclDirectFwd1x1,1");
+
+        FindDbData loaded;
+        EXPECT(loaded.Deserialize(ss.str()));
+        EXPECT(loaded.time == direct.time);
+        EXPECT_EQUAL(loaded.workspace, direct.workspace);
+        EXPECT_EQUAL(loaded.workspace_limit, direct.workspace_limit);
+        EXPECT_EQUAL(loaded.solver_id, direct.solver_id);
+        EXPECT_EQUAL(loaded.searched, 1);
+
+        // Algorithms with a single implementation have no solver id.
+        const FindDbData gemm{2.25f, 0, 0, "", false};
+        ss.str("");
+        gemm.Serialize(ss);
+        FindDbData loaded_gemm;
+        EXPECT(loaded_gemm.Deserialize(ss.str()));
+        EXPECT(loaded_gemm.time == gemm.time);
+        EXPECT(loaded_gemm.solver_id.empty());
+        EXPECT_EQUAL(loaded_gemm.searched, 0);
+
+        EXPECT(!loaded.Deserialize("0.5,1024"));
+    }
+};
+
+struct test_store_load : FindDbTest
+{
+    void run() const
+    {
+        auto db = GetDb();
+        EXPECT(!db.Load(fwd_algorithms(), 0, false));
+
+        const FindDbResults results{
+            {"miopenConvolutionFwdAlgoGEMM", FindDbData{3.0f, 2048, 4096, "", false}},
+            {"miopenConvolutionFwdAlgoDirect", FindDbData{1.0f, 0, 4096, "ConvAsm3x3U", false}},
+            {"miopenConvolutionFwdAlgoWinograd", FindDbData{2.0f, 0, 4096, "", false}},
+        };
+        EXPECT(db.Store(results));
+
+        // Sorted by time, the solver is kept.
+        auto loaded = GetDb().Load(fwd_algorithms(), 4096, false);
+        EXPECT(loaded);
+        EXPECT_EQUAL(loaded->size(), 3);
+        EXPECT_EQUAL((*loaded)[0].first, "miopenConvolutionFwdAlgoDirect");
+        EXPECT_EQUAL((*loaded)[0].second.solver_id, "ConvAsm3x3U");
+        EXPECT_EQUAL((*loaded)[1].first, "miopenConvolutionFwdAlgoWinograd");
+        EXPECT_EQUAL((*loaded)[2].first, "miopenConvolutionFwdAlgoGEMM");
+
+        // Other problems are not affected.
+        EXPECT(!GetDb("other").Load(fwd_algorithms(), 4096, false));
+
+        // Store replaces the whole record.
+        EXPECT(db.Store({{"miopenConvolutionFwdAlgoFFT", FindDbData{1.5f, 0, 4096, "", false}}}));
+        loaded = GetDb().Load(fwd_algorithms(), 4096, false);
+        EXPECT(loaded);
+        EXPECT_EQUAL(loaded->size(), 1);
+        EXPECT_EQUAL(loaded->front().first, "miopenConvolutionFwdAlgoFFT");
+
+        EXPECT(db.Remove());
+        EXPECT(!GetDb().Load(fwd_algorithms(), 4096, false));
+    }
+};
+
+struct test_workspace : FindDbTest
+{
+    void run() const
+    {
+        auto db = GetDb();
+        EXPECT(db.Store({
+            {"miopenConvolutionFwdAlgoGEMM", FindDbData{1.0f, 2048, 4096, "", false}},
+            {"miopenConvolutionFwdAlgoWinograd", FindDbData{2.0f, 0, 4096, "", false}},
+        }));
+
+        // Less workspace: algorithms that do not fit are dropped.
+        auto loaded = db.Load(fwd_algorithms(), 1024, false);
+        EXPECT(loaded);
+        EXPECT_EQUAL(loaded->size(), 1);
+        EXPECT_EQUAL(loaded->front().first, "miopenConvolutionFwdAlgoWinograd");
+
+        // More workspace: some algorithms may be missing from the record.
+        EXPECT(!db.Load(fwd_algorithms(), 8192, false));
+
+        // A single algorithm is loaded regardless of the workspace.
+        const auto gemm = db.Load("miopenConvolutionFwdAlgoGEMM");
+        EXPECT(gemm);
+        EXPECT_EQUAL(gemm->workspace, 2048);
+        EXPECT(!db.Load("miopenConvolutionFwdAlgoDirect"));
+    }
+};
+
+struct test_searched : FindDbTest
+{
+    void run() const
+    {
+        auto db = GetDb();
+        EXPECT(db.Store({{"miopenConvolutionFwdAlgoDirect",
+                          FindDbData{1.0f, 0, 0, "ConvOclDirectFwd", false}}}));
+        EXPECT(db.Load(fwd_algorithms(), 0, false));
+        EXPECT(!db.Load(fwd_algorithms(), 0, true));
+
+        EXPECT(db.Store({{"miopenConvolutionFwdAlgoDirect",
+                          FindDbData{0.5f, 0, 0, "ConvOclDirectFwd", true}}}));
+        EXPECT(db.Load(fwd_algorithms(), 0, false));
+        EXPECT(db.Load(fwd_algorithms(), 0, true));
+    }
+};
+
+struct test_installed : FindDbTest
+{
+    void run() const
+    {
+        {
+            std::ofstream file(installed.Path());
+            file << key << "=miopenConvolutionFwdAlgoGEMM:1,0,0,,0;"
+                 << "miopenConvolutionFwdAlgoDirect:2,0,0,ConvOclDirectFwd,0" << std::endl;
+        }
+        auto db     = GetDb();
+        auto loaded = db.Load(fwd_algorithms(), 0, false);
+        EXPECT(loaded);
+        EXPECT_EQUAL(loaded->size(), 2);
+        EXPECT_EQUAL(loaded->front().first, "miopenConvolutionFwdAlgoGEMM");
+
+        // User find-db takes precedence; the system one is never modified.
+        EXPECT(db.Store({{"miopenConvolutionFwdAlgoGEMM", FindDbData{3.0f, 0, 0, "", false}}}));
+        loaded = db.Load(fwd_algorithms(), 0, false);
+        EXPECT(loaded);
+        EXPECT_EQUAL(loaded->front().first, "miopenConvolutionFwdAlgoDirect");
+        EXPECT(db.Remove());
+        loaded = db.Load(fwd_algorithms(), 0, false);
+        EXPECT(loaded);
+        EXPECT_EQUAL(loaded->front().first, "miopenConvolutionFwdAlgoGEMM");
+    }
+};
+
+} // namespace tests
+} // namespace miopen
+
+int main()
+{
+    run_test<miopen::tests::test_serialization>();
+    run_test<miopen::tests::test_store_load>();
+    run_test<miopen::tests::test_workspace>();
+    run_test<miopen::tests::test_searched>();
+    run_test<miopen::tests::test_installed>();
+}
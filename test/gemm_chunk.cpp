@@ -0,0 +1,231 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/gemm_chunk.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "test.hpp"
+
+namespace miopen {
+namespace tests {
+
+struct test_workspace_size
+{
+    void run() const
+    {
+        // One image only needs its column buffer.
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(100, 30, 1, 4), std::size_t{400});
+        // Larger chunks also stage the other GEMM operand.
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(100, 30, 2, 4), std::size_t{1040});
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(100, 30, 8, 2), std::size_t{2080});
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(100, 30, 0, 4), std::size_t{0});
+    }
+};
+
+struct test_chunk_sizes
+{
+    void run() const
+    {
+        EXPECT(GetGemmChunkSizes(1) == std::vector<int>{1});
+        EXPECT(GetGemmChunkSizes(12) == (std::vector<int>{1, 2, 3, 4, 6, 12}));
+        // 4 takes two GEMMs of 4 and 3 images, like 5 or 6 would.
+        EXPECT(GetGemmChunkSizes(7) == (std::vector<int>{1, 2, 3, 4, 7}));
+        EXPECT(GetGemmChunkSizes(16) == (std::vector<int>{1, 2, 3, 4, 6, 8, 16}));
+        EXPECT(GetGemmChunkSizes(0).empty());
+    }
+};
+
+struct test_chunk_size
+{
+    void run() const
+    {
+        // Does not fit at all.
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 399), 0);
+        // Exactly the per-image size.
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 400), 1);
+        // Two images need 1040 bytes.
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 1039), 1);
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 1040), 2);
+        // 5 images would fit, but take as many GEMMs as 4.
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 520 * 5), 4);
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 520 * 7), 6);
+        // The whole batch.
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 520 * 16), 16);
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 1 << 20), 16);
+        // A prime batch ends with a smaller chunk.
+        EXPECT_EQUAL(GetGemmChunkSize(7, 100, 30, 4, 520 * 6), 4);
+        EXPECT_EQUAL(GetGemmChunkSize(127, 100, 30, 4, 520 * 64), 64);
+    }
+};
+
+// Workspaces that cannot hold a single image give no chunk, which the GEMM
+// paths must not run with.
+struct test_undersized_workspace
+{
+    void run() const
+    {
+        EXPECT_EQUAL(GetGemmChunkSize(16, 100, 30, 4, 0), 0);
+        EXPECT_EQUAL(GetGemmChunkSize(1, 100, 30, 4, 399), 0);
+        // The column buffer of one image, 1.2 GB, is larger than the 1 GB to
+        // which gfx803 caps the workspace.
+        const std::size_t col_size = std::size_t{300} << 20;
+        EXPECT(GetGemmChunkWorkSpaceSize(col_size, 1 << 20, 1, 4) > (std::size_t{1} << 30));
+        EXPECT_EQUAL(GetGemmChunkSize(64, col_size, 1 << 20, 4, std::size_t{1} << 30), 0);
+        // No images at all.
+        EXPECT_EQUAL(GetGemmChunkSize(0, 100, 30, 4, 1 << 20), 0);
+    }
+};
+
+// gfx803 caps the workspace at 1 GB. A single image over the cap keeps
+// reporting 0; larger chunks over it must not look like they need nothing.
+struct test_capped_workspace
+{
+    void run() const
+    {
+        const std::size_t limit    = std::size_t{1} << 30;
+        const std::size_t col_size = std::size_t{100} << 20;
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(col_size, 1 << 20, 1, 4, limit), col_size * 4);
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(col_size, 1 << 20, 2, 4, limit),
+                     GetGemmChunkWorkSpaceSize(col_size, 1 << 20, 2, 4));
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(col_size, 1 << 20, 3, 4, limit),
+                     std::numeric_limits<std::size_t>::max());
+        EXPECT_EQUAL(GetGemmChunkWorkSpaceSize(col_size * 3, 1 << 20, 1, 4, limit),
+                     std::size_t{0});
+        // The chunk picked under the cap reports the size it was picked with.
+        const int chunk = GetGemmChunkSize(16, col_size, 1 << 20, 4, limit);
+        EXPECT_EQUAL(chunk, 2);
+        EXPECT(GetGemmChunkWorkSpaceSize(col_size, 1 << 20, chunk, 4, limit) <= limit);
+    }
+};
+
+// Host model of the batched forward path: im2col of `chunk` images side by
+// side, one GEMM and a CNHW to NCHW transpose must match a direct convolution,
+// also when the last chunk has fewer images.
+struct test_batched_layout
+{
+    static const int n = 5, c = 2, h = 5, w = 4, k = 3, r = 3, s = 2, pad = 1;
+    static const int out_h = h + 2 * pad - r + 1;
+    static const int out_w = w + 2 * pad - s + 1;
+
+    static float Input(int in, int ic, int y, int x)
+    {
+        if(y < 0 || y >= h || x < 0 || x >= w)
+            return 0;
+        return static_cast<float>(((in * c + ic) * h + y) * w + x) * 0.5f - 10.0f;
+    }
+    static float Weight(int ik, int ic, int y, int x)
+    {
+        return static_cast<float>(((ik * c + ic) * r + y) * s + x) * 0.25f - 3.0f;
+    }
+
+    static std::vector<float> Direct()
+    {
+        std::vector<float> out(n * k * out_h * out_w, 0);
+        for(int in = 0; in < n; ++in)
+            for(int ik = 0; ik < k; ++ik)
+                for(int oy = 0; oy < out_h; ++oy)
+                    for(int ox = 0; ox < out_w; ++ox)
+                    {
+                        float acc = 0;
+                        for(int ic = 0; ic < c; ++ic)
+                            for(int y = 0; y < r; ++y)
+                                for(int x = 0; x < s; ++x)
+                                    acc += Input(in, ic, oy - pad + y, ox - pad + x) *
+                                           Weight(ik, ic, y, x);
+                        out[((in * k + ik) * out_h + oy) * out_w + ox] = acc;
+                    }
+        return out;
+    }
+
+    static std::vector<float> Batched(int chunk)
+    {
+        const int hw  = out_h * out_w;
+        const int crs = c * r * s;
+        std::vector<float> ws((crs + k) * chunk * hw);
+        std::vector<float> out(n * k * hw);
+        for(int i = 0; i < n; i += chunk)
+        {
+            // The last chunk may be smaller, and its column buffer with it
+            const int images = std::min(chunk, n - i);
+            const int cols   = crs * images * hw;
+            // im2col: row (ic, y, x), column (img, oy, ox)
+            for(int img = 0; img < images; ++img)
+                for(int row = 0; row < crs; ++row)
+                    for(int o = 0; o < hw; ++o)
+                    {
+                        const int ic = row / (r * s), y = (row / s) % r, x = row % s;
+                        ws[row * images * hw + img * hw + o] =
+                            Input(i + img, ic, o / out_w - pad + y, o % out_w - pad + x);
+                    }
+            // GEMM: (k x crs) * (crs x images*hw) into the staging area
+            for(int ik = 0; ik < k; ++ik)
+                for(int j = 0; j < images * hw; ++j)
+                {
+                    float acc = 0;
+                    for(int row = 0; row < crs; ++row)
+                        acc += Weight(ik, row / (r * s), (row / s) % r, row % s) *
+                               ws[row * images * hw + j];
+                    ws[cols + ik * images * hw + j] = acc;
+                }
+            // CNHW -> NCHW
+            for(int img = 0; img < images; ++img)
+                for(int ik = 0; ik < k; ++ik)
+                    for(int o = 0; o < hw; ++o)
+                        out[((i + img) * k + ik) * hw + o] =
+                            ws[cols + ik * images * hw + img * hw + o];
+        }
+        return out;
+    }
+
+    void run() const
+    {
+        const auto ref = Direct();
+        for(auto chunk : GetGemmChunkSizes(n))
+        {
+            const auto out = Batched(chunk);
+            EXPECT(out.size() == ref.size());
+            for(std::size_t i = 0; i < ref.size(); ++i)
+                EXPECT(out[i] == ref[i]);
+        }
+    }
+};
+
+} // namespace tests
+} // namespace miopen
+
+int main()
+{
+    run_test<miopen::tests::test_workspace_size>();
+    run_test<miopen::tests::test_chunk_sizes>();
+    run_test<miopen::tests::test_chunk_size>();
+    run_test<miopen::tests::test_undersized_workspace>();
+    run_test<miopen::tests::test_capped_workspace>();
+    run_test<miopen::tests::test_batched_layout>();
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/gemm_host.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using miopen::host::GemmIsa;
+
+struct test_gemm
+{
+    void run() const
+    {
+        // Sizes on both sides of the register and cache blocks
+        const std::vector<std::vector<std::size_t>> shapes = {{1, 1, 1},
+                                                              {6, 16, 1},
+                                                              {7, 17, 5},
+                                                              {5, 33, 300},
+                                                              {97, 31, 257},
+                                                              {130, 70, 40},
+                                                              {2, 4200, 3},
+                                                              {0, 5, 5},
+                                                              {4, 5, 0}};
+        for(auto isa : HostIsas())
+            for(auto&& shape : shapes)
+                for(bool transA : {false, true})
+                    for(bool transB : {false, true})
+                        for(float beta : {0.0f, 1.0f, -0.5f})
+                            Check(isa, transA, transB, shape[0], shape[1], shape[2], beta);
+    }
+
+    static void Check(GemmIsa isa,
+                      bool transA,
+                      bool transB,
+                      std::size_t M,
+                      std::size_t N,
+                      std::size_t K,
+                      float beta)
+    {
+        // Rows are padded, so that the strides matter
+        const std::size_t lda = (transA ? M : K) + 3;
+        const std::size_t ldb = (transB ? K : N) + 2;
+        const std::size_t ldc = N + 1;
+        const auto A          = Generate((transA ? K : M) * lda, 1);
+        const auto B          = Generate((transB ? N : K) * ldb, 2);
+        auto C                = Generate(M * ldc, 3);
+        // C must not be read when beta is 0
+        if(beta == 0)
+            std::fill(C.begin(), C.end(), std::numeric_limits<float>::quiet_NaN());
+        auto expected     = C;
+        const float alpha = 1.25f;
+
+        NaiveGemm(transA,
+                  transB,
+                  M,
+                  N,
+                  K,
+                  alpha,
+                  A.data(),
+                  lda,
+                  B.data(),
+                  ldb,
+                  beta,
+                  expected.data(),
+                  ldc);
+        auto C_packed = C;
+        miopen::host::Gemm(
+            isa, transA, transB, M, N, K, alpha, A.data(), lda, B.data(), ldb, beta, C.data(), ldc);
+        // op(B) packed up front goes through the same panels
+        const miopen::host::GemmPackedB packed{isa, transB, K, N, B.data(), ldb};
+        miopen::host::Gemm(transA, M, alpha, A.data(), lda, packed, beta, C_packed.data(), ldc);
+
+        for(std::size_t i = 0; i < M; i++)
+        {
+            for(std::size_t j = 0; j < N; j++)
+            {
+                const float x = expected[i * ldc + j];
+                const float y = C[i * ldc + j];
+                CHECK(std::abs(x - y) <= 1e-4f * (1 + std::sqrt(float(K)) + std::abs(x)));
+            }
+            // The padding between the rows stays untouched
+            if(beta != 0)
+                CHECK(expected[i * ldc + N] == C[i * ldc + N]);
+        }
+        for(std::size_t i = 0; i < M * ldc; i++)
+        {
+            if(beta == 0 && i % ldc == N)
+                continue;
+            CHECK(C_packed[i] == C[i]);
+        }
+    }
+};
+
+int main()
+{
+    run_test<test_gemm>();
+}
@@ -0,0 +1,215 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/handle.hpp>
+#include <miopen/per_thread.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tensor_ops.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static const std::size_t thread_count = 8;
+
+template <class F>
+void run_threads(F f)
+{
+    std::vector<std::thread> threads;
+    for(std::size_t i = 0; i < thread_count; i++)
+        threads.emplace_back([=] { f(i); });
+    for(auto& t : threads)
+        t.join();
+}
+
+struct test_per_thread
+{
+    void run()
+    {
+        miopen::PerThread<int> values;
+        CHECK(values.Empty());
+        CHECK(values.Find() == nullptr);
+
+        std::atomic<int> failures{0};
+        run_threads([&](std::size_t i) {
+            for(int n = 0; n < 100; n++)
+            {
+                values.Get() += static_cast<int>(i);
+                if(values.Get() != static_cast<int>(i) * (n + 1))
+                    failures++;
+            }
+        });
+        CHECK(failures == 0);
+        // Instances are destroyed when their thread exits.
+        CHECK(values.Empty());
+
+        values.Get() = 42;
+        CHECK(values.Find() != nullptr && *values.Find() == 42);
+        values.Erase();
+        CHECK(values.Find() == nullptr);
+
+        // Objects may also be destroyed before the threads which used them exit.
+        run_threads([&](std::size_t i) {
+            miopen::PerThread<int> local;
+            local.Get() = static_cast<int>(i);
+            if(local.Size() != 1)
+                failures++;
+        });
+        CHECK(failures == 0);
+    }
+};
+
+struct test_kernel_time
+{
+    void run()
+    {
+        miopen::Handle handle{};
+        handle.EnableProfiling(true);
+
+        std::atomic<int> failures{0};
+        run_threads([&](std::size_t i) {
+            for(int n = 0; n < 100; n++)
+            {
+                handle.ResetKernelTime();
+                handle.AccumKernelTime(static_cast<float>(i));
+                handle.AccumKernelTime(1.0f);
+                if(handle.GetKernelTime() != static_cast<float>(i + 1))
+                    failures++;
+            }
+        });
+        CHECK(failures == 0);
+        handle.EnableProfiling(false);
+    }
+};
+
+struct test_tensor_ops
+{
+    void run()
+    {
+        // The handle is shared on purpose: all threads compile and then reuse the same kernels.
+        miopen::Handle handle{};
+        const miopen::TensorDescriptor desc{miopenFloat, {2, 4, 8, 16}};
+        const auto n = desc.GetElementSize();
+
+        std::atomic<int> failures{0};
+        run_threads([&](std::size_t i) {
+            for(int iter = 0; iter < 20; iter++)
+            {
+                const auto a_value  = static_cast<float>(i + 1);
+                const float b_value = iter;
+                const float one     = 1;
+                const float zero    = 0;
+
+                std::vector<float> host(n, -1);
+                auto a = handle.Write(host);
+                auto b = handle.Write(host);
+                auto c = handle.Write(host);
+
+                miopen::SetTensor(handle, desc, a.get(), &a_value);
+                miopen::SetTensor(handle, desc, b.get(), &b_value);
+                miopen::OpTensor(handle,
+                                 miopenTensorOpAdd,
+                                 &one,
+                                 desc,
+                                 a.get(),
+                                 &one,
+                                 desc,
+                                 b.get(),
+                                 &zero,
+                                 desc,
+                                 c.get());
+
+                const auto result = handle.Read<float>(c, n);
+                if(!std::all_of(result.begin(), result.end(), [&](float x) {
+                       return x == a_value + b_value;
+                   }))
+                    failures++;
+            }
+        });
+        CHECK(failures == 0);
+    }
+};
+
+// A stream which differs from the one of a default handle.
+struct other_stream
+{
+#if MIOPEN_BACKEND_CPU
+    // The CPU backend only carries the stream around, so any distinct pointer will do.
+    int token = 0;
+    miopenAcceleratorQueue_t get() { return &token; }
+#else
+    miopen::Handle owner{};
+    miopenAcceleratorQueue_t get() { return owner.GetStream(); }
+#endif
+};
+
+struct test_thread_stream
+{
+    void run()
+    {
+        miopen::Handle handle{};
+        const auto stream = handle.GetStream();
+
+        // Set on the main thread, the stream must not be seen by the others.
+        other_stream main_stream;
+        handle.SetThreadStream(main_stream.get());
+        CHECK(handle.GetStream() == main_stream.get());
+
+        std::atomic<int> failures{0};
+        run_threads([&](std::size_t) {
+            other_stream own;
+            if(own.get() == stream)
+                failures++;
+            for(int n = 0; n < 100; n++)
+            {
+                // Without a thread stream every thread uses the stream of the handle.
+                if(handle.GetStream() != stream)
+                    failures++;
+                handle.SetThreadStream(own.get());
+                if(handle.GetStream() != own.get())
+                    failures++;
+                handle.SetThreadStream(nullptr);
+                if(handle.GetStream() != stream)
+                    failures++;
+            }
+        });
+        CHECK(failures == 0);
+
+        CHECK(handle.GetStream() == main_stream.get());
+        handle.SetThreadStream(nullptr);
+        CHECK(handle.GetStream() == stream);
+    }
+};
+
+int main()
+{
+    run_test<test_per_thread>();
+    run_test<test_kernel_time>();
+    run_test<test_tensor_ops>();
+    run_test<test_thread_stream>();
+}
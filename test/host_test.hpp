@@ -0,0 +1,158 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_HOST_TEST_HPP
+#define GUARD_HOST_TEST_HPP
+
+#include <miopen/gemm_host.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Data and references shared by the tests of the host engines.
+
+/// Values over offset +- scale that do not repeat within 4093 elements, so that reads of the
+/// wrong element show up.
+inline std::vector<float> Generate(std::size_t n, float seed, float scale = 1, float offset = 0)
+{
+    std::vector<float> v(n);
+    for(std::size_t i = 0; i < n; i++)
+        v[i] = offset + scale * std::sin(seed + static_cast<float>(i % 4093) * 0.61f);
+    return v;
+}
+
+/// |a - b| within tolerance relative to the magnitude of b.
+inline bool Near(double a, double b, double tolerance)
+{
+    return std::abs(a - b) <= tolerance * (std::abs(b) + 1);
+}
+
+/// Output size of an r-tap stride-1 convolution, or of its transpose for backward data.
+inline int OutSize(int in, int r, int pad, bool backward)
+{
+    return backward ? in + r - 1 - 2 * pad : in + 2 * pad - r + 1;
+}
+
+/// The direct convolution with a k x c x r x s filter, or its transpose, in double. mag gets
+/// the sum of the magnitudes of the products, which bounds the rounding error of any summation
+/// order.
+inline void DirectConv(bool backward,
+                       int n,
+                       int k,
+                       int c,
+                       int r,
+                       int s,
+                       int in_h,
+                       int in_w,
+                       int pad_h,
+                       int pad_w,
+                       const std::vector<float>& in,
+                       const std::vector<float>& w,
+                       std::vector<double>& out,
+                       std::vector<double>& mag)
+{
+    const int in_c    = backward ? k : c;
+    const int out_c   = backward ? c : k;
+    const int out_h   = OutSize(in_h, r, pad_h, backward);
+    const int out_w   = OutSize(in_w, s, pad_w, backward);
+    const int small_h = backward ? in_h : out_h;
+    const int small_w = backward ? in_w : out_w;
+    const int big_h   = backward ? out_h : in_h;
+    const int big_w   = backward ? out_w : in_w;
+    out.assign(std::size_t(n) * out_c * out_h * out_w, 0);
+    mag.assign(out.size(), 0);
+
+    // Backward data scatters dy through the filter: dx(ci, y + i - pad) += dy(ko, y) w(ko, ci, i)
+    for(int b = 0; b < n; b++)
+        for(int ko = 0; ko < k; ko++)
+            for(int ci = 0; ci < c; ci++)
+                for(int i = 0; i < r; i++)
+                    for(int j = 0; j < s; j++)
+                    {
+                        const double f = w[((std::size_t(ko) * c + ci) * r + i) * s + j];
+                        for(int y = 0; y < small_h; y++)
+                            for(int x = 0; x < small_w; x++)
+                            {
+                                const int yy = y + i - pad_h;
+                                const int xx = x + j - pad_w;
+                                if(yy < 0 || yy >= big_h || xx < 0 || xx >= big_w)
+                                    continue;
+                                std::size_t src, dst;
+                                if(backward)
+                                {
+                                    src = ((std::size_t(b) * in_c + ko) * in_h + y) * in_w + x;
+                                    dst = ((std::size_t(b) * out_c + ci) * out_h + yy) * out_w + xx;
+                                }
+                                else
+                                {
+                                    src = ((std::size_t(b) * in_c + ci) * in_h + yy) * in_w + xx;
+                                    dst = ((std::size_t(b) * out_c + ko) * out_h + y) * out_w + x;
+                                }
+                                out[dst] += f * in[src];
+                                mag[dst] += std::abs(f * in[src]);
+                            }
+                    }
+}
+
+/// The GEMM instruction sets this host supports.
+inline std::vector<miopen::host::GemmIsa> HostIsas()
+{
+    using miopen::host::GemmIsa;
+    std::vector<GemmIsa> isas;
+    for(auto isa : {GemmIsa::Scalar, GemmIsa::Avx2, GemmIsa::Avx512})
+        if(static_cast<int>(isa) <= static_cast<int>(miopen::host::GemmHostIsa()))
+            isas.push_back(isa);
+    return isas;
+}
+
+/// The triple loop of ADNN_mm_cpu, with double accumulation.
+inline void NaiveGemm(bool transA,
+                      bool transB,
+                      std::size_t M,
+                      std::size_t N,
+                      std::size_t K,
+                      float alpha,
+                      const float* A,
+                      std::size_t lda,
+                      const float* B,
+                      std::size_t ldb,
+                      float beta,
+                      float* C,
+                      std::size_t ldc)
+{
+    for(std::size_t i = 0; i < M; i++)
+        for(std::size_t j = 0; j < N; j++)
+        {
+            double x = 0;
+            for(std::size_t k = 0; k < K; k++)
+                x += double(transA ? A[k * lda + i] : A[i * lda + k]) *
+                     (transB ? B[j * ldb + k] : B[k * ldb + j]);
+            float& c = C[i * ldc + j];
+            c        = (beta == 0 ? 0.0f : beta * c) + alpha * static_cast<float>(x);
+        }
+}
+
+#endif
@@ -0,0 +1,334 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/generic_search.hpp>
+#include <miopen/legacy_exhaustive_search.hpp>
+#include <miopen/solver.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "test.hpp"
+
+namespace miopen {
+namespace tests {
+
+using solver::LegacyPerformanceConfig;
+
+/// The search space of the former hand-written ConvOclDirectFwdLegacyExhaustiveSearch::Search(),
+/// i.e. the configs it actually measured, in the same order.
+struct ReferenceSearchSpace
+{
+    std::vector<LegacyPerformanceConfig> configs;
+
+    template <class Solver>
+    void Measure(Solver s, const ConvolutionContext& params, const LegacyPerformanceConfig& result)
+    {
+        if(s.IsApplicable(params) && s.IsValidPerformanceConfig(params, result))
+            configs.push_back(result);
+    }
+
+    ReferenceSearchSpace(const ConvolutionContext& params)
+    {
+        LegacyPerformanceConfig result;
+
+        int grp_tl_ln[4]       = {8, 16, 32};
+        int tile_sz1[4]        = {8, 16, 32, 64};
+        int tile_sz0[4]        = {8, 16, 32, 64};
+        int out_pix_tile_sz[3] = {1, 2, 4};
+        int n_out_tiles_rg[5]  = {1, 2, 4, 8};
+        int n_in_tiles_rg[3]   = {1, 2, 4};
+        int n_in_stacks_sz[2]  = {1, 2};
+        int in_tiles[4]        = {64, 128, 256, 2048};
+
+        int out_pix_tl_cnt = 3;
+        int n_out_tls      = 4;
+        int n_in_tls       = 3;
+        int stack_cnt      = std::min(params.batch_sz, 2);
+        int n_tile0_sz     = 4;
+        int n_tile1_sz     = 4;
+
+        if(params.out_width >= 16)
+        {
+            tile_sz0[0] = 16;
+            tile_sz0[1] = 32;
+            n_tile0_sz  = 2;
+        }
+
+        if(params.out_height >= 16)
+        {
+            tile_sz1[0] = 16;
+            tile_sz1[1] = 32;
+            n_tile1_sz  = 2;
+        }
+
+        if(params.kernel_size0 == 1 && params.kernel_size1 == 1)
+        {
+            int n_grp_tiles0 = 3;
+            result.grp_tile1 = 1;
+            result.in_tile1  = 1;
+            result.in_tile0  = 1;
+
+            if(params.in_data_type == "FP32" && params.direction.IsForward() &&
+               params.n_inputs % 16 == 0 && params.n_outputs % 16 == 0)
+            {
+                n_in_tiles_rg[0]   = 0;
+                n_in_tiles_rg[1]   = 3;
+                n_out_tiles_rg[0]  = 4;
+                n_out_tiles_rg[1]  = 6;
+                out_pix_tl_cnt     = 3;
+                out_pix_tile_sz[0] = 0;
+                out_pix_tile_sz[1] = 1;
+                n_grp_tiles0       = 1;
+                grp_tl_ln[0]       = 64;
+
+                result.out_pix_tile1 = 1;
+            }
+            else
+            {
+                int i_sz = params.in_width * params.in_height;
+                if(params.kernel_stride0 == 1)
+                {
+                    out_pix_tl_cnt = (i_sz & 1) != 0 ? 1 : (i_sz & 0x3) != 0 ? 2 : 3;
+                }
+                else
+                {
+                    if(params.direction.IsForward())
+                    {
+                        out_pix_tl_cnt = (params.out_width & 1) != 0 ? 1 : 2;
+                    }
+                    else
+                    {
+                        out_pix_tl_cnt =
+                            (((params.out_width & 1) != 0) || ((params.in_width & 1) != 0)) ? 1
+                                                                                            : 2;
+                    }
+                }
+                out_pix_tile_sz[0] = 1;
+                out_pix_tile_sz[1] = 2;
+                out_pix_tile_sz[2] = 4;
+
+                n_out_tiles_rg[0] = 2;
+                n_out_tiles_rg[1] =
+                    (params.n_outputs % 64 == 0) ? 6 : (params.n_outputs % 32 == 0) ? 5 : 4;
+
+                n_in_tiles_rg[0] = 2;
+                n_in_tiles_rg[1] = (params.n_inputs % 8 == 0) ? 3 : 2;
+
+                grp_tl_ln[0] = 64;
+                grp_tl_ln[1] = 128;
+                grp_tl_ln[2] = 256;
+                n_grp_tiles0 = 3;
+
+                result.out_pix_tile1 = 0;
+            }
+
+            int version = result.out_pix_tile1;
+
+            for(int g0 = 0; g0 < n_grp_tiles0; ++g0)
+            {
+                result.grp_tile0 = grp_tl_ln[g0];
+                for(int o_t = n_out_tiles_rg[0]; o_t <= n_out_tiles_rg[1]; ++o_t)
+                {
+                    result.n_out_pix_tiles = (1 << o_t);
+                    for(int l = 0; l < out_pix_tl_cnt; ++l)
+                    {
+                        result.out_pix_tile0 = out_pix_tile_sz[l];
+                        if(version == 0 &&
+                           ((result.n_out_pix_tiles == 32 && result.out_pix_tile0 >= 4) ||
+                            (result.n_out_pix_tiles == 64 && result.out_pix_tile0 >= 2)))
+                            continue;
+
+                        for(int i_t = n_in_tiles_rg[0]; i_t <= n_in_tiles_rg[1]; ++i_t)
+                        {
+                            if(version == 1)
+                                result.n_in_data_tiles = in_tiles[i_t];
+                            else
+                                result.n_in_data_tiles = (1 << i_t);
+                            Measure(solver::ConvOclDirectFwd1x1{}, params, result);
+                        }
+                    }
+                }
+            }
+            return;
+        }
+
+        for(int j = 0; j < n_tile1_sz; ++j)
+        {
+            int tile_sz[3]  = {8, 16, 32};
+            result.in_tile1 = tile_sz1[j];
+            if(params.out_height * 2 <= result.in_tile1 && result.in_tile1 > tile_sz[0])
+                continue;
+
+            for(int i = 0; i < n_tile0_sz; ++i)
+            {
+                result.in_tile0 = tile_sz0[i];
+                if((params.out_width * 2 <= result.in_tile0 && result.in_tile0 > tile_sz[0]))
+                    continue;
+                if(params.out_height > 16 && params.out_width > 16 &&
+                   ((result.in_tile1 == 8 && result.in_tile0 == 8) ||
+                    (result.grp_tile0 == 8 && result.grp_tile1 == 8)))
+                    continue;
+                if(params.out_width > 32 && result.in_tile1 > result.in_tile0)
+                    continue;
+
+                for(int k = 0; k < out_pix_tl_cnt; ++k)
+                {
+                    result.out_pix_tile1 = out_pix_tile_sz[k];
+                    result.grp_tile1     = result.in_tile1 / result.out_pix_tile1;
+                    if(result.out_pix_tile1 > result.in_tile1 || result.grp_tile1 < 8)
+                        continue;
+
+                    for(int l = 0; l < out_pix_tl_cnt; ++l)
+                    {
+                        result.out_pix_tile0 = out_pix_tile_sz[l];
+                        result.grp_tile0     = result.in_tile0 / result.out_pix_tile0;
+                        if(result.out_pix_tile0 > result.in_tile0 || result.grp_tile0 < 8)
+                            continue;
+
+                        for(int o_t = 0; o_t < n_out_tls; ++o_t)
+                        {
+                            result.n_out_pix_tiles = n_out_tiles_rg[o_t];
+                            if(params.n_outputs < result.n_out_pix_tiles)
+                                continue;
+
+                            for(int i_t = 0; i_t < n_in_tls; ++i_t)
+                            {
+                                result.n_in_data_tiles = n_in_tiles_rg[i_t];
+                                if(params.n_inputs < result.n_in_data_tiles)
+                                    continue;
+
+                                for(int s = 0; s < stack_cnt; ++s)
+                                {
+                                    result.n_stacks = n_in_stacks_sz[s];
+                                    if(result.n_stacks > params.batch_sz)
+                                        continue;
+                                    if(result.out_pix_tile1 * result.out_pix_tile0 *
+                                           result.n_out_pix_tiles * result.n_stacks >=
+                                       128)
+                                        continue;
+                                    Measure(solver::ConvOclDirectFwd{}, params, result);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+/// Parses perf db key, e.g. "64-56-56-1x1-256-56-56-16-0x0-1x1-1x1-0-NCHW-FP32-F".
+static ConvolutionContext MakeContext(std::string key)
+{
+    std::replace(key.begin(), key.end(), '-', ' ');
+    std::replace(key.begin(), key.end(), 'x', ' ');
+    std::istringstream ss(key);
+    ConvolutionContext ctx;
+    std::string dir;
+    ss >> ctx.n_inputs >> ctx.in_height >> ctx.in_width >> ctx.kernel_size1 >> ctx.kernel_size0 >>
+        ctx.n_outputs >> ctx.out_height >> ctx.out_width >> ctx.batch_sz >> ctx.pad1 >> ctx.pad0 >>
+        ctx.kernel_stride1 >> ctx.kernel_stride0 >> ctx.kernel_dilation1 >> ctx.kernel_dilation0 >>
+        ctx.bias >> ctx.in_layout >> ctx.in_data_type >> dir;
+    ctx.out_layout    = ctx.in_layout;
+    ctx.out_data_type = ctx.in_data_type;
+    ctx.float_size    = ctx.in_data_type == "FP32" ? 32 : 16;
+    ctx.direction.Set(dir == "F" ? 1 : 0);
+    return ctx;
+}
+
+struct test_search_space
+{
+    void run() const
+    {
+        // Problems from the shipped perf dbs and a few corner cases.
+        const char* const keys[] = {
+            "64-56-56-1x1-256-56-56-16-0x0-1x1-1x1-0-NCHW-FP32-F",
+            "1024-14-14-1x1-2048-7-7-32-0x0-2x2-1x1-0-NCHW-FP32-F",
+            "256-56-56-1x1-64-56-56-16-0x0-1x1-1x1-0-NCHW-FP32-B",
+            "512-28-28-1x1-256-56-56-16-0x0-2x2-1x1-0-NCHW-FP32-B",
+            "3-17-17-1x1-10-17-17-4-0x0-1x1-1x1-0-NCHW-FP32-F",
+            "64-56-56-1x1-256-56-56-16-0x0-1x1-1x1-0-NCHW-FP16-F",
+            "1-48-480-3x3-16-48-480-16-1x1-1x1-1x1-0-NCHW-FP32-F",
+            "16-48-480-3x3-1-48-480-16-1x1-1x1-1x1-0-NCHW-FP32-B",
+            "3-224-224-3x3-64-224-224-8-1x1-1x1-1x1-0-NCHW-FP32-F",
+            "32-149-149-3x3-3-299-299-32-0x0-2x2-1x1-0-NCHW-FP32-B",
+            "48-35-35-5x5-64-35-35-32-2x2-1x1-1x1-0-NCHW-FP32-F",
+            "64-112-112-7x7-3-225-225-32-2x2-2x2-1x1-0-NCHW-FP32-B",
+            "16-8-8-3x3-32-8-8-4-1x1-1x1-1x1-0-NCHW-FP32-F",
+            "8-4-20-3x3-4-4-20-1-1x1-1x1-1x1-0-NCHW-FP32-F",
+            "32-12-40-3x3-48-12-40-2-1x1-1x1-1x1-0-NCHW-FP32-F",
+        };
+
+        for(const auto key : keys)
+        {
+            const auto ctx = MakeContext(key);
+            const ReferenceSearchSpace reference(ctx);
+            const solver::ComputedContainer<LegacyPerformanceConfig, ConvolutionContext> all(ctx);
+            const std::vector<LegacyPerformanceConfig> configs(all.begin(), all.end());
+
+            if(configs.size() != reference.configs.size())
+                std::cerr << key << ": " << configs.size() << " configs, expected "
+                          << reference.configs.size() << std::endl;
+            EXPECT_EQUAL(configs.size(), reference.configs.size());
+            EXPECT(configs == reference.configs);
+            EXPECT(!configs.empty());
+        }
+    }
+};
+
+struct test_set_next_value
+{
+    void run() const
+    {
+        // The whole space is visited and wraps around to the minimal value.
+        const LegacyPerformanceConfig first(true);
+        LegacyPerformanceConfig c(true);
+        std::size_t n = 1;
+        while(c.SetNextValue())
+            ++n;
+        EXPECT(c == first);
+        EXPECT_EQUAL(n, 2 * 3 * 5 * 4 * 6 + 4 * 4 * 3 * 3 * 4 * 3 * 2);
+
+        // Values are stored in the perf db, so the config shall survive serialization.
+        LegacyPerformanceConfig d;
+        std::ostringstream ss;
+        first.Serialize(ss);
+        EXPECT(d.Deserialize(ss.str()));
+        EXPECT(d == first);
+    }
+};
+
+} // namespace tests
+} // namespace miopen
+
+int main()
+{
+    run_test<miopen::tests::test_set_next_value>();
+    run_test<miopen::tests::test_search_space>();
+}
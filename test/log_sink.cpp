@@ -0,0 +1,150 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/log_sink.hpp>
+#include <miopen/logger.hpp>
+#include <miopen/tmp_dir.hpp>
+
+#include <boost/filesystem/operations.hpp>
+
+#include <cstdlib>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct capture_sink : miopen::LogSink
+{
+    std::shared_ptr<std::vector<std::string>> messages =
+        std::make_shared<std::vector<std::string>>();
+
+    void Write(const std::string& message) override { messages->push_back(message); }
+};
+
+/// Captures messages until destroyed.
+struct capture
+{
+    std::shared_ptr<std::vector<std::string>> messages;
+
+    capture()
+    {
+        std::unique_ptr<capture_sink> sink{new capture_sink{}};
+        messages = sink->messages;
+        miopen::SetLogSink(std::move(sink));
+    }
+
+    ~capture() { miopen::SetLogSink(std::unique_ptr<miopen::LogSink>{new miopen::StderrLogSink{}}); }
+};
+
+struct test_sync
+{
+    void run()
+    {
+        miopen::SetLogAsync(false);
+        capture c;
+        MIOPEN_LOG_I("x = " << 42);
+        MIOPEN_LOG_E("failed");
+        EXPECT_EQUAL(c.messages->size(), std::size_t{2});
+        EXPECT_EQUAL(c.messages->at(0), miopen::PlatformName() + ": Info [run] x = 42\n");
+        EXPECT_EQUAL(c.messages->at(1), miopen::PlatformName() + ": Error [run] failed\n");
+    }
+};
+
+struct test_async
+{
+    void run()
+    {
+        const int threads_count = 8;
+        const int messages_count = 1000;
+
+        miopen::SetLogAsync(true);
+        const auto dropped_before = miopen::LogDroppedCount();
+        capture c;
+        std::vector<std::thread> threads;
+        for(int t = 0; t < threads_count; t++)
+            threads.emplace_back([=] {
+                for(int i = 0; i < messages_count; i++)
+                    MIOPEN_LOG_I2(t << ' ' << i);
+            });
+        for(auto& thread : threads)
+            thread.join();
+        miopen::LogFlush();
+        miopen::SetLogAsync(false);
+
+        const auto dropped = miopen::LogDroppedCount() - dropped_before;
+        const auto prefix  = miopen::PlatformName() + ": Info2 [run] ";
+        std::vector<int> last(threads_count, -1);
+        std::size_t received = 0;
+        for(auto&& message : *c.messages)
+        {
+            if(message.find("messages dropped") != std::string::npos)
+                continue;
+            CHECK(message.compare(0, prefix.size(), prefix) == 0);
+            int t = 0;
+            int i = 0;
+            std::istringstream ss{message.substr(prefix.size())};
+            ss >> t >> i;
+            // Messages of each thread come in order.
+            CHECK(i > last.at(t));
+            last.at(t) = i;
+            received++;
+        }
+        EXPECT_EQUAL(received + dropped, std::size_t(threads_count * messages_count));
+    }
+};
+
+struct test_rotation
+{
+    void run()
+    {
+        miopen::TmpDir dir{"log_sink"};
+        const auto path = (dir.path / "miopen.log").string();
+        {
+            miopen::FileLogSink sink{path, 100, 2};
+            for(int i = 0; i < 10; i++)
+                sink.Write(std::string(29, 'a' + i) + "\n");
+            sink.Flush();
+        }
+        for(auto&& name : {path, path + ".1", path + ".2"})
+        {
+            CHECK(boost::filesystem::exists(name));
+            CHECK(boost::filesystem::file_size(name) <= 100);
+        }
+        CHECK(!boost::filesystem::exists(path + ".3"));
+        // 10 lines, 3 per file: the latest file holds the last line.
+        EXPECT_EQUAL(boost::filesystem::file_size(path), 30u);
+    }
+};
+
+int main()
+{
+    setenv("MIOPEN_LOG_LEVEL", "6", 1); // NOLINT
+    run_test<test_sync>();
+    run_test<test_async>();
+    run_test<test_rotation>();
+}
@@ -0,0 +1,190 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/lrn_host.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using miopen::host::LRNGeometry;
+
+/// Every window summed in double, as the driver computed it, for packed tensors.
+struct Reference
+{
+    LRNGeometry g;
+    double alpha, beta, K;
+
+    std::size_t Index(int b, int k, int i, int j) const
+    {
+        return ((std::size_t(b) * g.c + k) * g.h + i) * g.w + j;
+    }
+
+    /// Sum of f(b, k, i, j) over the window of (b, k, i, j) and its divisor. The window of a
+    /// channel ends pad channels after it, the window of a pixel starts pad values before it.
+    template <class F>
+    std::pair<double, double> Window(int b, int k, int i, int j, F f) const
+    {
+        double sum = 0;
+        if(g.across)
+        {
+            for(int m = std::max(k + g.pad - g.area + 1, 0); m <= std::min(k + g.pad, g.c - 1); m++)
+                sum += f(b, m, i, j);
+            return {sum, g.area};
+        }
+        for(int u = std::max(i - g.pad, 0); u < std::min(i - g.pad + g.area, g.h); u++)
+            for(int v = std::max(j - g.pad, 0); v < std::min(j - g.pad + g.area, g.w); v++)
+                sum += f(b, k, u, v);
+        return {sum, double(g.Extent(i, g.h)) * g.Extent(j, g.w)};
+    }
+
+    void Forward(const std::vector<float>& x, std::vector<double>& y, std::vector<double>& scale)
+    {
+        const auto square = [&](int b, int k, int i, int j) {
+            const double v = x[Index(b, k, i, j)];
+            return v * v;
+        };
+        for(int b = 0; b < g.n; b++)
+            for(int k = 0; k < g.c; k++)
+                for(int i = 0; i < g.h; i++)
+                    for(int j = 0; j < g.w; j++)
+                    {
+                        const auto win = Window(b, k, i, j, square);
+                        const auto e   = Index(b, k, i, j);
+                        scale[e]       = K + alpha * win.first / win.second;
+                        y[e]           = x[e] * std::pow(scale[e], -beta);
+                    }
+    }
+
+    std::vector<double> Backward(const std::vector<float>& y,
+                                 const std::vector<float>& dy,
+                                 const std::vector<float>& x,
+                                 const std::vector<float>& scale)
+    {
+        const auto ratio = [&](int b, int k, int i, int j) {
+            const auto e = Index(b, k, i, j);
+            return double(dy[e]) * y[e] / scale[e];
+        };
+        std::vector<double> dx(x.size());
+        for(int b = 0; b < g.n; b++)
+            for(int k = 0; k < g.c; k++)
+                for(int i = 0; i < g.h; i++)
+                    for(int j = 0; j < g.w; j++)
+                    {
+                        const auto win = Window(b, k, i, j, ratio);
+                        const auto e   = Index(b, k, i, j);
+                        dx[e]          = dy[e] * std::pow(double(scale[e]), -beta) -
+                                2 * alpha * beta / win.second * x[e] * win.first;
+                    }
+        return dx;
+    }
+};
+
+struct test_lrn_host
+{
+    void run() const
+    {
+        // n, c, h, w, area: single positions, windows longer than the tensor and even areas
+        const std::vector<std::vector<int>> cases = {{2, 3, 1, 1, 3},
+                                                     {2, 7, 5, 6, 5},
+                                                     {1, 16, 9, 11, 1},
+                                                     {1, 5, 13, 17, 4},
+                                                     {3, 2, 3, 4, 7},
+                                                     {1, 40, 20, 23, 11}};
+        for(auto&& p : cases)
+            for(bool across : {true, false})
+                for(double beta : {0.75, 0.5, 0.6})
+                    Check(LRNGeometry{across, p[4], p[0], p[1], p[2], p[3]}, beta);
+    }
+
+    static void Check(const LRNGeometry& g, double beta)
+    {
+        const std::size_t size = std::size_t(g.n) * g.c * g.h * g.w;
+        const auto x           = Generate(size, 1);
+        const auto dy          = Generate(size, 2);
+        Reference ref{g, 1e-2, beta, 2};
+
+        std::vector<double> ref_y(size), ref_scale(size);
+        ref.Forward(x, ref_y, ref_scale);
+        std::vector<float> y(size), scale(size);
+        miopen::host::LRNForward(g, ref.alpha, beta, ref.K, x.data(), y.data(), scale.data());
+        for(std::size_t i = 0; i < size; i++)
+        {
+            CHECK(Near(y[i], ref_y[i], 1e-6));
+            CHECK(Near(scale[i], ref_scale[i], 1e-6));
+        }
+
+        const auto expected = ref.Backward(y, dy, x, scale);
+        std::vector<float> dx(size);
+        miopen::host::LRNBackward(
+            g, ref.alpha, beta, y.data(), dy.data(), x.data(), scale.data(), dx.data());
+        for(std::size_t i = 0; i < size; i++)
+            CHECK(Near(dx[i], expected[i], 1e-6));
+    }
+};
+
+/// Rows and images with gaps between them, read and written through the strides.
+struct test_lrn_host_strides
+{
+    void run() const
+    {
+        for(bool across : {true, false})
+        {
+            LRNGeometry packed{across, 5, 2, 6, 7, 9};
+            LRNGeometry g = packed;
+            g.x_strides   = {{6 * 7 * 12 + 5, 7 * 12, 12, 1}};
+            g.y_strides   = {{6 * 8 * 9, 8 * 9, 9, 1}};
+
+            const auto x = Generate(2 * g.x_strides[0], 1);
+            std::vector<float> y(2 * g.y_strides[0]), y_packed(2 * packed.x_strides[0]);
+            std::vector<float> x_packed(y_packed.size());
+            for(int b = 0; b < g.n; b++)
+                for(int k = 0; k < g.c; k++)
+                    for(int i = 0; i < g.h; i++)
+                        for(int j = 0; j < g.w; j++)
+                            x_packed[((b * g.c + k) * g.h + i) * g.w + j] =
+                                x[b * g.x_strides[0] + k * g.x_strides[1] + i * g.x_strides[2] + j];
+
+            miopen::host::LRNForward<float, float>(g, 1e-2, 0.75, 2, x.data(), y.data(), nullptr);
+            miopen::host::LRNForward<float, float>(
+                packed, 1e-2, 0.75, 2, x_packed.data(), y_packed.data(), nullptr);
+            for(int b = 0; b < g.n; b++)
+                for(int k = 0; k < g.c; k++)
+                    for(int i = 0; i < g.h; i++)
+                        for(int j = 0; j < g.w; j++)
+                            CHECK(y[b * g.y_strides[0] + k * g.y_strides[1] + i * g.y_strides[2] +
+                                    j] == y_packed[((b * g.c + k) * g.h + i) * g.w + j]);
+        }
+    }
+};
+
+int main()
+{
+    run_test<test_lrn_host>();
+    run_test<test_lrn_host_strides>();
+}
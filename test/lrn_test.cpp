@@ -50,61 +50,51 @@ struct verify_lrn_foward
         int n_batch, channels, height, width;
         std::tie(n_batch, channels, height, width) = miopen::tien<4>(input.desc.GetLengths());
 
-        auto alpha  = lrn.GetAlpha();
-        auto beta   = lrn.GetBeta();
-        auto K      = lrn.GetK();
-        auto lrn_n  = lrn.GetN();
-        auto radius = (lrn.GetN() - 1) / 2;
-        auto mode   = lrn.GetMode();
+        const double alpha = lrn.GetAlpha();
+        const double beta  = lrn.GetBeta();
+        const double K     = lrn.GetK();
+        const int lrn_n    = lrn.GetN();
+        const int pad      = lrn_n - (lrn_n - 1) / 2 - 1;
+        const auto mode    = lrn.GetMode();
 
         CHECK((lrn_n & 1) == 1);
         if(mode == miopenLRNCrossChannel)
         {
-            auto alphaoverarea = alpha / lrn_n;
-
+            // The window of a channel ends pad channels after it.
             par_ford(n_batch, height, width)([&](int b, int h, int w) {
-                double scale = 0;
                 ford(channels)([&](int c) {
-                    auto start = (c - radius) < 0 ? 0 : (c - radius);
-                    auto end   = (c + radius) > channels ? channels : (c + radius);
+                    const auto start = std::max(c + pad - lrn_n + 1, 0);
+                    const auto end   = std::min(c + pad + 1, channels);
 
+                    double sum = 0;
                     for(auto k = start; k < end; k++)
-                    {
-                        scale += std::pow(input(b, k, h, w), 2);
-                    }
-
-                    scale *= alphaoverarea;
-                    scale += K;
-                    scale = std::pow(scale, -beta);
+                        sum += std::pow(input(b, k, h, w), 2);
 
-                    output(b, c, h, w) = input(b, c, h, w) * scale;
+                    const double scale = K + alpha / lrn_n * sum;
+                    output(b, c, h, w) = T(input(b, c, h, w) * std::pow(scale, -beta));
                 });
             });
         }
         else
         {
-
+            // The window of a pixel starts pad values before it. It is averaged over its size,
+            // clipped at the padding after the plane only.
             par_ford(n_batch, channels)([&](int b, int c) {
-                double scale = 0;
                 ford(height, width)([&](int h, int w) {
-                    auto left   = (w - radius) < 0 ? 0 : (w - radius);
-                    auto right  = (w + radius) > width ? width : (w + radius);
-                    auto top    = (h - radius) < 0 ? 0 : (h - radius);
-                    auto bottom = (h + radius) > height ? height : (h + radius);
-                    auto alphaoverarea =
-                        radius == 0 ? 0 : alpha / ((right - left) * (bottom - top));
-
-                    for(auto i = left; i < right; i++)
-                    {
-                        for(auto j = top; j < bottom; j++)
-                        {
-                            scale += std::pow(input(b, c, h, w), 2);
-                        }
-                    }
-                    scale *= alphaoverarea;
-                    scale += K;
-                    scale = std::pow(scale, -beta);
-                    output(b, c, h, w) = input(b, c, h, w) * scale;
+                    const auto top    = h - pad;
+                    const auto left   = w - pad;
+                    const auto bottom = std::min(top + lrn_n, height);
+                    const auto right  = std::min(left + lrn_n, width);
+                    const auto area   = std::min(lrn_n, height + 2 * pad - h) *
+                                      std::min(lrn_n, width + 2 * pad - w);
+
+                    double sum = 0;
+                    for(auto i = std::max(top, 0); i < bottom; i++)
+                        for(auto j = std::max(left, 0); j < right; j++)
+                            sum += std::pow(input(b, c, i, j), 2);
+
+                    const double scale = K + alpha / area * sum;
+                    output(b, c, h, w) = T(input(b, c, h, w) * std::pow(scale, -beta));
                 });
             });
         }
@@ -160,55 +150,53 @@ struct verify_lrn_bwd
         int n_batch, channels, height, width;
         std::tie(n_batch, channels, height, width) = miopen::tien<4>(inputY.desc.GetLengths());
 
-        auto routputDX = outputDX;
-        auto alpha     = lrn.GetAlpha();
-        auto beta      = lrn.GetBeta();
-        auto lrn_n     = lrn.GetN();
-        auto mode      = lrn.GetMode();
-        auto radius    = (lrn_n - 1) / 2;
+        auto routputDX     = outputDX;
+        const double alpha = lrn.GetAlpha();
+        const double beta  = lrn.GetBeta();
+        const int lrn_n    = lrn.GetN();
+        const int pad      = lrn_n - (lrn_n - 1) / 2 - 1;
+        const auto mode    = lrn.GetMode();
 
+        // The windows are the ones of the forward pass.
         if(mode == miopenLRNWithinChannel)
         {
             par_ford(n_batch, channels)([&](int b, int c) {
                 ford(height, width)([&](int h, int w) {
-                    double ydy             = 0;
-                    auto left              = (w - radius) < 0 ? 0 : (w - radius);
-                    auto right             = (left + lrn_n) > width ? width : (left + lrn_n);
-                    auto top               = (h - radius) < 0 ? 0 : (h - radius);
-                    auto bottom            = (top + lrn_n) > height ? height : (top + lrn_n);
-                    auto adjust_area       = (right - left) * (bottom - top);
-                    auto cache_ratio_value = 2 * alpha * beta / adjust_area;
-
-                    for(auto i = left; i < right; i++)
-                    {
-                        for(auto j = top; j < bottom; j++)
-                        {
-                            ydy += (inputY(b, c, j, i) * inputDY(b, c, j, i) / scale(b, c, j, i));
-                        }
-                    }
-
-                    routputDX(b, c, h, w) = pow(scale(b, c, h, w), -beta) * inputDY(b, c, h, w) -
-                                            cache_ratio_value * inputX(b, c, h, w) * ydy;
+                    const auto top    = h - pad;
+                    const auto left   = w - pad;
+                    const auto bottom = std::min(top + lrn_n, height);
+                    const auto right  = std::min(left + lrn_n, width);
+                    const auto area   = std::min(lrn_n, height + 2 * pad - h) *
+                                      std::min(lrn_n, width + 2 * pad - w);
+                    const auto cache_ratio_value = 2 * alpha * beta / area;
+
+                    double ydy = 0;
+                    for(auto i = std::max(top, 0); i < bottom; i++)
+                        for(auto j = std::max(left, 0); j < right; j++)
+                            ydy += inputY(b, c, i, j) * inputDY(b, c, i, j) / scale(b, c, i, j);
+
+                    routputDX(b, c, h, w) =
+                        T(std::pow(double(scale(b, c, h, w)), -beta) * inputDY(b, c, h, w) -
+                          cache_ratio_value * inputX(b, c, h, w) * ydy);
                 });
             });
         }
         else
         {
-            auto cache_ratio_value = 2 * alpha * beta / lrn_n;
+            const auto cache_ratio_value = 2 * alpha * beta / lrn_n;
 
             par_ford(n_batch, height, width)([&](int b, int h, int w) {
                 ford(channels)([&](int c) {
-                    double ydy = 0;
-                    auto start = (c - radius) < 0 ? 0 : (c - radius);
-                    auto end   = (c + radius) > channels ? channels : (c + radius);
+                    const auto start = std::max(c + pad - lrn_n + 1, 0);
+                    const auto end   = std::min(c + pad + 1, channels);
 
+                    double ydy = 0;
                     for(auto k = start; k < end; k++)
-                    {
-                        ydy += (inputY(b, k, h, w) * inputDY(b, k, h, w) / scale(b, k, h, w));
-                    }
+                        ydy += inputY(b, k, h, w) * inputDY(b, k, h, w) / scale(b, k, h, w);
 
-                    routputDX(b, c, h, w) = pow(scale(b, c, h, w), -beta) * inputDY(b, c, h, w) -
-                                            cache_ratio_value * inputX(b, c, h, w) * ydy;
+                    routputDX(b, c, h, w) =
+                        T(std::pow(double(scale(b, c, h, w)), -beta) * inputDY(b, c, h, w) -
+                          cache_ratio_value * inputX(b, c, h, w) * ydy);
                 });
             });
         }
@@ -275,7 +263,7 @@ struct lrn_driver : test_driver
         add(input, "input", get_input_tensor());
         add(n, "N", generate_data({1, 3, 5}));
         add(alpha, "alpha", generate_data({1.0}));
-        add(beta, "beta", generate_data({0}));
+        add(beta, "beta", generate_data({0.0, 0.75}));
         add(k, "K", generate_data({1}));
         add(mode, "mode", generate_data({"Within_Channel", "Across_Channel"}));
     }
@@ -250,6 +250,13 @@ struct conv_forward : output_tensor_fixture
                          sz_fwd_workspace,
                          hipMemcpyHostToDevice) == hipSuccess);
 
+#elif MIOPEN_BACKEND_CPU
+
+        void* in_dev            = in.data();
+        void* wei_dev           = wei.data();
+        void* out_dev           = out.data();
+        void* fwd_workspace_dev = fwd_workspace.data();
+
 #endif
         int value = 10;
         STATUS(miopenSetTensor(handle, inputTensor, in_dev, &value));
@@ -284,7 +291,11 @@ struct conv_forward : output_tensor_fixture
                                             convFilter,
                                             wei_dev,
                                             convDesc,
+#if MIOPEN_BACKEND_CPU
+                                            miopenConvolutionFwdAlgoGEMM,
+#else
                                             miopenConvolutionFwdAlgoDirect,
+#endif
                                             &beta,
                                             outputTensor,
                                             out_dev,
@@ -0,0 +1,166 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/perf_predictor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "test.hpp"
+
+namespace miopen {
+namespace tests {
+
+static const char* const sig_1x1 = "1x1-0x0-1x1-1x1-0-NCHW-FP32-F";
+static const char* const sig_3x3 = "3x3-1x1-1x1-1x1-0-NCHW-FP32-F";
+
+// Sorted by (device, solver, signature).
+static const PerfPredictorRecord test_records[] = {
+    {"gfx803_64", "SolverA", sig_1x1, {{64, 28, 28, 64, 16}}, "803"},
+    {"gfx900_56", "SolverA", sig_1x1, {{64, 28, 28, 64, 16}}, "900_56"},
+    {"gfx900_64", "SolverA", sig_1x1, {{64, 28, 28, 64, 16}}, "small"},
+    {"gfx900_64", "SolverA", sig_1x1, {{512, 7, 7, 512, 16}}, "large"},
+    {"gfx900_64", "SolverA", sig_1x1, {{256, 14, 14, 256, 16}}, "small"},
+    {"gfx900_64", "SolverA", sig_3x3, {{64, 28, 28, 64, 16}}, "3x3"},
+    {"gfx900_64", "SolverB", sig_1x1, {{64, 28, 28, 64, 16}}, "B"},
+};
+static const std::size_t n_test_records = sizeof(test_records) / sizeof(test_records[0]);
+
+struct test_parse_key
+{
+    void run() const
+    {
+        PerfPredictorKey key;
+        EXPECT(ParsePerfDbKey("576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F", key));
+        EXPECT_EQUAL(key.signature, "1x1-1x1-2x2-3x3-0-NCHW-FP32-F");
+        EXPECT_EQUAL(key.features[0], 576);
+        EXPECT_EQUAL(key.features[1], 4);
+        EXPECT_EQUAL(key.features[2], 4);
+        EXPECT_EQUAL(key.features[3], 192);
+        EXPECT_EQUAL(key.features[4], 8);
+
+        EXPECT(!ParsePerfDbKey("576-4-4-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32", key));
+        EXPECT(!ParsePerfDbKey("576-4-a-1x1-192-4-4-8-1x1-2x2-3x3-0-NCHW-FP32-F", key));
+        EXPECT(!ParsePerfDbKey("", key));
+    }
+};
+
+struct test_distance
+{
+    void run() const
+    {
+        const PerfPredictorFeatures a{{64, 28, 28, 64, 16}};
+        const PerfPredictorFeatures b{{128, 28, 28, 64, 16}};
+        const PerfPredictorFeatures c{{128, 14, 28, 64, 32}};
+        EXPECT(PerfPredictorDistance(a, a) == 0.0);
+        EXPECT(PerfPredictorDistance(a, b) == 1.0);
+        EXPECT(PerfPredictorDistance(b, a) == 1.0);
+        EXPECT(std::abs(PerfPredictorDistance(a, c) - 3.0) < 1.0e-9);
+    }
+};
+
+struct test_predict
+{
+    static std::vector<std::string> Predict(const std::string& device,
+                                            const std::string& solver,
+                                            const std::string& signature,
+                                            const PerfPredictorFeatures& features,
+                                            std::size_t max_n = 3)
+    {
+        const PerfPredictorKey key{signature, features};
+        return PredictPerformanceConfigs(
+            test_records, n_test_records, device, solver, key, max_n);
+    }
+
+    void run() const
+    {
+        // Nearest first, without duplicates.
+        auto p = Predict("gfx900_64", "SolverA", sig_1x1, {{480, 7, 7, 512, 16}});
+        EXPECT_EQUAL(p.size(), 2);
+        EXPECT_EQUAL(p[0], "large");
+        EXPECT_EQUAL(p[1], "small");
+
+        p = Predict("gfx900_64", "SolverA", sig_1x1, {{64, 32, 32, 64, 16}}, 1);
+        EXPECT_EQUAL(p.size(), 1);
+        EXPECT_EQUAL(p[0], "small");
+
+        // Only the same solver and signature.
+        p = Predict("gfx900_64", "SolverB", sig_1x1, {{512, 7, 7, 512, 16}});
+        EXPECT_EQUAL(p.size(), 1);
+        EXPECT_EQUAL(p[0], "B");
+        p = Predict("gfx900_64", "SolverA", sig_3x3, {{512, 7, 7, 512, 16}});
+        EXPECT_EQUAL(p.size(), 1);
+        EXPECT_EQUAL(p[0], "3x3");
+        EXPECT(Predict("gfx900_64", "SolverC", sig_1x1, {{64, 28, 28, 64, 16}}).empty());
+        EXPECT(Predict("gfx900_64", "SolverB", sig_3x3, {{64, 28, 28, 64, 16}}).empty());
+
+        // Unknown device: fall back to the same architecture only.
+        p = Predict("gfx900_36", "SolverA", sig_1x1, {{64, 28, 28, 64, 16}});
+        EXPECT(std::find(p.begin(), p.end(), "900_56") != p.end());
+        EXPECT(std::find(p.begin(), p.end(), "803") == p.end());
+        EXPECT(Predict("gfx906_64", "SolverA", sig_1x1, {{64, 28, 28, 64, 16}}).empty());
+    }
+};
+
+struct test_generated_tables
+{
+    void run() const
+    {
+        std::size_t n_records = 0;
+        const auto records    = GetPerfPredictorRecords(n_records);
+        EXPECT(n_records > 0);
+        EXPECT(std::is_sorted(records,
+                              records + n_records,
+                              [](const PerfPredictorRecord& l, const PerfPredictorRecord& r) {
+                                  int c = std::strcmp(l.device, r.device);
+                                  if(c == 0)
+                                      c = std::strcmp(l.solver, r.solver);
+                                  if(c == 0)
+                                      c = std::strcmp(l.signature, r.signature);
+                                  return c < 0;
+                              }));
+        for(std::size_t i = 0; i < n_records; ++i)
+        {
+            for(const auto f : records[i].features)
+                EXPECT(f > 0);
+            EXPECT(std::strlen(records[i].values) > 0);
+        }
+    }
+};
+
+} // namespace tests
+} // namespace miopen
+
+int main()
+{
+    run_test<miopen::tests::test_parse_key>();
+    run_test<miopen::tests::test_distance>();
+    run_test<miopen::tests::test_predict>();
+    run_test<miopen::tests::test_generated_tables>();
+}
@@ -0,0 +1,163 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/pooling_host.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using miopen::host::PoolingGeometry;
+
+/// A scan of every window in double, keeping the full argmax offset (-1 for none).
+struct Reference
+{
+    std::vector<double> y;
+    std::vector<int> arg;
+
+    Reference(const PoolingGeometry& g, bool max, const std::vector<float>& x)
+        : y(std::size_t(g.n) * g.c * g.out_h * g.out_w), arg(y.size(), -1)
+    {
+        std::size_t yi = 0;
+        for(int b = 0; b < g.n * g.c; b++)
+            for(int i = 0; i < g.out_h; i++)
+                for(int j = 0; j < g.out_w; j++, yi++)
+                {
+                    const int h0 = i * g.stride_h - g.pad_h;
+                    const int w0 = j * g.stride_w - g.pad_w;
+                    double acc   = max ? std::numeric_limits<float>::lowest() : 0;
+                    for(int h = std::max(h0, 0); h < std::min(h0 + g.window_h, g.in_h); h++)
+                        for(int w = std::max(w0, 0); w < std::min(w0 + g.window_w, g.in_w); w++)
+                        {
+                            const double v = x[(std::size_t(b) * g.in_h + h) * g.in_w + w];
+                            if(!max)
+                                acc += v;
+                            else if(v > acc)
+                            {
+                                acc     = v;
+                                arg[yi] = (h - h0) * g.window_w + (w - w0);
+                            }
+                        }
+                    y[yi] = max ? acc : acc / g.PoolSize(i, j);
+                }
+    }
+
+    /// The gradient of the windows for dy.
+    std::vector<double> Backward(const PoolingGeometry& g, bool max, const std::vector<float>& dy)
+    {
+        std::vector<double> dx(std::size_t(g.n) * g.c * g.in_h * g.in_w);
+        std::size_t yi = 0;
+        for(int b = 0; b < g.n * g.c; b++)
+            for(int i = 0; i < g.out_h; i++)
+                for(int j = 0; j < g.out_w; j++, yi++)
+                {
+                    const int h0 = i * g.stride_h - g.pad_h;
+                    const int w0 = j * g.stride_w - g.pad_w;
+                    for(int h = std::max(h0, 0); h < std::min(h0 + g.window_h, g.in_h); h++)
+                        for(int w = std::max(w0, 0); w < std::min(w0 + g.window_w, g.in_w); w++)
+                        {
+                            const bool hit = !max || arg[yi] == (h - h0) * g.window_w + (w - w0);
+                            if(hit)
+                                dx[(std::size_t(b) * g.in_h + h) * g.in_w + w] +=
+                                    max ? dy[yi] : dy[yi] / g.PoolSize(i, j);
+                        }
+                }
+        return dx;
+    }
+};
+
+struct test_pooling_host
+{
+    void run() const
+    {
+        // n, c, h, w, window h, w, pad h, w, stride h, w and outputs beyond the last full window.
+        // They cover small scanned windows, running maxima along either axis, windows over 256
+        // values and windows over padding only.
+        const std::vector<std::vector<int>> cases = {{2, 3, 9, 11, 2, 2, 0, 0, 2, 2, 0},
+                                                     {1, 2, 13, 17, 3, 3, 1, 1, 1, 1, 0},
+                                                     {1, 2, 20, 23, 3, 3, 1, 1, 2, 2, 0},
+                                                     {2, 1, 30, 33, 7, 9, 3, 4, 1, 2, 0},
+                                                     {1, 1, 31, 12, 8, 2, 2, 0, 2, 1, 0},
+                                                     {1, 2, 8, 8, 8, 8, 0, 0, 1, 1, 0},
+                                                     {1, 1, 40, 41, 17, 19, 0, 0, 1, 1, 0},
+                                                     {1, 2, 50, 45, 13, 4, 6, 1, 2, 1, 0},
+                                                     {1, 1, 20, 70, 3, 15, 1, 7, 1, 3, 0},
+                                                     {1, 1, 5, 5, 2, 2, 1, 1, 3, 3, 1},
+                                                     {2, 2, 7, 9, 3, 2, 2, 1, 2, 3, 2}};
+        for(auto&& p : cases)
+        {
+            const PoolingGeometry g{p[0],
+                                    p[1],
+                                    p[2],
+                                    p[3],
+                                    (p[2] + 2 * p[6] - p[4]) / p[8] + 1 + p[10],
+                                    (p[3] + 2 * p[7] - p[5]) / p[9] + 1 + p[10],
+                                    p[4],
+                                    p[5],
+                                    p[6],
+                                    p[7],
+                                    p[8],
+                                    p[9]};
+            for(bool max : {true, false})
+                Check(g, max);
+        }
+    }
+
+    static void Check(const PoolingGeometry& g, bool max)
+    {
+        auto x        = Generate(std::size_t(g.n) * g.c * g.in_h * g.in_w, 1);
+        const auto dy = Generate(std::size_t(g.n) * g.c * g.out_h * g.out_w, 2);
+        // On a grid of quarters, so that windows often hold several equal maxima
+        for(auto& v : x)
+            v = std::round(4 * v) / 4;
+        Reference ref{g, max, x};
+
+        std::vector<float> y(dy.size()), dx(x.size());
+        std::vector<uint8_t> index(dy.size());
+        miopen::host::PoolingForward(g, max, x.data(), y.data(), index.data());
+        for(std::size_t i = 0; i < y.size(); i++)
+        {
+            CHECK(Near(y[i], ref.y[i], 1e-6));
+            if(max)
+                CHECK(index[i] == (ref.arg[i] < 0 ? miopen::host::pooling_no_index
+                                                  : static_cast<uint8_t>(ref.arg[i])));
+        }
+
+        const auto expected = ref.Backward(g, max, dy);
+        miopen::host::PoolingBackward(
+            g, max, dy.data(), dx.data(), index.data(), x.data(), y.data());
+        for(std::size_t i = 0; i < dx.size(); i++)
+            CHECK(Near(dx[i], expected[i], 1e-5));
+    }
+};
+
+int main()
+{
+    run_test<test_pooling_host>();
+}
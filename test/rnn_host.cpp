@@ -0,0 +1,136 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "rnn_reference.hpp"
+#include "test.hpp"
+#include <miopen/rnn_host.hpp>
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+using miopen::host::RNNForward;
+
+template <class T>
+static bool AllNear(const std::vector<float>& a, const std::vector<T>& b, double tolerance)
+{
+    if(a.size() != b.size())
+        return false;
+    for(std::size_t i = 0; i < a.size(); i++)
+        if(!Near(a[i], b[i], tolerance))
+            return false;
+    return true;
+}
+
+struct test_rnn_host
+{
+    void run() const
+    {
+        for(auto mode : {miopenRNNRELU, miopenRNNTANH, miopenLSTM, miopenGRU})
+            for(bool bidirectional : {false, true})
+                for(bool biased : {false, true})
+                    for(bool skip : {false, true})
+                        for(bool states : {false, true})
+                        {
+                            // Odd lengths for the scalar tails of the packs, batches that shrink
+                            // over time and more state rows than the first batch
+                            const RNNReference deep{
+                                mode, 2, 5, skip ? 5 : 7, bidirectional, biased, skip};
+                            const RNNReference single{
+                                mode, 1, 8, skip ? 8 : 3, bidirectional, biased, skip};
+                            Check(deep, {4, 4, 3, 1, 1}, 5, states);
+                            Check(single, {3}, 3, states);
+                        }
+        // Gates and rows spread over threads
+        for(auto mode : {miopenLSTM, miopenGRU})
+            Check(RNNReference{mode, 2, 37, 19, true, true, false}, {40, 40, 33, 2}, 40, true);
+    }
+
+    static void
+    Check(const RNNReference& ref, const std::vector<int>& batches, int hy_n, bool states)
+    {
+        const int d            = ref.Directions();
+        const int h            = ref.hidden;
+        const int rows         = std::accumulate(batches.begin(), batches.end(), 0);
+        const std::size_t size = std::size_t(ref.layers) * d * hy_n * h;
+        const auto w           = Generate(ref.WeightSize(), 1, 1 / std::sqrt(float(h)));
+        const auto x           = Generate(std::size_t(rows) * ref.in_h, 2, 1);
+        const auto hx          = Generate(size, 3, 0.5f);
+        const auto cx          = Generate(size, 4, 0.5f);
+        const bool lstm        = ref.mode == miopenLSTM;
+
+        const auto expected = ref.Run(
+            w, batches, hy_n, x, states ? hx.data() : nullptr, states ? cx.data() : nullptr);
+
+        const RNNForward rnn{ref.mode,
+                             ref.layers,
+                             ref.hidden,
+                             ref.in_h,
+                             ref.bidirectional,
+                             ref.biased,
+                             ref.skip,
+                             w.data()};
+        CHECK(rnn.WeightSize() == w.size());
+        CHECK(rnn.ReserveSize(batches) == expected.reserve.size());
+
+        // Values left in the outputs are overwritten
+        std::vector<float> y(std::size_t(rows) * d * h, 7), hy(size, 7), cy(size, 7),
+            reserve(rnn.ReserveSize(batches), 7);
+        rnn.Run(batches,
+                hy_n,
+                x.data(),
+                states ? hx.data() : nullptr,
+                states ? cx.data() : nullptr,
+                y.data(),
+                hy.data(),
+                lstm ? cy.data() : nullptr,
+                reserve.data());
+        CHECK(AllNear(y, expected.y, 1e-5));
+        CHECK(AllNear(hy, expected.hy, 1e-5));
+        CHECK(AllNear(reserve, expected.reserve, 1e-5));
+        if(lstm)
+            CHECK(AllNear(cy, expected.cy, 1e-5));
+
+        // Inference, without states to return
+        std::vector<float> y_inference(y.size());
+        rnn.Run(batches,
+                hy_n,
+                x.data(),
+                states ? hx.data() : nullptr,
+                states ? cx.data() : nullptr,
+                y_inference.data(),
+                nullptr,
+                nullptr,
+                nullptr);
+        CHECK(y_inference == y);
+    }
+};
+
+int main()
+{
+    run_test<test_rnn_host>();
+}
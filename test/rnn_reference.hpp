@@ -0,0 +1,204 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_RNN_REFERENCE_HPP
+#define GUARD_RNN_REFERENCE_HPP
+
+#include <miopen/miopen.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+inline double Sigmoid(double x) { return 1 / (1 + std::exp(-x)); }
+
+/// The forward pass in double, a layer, direction, time step and row at a time, with every
+/// product of a time step taken on its own, as the driver verifiers computed it.
+struct RNNReference
+{
+    miopenRNNMode_t mode;
+    int layers, hidden, in_h;
+    bool bidirectional, biased, skip;
+
+    struct Result
+    {
+        std::vector<double> y, hy, cy, reserve;
+    };
+
+    int Directions() const { return bidirectional ? 2 : 1; }
+    int Gates() const { return mode == miopenLSTM ? 4 : mode == miopenGRU ? 3 : 1; }
+
+    std::size_t WeightSize() const
+    {
+        const int d = Directions();
+        return std::size_t((skip ? 0 : in_h) + hidden + (d * hidden + hidden) * (layers - 1) +
+                           (biased ? 2 * layers : 0)) *
+               d * Gates() * hidden;
+    }
+
+    Result Run(const std::vector<float>& w,
+               const std::vector<int>& batches,
+               int hy_n,
+               const std::vector<float>& x,
+               const float* hx,
+               const float* cx) const
+    {
+        const int d      = Directions();
+        const int g      = Gates();
+        const int h      = hidden;
+        const int ws     = d * g * h;
+        const int inputs = skip ? 0 : in_h;
+        const int rows   = std::accumulate(batches.begin(), batches.end(), 0);
+        const int steps  = batches.size();
+        const int states = mode == miopenLSTM ? 2 : mode == miopenGRU ? 1 : 0;
+        const int stride = (g + states) * d * h;
+        const std::size_t half = std::size_t(layers) * rows * stride;
+        const std::size_t bias = std::size_t(inputs + h + (d * h + h) * (layers - 1)) * ws;
+        const bool gated       = mode == miopenLSTM || mode == miopenGRU;
+        // The hidden states of LSTM and GRU, or the activations of the vanilla RNN
+        const std::size_t out_col = mode == miopenLSTM ? 5 * d * h : gated ? 3 * d * h : half;
+
+        std::vector<int> offsets(steps + 1, 0);
+        std::partial_sum(batches.begin(), batches.end(), offsets.begin() + 1);
+
+        Result r;
+        r.reserve.assign(2 * half, 0);
+        r.hy.assign(std::size_t(layers) * d * hy_n * h, 0);
+        r.cy = r.hy;
+
+        for(int li = 0; li < layers; li++)
+        {
+            double* first    = r.reserve.data() + std::size_t(li) * rows * stride;
+            const double* in = li == 0 ? nullptr : first - std::size_t(rows) * stride + out_col;
+            const int len   = li == 0 ? inputs : d * h;
+            const float* wx = w.data() + (li == 0 ? 0 : (inputs + h + (li - 1) * (d * h + h)) * ws);
+            for(int b = 0; b < rows; b++)
+                for(int j = 0; j < ws; j++)
+                {
+                    double v = biased ? w[bias + li * 2 * ws + j] : 0;
+                    if(li == 0 && skip)
+                        v += x[b * h + j % h];
+                    for(int k = 0; k < len; k++)
+                        v += double(wx[j * len + k]) *
+                             (li == 0 ? double(x[b * in_h + k]) : in[b * stride + k]);
+                    first[b * stride + j] = v;
+                }
+
+            for(int dir = 0; dir < d; dir++)
+            {
+                const float* wh = w.data() + (inputs + li * (d * h + h)) * ws + dir * g * h * h;
+                const std::size_t bh = bias + (li * 2 + 1) * ws + dir * g * h;
+                const std::size_t state = (std::size_t(li) * d + dir) * hy_n * h;
+                const std::size_t h_col = out_col + dir * h;
+                const std::size_t c_col = 4 * d * h + dir * h;
+                for(int s = 0; s < steps; s++)
+                {
+                    const int t    = dir == 0 ? s : steps - 1 - s;
+                    const int prev = dir == 0 ? t - 1 : t + 1;
+                    for(int b = 0; b < batches[t]; b++)
+                    {
+                        double* row = first + (offsets[t] + b) * stride;
+                        // The previous state of the row, of its hidden state in the second half
+                        // of the reserve for the vanilla RNN
+                        const double* last =
+                            s > 0 && b < batches[prev] ? first + (offsets[prev] + b) * stride
+                                                       : nullptr;
+                        std::vector<double> h_prev(h, 0), c_prev(h, 0), p(g * h, 0);
+                        const bool recurrent = last != nullptr || hx != nullptr;
+                        for(int k = 0; k < h; k++)
+                        {
+                            if(last != nullptr)
+                            {
+                                h_prev[k] = last[h_col + k];
+                                c_prev[k] = mode == miopenLSTM ? last[c_col + k] : 0;
+                            }
+                            else
+                            {
+                                h_prev[k] = hx == nullptr ? 0 : hx[state + b * h + k];
+                                c_prev[k] = cx == nullptr ? 0 : cx[state + b * h + k];
+                            }
+                        }
+                        if(recurrent)
+                            for(int j = 0; j < g * h; j++)
+                            {
+                                p[j] = biased ? w[bh + j] : 0;
+                                for(int k = 0; k < h; k++)
+                                    p[j] += double(wh[j * h + k]) * h_prev[k];
+                            }
+
+                        double* pre = row + dir * g * h;
+                        double* act = pre + half;
+                        for(int k = 0; k < h; k++)
+                        {
+                            double out = 0;
+                            if(mode == miopenLSTM)
+                            {
+                                for(int q = 0; q < 4; q++)
+                                    pre[q * h + k] += p[q * h + k];
+                                act[k]         = Sigmoid(pre[k]);
+                                act[h + k]     = Sigmoid(pre[h + k]);
+                                act[2 * h + k] = Sigmoid(pre[2 * h + k]);
+                                act[3 * h + k] = std::tanh(pre[3 * h + k]);
+                                const double c = act[k] * act[3 * h + k] + act[h + k] * c_prev[k];
+                                row[c_col + k] = c;
+                                row[half + c_col + k]   = std::tanh(c);
+                                r.cy[state + b * h + k] = c;
+                                out                     = act[2 * h + k] * std::tanh(c);
+                            }
+                            else if(mode == miopenGRU)
+                            {
+                                pre[k] += p[k];
+                                pre[h + k] += p[h + k];
+                                act[k]     = Sigmoid(pre[k]);
+                                act[h + k] = Sigmoid(pre[h + k]);
+                                pre[2 * h + k] += act[h + k] * p[2 * h + k];
+                                act[2 * h + k]        = std::tanh(pre[2 * h + k]);
+                                row[half + h_col + k] = p[2 * h + k];
+                                out = (1 - act[k]) * act[2 * h + k] + act[k] * h_prev[k];
+                            }
+                            else
+                            {
+                                pre[k] += p[k];
+                                out = mode == miopenRNNRELU ? std::max(pre[k], 0.0)
+                                                            : std::tanh(pre[k]);
+                            }
+                            row[h_col + k]          = out;
+                            r.hy[state + b * h + k] = out;
+                        }
+                    }
+                }
+            }
+        }
+
+        const double* out = r.reserve.data() + std::size_t(layers - 1) * rows * stride + out_col;
+        for(int b = 0; b < rows; b++)
+            for(int k = 0; k < d * h; k++)
+                r.y.push_back(out[b * stride + k]);
+        return r;
+    }
+};
+
+#endif
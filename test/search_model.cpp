@@ -0,0 +1,234 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/generic_search.hpp>
+#include <miopen/search_model.hpp>
+#include <miopen/solver.hpp>
+
+#include <limits>
+#include <vector>
+
+#include "test.hpp"
+
+namespace miopen {
+namespace tests {
+
+/// Performance config with a single field [1..8], valid if the value
+/// does not exceed the problem's n_inputs.
+struct TestModelConfig
+{
+    int v;
+
+    TestModelConfig() : v(-1) {}
+    TestModelConfig(bool) : v(1) {}
+
+    bool SetNextValue()
+    {
+        if(++v <= 8)
+            return true;
+        v = 1;
+        return false;
+    }
+    bool IsValid(const ConvolutionContext& c) const { return v <= c.n_inputs; }
+    bool operator==(const TestModelConfig& other) const { return v == other.v; }
+};
+
+/// The best value is 5, the farther from it, the worse.
+struct ModelTestSolver
+{
+    double EstimatePerformanceConfigCost(const ConvolutionContext&,
+                                         const TestModelConfig& config) const
+    {
+        return config.v > 5 ? config.v - 5 : 5 - config.v;
+    }
+};
+
+struct NoModelTestSolver
+{
+};
+
+struct test_occupancy
+{
+    void run() const
+    {
+        solver::KernelCostEstimate k;
+        k.vgprs = 24;
+        EXPECT_EQUAL(solver::EstimateWavesPerSimd(k), 10);
+        k.vgprs = 128;
+        EXPECT_EQUAL(solver::EstimateWavesPerSimd(k), 2);
+        k.vgprs = 257;
+        EXPECT_EQUAL(solver::EstimateWavesPerSimd(k), 0);
+
+        k.vgprs              = 24;
+        k.max_waves_per_simd = 3;
+        EXPECT_EQUAL(solver::EstimateWavesPerSimd(k), 3);
+
+        // 32K LDS per 4-wave group => 2 groups per CU => 2 waves per SIMD.
+        k.max_waves_per_simd = 0;
+        k.waves_per_group    = 4;
+        k.lds_bytes          = 32 * 1024;
+        EXPECT_EQUAL(solver::EstimateWavesPerSimd(k), 2);
+        EXPECT(solver::EstimateOccupancy(k) > 0.19 && solver::EstimateOccupancy(k) < 0.21);
+    }
+};
+
+struct test_dispatch_efficiency
+{
+    void run() const
+    {
+        const solver::GcnReferenceDevice dev;
+        solver::KernelCostEstimate k;
+        k.vgprs           = 64; // 4 waves per SIMD, 16 single-wave groups per CU.
+        k.waves_per_group = 1;
+        k.n_groups        = static_cast<size_t>(dev.n_cus) * 16;
+        EXPECT(solver::EstimateDispatchEfficiency(k) == 1.0);
+
+        // One more group requires a second, almost empty round.
+        k.n_groups += 1;
+        EXPECT(solver::EstimateDispatchEfficiency(k) < 0.51);
+
+        // Grid too small to fill the machine.
+        k.n_groups = dev.n_cus;
+        EXPECT(solver::EstimateDispatchEfficiency(k) < 0.07);
+    }
+};
+
+struct test_kernel_cost
+{
+    void run() const
+    {
+        solver::KernelCostEstimate k;
+        k.vgprs    = 64;
+        k.n_groups = 64 * 16;
+        k.flops    = 1.0e9;
+        k.bytes    = 1.0e6;
+        const auto compute_bound = solver::EstimateKernelCost(k);
+        EXPECT(compute_bound > 0.0);
+
+        // More memory traffic shall not make things faster.
+        k.bytes = 1.0e9;
+        EXPECT(solver::EstimateKernelCost(k) > compute_bound);
+
+        // Lower occupancy shall not make things faster.
+        k.bytes = 1.0e6;
+        k.vgprs = 200;
+        EXPECT(solver::EstimateKernelCost(k) > compute_bound);
+
+        // Unlaunchable.
+        k.vgprs = 300;
+        EXPECT(solver::EstimateKernelCost(k) == std::numeric_limits<double>::max());
+    }
+};
+
+struct test_search_order
+{
+    void run() const
+    {
+        ConvolutionContext context;
+        context.n_inputs = 7;
+        const solver::ComputedContainer<TestModelConfig, ConvolutionContext> all(context);
+
+        bool is_model_guided = false;
+        const auto ordered =
+            solver::GetSearchOrder(ModelTestSolver{}, context, all, 0, is_model_guided);
+        EXPECT(is_model_guided);
+        EXPECT_EQUAL(ordered.size(), 7);
+        // Equal costs keep lexicographic order.
+        const std::vector<int> expected{5, 4, 6, 3, 7, 2, 1};
+        for(std::size_t i = 0; i < expected.size(); ++i)
+            EXPECT_EQUAL(ordered[i].v, expected[i]);
+
+        const auto top = solver::GetSearchOrder(ModelTestSolver{}, context, all, 3, is_model_guided);
+        EXPECT_EQUAL(top.size(), 3);
+        EXPECT_EQUAL(top[0].v, 5);
+        EXPECT_EQUAL(top[2].v, 6);
+
+        const auto plain =
+            solver::GetSearchOrder(NoModelTestSolver{}, context, all, 3, is_model_guided);
+        EXPECT(!is_model_guided);
+        EXPECT_EQUAL(plain.size(), 7);
+        for(std::size_t i = 0; i < plain.size(); ++i)
+            EXPECT_EQUAL(plain[i].v, static_cast<int>(i) + 1);
+    }
+};
+
+struct test_asm3x3u_model
+{
+    void run() const
+    {
+        ConvolutionContext context;
+        context.n_inputs       = 64;
+        context.n_outputs      = 64;
+        context.in_height      = 56;
+        context.in_width       = 56;
+        context.out_height     = 56;
+        context.out_width      = 56;
+        context.batch_sz       = 16;
+        context.kernel_size0   = 3;
+        context.kernel_size1   = 3;
+        context.pad0           = 1;
+        context.pad1           = 1;
+        context.kernel_stride0 = 1;
+        context.kernel_stride1 = 1;
+        context.direction.Set(1);
+
+        const solver::ConvAsm3x3U s;
+        const solver::ComputedContainer<solver::PerformanceConfigConvAsm3x3U, ConvolutionContext>
+            all(context);
+        bool is_model_guided = false;
+        const auto ordered   = solver::GetSearchOrder(s, context, all, 0, is_model_guided);
+        EXPECT(is_model_guided);
+        EXPECT(!ordered.empty());
+
+        double prev = 0.0;
+        for(const auto& config : ordered)
+        {
+            EXPECT(config.IsValid(context));
+            const auto cost = s.EstimatePerformanceConfigCost(context, config);
+            EXPECT(cost >= prev);
+            EXPECT(cost < std::numeric_limits<double>::max());
+            prev = cost;
+        }
+
+        // Tiny tiles re-read the whole input for each filter and shall lose to
+        // the default (EuristicInit) config.
+        const solver::PerformanceConfigConvAsm3x3U tiny(0, 1, 1);
+        EXPECT(s.EstimatePerformanceConfigCost(context, tiny) >
+               s.EstimatePerformanceConfigCost(context, s.GetPerformanceConfig(context)));
+    }
+};
+
+} // namespace tests
+} // namespace miopen
+
+int main()
+{
+    run_test<miopen::tests::test_occupancy>();
+    run_test<miopen::tests::test_dispatch_efficiency>();
+    run_test<miopen::tests::test_kernel_cost>();
+    run_test<miopen::tests::test_search_order>();
+    run_test<miopen::tests::test_asm3x3u_model>();
+}
@@ -0,0 +1,133 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "softmax_reference.hpp"
+#include "test.hpp"
+#include <miopen/softmax_host.hpp>
+
+#include <vector>
+
+using miopen::host::SoftmaxGeometry;
+
+struct test_softmax_host
+{
+    void run() const
+    {
+        // n, c, h, w: classifier outputs of a single pixel, images with fewer pixels than a
+        // block, blocks over several rows and a single channel
+        const std::vector<std::vector<int>> cases = {{3, 1000, 1, 1},
+                                                     {2, 10, 1, 1},
+                                                     {2, 7, 3, 3},
+                                                     {2, 5, 13, 17},
+                                                     {1, 600, 9, 11},
+                                                     {2, 1, 6, 7}};
+        for(auto&& p : cases)
+            for(float scale : {1.0f, 30.0f})
+                Check(SoftmaxGeometry{p[0], p[1], p[2], p[3]}, scale);
+    }
+
+    static void Check(const SoftmaxGeometry& g, float scale)
+    {
+        const std::size_t size = std::size_t(g.n) * g.c * g.Pixels();
+        const auto x           = Generate(size, 1, scale);
+        const SoftmaxReference ref{g};
+
+        const auto expected = ref.Forward(x);
+        auto y              = x;
+        miopen::host::SoftmaxForward(g, y.data());
+        for(std::size_t i = 0; i < size; i++)
+            CHECK(Near(y[i], expected[i], 1e-6));
+
+        const auto dy             = Generate(size, 2, 1);
+        const auto expected_dx    = ref.Backward(y, dy);
+        auto dx                   = dy;
+        std::vector<double> dx_64(dy.begin(), dy.end());
+        miopen::host::SoftmaxBackward(g, y.data(), dx.data());
+        miopen::host::SoftmaxBackward(g, y.data(), dx_64.data());
+        for(std::size_t i = 0; i < size; i++)
+        {
+            CHECK(Near(dx[i], expected_dx[i], 1e-6));
+            CHECK(Near(dx_64[i], expected_dx[i], 1e-13));
+        }
+    }
+};
+
+/// Rows and images with gaps between them, read and written through the strides.
+struct test_softmax_host_strides
+{
+    void run() const
+    {
+        for(auto&& p : std::vector<std::vector<int>>{{2, 6, 7, 9}, {3, 20, 1, 1}})
+        {
+            const SoftmaxGeometry packed{p[0], p[1], p[2], p[3]};
+            const int n = packed.n, c = packed.c, h = packed.h, w = packed.w;
+
+            const std::size_t row = w + 3;
+            SoftmaxGeometry g     = packed;
+            g.y_strides           = {{c * h * row + 5, h * row, row, 1}};
+            g.dx_strides          = g.y_strides;
+
+            const auto x = Generate(n * g.y_strides[0], 1, 5);
+            std::vector<float> x_packed(n * packed.y_strides[0]);
+            const auto at = [&](int b, int k, int i, int j) {
+                return b * g.y_strides[0] + k * g.y_strides[1] + i * g.y_strides[2] + j;
+            };
+            const auto packed_at = [&](int b, int k, int i, int j) {
+                return ((std::size_t(b) * c + k) * h + i) * w + j;
+            };
+            for(int b = 0; b < n; b++)
+                for(int k = 0; k < c; k++)
+                    for(int i = 0; i < h; i++)
+                        for(int j = 0; j < w; j++)
+                            x_packed[packed_at(b, k, i, j)] = x[at(b, k, i, j)];
+
+            auto y         = x;
+            auto dx        = x;
+            auto dx_packed = x_packed;
+            miopen::host::SoftmaxForward(g, y.data());
+            miopen::host::SoftmaxForward(packed, x_packed.data());
+            miopen::host::SoftmaxBackward(g, y.data(), dx.data());
+            miopen::host::SoftmaxBackward(packed, x_packed.data(), dx_packed.data());
+            for(int b = 0; b < n; b++)
+                for(int k = 0; k < c; k++)
+                    for(int i = 0; i < h; i++)
+                        for(int j = 0; j < w; j++)
+                        {
+                            CHECK(y[at(b, k, i, j)] == x_packed[packed_at(b, k, i, j)]);
+                            CHECK(dx[at(b, k, i, j)] == dx_packed[packed_at(b, k, i, j)]);
+                        }
+            // The gaps are left alone
+            CHECK(y[at(0, 0, 0, w)] == x[at(0, 0, 0, w)]);
+        }
+    }
+};
+
+int main()
+{
+    run_test<test_softmax_host>();
+    run_test<test_softmax_host_strides>();
+}
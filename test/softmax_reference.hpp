@@ -0,0 +1,81 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+#ifndef GUARD_SOFTMAX_REFERENCE_HPP
+#define GUARD_SOFTMAX_REFERENCE_HPP
+
+#include <miopen/softmax_host.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/// The softmax of every pixel in double, a channel at a time, as the driver computed it, for
+/// packed tensors.
+struct SoftmaxReference
+{
+    miopen::host::SoftmaxGeometry g;
+
+    std::size_t Index(int b, int k, std::size_t p) const
+    {
+        return (std::size_t(b) * g.c + k) * g.Pixels() + p;
+    }
+
+    std::vector<double> Forward(const std::vector<float>& x) const
+    {
+        std::vector<double> y(x.size());
+        for(int b = 0; b < g.n; b++)
+            for(std::size_t p = 0; p < g.Pixels(); p++)
+            {
+                double m = std::numeric_limits<double>::lowest();
+                for(int k = 0; k < g.c; k++)
+                    m = std::max<double>(m, x[Index(b, k, p)]);
+                double sum = 0;
+                for(int k = 0; k < g.c; k++)
+                    sum += y[Index(b, k, p)] = std::exp(x[Index(b, k, p)] - m);
+                for(int k = 0; k < g.c; k++)
+                    y[Index(b, k, p)] /= sum;
+            }
+        return y;
+    }
+
+    std::vector<double> Backward(const std::vector<float>& y, const std::vector<float>& dy) const
+    {
+        std::vector<double> dx(y.size());
+        for(int b = 0; b < g.n; b++)
+            for(std::size_t p = 0; p < g.Pixels(); p++)
+            {
+                double dot = 0;
+                for(int k = 0; k < g.c; k++)
+                    dot += double(y[Index(b, k, p)]) * dy[Index(b, k, p)];
+                for(int k = 0; k < g.c; k++)
+                    dx[Index(b, k, p)] = y[Index(b, k, p)] * (dy[Index(b, k, p)] - dot);
+            }
+        return dx;
+    }
+};
+
+#endif
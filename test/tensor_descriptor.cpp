@@ -0,0 +1,150 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/errors.hpp>
+#include <miopen/tensor.hpp>
+
+#include <numeric>
+#include <unordered_set>
+#include <vector>
+
+struct test_inline_vector
+{
+    void run() const
+    {
+        using vector_t = miopen::InlineVector<int, 4>;
+        vector_t x{1, 2, 3};
+        EXPECT_EQUAL(x.size(), std::size_t{3});
+        EXPECT_EQUAL(x.back(), 3);
+        EXPECT(x == std::vector<int>({1, 2, 3}));
+        EXPECT(std::vector<int>({1, 2}) != x);
+
+        x.push_back(4);
+        bool thrown = false;
+        try
+        {
+            x.push_back(5);
+        }
+        catch(const miopen::Exception&)
+        {
+            thrown = true;
+        }
+        EXPECT(thrown);
+
+        x.resize(2);
+        x.resize(3);
+        EXPECT(x == vector_t({1, 2, 0}));
+        EXPECT(vector_t({1, 2}) < x);
+        EXPECT(std::vector<int>(x) == std::vector<int>({1, 2, 0}));
+        EXPECT(std::accumulate(x.rbegin(), x.rend(), 0) == 3);
+
+        const vector_t y(std::vector<int>{7, 8});
+        EXPECT(y == vector_t({7, 8}));
+        EXPECT(vector_t(2, 7) == std::vector<int>({7, 7}));
+        EXPECT(vector_t(y.begin(), y.end()) == y);
+    }
+};
+
+struct test_derived_values
+{
+    static std::size_t Space(const std::vector<std::size_t>& lens,
+                             const std::vector<std::size_t>& strides)
+    {
+        std::size_t space = 1;
+        for(std::size_t i = 0; i < lens.size(); i++)
+            space += (lens[i] - 1) * strides[i];
+        return space;
+    }
+
+    void run() const
+    {
+        const miopen::TensorDescriptor packed{miopenFloat, {2, 3, 4, 5}};
+        EXPECT(packed.GetStrides() == std::vector<std::size_t>({60, 20, 5, 1}));
+        EXPECT_EQUAL(packed.GetElementSize(), std::size_t{120});
+        EXPECT_EQUAL(packed.GetElementSpace(), std::size_t{120});
+        EXPECT(packed.IsPacked());
+
+        const std::vector<std::size_t> lens    = {2, 3, 4, 5};
+        const std::vector<std::size_t> strides = {100, 30, 6, 1};
+        const miopen::TensorDescriptor strided{miopenHalf, lens, strides};
+        const auto copy = strided;
+        for(auto&& desc : {strided, copy})
+        {
+            EXPECT_EQUAL(desc.GetElementSize(), std::size_t{120});
+            EXPECT_EQUAL(desc.GetElementSpace(), Space(lens, strides));
+            EXPECT_EQUAL(desc.GetNumBytes(), 2 * Space(lens, strides));
+            EXPECT(not desc.IsPacked());
+        }
+
+        const int ilens[]    = {3, 4};
+        const int istrides[] = {4, 1};
+        EXPECT(miopen::TensorDescriptor(miopenFloat, ilens, istrides, 2).IsPacked());
+        EXPECT(miopen::TensorDescriptor(miopenFloat, ilens, 2) ==
+               miopen::TensorDescriptor(miopenFloat, ilens, istrides, 2));
+
+        const miopen::TensorDescriptor empty;
+        EXPECT_EQUAL(empty.GetElementSize(), std::size_t{1});
+        EXPECT(empty.IsPacked());
+
+        const std::vector<int> too_many(9, 1);
+        bool thrown = false;
+        try
+        {
+            miopen::TensorDescriptor(miopenFloat, too_many.data(), too_many.size());
+        }
+        catch(const miopen::Exception&)
+        {
+            thrown = true;
+        }
+        EXPECT(thrown);
+    }
+};
+
+struct test_hash
+{
+    void run() const
+    {
+        const miopen::TensorDescriptor a{miopenFloat, {4, 8, 16}};
+        const miopen::TensorDescriptor b{miopenFloat, {4, 8, 16}, {128, 16, 1}};
+        const miopen::TensorDescriptor c{miopenHalf, {4, 8, 16}};
+        const miopen::TensorDescriptor d{miopenFloat, {4, 8, 16}, {256, 32, 1}};
+        EXPECT(a == b);
+        EXPECT_EQUAL(a.GetHash(), b.GetHash());
+        EXPECT(a.GetHash() != c.GetHash());
+        EXPECT(a.GetHash() != d.GetHash());
+
+        std::unordered_set<miopen::TensorDescriptor> set = {a, b, c, d};
+        EXPECT_EQUAL(set.size(), std::size_t{3});
+    }
+};
+
+int main()
+{
+    run_test<test_inline_vector>();
+    run_test<test_derived_values>();
+    run_test<test_hash>();
+}
@@ -0,0 +1,287 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/parallel_for.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/tensor_ops_host.hpp>
+
+#include <half.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+using lens_t = std::vector<std::size_t>;
+
+// Strides of a tensor cut out of a larger packed one, as test/tensor_ops.cpp does.
+static lens_t SubStrides(const lens_t& lens, std::size_t pad)
+{
+    lens_t strides(lens.size(), 1);
+    for(std::size_t d = lens.size() - 1; d-- > 0;)
+        strides[d] = strides[d + 1] * (lens[d + 1] + pad);
+    return strides;
+}
+
+static float Op(miopenTensorOp_t op, float a, float b)
+{
+    switch(op)
+    {
+    case miopenTensorOpAdd: return a + b;
+    case miopenTensorOpMul: return a * b;
+    case miopenTensorOpMin: return std::min(a, b);
+    case miopenTensorOpMax: return std::max(a, b);
+    }
+    return 0;
+}
+
+/// Visits every index of lens in order, passing the offsets in a, b and c. b broadcasts its
+/// dimensions of length 1.
+template <class F>
+static void ForEachIndex(const miopen::TensorDescriptor& a,
+                         const miopen::TensorDescriptor& b,
+                         const miopen::TensorDescriptor& c,
+                         F f)
+{
+    const auto& lens = c.GetLengths();
+    lens_t index(lens.size(), 0);
+    for(std::size_t i = 0; i < c.GetElementSize(); i++)
+    {
+        std::size_t ao = 0;
+        std::size_t bo = 0;
+        std::size_t co = 0;
+        for(std::size_t d = 0; d < lens.size(); d++)
+        {
+            ao += index[d] * a.GetStrides()[d];
+            bo += (b.GetLengths()[d] == 1 ? 0 : index[d]) * b.GetStrides()[d];
+            co += index[d] * c.GetStrides()[d];
+        }
+        f(ao, bo, co);
+        for(std::size_t d = lens.size(); d-- > 0;)
+        {
+            if(++index[d] < lens[d])
+                break;
+            index[d] = 0;
+        }
+    }
+}
+
+struct test_op_tensor
+{
+    void run() const
+    {
+        const std::vector<std::pair<lens_t, lens_t>> shapes = {
+            {{32, 16, 8, 4, 4}, {32, 16, 8, 4, 4}},
+            {{32, 16, 8, 4, 4}, {1, 16, 8, 1, 1}},
+            {{32, 16, 8, 4, 4}, {1, 1, 8, 4, 1}},
+            {{16, 20, 16, 8}, {16, 1, 1, 1}},
+            {{16, 20, 16, 8}, {1, 20, 1, 8}},
+            {{20, 16, 8}, {1, 1, 1}},
+            {{1, 16, 8}, {1, 16, 1}},
+            {{3000}, {3000}},
+            {{64, 70000}, {64, 1}},
+            {{8}, {1}},
+        };
+        const std::vector<miopenTensorOp_t> ops = {
+            miopenTensorOpAdd, miopenTensorOpMul, miopenTensorOpMin, miopenTensorOpMax};
+
+        for(auto&& shape : shapes)
+            for(std::size_t pad : {0, 1})
+                for(auto op : ops)
+                    for(float beta : {0.0f, 0.5f})
+                        Check(shape.first, shape.second, pad, op, beta);
+    }
+
+    static void
+    Check(const lens_t& clens, const lens_t& blens, std::size_t pad, miopenTensorOp_t op, float beta)
+    {
+        const miopen::TensorDescriptor a{miopenFloat, clens, SubStrides(clens, pad)};
+        const miopen::TensorDescriptor b{miopenFloat, blens, SubStrides(blens, pad)};
+        const miopen::TensorDescriptor c{miopenFloat, clens, SubStrides(clens, 2 * pad)};
+        const std::size_t offsets[] = {3 * pad, 1 * pad, 2 * pad};
+        const auto A = Generate(a.GetElementSpace() + offsets[0], 1, 4);
+        const auto B = Generate(b.GetElementSpace() + offsets[1], 2, 4);
+        auto C       = Generate(c.GetElementSpace() + offsets[2], 3, 4);
+
+        const float alpha0 = 1.5f;
+        const float alpha1 = -0.5f;
+        auto expected      = C;
+        ForEachIndex(a, b, c, [&](std::size_t ao, std::size_t bo, std::size_t co) {
+            auto& y = expected[co + offsets[2]];
+            y = Op(op, alpha0 * A[ao + offsets[0]], alpha1 * B[bo + offsets[1]]) + beta * y;
+        });
+
+        miopen::host::OpTensor(op,
+                               &alpha0,
+                               a,
+                               A.data(),
+                               &alpha1,
+                               b,
+                               B.data(),
+                               &beta,
+                               c,
+                               C.data(),
+                               offsets[0],
+                               offsets[1],
+                               offsets[2]);
+        // Elements between the strides must stay untouched, so compare everything.
+        for(std::size_t i = 0; i < C.size(); i++)
+            CHECK(std::abs(C[i] - expected[i]) <= 1e-5f * (1 + std::abs(expected[i])));
+    }
+};
+
+struct test_unary
+{
+    void run() const
+    {
+        for(auto&& lens : {lens_t{4, 5, 6, 7}, lens_t{2, 3, 40000}, lens_t{1, 1, 1}})
+        {
+            for(std::size_t pad : {0, 3})
+            {
+                const miopen::TensorDescriptor y{miopenFloat, lens, SubStrides(lens, pad)};
+                const miopen::TensorDescriptor x{miopenFloat, lens, SubStrides(lens, 2 - pad % 2)};
+                const auto X = Generate(x.GetElementSpace(), 4, 4);
+                const auto Y = Generate(y.GetElementSpace() + pad, 5, 4);
+
+                auto set         = Y;
+                auto set_ref     = Y;
+                auto scaled      = Y;
+                auto scaled_ref  = Y;
+                auto copied      = Y;
+                auto copied_ref  = Y;
+                const float fill = 7.0f;
+                const float s    = -2.0f;
+                ForEachIndex(y, x, y, [&](std::size_t yo, std::size_t xo, std::size_t) {
+                    set_ref[yo + pad] = fill;
+                    scaled_ref[yo + pad] *= s;
+                    copied_ref[yo + pad] = X[xo];
+                });
+
+                miopen::host::SetTensor(y, set.data(), &fill, pad);
+                miopen::host::ScaleTensor(y, scaled.data(), &s, pad);
+                miopen::host::CopyTensor(x, X.data(), y, copied.data(), 0, pad);
+                CHECK(set == set_ref);
+                CHECK(scaled == scaled_ref);
+                CHECK(copied == copied_ref);
+            }
+        }
+    }
+};
+
+struct test_half
+{
+    void run() const
+    {
+        const lens_t lens = {3, 5, 7};
+        const miopen::TensorDescriptor desc{miopenHalf, lens};
+        const std::size_t n = desc.GetElementSize();
+        std::vector<half_float::half> A(n), B(1, half_float::half(2.0f)), C(n);
+        for(std::size_t i = 0; i < n; i++)
+            A[i] = half_float::half(static_cast<float>(i) / 4);
+        const miopen::TensorDescriptor bdesc{miopenHalf, lens_t{1, 1, 1}};
+        const float one  = 1.0f;
+        const float zero = 0.0f;
+        miopen::host::OpTensor(miopenTensorOpMul,
+                               &one,
+                               desc,
+                               A.data(),
+                               &one,
+                               bdesc,
+                               B.data(),
+                               &zero,
+                               desc,
+                               C.data());
+        for(std::size_t i = 0; i < n; i++)
+            CHECK(static_cast<float>(C[i]) == static_cast<float>(i) / 2);
+    }
+};
+
+struct test_parallel_for
+{
+    void run() const
+    {
+        std::vector<std::atomic<int>> hits(100003);
+        for(auto& hit : hits)
+            hit = 0;
+        miopen::ParallelFor(hits.size(), 1000, [&](std::size_t begin, std::size_t end) {
+            CHECK(end - begin <= 1000);
+            // Nested calls run on the calling thread.
+            miopen::ParallelFor(end - begin, 1, [&](std::size_t b, std::size_t e) {
+                for(auto i = begin + b; i < begin + e; i++)
+                    hits[i]++;
+            });
+        });
+        CHECK(std::all_of(hits.begin(), hits.end(), [](const std::atomic<int>& hit) {
+            return hit == 1;
+        }));
+
+        // Calls nested two deep, under a range small enough to run inline and under the two
+        // ranges of a parallel call, as the directions of a bidirectional RNN run
+        for(std::size_t outer : {1, 2})
+        {
+            for(auto& hit : hits)
+                hit = 0;
+            miopen::ParallelFor(outer, 1, [&](std::size_t o, std::size_t) {
+                miopen::ParallelFor(hits.size() / 2, 100, [&](std::size_t begin, std::size_t end) {
+                    miopen::ParallelFor(end - begin, 7, [&](std::size_t b, std::size_t e) {
+                        for(auto i = begin + b; i < begin + e; i++)
+                            hits[2 * i + o]++;
+                    });
+                });
+            });
+            const auto once =
+                std::count_if(hits.begin(), hits.end(), [](const std::atomic<int>& hit) {
+                    return hit == 1;
+                });
+            CHECK(std::size_t(once) == outer * (hits.size() / 2));
+        }
+
+        bool thrown = false;
+        try
+        {
+            miopen::ParallelFor(100, 1, [](std::size_t begin, std::size_t) {
+                if(begin == 42)
+                    throw std::runtime_error("42");
+            });
+        }
+        catch(const std::runtime_error&)
+        {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+};
+
+int main()
+{
+    run_test<test_op_tensor>();
+    run_test<test_unary>();
+    run_test<test_half>();
+    run_test<test_parallel_for>();
+}
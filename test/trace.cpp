@@ -0,0 +1,122 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "test.hpp"
+#include <miopen/temp_file.hpp>
+#include <miopen/trace.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+static std::string TracePath()
+{
+    static const miopen::TempFile file{"miopen-trace"};
+    return file.Path();
+}
+
+static std::string ReadFile(const std::string& path)
+{
+    std::ifstream file(path);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+static std::size_t Count(const std::string& s, const std::string& what)
+{
+    std::size_t n = 0;
+    for(auto pos = s.find(what); pos != std::string::npos; pos = s.find(what, pos + 1))
+        n++;
+    return n;
+}
+
+struct test_scopes
+{
+    void run() const
+    {
+        CHECK(miopen::IsTracing());
+        {
+            miopen::TraceScope outer{"test", "outer"};
+            {
+                miopen::TraceScope inner{"test", [] { return std::string{"inner \"quoted\""}; }};
+            }
+            miopen::TraceKernel("kernel_a", 0.5f);
+        }
+
+        std::vector<std::thread> threads;
+        for(int i = 0; i < 4; i++)
+            threads.emplace_back([] {
+                for(int j = 0; j < 100; j++)
+                    miopen::TraceScope scope{"test", "worker"};
+            });
+        for(auto& thread : threads)
+            thread.join();
+
+        miopen::TraceWrite(TracePath());
+        const auto trace = ReadFile(TracePath());
+        CHECK(trace.find("\"traceEvents\"") != std::string::npos);
+        CHECK(trace.find(R"("name":"outer","cat":"test","ph":"X","pid":1)") != std::string::npos);
+        CHECK(trace.find(R"("name":"inner \"quoted\"")") != std::string::npos);
+        CHECK(trace.find(R"("name":"kernel_a","cat":"kernel","ph":"X","pid":2)") !=
+              std::string::npos);
+        EXPECT_EQUAL(Count(trace, R"("name":"worker")"), std::size_t{400});
+        // 5 threads have recorded events.
+        CHECK(trace.find("\"tid\":5,") != std::string::npos);
+        CHECK(trace.find("\"tid\":6,") == std::string::npos);
+    }
+};
+
+struct test_macros
+{
+    void run() const
+    {
+        int evaluated = 0;
+        {
+            MIOPEN_TRACE_FUNCTION("test");
+            MIOPEN_TRACE_SCOPE("test", "macro " << ++evaluated);
+        }
+        miopen::TraceWrite(TracePath());
+        const auto trace = ReadFile(TracePath());
+#if MIOPEN_ENABLE_TRACE
+        EXPECT_EQUAL(evaluated, 1);
+        CHECK(trace.find(R"("name":"run")") != std::string::npos);
+        CHECK(trace.find(R"("name":"macro 1")") != std::string::npos);
+#else
+        // Compiled out, the name is not even evaluated.
+        EXPECT_EQUAL(evaluated, 0);
+        CHECK(trace.find(R"("name":"macro)") == std::string::npos);
+#endif
+    }
+};
+
+int main()
+{
+    setenv("MIOPEN_TRACE_FILE", TracePath().c_str(), 1); // NOLINT
+    run_test<test_scopes>();
+    run_test<test_macros>();
+}
@@ -0,0 +1,104 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include "host_test.hpp"
+#include "test.hpp"
+#include <miopen/convolution.hpp>
+#include <miopen/gemm_host.hpp>
+#include <miopen/tensor.hpp>
+#include <miopen/winograd_host.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using miopen::host::WinogradTile;
+
+struct test_winograd
+{
+    void run() const
+    {
+        // n, k, c, h, w: tiles that do and do not divide the output, and wide GEMMs
+        const std::vector<std::vector<int>> shapes = {{1, 1, 1, 3, 3},
+                                                      {2, 3, 5, 7, 9},
+                                                      {1, 4, 2, 13, 5},
+                                                      {3, 8, 6, 10, 10},
+                                                      {1, 33, 17, 9, 12},
+                                                      {2, 16, 64, 16, 15}};
+        for(auto tile : {WinogradTile::F2x3, WinogradTile::F4x3})
+            for(auto&& shape : shapes)
+                for(bool backward : {false, true})
+                    for(int pad : {0, 1, 2})
+                        Check(tile, backward, shape[0], shape[1], shape[2], shape[3], shape[4], pad);
+    }
+
+    static void Check(WinogradTile tile, bool backward, int n, int k, int c, int h, int w, int pad)
+    {
+        const int out_h = OutSize(h, 3, pad, backward);
+        const int out_w = OutSize(w, 3, pad, backward);
+        if(out_h < 1 || out_w < 1)
+            return;
+        const auto in   = Generate(std::size_t(n) * (backward ? k : c) * h * w, 1);
+        const auto wei  = Generate(std::size_t(k) * c * 9, 2);
+        std::vector<double> expected, mag;
+        DirectConv(backward, n, k, c, 3, 3, h, w, pad, pad, in, wei, expected, mag);
+
+        const miopen::host::WinogradConv3x3 winograd{tile, k, c, wei.data(), backward};
+        CHECK(winograd.InputChannels() == (backward ? k : c));
+        CHECK(winograd.OutputChannels() == (backward ? c : k));
+        std::vector<float> out(expected.size(), std::nanf(""));
+        winograd.Run(n, h, w, pad, pad, out_h, out_w, in.data(), out.data());
+
+        // The transforms scale the rounding error of the products by a constant of the tile
+        const double bound = tile == WinogradTile::F2x3 ? 1e-5 : 1e-4;
+        for(std::size_t i = 0; i < out.size(); i++)
+            CHECK(std::abs(out[i] - expected[i]) <= bound * (mag[i] + 1e-3));
+    }
+};
+
+struct test_winograd_applicable
+{
+    void run() const
+    {
+        const miopen::TensorDescriptor w3{miopenFloat, {8, 4, 3, 3}};
+        const miopen::TensorDescriptor w5{miopenFloat, {8, 4, 5, 5}};
+        using miopen::host::IsWinogradApplicable;
+
+        CHECK(IsWinogradApplicable(miopen::ConvolutionDescriptor{1, 1, 1, 1}, w3, false));
+        CHECK(IsWinogradApplicable(miopen::ConvolutionDescriptor{2, 2, 1, 1}, w3, true));
+        CHECK(IsWinogradApplicable(miopen::ConvolutionDescriptor{3, 3, 1, 1}, w3, false));
+        CHECK(!IsWinogradApplicable(miopen::ConvolutionDescriptor{3, 3, 1, 1}, w3, true));
+        CHECK(!IsWinogradApplicable(miopen::ConvolutionDescriptor{1, 1, 2, 2}, w3, false));
+        CHECK(!IsWinogradApplicable(miopen::ConvolutionDescriptor{1, 1, 1, 1, 2, 2}, w3, false));
+        CHECK(!IsWinogradApplicable(miopen::ConvolutionDescriptor{1, 1, 1, 1}, w5, false));
+    }
+};
+
+int main()
+{
+    run_test<test_winograd>();
+    run_test<test_winograd_applicable>();
+}
@@ -0,0 +1,205 @@
+/*******************************************************************************
+*
+* MIT License
+*
+* Copyright (c) 2018 Advanced Micro Devices, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+*******************************************************************************/
+
+#include <miopen/solver.hpp>
+#include <miopen/workspace_cache.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test.hpp"
+
+namespace miopen {
+namespace tests {
+
+struct test_memoization
+{
+    void run() const
+    {
+        WorkspaceSizeCache cache;
+        int computed     = 0;
+        const auto size  = [&]() {
+            ++computed;
+            return std::size_t{42};
+        };
+        const auto other = [&]() {
+            ++computed;
+            return std::size_t{7};
+        };
+
+        EXPECT_EQUAL(cache.Get("a", 0, size), std::size_t{42});
+        EXPECT_EQUAL(cache.Get("a", 0, other), std::size_t{42});
+        EXPECT_EQUAL(computed, 1);
+
+        EXPECT_EQUAL(cache.Get("b", 0, other), std::size_t{7});
+        EXPECT_EQUAL(computed, 2);
+        EXPECT_EQUAL(cache.Size(), std::size_t{2});
+
+        cache.Clear();
+        EXPECT_EQUAL(cache.Get("a", 0, other), std::size_t{7});
+        EXPECT_EQUAL(computed, 3);
+    }
+};
+
+struct test_generation
+{
+    void run() const
+    {
+        WorkspaceSizeCache cache;
+        int computed    = 0;
+        const auto size = [&]() {
+            ++computed;
+            return std::size_t{1};
+        };
+
+        cache.Get("a", 0, size);
+        cache.Get("b", 0, size);
+        EXPECT_EQUAL(computed, 2);
+
+        // A db has been written: everything is recomputed.
+        cache.Get("a", 1, size);
+        EXPECT_EQUAL(computed, 3);
+        EXPECT_EQUAL(cache.Size(), std::size_t{1});
+        cache.Get("a", 1, size);
+        EXPECT_EQUAL(computed, 3);
+
+        // A result computed while the db has been written is not kept.
+        cache.Get("c", 1, [&]() {
+            cache.Get("d", 2, size);
+            return std::size_t{3};
+        });
+        EXPECT_EQUAL(cache.Size(), std::size_t{1});
+        EXPECT_EQUAL(cache.Get("c", 2, size), std::size_t{1});
+    }
+};
+
+struct test_concurrency
+{
+    void run() const
+    {
+        WorkspaceSizeCache cache;
+        std::atomic<int> computed{0};
+        std::vector<std::thread> threads;
+
+        for(int t = 0; t < 8; ++t)
+        {
+            threads.emplace_back([&, t]() {
+                for(int i = 0; i < 1000; ++i)
+                {
+                    const auto key = std::to_string((i + t) % 16);
+                    const auto sz  = cache.Get(key, 0, [&]() {
+                        ++computed;
+                        return std::size_t{128} * ((i + t) % 16);
+                    });
+                    CHECK(sz == std::size_t{128} * ((i + t) % 16));
+                }
+            });
+        }
+        for(auto& thread : threads)
+            thread.join();
+
+        EXPECT_EQUAL(cache.Size(), std::size_t{16});
+        EXPECT(computed >= 16);
+    }
+};
+
+static ConvolutionContext GetWrWContext(int c, int h, int w, int k, int y, int x, int n, int stride)
+{
+    ConvolutionContext ctx;
+    ctx.direction.SetBackwardWrW();
+    ctx.n_inputs       = c;
+    ctx.in_height      = h;
+    ctx.in_width       = w;
+    ctx.n_outputs      = k;
+    ctx.kernel_size1   = y;
+    ctx.kernel_size0   = x;
+    ctx.batch_sz       = n;
+    ctx.pad1           = y == 1 ? 0 : y / 2;
+    ctx.pad0           = x == 1 ? 0 : x / 2;
+    ctx.kernel_stride1 = stride;
+    ctx.kernel_stride0 = stride;
+    ctx.out_height     = (h + 2 * ctx.pad1 - y) / stride + 1;
+    ctx.out_width      = (w + 2 * ctx.pad0 - x) / stride + 1;
+
+    ctx.in_stride          = w;
+    ctx.in_channel_stride  = w * h;
+    ctx.in_batch_stride    = w * h * c;
+    ctx.out_stride         = ctx.out_width;
+    ctx.out_channel_stride = ctx.out_width * ctx.out_height;
+    ctx.out_batch_stride   = ctx.out_width * ctx.out_height * k;
+    ctx.kernel_dilation0   = 1;
+    ctx.kernel_dilation1   = 1;
+    ctx.in_layout          = "NCHW";
+    ctx.out_layout         = "NCHW";
+    ctx.weights_layout     = "NCHW";
+    ctx.in_data_type       = "FP32";
+    ctx.out_data_type      = "FP32";
+    return ctx;
+}
+
+template <class Solver>
+static std::size_t CheckWorkspaceSize(const ConvolutionContext& ctx)
+{
+    const Solver solver{};
+    const auto expected = solver.GetSolution(ctx).workspce_sz;
+    EXPECT_EQUAL(solver.GetWorkspaceSize(ctx), expected);
+    return expected;
+}
+
+struct test_solver_workspace_size
+{
+    void run() const
+    {
+        // GetWorkspaceSize() shall not contradict GetSolution().
+        using namespace solver;
+        EXPECT(CheckWorkspaceSize<ConvOclBwdWrW2>(GetWrWContext(3, 227, 227, 96, 11, 11, 128, 4)) >
+               0);
+        CheckWorkspaceSize<ConvOclBwdWrW2>(GetWrWContext(16, 32, 32, 16, 3, 3, 1, 2));
+        EXPECT(CheckWorkspaceSize<ConvOclBwdWrW53>(GetWrWContext(128, 56, 56, 128, 3, 3, 32, 1)) >
+               0);
+        EXPECT_EQUAL(CheckWorkspaceSize<ConvOclBwdWrW53>(GetWrWContext(8, 14, 14, 8, 3, 3, 1, 1)),
+                     std::size_t{0});
+        EXPECT(CheckWorkspaceSize<ConvOclBwdWrW1x1>(GetWrWContext(64, 28, 28, 128, 1, 1, 32, 2)) >
+               0);
+        EXPECT_EQUAL(
+            CheckWorkspaceSize<ConvOclBwdWrW1x1>(GetWrWContext(64, 28, 28, 128, 1, 1, 32, 1)),
+            std::size_t{0});
+    }
+};
+
+} // namespace tests
+} // namespace miopen
+
+int main()
+{
+    run_test<miopen::tests::test_memoization>();
+    run_test<miopen::tests::test_generation>();
+    run_test<miopen::tests::test_concurrency>();
+    run_test<miopen::tests::test_solver_workspace_size>();
+}